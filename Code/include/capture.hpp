@@ -0,0 +1,109 @@
+/// @file     capture.hpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Declaration of a frame "capture" class.
+///
+/// @details  A Neutrino "capture" records the rendered frames to disk, e.g. to make movies of a
+/// simulation run (also on headless servers, together with the NU_WINDOW_OFFSCREEN window mode of
+/// the @link opengl @endlink class). The frames are read back from the framebuffer through two
+/// [pixel buffer objects](https://www.khronos.org/opengl/wiki/Pixel_Buffer_Object) used in turn:
+/// the read of a frame is collected one frame later, when the GPU has already completed it, so
+/// the render loop does not stall. The collected frames are encoded and written by a background
+/// thread, as raw RGBA, PNG files or a YUV4MPEG2 video stream. To be invoked after the plot and
+/// before the refresh:
+///
+///     C->init (gui, "movie.y4m", NU_CAPTURE_Y4M);
+///     ...
+///     gui->plot (S);
+///     C->grab ();
+///     gui->refresh ();
+
+#ifndef capture_hpp
+#define capture_hpp
+
+#include "neutrino.hpp"
+#include "opengl.hpp"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+
+namespace nu
+{
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////// "capture" class /////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class capture
+/// ### Frame capture.
+/// Declares a frame capture.
+/// To be used to record the rendered frames to disk.
+class capture : public neutrino                                                                     /// @brief **Frame capture.**
+{
+private:
+  GLuint                            pbo[2];                                                         ///< @brief **Pixel buffer objects.**
+  GLsync                            fence[2];                                                       ///< @brief **Pixel buffer read fences.**
+  bool                              pending[2];                                                     ///< @brief **Pixel buffer "pending read" flags.**
+  size_t                            pbo_index;                                                      ///< @brief **Next pixel buffer index.**
+  std::string                       file_name;                                                      ///< @brief **Capture file name (file name prefix for PNG).**
+  std::ofstream                     file;                                                           ///< @brief **Capture file.**
+  std::thread                       writer;                                                         ///< @brief **Writer thread.**
+  std::mutex                        frames_lock;                                                    ///< @brief **Frame queue lock.**
+  std::condition_variable           frames_signal;                                                  ///< @brief **Frame queue signal.**
+  std::deque<std::vector<GLubyte> > frames;                                                         ///< @brief **Frame queue (bottom-up RGBA).**
+  bool                              stop;                                                           ///< @brief **Writer thread "stop" flag.**
+
+  /// @brief **Pixel buffer collector.**
+  /// @details Waits for the read of a pixel buffer, copies its frame and queues it to the writer
+  /// thread. Blocks only when the writer thread is late by more than @link NU_CAPTURE_QUEUE
+  /// @endlink frames.
+  void collect (
+                size_t loc_index                                                                    ///< Pixel buffer index.
+               );
+
+  /// @brief **Writer thread loop.**
+  /// @details Encodes and writes the queued frames, until stopped.
+  void loop ();
+
+  /// @brief **Frame writer.**
+  /// @details Writes a frame in the capture format. Runs on the writer thread.
+  void write (
+              std::vector<GLubyte>& loc_frame,                                                      ///< Frame (bottom-up RGBA).
+              size_t                loc_frame_index                                                 ///< Frame index.
+             );
+
+public:
+  capture_format                    format;                                                         ///< @brief **Capture format.**
+  int                               size_x;                                                         ///< @brief **Frame x-size [px].**
+  int                               size_y;                                                         ///< @brief **Frame y-size [px].**
+  size_t                            captured;                                                       ///< @brief **Number of captured frames [#].**
+  bool                              ready;                                                          ///< @brief **Capture "ready" flag.**
+
+  /// @brief **Class constructor.**
+  /// @details It does nothing. The capture is started by the @link init @endlink method.
+  capture ();
+
+  /// @brief **Capture initializer.**
+  /// @details Creates the pixel buffers of the size of the GUI framebuffer, opens the capture
+  /// file and starts the writer thread.
+  void init (
+             nu::opengl*    loc_gui,                                                                ///< GUI.
+             std::string    loc_file_name,                                                          ///< Capture file name (file name prefix for PNG).
+             capture_format loc_format                                                              ///< Capture format.
+            );
+
+  /// @brief **Frame grabber.**
+  /// @details Starts the asynchronous read of the current framebuffer and queues the previous
+  /// frame to the writer thread.
+  void grab ();
+
+  /// @brief **Capture terminator.**
+  /// @details Queues the last frame, waits for the writer thread to write all frames and closes
+  /// the capture file.
+  void close ();
+
+  /// @brief **Class destructor.**
+  /// @details Terminates the capture, if still running.
+  ~capture ();
+};
+}
+#endif
@@ -224,6 +224,87 @@ typedef struct _nu_float4_structure
 } nu_float4_structure;
 #pragma pack(pop)
 
+/// @brief    **Data structure. Internally used by Neutrino.**
+/// @details  This structure is used as data storage in the "nu::half4" class (half precision (16-bit) floating point
+/// components). It is tightly packed to be compatible with the OpenCL requirement of having a
+/// contiguous data arrangement without padding.
+#pragma pack(push, 1)                                                                               // Packing data in 1 column...
+typedef struct _nu_half4_structure
+{
+  GLhalf x;                                                                                         ///< "x" coordinate.
+  GLhalf y;                                                                                         ///< "y" coordinate.
+  GLhalf z;                                                                                         ///< "z" coordinate.
+  GLhalf w;                                                                                         ///< "w" coordinate.
+} nu_half4_structure;
+#pragma pack(pop)
+
+/// @brief    **Data structure. Internally used by Neutrino.**
+/// @details  This structure is used as data storage in the "nu::short4" class (16-bit signed integer
+/// components). It is tightly packed to be compatible with the OpenCL requirement of having a
+/// contiguous data arrangement without padding.
+#pragma pack(push, 1)                                                                               // Packing data in 1 column...
+typedef struct _nu_short4_structure
+{
+  GLshort x;                                                                                        ///< "x" coordinate.
+  GLshort y;                                                                                        ///< "y" coordinate.
+  GLshort z;                                                                                        ///< "z" coordinate.
+  GLshort w;                                                                                        ///< "w" coordinate.
+} nu_short4_structure;
+#pragma pack(pop)
+
+/// @brief    **Data structure. Internally used by Neutrino.**
+/// @details  This structure is used as data storage in the "nu::uchar4" class (normalized 8-bit unsigned integer
+/// components). It is tightly packed to be compatible with the OpenCL requirement of having a
+/// contiguous data arrangement without padding.
+#pragma pack(push, 1)                                                                               // Packing data in 1 column...
+typedef struct _nu_uchar4_structure
+{
+  GLubyte x;                                                                                        ///< "x" coordinate.
+  GLubyte y;                                                                                        ///< "y" coordinate.
+  GLubyte z;                                                                                        ///< "z" coordinate.
+  GLubyte w;                                                                                        ///< "w" coordinate.
+} nu_uchar4_structure;
+#pragma pack(pop)
+
+/// @brief    **Data structure. Internally used by Neutrino.**
+/// @details  This structure is used as data storage in the "nu::double2" class (double precision,
+/// 64-bit floating point components). It is tightly packed to be compatible with the OpenCL
+/// requirement of having a contiguous data arrangement without padding.
+#pragma pack(push, 1)                                                                               // Packing data in 1 column...
+typedef struct _nu_double2_structure
+{
+  GLdouble x;                                                                                       ///< "x" coordinate.
+  GLdouble y;                                                                                       ///< "y" coordinate.
+} nu_double2_structure;
+#pragma pack(pop)
+
+/// @brief    **Data structure. Internally used by Neutrino.**
+/// @details  This structure is used as data storage in the "nu::double3" class (double precision,
+/// 64-bit floating point components). It is tightly packed to be compatible with the OpenCL
+/// requirement of having a contiguous data arrangement without padding.
+#pragma pack(push, 1)                                                                               // Packing data in 1 column...
+typedef struct _nu_double3_structure
+{
+  GLdouble x;                                                                                       ///< "x" coordinate.
+  GLdouble y;                                                                                       ///< "y" coordinate.
+  GLdouble z;                                                                                       ///< "z" coordinate.
+} nu_double3_structure;
+#pragma pack(pop)
+
+/// @brief    **Data structure. Internally used by Neutrino.**
+/// @details  This structure is used as data storage in the "nu::double4" class (double precision,
+/// 64-bit floating point components). It is tightly packed to be compatible with the OpenCL
+/// requirement of having a contiguous data arrangement without padding.
+#pragma pack(push, 1)                                                                               // Packing data in 1 column...
+typedef struct _nu_double4_structure
+{
+  GLdouble x;                                                                                       ///< "x" coordinate.
+  GLdouble y;                                                                                       ///< "y" coordinate.
+  GLdouble z;                                                                                       ///< "z" coordinate.
+  GLdouble w;                                                                                       ///< "w" coordinate.
+} nu_double4_structure;
+#pragma pack(pop)
+
 // Neutrino data types:
 typedef enum
 {
@@ -235,6 +316,14 @@ typedef enum
   NU_FLOAT2,                                                                                        ///< Neutrino "nu::float2" data type.
   NU_FLOAT3,                                                                                        ///< Neutrino "nu::float3" data type.
   NU_FLOAT4,                                                                                        ///< Neutrino "nu::float4" data type.
+  NU_HALF,                                                                                          ///< Neutrino "nu::half1" data type.
+  NU_HALF4,                                                                                         ///< Neutrino "nu::half4" data type.
+  NU_SHORT4,                                                                                        ///< Neutrino "nu::short4" data type.
+  NU_UCHAR4,                                                                                        ///< Neutrino "nu::uchar4" data type.
+  NU_DOUBLE,                                                                                        ///< Neutrino "nu::double1" data type.
+  NU_DOUBLE2,                                                                                       ///< Neutrino "nu::double2" data type.
+  NU_DOUBLE3,                                                                                       ///< Neutrino "nu::double3" data type.
+  NU_DOUBLE4,                                                                                       ///< Neutrino "nu::double4" data type.
 } nu_type;
 
 namespace nu
@@ -249,6 +338,26 @@ public:
   nu_type                   type;                                                                   ///< Kernel argument data type.
   size_t                    layout;                                                                 ///< Kernel argument layout index.
   static std::vector<data*> container;                                                              ///< @brief **Neutrino data array.**
+
+  /// @brief **Data accessor.**
+  /// @details Gets the host data, element size, number of elements, device buffer and buffer
+  /// "ready" flag of the data object, whatever its type.
+  void          access (
+                        void**   loc_host,                                                          ///< Host data.
+                        size_t*  loc_element,                                                       ///< Element size [bytes].
+                        size_t*  loc_count,                                                         ///< Number of elements [#].
+                        cl_mem** loc_buffer,                                                        ///< Device buffer.
+                        bool**   loc_ready                                                          ///< Buffer "ready" flag.
+                       );
+
+  /// @brief **Shared buffer acquirer.**
+  /// @details Enqueues the acquire (or the release) of the OpenGL shared buffers of some data
+  /// objects for OpenCL, in the OpenCL/GL interoperability modality. Does nothing otherwise.
+  /// Returns the OpenCL error code.
+  static cl_int share (
+                       std::vector<data*>& loc_data,                                                ///< Data objects.
+                       bool                loc_acquire                                              ///< "Acquire" flag (false = release).
+                      );
 };
 
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -259,7 +368,7 @@ public:
 /// Declares a 1xN vector (N = data size) of **GLint** data numbers.
 /// To be used to transfer memory between host and client. It does not have bindings for
 /// OpenGL/CL interoperability. Not intended to be used for graphics rendering.
-class int1 : public data                                                                            /// @brief **1xN vector of "GLint" data.**
+class int1 : public data                                                                                /// @brief **1xN vector of "GLint" data.**
 {
 private:
 
@@ -313,17 +422,31 @@ public:
         size_t loc_layout                                                                           ///< Kernel argument layout index.
        );
 
-  /// @brief **Read file function.**
-  /// @details Reads data from a file and fills the data variable. If the data in the file is
-  /// longer than the data variable size, then the reading process is interrupted.
+  /// @brief **Read text file function.**
+  /// @details Reads data from a text (or CSV) file and fills the data variable. If the data in the
+  /// file is longer than the data variable size, then the reading process is interrupted.
   /// If the data in the file is shorter, than after filling the data variable with the data from
-  /// the file the data variable is filled with zeros.
-  /// The data must be organized in 1 column of 1 **GLint** number per line.
+  /// the file the data variable is filled with zeros. If the data variable is empty (and the
+  /// buffer is not "ready"), then it is sized as the data in the file. If the buffer is "ready",
+  /// then the data are also uploaded into it.
+  /// The data must be organized in lines of 1 **GLint** number,
+  /// separated by spaces, commas or semicolons: lines not starting with a number (comments,
+  /// headers) are skipped. The file is memory mapped and parsed by multiple threads.
   void read (
              std::string loc_file_directory,                                                        ///< File directory.
              std::string loc_file_name                                                              ///< File name.
             );
 
+  /// @brief **Load binary file function.**
+  /// @details Loads data from a binary file of raw int1 elements (as in the data variable) and
+  /// fills the data variable, with the same truncation, zero filling and sizing rules of the
+  /// @link read @endlink function. If the buffer is "ready", then the data are also uploaded
+  /// into it. The file is memory mapped: no parsing occurs.
+  void load (
+             std::string loc_file_directory,                                                        ///< File directory.
+             std::string loc_file_name                                                              ///< File name.
+            );
+
   /// @brief **Class destructor.**
   /// @details It deallocates the host PC memory previously allocated by the
   /// @link nu::int1::init @endlink as data storage.
@@ -393,6 +516,31 @@ public:
         size_t loc_layout                                                                           ///< Kernel argument layout index.
        );
 
+  /// @brief **Read text file function.**
+  /// @details Reads data from a text (or CSV) file and fills the data variable. If the data in the
+  /// file is longer than the data variable size, then the reading process is interrupted.
+  /// If the data in the file is shorter, than after filling the data variable with the data from
+  /// the file the data variable is filled with zeros. If the data variable is empty (and the
+  /// buffer is not "ready"), then it is sized as the data in the file. If the buffer is "ready",
+  /// then the data are also uploaded into it.
+  /// The data must be organized in lines of 2 **GLint** numbers,
+  /// separated by spaces, commas or semicolons: lines not starting with a number (comments,
+  /// headers) are skipped. The file is memory mapped and parsed by multiple threads.
+  void read (
+             std::string loc_file_directory,                                                        ///< File directory.
+             std::string loc_file_name                                                              ///< File name.
+            );
+
+  /// @brief **Load binary file function.**
+  /// @details Loads data from a binary file of raw int2 elements (as in the data variable) and
+  /// fills the data variable, with the same truncation, zero filling and sizing rules of the
+  /// @link read @endlink function. If the buffer is "ready", then the data are also uploaded
+  /// into it. The file is memory mapped: no parsing occurs.
+  void load (
+             std::string loc_file_directory,                                                        ///< File directory.
+             std::string loc_file_name                                                              ///< File name.
+            );
+
   /// @brief **Class destructor.**
   /// @details It deallocates the host PC memory previously allocated by the
   /// @link nu::int2::init @endlink as data storage.
@@ -407,7 +555,7 @@ public:
 /// Declares a 3xN vector (N = data size) of "GLint" data numbers.
 /// To be used to transfer memory between host and client. It does not have bindings for
 /// OpenGL/CL interoperability. Not intended to be used for graphics rendering.
-class int3 : public data                                                                            /// @brief **3xN vector of "GLint" data.**
+class int3 : public data                                                                                /// @brief **3xN vector of "GLint" data.**
 {
 private:
 
@@ -461,6 +609,31 @@ public:
         size_t loc_layout                                                                           ///< Kernel argument layout index.
        );
 
+  /// @brief **Read text file function.**
+  /// @details Reads data from a text (or CSV) file and fills the data variable. If the data in the
+  /// file is longer than the data variable size, then the reading process is interrupted.
+  /// If the data in the file is shorter, than after filling the data variable with the data from
+  /// the file the data variable is filled with zeros. If the data variable is empty (and the
+  /// buffer is not "ready"), then it is sized as the data in the file. If the buffer is "ready",
+  /// then the data are also uploaded into it.
+  /// The data must be organized in lines of 3 **GLint** numbers,
+  /// separated by spaces, commas or semicolons: lines not starting with a number (comments,
+  /// headers) are skipped. The file is memory mapped and parsed by multiple threads.
+  void read (
+             std::string loc_file_directory,                                                        ///< File directory.
+             std::string loc_file_name                                                              ///< File name.
+            );
+
+  /// @brief **Load binary file function.**
+  /// @details Loads data from a binary file of raw int3 elements (as in the data variable) and
+  /// fills the data variable, with the same truncation, zero filling and sizing rules of the
+  /// @link read @endlink function. If the buffer is "ready", then the data are also uploaded
+  /// into it. The file is memory mapped: no parsing occurs.
+  void load (
+             std::string loc_file_directory,                                                        ///< File directory.
+             std::string loc_file_name                                                              ///< File name.
+            );
+
   /// @brief **Class destructor.**
   /// @details It deallocates the host PC memory previously allocated by the
   /// @link nu::int3::init @endlink as data storage.
@@ -475,7 +648,7 @@ public:
 /// Declares a 4xN vector (N = data size) of "GLint" data numbers.
 /// To be used to transfer memory between host and client. It does not have bindings for
 /// OpenGL/CL interoperability. Not intended to be used for graphics rendering.
-class int4 : public data                                                                            /// @brief **4xN vector of "GLint" data.**
+class int4 : public data                                                                                /// @brief **4xN vector of "GLint" data.**
 {
 private:
 
@@ -529,6 +702,31 @@ public:
         size_t loc_layout                                                                           ///< Kernel argument layout index.
        );
 
+  /// @brief **Read text file function.**
+  /// @details Reads data from a text (or CSV) file and fills the data variable. If the data in the
+  /// file is longer than the data variable size, then the reading process is interrupted.
+  /// If the data in the file is shorter, than after filling the data variable with the data from
+  /// the file the data variable is filled with zeros. If the data variable is empty (and the
+  /// buffer is not "ready"), then it is sized as the data in the file. If the buffer is "ready",
+  /// then the data are also uploaded into it.
+  /// The data must be organized in lines of 4 **GLint** numbers,
+  /// separated by spaces, commas or semicolons: lines not starting with a number (comments,
+  /// headers) are skipped. The file is memory mapped and parsed by multiple threads.
+  void read (
+             std::string loc_file_directory,                                                        ///< File directory.
+             std::string loc_file_name                                                              ///< File name.
+            );
+
+  /// @brief **Load binary file function.**
+  /// @details Loads data from a binary file of raw int4 elements (as in the data variable) and
+  /// fills the data variable, with the same truncation, zero filling and sizing rules of the
+  /// @link read @endlink function. If the buffer is "ready", then the data are also uploaded
+  /// into it. The file is memory mapped: no parsing occurs.
+  void load (
+             std::string loc_file_directory,                                                        ///< File directory.
+             std::string loc_file_name                                                              ///< File name.
+            );
+
   /// @brief **Class destructor.**
   /// @details It deallocates the host PC memory previously allocated by the
   /// @link nu::int4::init @endlink as data storage.
@@ -543,7 +741,7 @@ public:
 /// Declares a 1xN vector (N = data size) of "GLfloat" data numbers.
 /// To be used to transfer memory between host and client. It does not have bindings for
 /// OpenGL/CL interoperability. Not intended to be used for graphics rendering.
-class float1 : public data                                                                          /// @brief **1xN vector of "GLfloat" data.**
+class float1 : public data                                                                              /// @brief **1xN vector of "GLfloat" data.**
 {
 private:
 
@@ -597,6 +795,31 @@ public:
           size_t loc_layout                                                                         ///< Kernel argument layout index.
          );
 
+  /// @brief **Read text file function.**
+  /// @details Reads data from a text (or CSV) file and fills the data variable. If the data in the
+  /// file is longer than the data variable size, then the reading process is interrupted.
+  /// If the data in the file is shorter, than after filling the data variable with the data from
+  /// the file the data variable is filled with zeros. If the data variable is empty (and the
+  /// buffer is not "ready"), then it is sized as the data in the file. If the buffer is "ready",
+  /// then the data are also uploaded into it.
+  /// The data must be organized in lines of 1 **GLfloat** number,
+  /// separated by spaces, commas or semicolons: lines not starting with a number (comments,
+  /// headers) are skipped. The file is memory mapped and parsed by multiple threads.
+  void read (
+             std::string loc_file_directory,                                                        ///< File directory.
+             std::string loc_file_name                                                              ///< File name.
+            );
+
+  /// @brief **Load binary file function.**
+  /// @details Loads data from a binary file of raw float1 elements (as in the data variable) and
+  /// fills the data variable, with the same truncation, zero filling and sizing rules of the
+  /// @link read @endlink function. If the buffer is "ready", then the data are also uploaded
+  /// into it. The file is memory mapped: no parsing occurs.
+  void load (
+             std::string loc_file_directory,                                                        ///< File directory.
+             std::string loc_file_name                                                              ///< File name.
+            );
+
   /// @brief **Class destructor.**
   /// @details It deallocates the host PC memory previously allocated by the
   /// @link nu::float1::init @endlink as data storage.
@@ -611,7 +834,7 @@ public:
 /// Declares a 2xN vector (N = data size) of "GLfloat" data numbers.
 /// To be used to transfer memory between host and client. It does not have bindings for
 /// OpenGL/CL interoperability. Not intended for graphics rendering.
-class float2 : public data                                                                          /// @brief **2xN vector of "GLfloat" data.**
+class float2 : public data                                                                              /// @brief **2xN vector of "GLfloat" data.**
 {
 private:
 
@@ -665,6 +888,31 @@ public:
           size_t loc_layout                                                                         ///< Kernel argument layout index.
          );
 
+  /// @brief **Read text file function.**
+  /// @details Reads data from a text (or CSV) file and fills the data variable. If the data in the
+  /// file is longer than the data variable size, then the reading process is interrupted.
+  /// If the data in the file is shorter, than after filling the data variable with the data from
+  /// the file the data variable is filled with zeros. If the data variable is empty (and the
+  /// buffer is not "ready"), then it is sized as the data in the file. If the buffer is "ready",
+  /// then the data are also uploaded into it.
+  /// The data must be organized in lines of 2 **GLfloat** numbers,
+  /// separated by spaces, commas or semicolons: lines not starting with a number (comments,
+  /// headers) are skipped. The file is memory mapped and parsed by multiple threads.
+  void read (
+             std::string loc_file_directory,                                                        ///< File directory.
+             std::string loc_file_name                                                              ///< File name.
+            );
+
+  /// @brief **Load binary file function.**
+  /// @details Loads data from a binary file of raw float2 elements (as in the data variable) and
+  /// fills the data variable, with the same truncation, zero filling and sizing rules of the
+  /// @link read @endlink function. If the buffer is "ready", then the data are also uploaded
+  /// into it. The file is memory mapped: no parsing occurs.
+  void load (
+             std::string loc_file_directory,                                                        ///< File directory.
+             std::string loc_file_name                                                              ///< File name.
+            );
+
   /// @brief **Class destructor.**
   /// @details It deallocates the host PC memory previously allocated by the
   /// @link nu::float2::init @endlink as data storage.
@@ -679,7 +927,7 @@ public:
 /// Declares a 3xN vector (N = data size) of "GLfloat" data numbers.
 /// To be used to transfer memory between host and client. It does not have bindings for
 /// OpenGL/CL interoperability. Not intended for graphics rendering.
-class float3 : public data                                                                          /// @brief **3xN vector of "GLfloat" data.**
+class float3 : public data                                                                              /// @brief **3xN vector of "GLfloat" data.**
 {
 private:
 
@@ -733,6 +981,31 @@ public:
           size_t loc_layout                                                                         ///< Kernel argument layout index.
          );
 
+  /// @brief **Read text file function.**
+  /// @details Reads data from a text (or CSV) file and fills the data variable. If the data in the
+  /// file is longer than the data variable size, then the reading process is interrupted.
+  /// If the data in the file is shorter, than after filling the data variable with the data from
+  /// the file the data variable is filled with zeros. If the data variable is empty (and the
+  /// buffer is not "ready"), then it is sized as the data in the file. If the buffer is "ready",
+  /// then the data are also uploaded into it.
+  /// The data must be organized in lines of 3 **GLfloat** numbers,
+  /// separated by spaces, commas or semicolons: lines not starting with a number (comments,
+  /// headers) are skipped. The file is memory mapped and parsed by multiple threads.
+  void read (
+             std::string loc_file_directory,                                                        ///< File directory.
+             std::string loc_file_name                                                              ///< File name.
+            );
+
+  /// @brief **Load binary file function.**
+  /// @details Loads data from a binary file of raw float3 elements (as in the data variable) and
+  /// fills the data variable, with the same truncation, zero filling and sizing rules of the
+  /// @link read @endlink function. If the buffer is "ready", then the data are also uploaded
+  /// into it. The file is memory mapped: no parsing occurs.
+  void load (
+             std::string loc_file_directory,                                                        ///< File directory.
+             std::string loc_file_name                                                              ///< File name.
+            );
+
   /// @brief **Class destructor.**
   /// @details It deallocates the host PC memory previously allocated by the
   /// @link nu::float3::init @endlink as data storage.
@@ -747,7 +1020,7 @@ public:
 /// Declares a 4xN vector (N = data size) of "GLfloat" data numbers.
 /// To be used to transfer memory between host and client. It does not have bindings for
 /// OpenGL/CL interoperability. Not intended for graphics rendering.
-class float4 : public data                                                                          /// @brief **4xN vector of "GLfloat" data.**
+class float4 : public data                                                                              /// @brief **4xN vector of "GLfloat" data.**
 {
 private:
 
@@ -801,10 +1074,806 @@ public:
           size_t loc_layout                                                                         ///< Kernel argument layout index.
          );
 
+  /// @brief **Read text file function.**
+  /// @details Reads data from a text (or CSV) file and fills the data variable. If the data in the
+  /// file is longer than the data variable size, then the reading process is interrupted.
+  /// If the data in the file is shorter, than after filling the data variable with the data from
+  /// the file the data variable is filled with zeros. If the data variable is empty (and the
+  /// buffer is not "ready"), then it is sized as the data in the file. If the buffer is "ready",
+  /// then the data are also uploaded into it.
+  /// The data must be organized in lines of 4 **GLfloat** numbers,
+  /// separated by spaces, commas or semicolons: lines not starting with a number (comments,
+  /// headers) are skipped. The file is memory mapped and parsed by multiple threads.
+  void read (
+             std::string loc_file_directory,                                                        ///< File directory.
+             std::string loc_file_name                                                              ///< File name.
+            );
+
+  /// @brief **Load binary file function.**
+  /// @details Loads data from a binary file of raw float4 elements (as in the data variable) and
+  /// fills the data variable, with the same truncation, zero filling and sizing rules of the
+  /// @link read @endlink function. If the buffer is "ready", then the data are also uploaded
+  /// into it. The file is memory mapped: no parsing occurs.
+  void load (
+             std::string loc_file_directory,                                                        ///< File directory.
+             std::string loc_file_name                                                              ///< File name.
+            );
+
   /// @brief **Class destructor.**
   /// @details It deallocates the host PC memory previously allocated by the
   /// @link nu::float4::init @endlink as data storage.
   ~float4();
 };
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////// "half1" class ///////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class half1
+/// ### 1xN vector of "GLhalf" data.
+/// Declares a 1xN vector (N = data size) of "GLhalf" (half precision, 16-bit) data numbers.
+/// To be used to halve the memory traffic of bandwidth-bound kernels. In the kernels, it is a
+/// "__global half*" argument accessed by vload_half and vstore_half (available even without
+/// the cl_khr_fp16 extension). In the shaders, it is a "float" vertex attribute. The host data
+/// can be converted by the @link nu::half @endlink and @link nu::single @endlink functions.
+class half1 : public data                                                                               /// @brief **1xN vector of "GLhalf" data.**
+{
+private:
+
+public:
+  /// @details 1xN (N = data @link size @endlink ) **GLhalf** data storage.
+  /// These data are stored in the host PC memory.
+  /// They can be eventually exchanged between the client GPU by using the @link queue::init
+  /// @endlink and @link write @endlink methods of the @link queue @endlink class.
+  /// The data storage is created by the @link nu::int1::init @endlink method and destroyed by the
+  /// class destructor. An OpenCL **cl_mem** @link buffer @endlink object is initialized by the
+  /// @link kernel::setarg @endlink method upon the verification of the status of the @link ready
+  /// @endlink flag. The latter one serves as an indicator (internally managed by Neutrino) in order
+  /// allow the @link buffer @endlink initialization and to impede it during subsequents
+  /// calls of the @link kernel::setarg @endlink method.
+  std::vector<GLhalf> data;                                                                         ///< @brief **Data [GLhalf].**
+
+  /// @details **cl_mem** OpenCL memory buffer object. It does not contain user data. It is
+  /// internally used by Neutrino within the OpenCL mechanisms to define the properties of
+  /// the memory allocation on the client GPU.
+  cl_mem              buffer;                                                                       ///< @brief **Data memory buffer.**.
+
+  /// @details [OpenGL data Vertex Array Object]
+  /// (https://www.khronos.org/opengl/wiki/Vertex_Specification). Internally used by Neutrino.
+  GLuint              vao;                                                                          ///< @brief **OpenGL data Vertex Array Object.**
+
+  /// @details [OpenGL data Vertex Buffer Object]
+  /// (https://www.khronos.org/opengl/wiki/Shader_Storage_Buffer_Object).
+  /// Internally used by Neutrino.
+  GLuint              ssbo;                                                                         ///< @brief **OpenGL data Shader Storage Buffer Object.**
+
+  /// @details This flag serves as an indicator (internally managed by Neutrino) in order
+  /// allow the @link buffer @endlink initialization and to impede it during subsequents
+  /// calls of the @link kernel::setarg @endlink method. It is internally managed by Neutrino.
+  GLuint              layout;                                                                       ///< @brief **Data layout index [#].**
+
+  /// @details String name of the object instance. To be set by the user according to what
+  /// defined in the GLSL OpenGL shaders. Used to uniquely identify the object reference as
+  /// variable in the GLSL OpenGL shaders.
+  std::string         name;                                                                         ///< @brief **Data name.**
+
+  /// @details This flag serves as an indicator (internally managed by Neutrino) in order
+  /// allow the @link buffer @endlink initialization and to impede it during subsequents
+  /// calls of the @link kernel::setarg @endlink method. It is internally managed by Neutrino.
+  bool                ready;                                                                        ///< @brief **Buffer "ready" flag.**
+
+  /// @brief **Class constructor.**
+  /// @details It resets the @link ready @endlink. The initialization of the class must occur
+  /// after the initialization of the @link opencl @endlink and the @link opengl @endlink object,
+  /// therefore it must be done by invoking the @link nu::half1::init @endlink method.
+  half1 (
+          size_t loc_layout                                                                         ///< Kernel argument layout index.
+         );
+
+  /// @brief **Read text file function.**
+  /// @details Reads data from a text (or CSV) file and fills the data variable. If the data in the
+  /// file is longer than the data variable size, then the reading process is interrupted.
+  /// If the data in the file is shorter, than after filling the data variable with the data from
+  /// the file the data variable is filled with zeros. If the data variable is empty (and the
+  /// buffer is not "ready"), then it is sized as the data in the file. If the buffer is "ready",
+  /// then the data are also uploaded into it.
+  /// The data must be organized in lines of 1 **GLhalf** number (written as decimal floating point numbers),
+  /// separated by spaces, commas or semicolons: lines not starting with a number (comments,
+  /// headers) are skipped. The file is memory mapped and parsed by multiple threads.
+  void read (
+             std::string loc_file_directory,                                                        ///< File directory.
+             std::string loc_file_name                                                              ///< File name.
+            );
+
+  /// @brief **Load binary file function.**
+  /// @details Loads data from a binary file of raw half1 elements (as in the data variable) and
+  /// fills the data variable, with the same truncation, zero filling and sizing rules of the
+  /// @link read @endlink function. If the buffer is "ready", then the data are also uploaded
+  /// into it. The file is memory mapped: no parsing occurs.
+  void load (
+             std::string loc_file_directory,                                                        ///< File directory.
+             std::string loc_file_name                                                              ///< File name.
+            );
+
+  /// @brief **Class destructor.**
+  /// @details It deallocates the host PC memory previously allocated by the
+  /// @link nu::half1::init @endlink as data storage.
+  ~half1();
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////// "half4" class ///////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class half4
+/// ### 4xN vector of "GLhalf" data.
+/// Declares a 4xN vector (N = data size) of "GLhalf" (half precision, 16-bit) data numbers.
+/// To be used to halve the memory traffic of bandwidth-bound kernels. In the kernels, it is a
+/// "__global half*" argument accessed by vload_half4 and vstore_half4 (available even without
+/// the cl_khr_fp16 extension). In the shaders, it is a "vec4" vertex attribute. The host data
+/// can be converted by the @link nu::half @endlink and @link nu::single @endlink functions.
+class half4 : public data                                                                               /// @brief **4xN vector of "GLhalf" data.**
+{
+private:
+
+public:
+  /// @details 4xN (N = data @link size @endlink ) **GLhalf** data storage.
+  /// These data are stored in the host PC memory.
+  /// They can be eventually exchanged between the client GPU by using the @link queue::init
+  /// @endlink and @link write @endlink methods of the @link queue @endlink class.
+  /// The data storage is created by the @link nu::int1::init @endlink method and destroyed by the
+  /// class destructor. An OpenCL **cl_mem** @link buffer @endlink object is initialized by the
+  /// @link kernel::setarg @endlink method upon the verification of the status of the @link ready
+  /// @endlink flag. The latter one serves as an indicator (internally managed by Neutrino) in order
+  /// allow the @link buffer @endlink initialization and to impede it during subsequents
+  /// calls of the @link kernel::setarg @endlink method.
+  std::vector<nu_half4_structure> data;                                                             ///< @brief **Data [GLhalf].**
+
+  /// @details **cl_mem** OpenCL memory buffer object. It does not contain user data. It is
+  /// internally used by Neutrino within the OpenCL mechanisms to define the properties of
+  /// the memory allocation on the client GPU.
+  cl_mem                          buffer;                                                           ///< @brief **Data memory buffer.**.
+
+  /// @details [OpenGL data Vertex Array Object]
+  /// (https://www.khronos.org/opengl/wiki/Vertex_Specification). Internally used by Neutrino.
+  GLuint                          vao;                                                              ///< @brief **OpenGL data Vertex Array Object.**
+
+  /// @details [OpenGL data Vertex Buffer Object]
+  /// (https://www.khronos.org/opengl/wiki/Shader_Storage_Buffer_Object).
+  /// Internally used by Neutrino.
+  GLuint                          ssbo;                                                             ///< @brief **OpenGL data Shader Storage Buffer Object.**
+
+  /// @details This flag serves as an indicator (internally managed by Neutrino) in order
+  /// allow the @link buffer @endlink initialization and to impede it during subsequents
+  /// calls of the @link kernel::setarg @endlink method. It is internally managed by Neutrino.
+  GLuint                          layout;                                                           ///< @brief **Data layout index [#].**
+
+  /// @details String name of the object instance. To be set by the user according to what
+  /// defined in the GLSL OpenGL shaders. Used to uniquely identify the object reference as
+  /// variable in the GLSL OpenGL shaders.
+  std::string                     name;                                                             ///< @brief **Data name.**
+
+  /// @details This flag serves as an indicator (internally managed by Neutrino) in order
+  /// allow the @link buffer @endlink initialization and to impede it during subsequents
+  /// calls of the @link kernel::setarg @endlink method. It is internally managed by Neutrino.
+  bool                            ready;                                                            ///< @brief **Buffer "ready" flag.**
+
+  /// @brief **Class constructor.**
+  /// @details It resets the @link ready @endlink. The initialization of the class must occur
+  /// after the initialization of the @link opencl @endlink and the @link opengl @endlink object,
+  /// therefore it must be done by invoking the @link nu::half4::init @endlink method.
+  half4 (
+          size_t loc_layout                                                                         ///< Kernel argument layout index.
+         );
+
+  /// @brief **Read text file function.**
+  /// @details Reads data from a text (or CSV) file and fills the data variable. If the data in the
+  /// file is longer than the data variable size, then the reading process is interrupted.
+  /// If the data in the file is shorter, than after filling the data variable with the data from
+  /// the file the data variable is filled with zeros. If the data variable is empty (and the
+  /// buffer is not "ready"), then it is sized as the data in the file. If the buffer is "ready",
+  /// then the data are also uploaded into it.
+  /// The data must be organized in lines of 4 **GLhalf** numbers (written as decimal floating point numbers),
+  /// separated by spaces, commas or semicolons: lines not starting with a number (comments,
+  /// headers) are skipped. The file is memory mapped and parsed by multiple threads.
+  void read (
+             std::string loc_file_directory,                                                        ///< File directory.
+             std::string loc_file_name                                                              ///< File name.
+            );
+
+  /// @brief **Load binary file function.**
+  /// @details Loads data from a binary file of raw half4 elements (as in the data variable) and
+  /// fills the data variable, with the same truncation, zero filling and sizing rules of the
+  /// @link read @endlink function. If the buffer is "ready", then the data are also uploaded
+  /// into it. The file is memory mapped: no parsing occurs.
+  void load (
+             std::string loc_file_directory,                                                        ///< File directory.
+             std::string loc_file_name                                                              ///< File name.
+            );
+
+  /// @brief **Class destructor.**
+  /// @details It deallocates the host PC memory previously allocated by the
+  /// @link nu::half4::init @endlink as data storage.
+  ~half4();
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////// "short4" class ///////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class short4
+/// ### 4xN vector of "GLshort" data.
+/// Declares a 4xN vector (N = data size) of "GLshort" (packed 16-bit signed integer) data
+/// numbers. To be used to halve the memory traffic of bandwidth-bound kernels on integer data
+/// (e.g. indices, flags). In the kernels, it is a "__global short4*" argument. In the shaders, it
+/// is an "ivec4" vertex attribute.
+class short4 : public data                                                                              /// @brief **4xN vector of "GLshort" data.**
+{
+private:
+
+public:
+  /// @details 4xN (N = data @link size @endlink ) **GLshort** data storage.
+  /// These data are stored in the host PC memory.
+  /// They can be eventually exchanged between the client GPU by using the @link queue::init
+  /// @endlink and @link write @endlink methods of the @link queue @endlink class.
+  /// The data storage is created by the @link nu::int1::init @endlink method and destroyed by the
+  /// class destructor. An OpenCL **cl_mem** @link buffer @endlink object is initialized by the
+  /// @link kernel::setarg @endlink method upon the verification of the status of the @link ready
+  /// @endlink flag. The latter one serves as an indicator (internally managed by Neutrino) in order
+  /// allow the @link buffer @endlink initialization and to impede it during subsequents
+  /// calls of the @link kernel::setarg @endlink method.
+  std::vector<nu_short4_structure> data;                                                            ///< @brief **Data [GLshort].**
+
+  /// @details **cl_mem** OpenCL memory buffer object. It does not contain user data. It is
+  /// internally used by Neutrino within the OpenCL mechanisms to define the properties of
+  /// the memory allocation on the client GPU.
+  cl_mem                           buffer;                                                          ///< @brief **Data memory buffer.**.
+
+  /// @details [OpenGL data Vertex Array Object]
+  /// (https://www.khronos.org/opengl/wiki/Vertex_Specification). Internally used by Neutrino.
+  GLuint                           vao;                                                             ///< @brief **OpenGL data Vertex Array Object.**
+
+  /// @details [OpenGL data Vertex Buffer Object]
+  /// (https://www.khronos.org/opengl/wiki/Shader_Storage_Buffer_Object).
+  /// Internally used by Neutrino.
+  GLuint                           ssbo;                                                            ///< @brief **OpenGL data Shader Storage Buffer Object.**
+
+  /// @details This flag serves as an indicator (internally managed by Neutrino) in order
+  /// allow the @link buffer @endlink initialization and to impede it during subsequents
+  /// calls of the @link kernel::setarg @endlink method. It is internally managed by Neutrino.
+  GLuint                           layout;                                                          ///< @brief **Data layout index [#].**
+
+  /// @details String name of the object instance. To be set by the user according to what
+  /// defined in the GLSL OpenGL shaders. Used to uniquely identify the object reference as
+  /// variable in the GLSL OpenGL shaders.
+  std::string                      name;                                                            ///< @brief **Data name.**
+
+  /// @details This flag serves as an indicator (internally managed by Neutrino) in order
+  /// allow the @link buffer @endlink initialization and to impede it during subsequents
+  /// calls of the @link kernel::setarg @endlink method. It is internally managed by Neutrino.
+  bool                             ready;                                                           ///< @brief **Buffer "ready" flag.**
+
+  /// @brief **Class constructor.**
+  /// @details It resets the @link ready @endlink. The initialization of the class must occur
+  /// after the initialization of the @link opencl @endlink and the @link opengl @endlink object,
+  /// therefore it must be done by invoking the @link nu::short4::init @endlink method.
+  short4 (
+          size_t loc_layout                                                                         ///< Kernel argument layout index.
+         );
+
+  /// @brief **Read text file function.**
+  /// @details Reads data from a text (or CSV) file and fills the data variable. If the data in the
+  /// file is longer than the data variable size, then the reading process is interrupted.
+  /// If the data in the file is shorter, than after filling the data variable with the data from
+  /// the file the data variable is filled with zeros. If the data variable is empty (and the
+  /// buffer is not "ready"), then it is sized as the data in the file. If the buffer is "ready",
+  /// then the data are also uploaded into it.
+  /// The data must be organized in lines of 4 **GLshort** numbers,
+  /// separated by spaces, commas or semicolons: lines not starting with a number (comments,
+  /// headers) are skipped. The file is memory mapped and parsed by multiple threads.
+  void read (
+             std::string loc_file_directory,                                                        ///< File directory.
+             std::string loc_file_name                                                              ///< File name.
+            );
+
+  /// @brief **Load binary file function.**
+  /// @details Loads data from a binary file of raw short4 elements (as in the data variable) and
+  /// fills the data variable, with the same truncation, zero filling and sizing rules of the
+  /// @link read @endlink function. If the buffer is "ready", then the data are also uploaded
+  /// into it. The file is memory mapped: no parsing occurs.
+  void load (
+             std::string loc_file_directory,                                                        ///< File directory.
+             std::string loc_file_name                                                              ///< File name.
+            );
+
+  /// @brief **Class destructor.**
+  /// @details It deallocates the host PC memory previously allocated by the
+  /// @link nu::short4::init @endlink as data storage.
+  ~short4();
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////// "uchar4" class ///////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class uchar4
+/// ### 4xN vector of "GLubyte" data.
+/// Declares a 4xN vector (N = data size) of "GLubyte" (normalized 8-bit unsigned integer) data
+/// numbers, representing values in [0, 1] (e.g. colors). In the kernels, it is a
+/// "__global uchar4*" argument (to be converted by convert_uchar4 (x)/255.0f and
+/// convert_uchar4_sat_rte (x*255.0f)). In the shaders, it is a "vec4" vertex attribute in [0, 1].
+class uchar4 : public data                                                                              /// @brief **4xN vector of "GLubyte" data.**
+{
+private:
+
+public:
+  /// @details 4xN (N = data @link size @endlink ) **GLubyte** data storage.
+  /// These data are stored in the host PC memory.
+  /// They can be eventually exchanged between the client GPU by using the @link queue::init
+  /// @endlink and @link write @endlink methods of the @link queue @endlink class.
+  /// The data storage is created by the @link nu::int1::init @endlink method and destroyed by the
+  /// class destructor. An OpenCL **cl_mem** @link buffer @endlink object is initialized by the
+  /// @link kernel::setarg @endlink method upon the verification of the status of the @link ready
+  /// @endlink flag. The latter one serves as an indicator (internally managed by Neutrino) in order
+  /// allow the @link buffer @endlink initialization and to impede it during subsequents
+  /// calls of the @link kernel::setarg @endlink method.
+  std::vector<nu_uchar4_structure> data;                                                            ///< @brief **Data [GLubyte].**
+
+  /// @details **cl_mem** OpenCL memory buffer object. It does not contain user data. It is
+  /// internally used by Neutrino within the OpenCL mechanisms to define the properties of
+  /// the memory allocation on the client GPU.
+  cl_mem                           buffer;                                                          ///< @brief **Data memory buffer.**.
+
+  /// @details [OpenGL data Vertex Array Object]
+  /// (https://www.khronos.org/opengl/wiki/Vertex_Specification). Internally used by Neutrino.
+  GLuint                           vao;                                                             ///< @brief **OpenGL data Vertex Array Object.**
+
+  /// @details [OpenGL data Vertex Buffer Object]
+  /// (https://www.khronos.org/opengl/wiki/Shader_Storage_Buffer_Object).
+  /// Internally used by Neutrino.
+  GLuint                           ssbo;                                                            ///< @brief **OpenGL data Shader Storage Buffer Object.**
+
+  /// @details This flag serves as an indicator (internally managed by Neutrino) in order
+  /// allow the @link buffer @endlink initialization and to impede it during subsequents
+  /// calls of the @link kernel::setarg @endlink method. It is internally managed by Neutrino.
+  GLuint                           layout;                                                          ///< @brief **Data layout index [#].**
+
+  /// @details String name of the object instance. To be set by the user according to what
+  /// defined in the GLSL OpenGL shaders. Used to uniquely identify the object reference as
+  /// variable in the GLSL OpenGL shaders.
+  std::string                      name;                                                            ///< @brief **Data name.**
+
+  /// @details This flag serves as an indicator (internally managed by Neutrino) in order
+  /// allow the @link buffer @endlink initialization and to impede it during subsequents
+  /// calls of the @link kernel::setarg @endlink method. It is internally managed by Neutrino.
+  bool                             ready;                                                           ///< @brief **Buffer "ready" flag.**
+
+  /// @brief **Class constructor.**
+  /// @details It resets the @link ready @endlink. The initialization of the class must occur
+  /// after the initialization of the @link opencl @endlink and the @link opengl @endlink object,
+  /// therefore it must be done by invoking the @link nu::uchar4::init @endlink method.
+  uchar4 (
+          size_t loc_layout                                                                         ///< Kernel argument layout index.
+         );
+
+  /// @brief **Read text file function.**
+  /// @details Reads data from a text (or CSV) file and fills the data variable. If the data in the
+  /// file is longer than the data variable size, then the reading process is interrupted.
+  /// If the data in the file is shorter, than after filling the data variable with the data from
+  /// the file the data variable is filled with zeros. If the data variable is empty (and the
+  /// buffer is not "ready"), then it is sized as the data in the file. If the buffer is "ready",
+  /// then the data are also uploaded into it.
+  /// The data must be organized in lines of 4 **GLubyte** numbers (written as normalized
+  /// decimal floating point numbers in [0, 1]),
+  /// separated by spaces, commas or semicolons: lines not starting with a number (comments,
+  /// headers) are skipped. The file is memory mapped and parsed by multiple threads.
+  void read (
+             std::string loc_file_directory,                                                        ///< File directory.
+             std::string loc_file_name                                                              ///< File name.
+            );
+
+  /// @brief **Load binary file function.**
+  /// @details Loads data from a binary file of raw uchar4 elements (as in the data variable) and
+  /// fills the data variable, with the same truncation, zero filling and sizing rules of the
+  /// @link read @endlink function. If the buffer is "ready", then the data are also uploaded
+  /// into it. The file is memory mapped: no parsing occurs.
+  void load (
+             std::string loc_file_directory,                                                        ///< File directory.
+             std::string loc_file_name                                                              ///< File name.
+            );
+
+  /// @brief **Class destructor.**
+  /// @details It deallocates the host PC memory previously allocated by the
+  /// @link nu::uchar4::init @endlink as data storage.
+  ~uchar4();
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////// "double1" class ////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class double1
+/// ### 1xN vector of "GLdouble" data.
+/// Declares a 1xN vector (N = data size) of "GLdouble" (double precision, 64-bit) data
+/// numbers. To be used by kernels needing double precision (e.g. stiff solvers): it requires
+/// a device with double precision support, checked when the kernel is built. In the kernels, it
+/// is a "__global double*" argument. In the shaders, it is a "double" vertex attribute.
+class double1 : public data                                                                              /// @brief **1xN vector of "GLdouble" data.**
+{
+private:
+
+public:
+  /// @details 1xN (N = data @link size @endlink ) **GLdouble** data storage.
+  /// These data are stored in the host PC memory.
+  /// They can be eventually exchanged between the client GPU by using the @link queue::init
+  /// @endlink and @link write @endlink methods of the @link queue @endlink class.
+  /// The data storage is created by the @link nu::int1::init @endlink method and destroyed by the
+  /// class destructor. An OpenCL **cl_mem** @link buffer @endlink object is initialized by the
+  /// @link kernel::setarg @endlink method upon the verification of the status of the @link ready
+  /// @endlink flag. The latter one serves as an indicator (internally managed by Neutrino) in order
+  /// allow the @link buffer @endlink initialization and to impede it during subsequents
+  /// calls of the @link kernel::setarg @endlink method.
+  std::vector<GLdouble> data;                                                                       ///< @brief **Data [GLdouble].**
+
+  /// @details **cl_mem** OpenCL memory buffer object. It does not contain user data. It is
+  /// internally used by Neutrino within the OpenCL mechanisms to define the properties of
+  /// the memory allocation on the client GPU.
+  cl_mem                buffer;                                                                     ///< @brief **Data memory buffer.**.
+
+  /// @details [OpenGL data Vertex Array Object]
+  /// (https://www.khronos.org/opengl/wiki/Vertex_Specification). Internally used by Neutrino.
+  GLuint                vao;                                                                        ///< @brief **OpenGL data Vertex Array Object.**
+
+  /// @details [OpenGL data Vertex Buffer Object]
+  /// (https://www.khronos.org/opengl/wiki/Shader_Storage_Buffer_Object).
+  /// Internally used by Neutrino.
+  GLuint                ssbo;                                                                       ///< @brief **OpenGL data Shader Storage Buffer Object.**
+
+  /// @details This flag serves as an indicator (internally managed by Neutrino) in order
+  /// allow the @link buffer @endlink initialization and to impede it during subsequents
+  /// calls of the @link kernel::setarg @endlink method. It is internally managed by Neutrino.
+  GLuint                layout;                                                                     ///< @brief **Data layout index [#].**
+
+  /// @details String name of the object instance. To be set by the user according to what
+  /// defined in the GLSL OpenGL shaders. Used to uniquely identify the object reference as
+  /// variable in the GLSL OpenGL shaders.
+  std::string           name;                                                                       ///< @brief **Data name.**
+
+  /// @details This flag serves as an indicator (internally managed by Neutrino) in order
+  /// allow the @link buffer @endlink initialization and to impede it during subsequents
+  /// calls of the @link kernel::setarg @endlink method. It is internally managed by Neutrino.
+  bool                  ready;                                                                      ///< @brief **Buffer "ready" flag.**
+
+  /// @brief **Class constructor.**
+  /// @details It resets the @link ready @endlink. The initialization of the class must occur
+  /// after the initialization of the @link opencl @endlink and the @link opengl @endlink object,
+  /// therefore it must be done by invoking the @link nu::double1::init @endlink method.
+  double1 (
+          size_t loc_layout                                                                         ///< Kernel argument layout index.
+         );
+
+  /// @brief **Read text file function.**
+  /// @details Reads data from a text (or CSV) file and fills the data variable. If the data in the
+  /// file is longer than the data variable size, then the reading process is interrupted.
+  /// If the data in the file is shorter, than after filling the data variable with the data from
+  /// the file the data variable is filled with zeros. If the data variable is empty (and the
+  /// buffer is not "ready"), then it is sized as the data in the file. If the buffer is "ready",
+  /// then the data are also uploaded into it.
+  /// The data must be organized in lines of 1 **GLdouble** number,
+  /// separated by spaces, commas or semicolons: lines not starting with a number (comments,
+  /// headers) are skipped. The file is memory mapped and parsed by multiple threads.
+  void read (
+             std::string loc_file_directory,                                                        ///< File directory.
+             std::string loc_file_name                                                              ///< File name.
+            );
+
+  /// @brief **Load binary file function.**
+  /// @details Loads data from a binary file of raw double1 elements (as in the data variable) and
+  /// fills the data variable, with the same truncation, zero filling and sizing rules of the
+  /// @link read @endlink function. If the buffer is "ready", then the data are also uploaded
+  /// into it. The file is memory mapped: no parsing occurs.
+  void load (
+             std::string loc_file_directory,                                                        ///< File directory.
+             std::string loc_file_name                                                              ///< File name.
+            );
+
+  /// @brief **Class destructor.**
+  /// @details It deallocates the host PC memory previously allocated by the
+  /// @link nu::double1::init @endlink as data storage.
+  ~double1();
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////// "double2" class ////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class double2
+/// ### 2xN vector of "GLdouble" data.
+/// Declares a 2xN vector (N = data size) of "GLdouble" (double precision, 64-bit) data
+/// numbers. To be used by kernels needing double precision (e.g. stiff solvers): it requires
+/// a device with double precision support, checked when the kernel is built. In the kernels, it
+/// is a "__global double2*" argument. In the shaders, it is a "dvec2" vertex attribute.
+class double2 : public data                                                                              /// @brief **2xN vector of "GLdouble" data.**
+{
+private:
+
+public:
+  /// @details 2xN (N = data @link size @endlink ) **GLdouble** data storage.
+  /// These data are stored in the host PC memory.
+  /// They can be eventually exchanged between the client GPU by using the @link queue::init
+  /// @endlink and @link write @endlink methods of the @link queue @endlink class.
+  /// The data storage is created by the @link nu::int1::init @endlink method and destroyed by the
+  /// class destructor. An OpenCL **cl_mem** @link buffer @endlink object is initialized by the
+  /// @link kernel::setarg @endlink method upon the verification of the status of the @link ready
+  /// @endlink flag. The latter one serves as an indicator (internally managed by Neutrino) in order
+  /// allow the @link buffer @endlink initialization and to impede it during subsequents
+  /// calls of the @link kernel::setarg @endlink method.
+  std::vector<nu_double2_structure> data;                                                           ///< @brief **Data [GLdouble].**
+
+  /// @details **cl_mem** OpenCL memory buffer object. It does not contain user data. It is
+  /// internally used by Neutrino within the OpenCL mechanisms to define the properties of
+  /// the memory allocation on the client GPU.
+  cl_mem                            buffer;                                                         ///< @brief **Data memory buffer.**.
+
+  /// @details [OpenGL data Vertex Array Object]
+  /// (https://www.khronos.org/opengl/wiki/Vertex_Specification). Internally used by Neutrino.
+  GLuint                            vao;                                                            ///< @brief **OpenGL data Vertex Array Object.**
+
+  /// @details [OpenGL data Vertex Buffer Object]
+  /// (https://www.khronos.org/opengl/wiki/Shader_Storage_Buffer_Object).
+  /// Internally used by Neutrino.
+  GLuint                            ssbo;                                                           ///< @brief **OpenGL data Shader Storage Buffer Object.**
+
+  /// @details This flag serves as an indicator (internally managed by Neutrino) in order
+  /// allow the @link buffer @endlink initialization and to impede it during subsequents
+  /// calls of the @link kernel::setarg @endlink method. It is internally managed by Neutrino.
+  GLuint                            layout;                                                         ///< @brief **Data layout index [#].**
+
+  /// @details String name of the object instance. To be set by the user according to what
+  /// defined in the GLSL OpenGL shaders. Used to uniquely identify the object reference as
+  /// variable in the GLSL OpenGL shaders.
+  std::string                       name;                                                           ///< @brief **Data name.**
+
+  /// @details This flag serves as an indicator (internally managed by Neutrino) in order
+  /// allow the @link buffer @endlink initialization and to impede it during subsequents
+  /// calls of the @link kernel::setarg @endlink method. It is internally managed by Neutrino.
+  bool                              ready;                                                          ///< @brief **Buffer "ready" flag.**
+
+  /// @brief **Class constructor.**
+  /// @details It resets the @link ready @endlink. The initialization of the class must occur
+  /// after the initialization of the @link opencl @endlink and the @link opengl @endlink object,
+  /// therefore it must be done by invoking the @link nu::double2::init @endlink method.
+  double2 (
+          size_t loc_layout                                                                         ///< Kernel argument layout index.
+         );
+
+  /// @brief **Read text file function.**
+  /// @details Reads data from a text (or CSV) file and fills the data variable. If the data in the
+  /// file is longer than the data variable size, then the reading process is interrupted.
+  /// If the data in the file is shorter, than after filling the data variable with the data from
+  /// the file the data variable is filled with zeros. If the data variable is empty (and the
+  /// buffer is not "ready"), then it is sized as the data in the file. If the buffer is "ready",
+  /// then the data are also uploaded into it.
+  /// The data must be organized in lines of 2 **GLdouble** numbers,
+  /// separated by spaces, commas or semicolons: lines not starting with a number (comments,
+  /// headers) are skipped. The file is memory mapped and parsed by multiple threads.
+  void read (
+             std::string loc_file_directory,                                                        ///< File directory.
+             std::string loc_file_name                                                              ///< File name.
+            );
+
+  /// @brief **Load binary file function.**
+  /// @details Loads data from a binary file of raw double2 elements (as in the data variable) and
+  /// fills the data variable, with the same truncation, zero filling and sizing rules of the
+  /// @link read @endlink function. If the buffer is "ready", then the data are also uploaded
+  /// into it. The file is memory mapped: no parsing occurs.
+  void load (
+             std::string loc_file_directory,                                                        ///< File directory.
+             std::string loc_file_name                                                              ///< File name.
+            );
+
+  /// @brief **Class destructor.**
+  /// @details It deallocates the host PC memory previously allocated by the
+  /// @link nu::double2::init @endlink as data storage.
+  ~double2();
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////// "double3" class ////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class double3
+/// ### 3xN vector of "GLdouble" data.
+/// Declares a 3xN vector (N = data size) of "GLdouble" (double precision, 64-bit) data
+/// numbers. To be used by kernels needing double precision (e.g. stiff solvers): it requires
+/// a device with double precision support, checked when the kernel is built. In the kernels, it
+/// is a "__global double*" argument (tightly packed: to be
+/// accessed by vload3 and vstore3). In the shaders, it is a "dvec3" vertex attribute.
+class double3 : public data                                                                              /// @brief **3xN vector of "GLdouble" data.**
+{
+private:
+
+public:
+  /// @details 3xN (N = data @link size @endlink ) **GLdouble** data storage.
+  /// These data are stored in the host PC memory.
+  /// They can be eventually exchanged between the client GPU by using the @link queue::init
+  /// @endlink and @link write @endlink methods of the @link queue @endlink class.
+  /// The data storage is created by the @link nu::int1::init @endlink method and destroyed by the
+  /// class destructor. An OpenCL **cl_mem** @link buffer @endlink object is initialized by the
+  /// @link kernel::setarg @endlink method upon the verification of the status of the @link ready
+  /// @endlink flag. The latter one serves as an indicator (internally managed by Neutrino) in order
+  /// allow the @link buffer @endlink initialization and to impede it during subsequents
+  /// calls of the @link kernel::setarg @endlink method.
+  std::vector<nu_double3_structure> data;                                                           ///< @brief **Data [GLdouble].**
+
+  /// @details **cl_mem** OpenCL memory buffer object. It does not contain user data. It is
+  /// internally used by Neutrino within the OpenCL mechanisms to define the properties of
+  /// the memory allocation on the client GPU.
+  cl_mem                            buffer;                                                         ///< @brief **Data memory buffer.**.
+
+  /// @details [OpenGL data Vertex Array Object]
+  /// (https://www.khronos.org/opengl/wiki/Vertex_Specification). Internally used by Neutrino.
+  GLuint                            vao;                                                            ///< @brief **OpenGL data Vertex Array Object.**
+
+  /// @details [OpenGL data Vertex Buffer Object]
+  /// (https://www.khronos.org/opengl/wiki/Shader_Storage_Buffer_Object).
+  /// Internally used by Neutrino.
+  GLuint                            ssbo;                                                           ///< @brief **OpenGL data Shader Storage Buffer Object.**
+
+  /// @details This flag serves as an indicator (internally managed by Neutrino) in order
+  /// allow the @link buffer @endlink initialization and to impede it during subsequents
+  /// calls of the @link kernel::setarg @endlink method. It is internally managed by Neutrino.
+  GLuint                            layout;                                                         ///< @brief **Data layout index [#].**
+
+  /// @details String name of the object instance. To be set by the user according to what
+  /// defined in the GLSL OpenGL shaders. Used to uniquely identify the object reference as
+  /// variable in the GLSL OpenGL shaders.
+  std::string                       name;                                                           ///< @brief **Data name.**
+
+  /// @details This flag serves as an indicator (internally managed by Neutrino) in order
+  /// allow the @link buffer @endlink initialization and to impede it during subsequents
+  /// calls of the @link kernel::setarg @endlink method. It is internally managed by Neutrino.
+  bool                              ready;                                                          ///< @brief **Buffer "ready" flag.**
+
+  /// @brief **Class constructor.**
+  /// @details It resets the @link ready @endlink. The initialization of the class must occur
+  /// after the initialization of the @link opencl @endlink and the @link opengl @endlink object,
+  /// therefore it must be done by invoking the @link nu::double3::init @endlink method.
+  double3 (
+          size_t loc_layout                                                                         ///< Kernel argument layout index.
+         );
+
+  /// @brief **Read text file function.**
+  /// @details Reads data from a text (or CSV) file and fills the data variable. If the data in the
+  /// file is longer than the data variable size, then the reading process is interrupted.
+  /// If the data in the file is shorter, than after filling the data variable with the data from
+  /// the file the data variable is filled with zeros. If the data variable is empty (and the
+  /// buffer is not "ready"), then it is sized as the data in the file. If the buffer is "ready",
+  /// then the data are also uploaded into it.
+  /// The data must be organized in lines of 3 **GLdouble** numbers,
+  /// separated by spaces, commas or semicolons: lines not starting with a number (comments,
+  /// headers) are skipped. The file is memory mapped and parsed by multiple threads.
+  void read (
+             std::string loc_file_directory,                                                        ///< File directory.
+             std::string loc_file_name                                                              ///< File name.
+            );
+
+  /// @brief **Load binary file function.**
+  /// @details Loads data from a binary file of raw double3 elements (as in the data variable) and
+  /// fills the data variable, with the same truncation, zero filling and sizing rules of the
+  /// @link read @endlink function. If the buffer is "ready", then the data are also uploaded
+  /// into it. The file is memory mapped: no parsing occurs.
+  void load (
+             std::string loc_file_directory,                                                        ///< File directory.
+             std::string loc_file_name                                                              ///< File name.
+            );
+
+  /// @brief **Class destructor.**
+  /// @details It deallocates the host PC memory previously allocated by the
+  /// @link nu::double3::init @endlink as data storage.
+  ~double3();
+};
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////// "double4" class ////////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class double4
+/// ### 4xN vector of "GLdouble" data.
+/// Declares a 4xN vector (N = data size) of "GLdouble" (double precision, 64-bit) data
+/// numbers. To be used by kernels needing double precision (e.g. stiff solvers): it requires
+/// a device with double precision support, checked when the kernel is built. In the kernels, it
+/// is a "__global double4*" argument. In the shaders, it is a "dvec4" vertex attribute.
+class double4 : public data                                                                              /// @brief **4xN vector of "GLdouble" data.**
+{
+private:
+
+public:
+  /// @details 4xN (N = data @link size @endlink ) **GLdouble** data storage.
+  /// These data are stored in the host PC memory.
+  /// They can be eventually exchanged between the client GPU by using the @link queue::init
+  /// @endlink and @link write @endlink methods of the @link queue @endlink class.
+  /// The data storage is created by the @link nu::int1::init @endlink method and destroyed by the
+  /// class destructor. An OpenCL **cl_mem** @link buffer @endlink object is initialized by the
+  /// @link kernel::setarg @endlink method upon the verification of the status of the @link ready
+  /// @endlink flag. The latter one serves as an indicator (internally managed by Neutrino) in order
+  /// allow the @link buffer @endlink initialization and to impede it during subsequents
+  /// calls of the @link kernel::setarg @endlink method.
+  std::vector<nu_double4_structure> data;                                                           ///< @brief **Data [GLdouble].**
+
+  /// @details **cl_mem** OpenCL memory buffer object. It does not contain user data. It is
+  /// internally used by Neutrino within the OpenCL mechanisms to define the properties of
+  /// the memory allocation on the client GPU.
+  cl_mem                            buffer;                                                         ///< @brief **Data memory buffer.**.
+
+  /// @details [OpenGL data Vertex Array Object]
+  /// (https://www.khronos.org/opengl/wiki/Vertex_Specification). Internally used by Neutrino.
+  GLuint                            vao;                                                            ///< @brief **OpenGL data Vertex Array Object.**
+
+  /// @details [OpenGL data Vertex Buffer Object]
+  /// (https://www.khronos.org/opengl/wiki/Shader_Storage_Buffer_Object).
+  /// Internally used by Neutrino.
+  GLuint                            ssbo;                                                           ///< @brief **OpenGL data Shader Storage Buffer Object.**
+
+  /// @details This flag serves as an indicator (internally managed by Neutrino) in order
+  /// allow the @link buffer @endlink initialization and to impede it during subsequents
+  /// calls of the @link kernel::setarg @endlink method. It is internally managed by Neutrino.
+  GLuint                            layout;                                                         ///< @brief **Data layout index [#].**
+
+  /// @details String name of the object instance. To be set by the user according to what
+  /// defined in the GLSL OpenGL shaders. Used to uniquely identify the object reference as
+  /// variable in the GLSL OpenGL shaders.
+  std::string                       name;                                                           ///< @brief **Data name.**
+
+  /// @details This flag serves as an indicator (internally managed by Neutrino) in order
+  /// allow the @link buffer @endlink initialization and to impede it during subsequents
+  /// calls of the @link kernel::setarg @endlink method. It is internally managed by Neutrino.
+  bool                              ready;                                                          ///< @brief **Buffer "ready" flag.**
+
+  /// @brief **Class constructor.**
+  /// @details It resets the @link ready @endlink. The initialization of the class must occur
+  /// after the initialization of the @link opencl @endlink and the @link opengl @endlink object,
+  /// therefore it must be done by invoking the @link nu::double4::init @endlink method.
+  double4 (
+          size_t loc_layout                                                                         ///< Kernel argument layout index.
+         );
+
+  /// @brief **Read text file function.**
+  /// @details Reads data from a text (or CSV) file and fills the data variable. If the data in the
+  /// file is longer than the data variable size, then the reading process is interrupted.
+  /// If the data in the file is shorter, than after filling the data variable with the data from
+  /// the file the data variable is filled with zeros. If the data variable is empty (and the
+  /// buffer is not "ready"), then it is sized as the data in the file. If the buffer is "ready",
+  /// then the data are also uploaded into it.
+  /// The data must be organized in lines of 4 **GLdouble** numbers,
+  /// separated by spaces, commas or semicolons: lines not starting with a number (comments,
+  /// headers) are skipped. The file is memory mapped and parsed by multiple threads.
+  void read (
+             std::string loc_file_directory,                                                        ///< File directory.
+             std::string loc_file_name                                                              ///< File name.
+            );
+
+  /// @brief **Load binary file function.**
+  /// @details Loads data from a binary file of raw double4 elements (as in the data variable) and
+  /// fills the data variable, with the same truncation, zero filling and sizing rules of the
+  /// @link read @endlink function. If the buffer is "ready", then the data are also uploaded
+  /// into it. The file is memory mapped: no parsing occurs.
+  void load (
+             std::string loc_file_directory,                                                        ///< File directory.
+             std::string loc_file_name                                                              ///< File name.
+            );
+
+  /// @brief **Class destructor.**
+  /// @details It deallocates the host PC memory previously allocated by the
+  /// @link nu::double4::init @endlink as data storage.
+  ~double4();
+};
+
+/// @brief **Half precision converter.**
+/// @details Converts a **GLfloat** number to a **GLhalf** (half precision, 16-bit) number, rounding
+/// to the nearest even. Used to fill the host data of the @link nu::half1 @endlink and
+/// @link nu::half4 @endlink classes.
+GLhalf  half (
+              GLfloat loc_value                                                                     ///< Single precision number.
+             );
+
+/// @brief **Single precision converter.**
+/// @details Converts a **GLhalf** (half precision, 16-bit) number to a **GLfloat** number. Used to
+/// read the host data of the @link nu::half1 @endlink and @link nu::half4 @endlink classes.
+GLfloat single (
+                GLhalf loc_value                                                                    ///< Half precision number.
+               );
 }
 #endif
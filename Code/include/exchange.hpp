@@ -0,0 +1,96 @@
+/// @file     exchange.hpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Declaration of a frame "exchange" class.
+///
+/// @details  A Neutrino "exchange" hands off the rendered data from a compute thread to the
+/// render thread through a lock-free [triple buffer](https://en.wikipedia.org/wiki/Multiple_buffering#Triple_buffering):
+/// the compute thread fills the "back" slot and publishes it, the render thread draws from the
+/// "front" slot and takes the latest published slot, if any, at each frame. The two threads
+/// never wait for each other: a slow simulation step (e.g. 200 ms) does not slow down the
+/// interaction and the rendering does not subtract time from the computation. GLFW needs the
+/// window and its events on the main thread, therefore the OpenGL context stays on the main
+/// (render) thread and the OpenCL computation runs on its own thread, in NU_RENDER_THREADED
+/// render mode. The @link publish @endlink method acquires the source buffer by itself, therefore
+/// it is invoked after the @link opencl::release @endlink call:
+///
+///     gui->set_render (NU_RENDER_THREADED);
+///     X->init (position);                                        // Render thread.
+///     std::thread compute ([&] {while(run) {cl->acquire (); cl->execute (K, NU_WAIT); cl->release (); X->publish ();}});
+///     while(!gui->closed ())
+///     {
+///       X->update (); gui->clear (); X->bind (0); gui->plot (S); gui->refresh (); gui->poll_events ();
+///     }
+
+#ifndef exchange_hpp
+#define exchange_hpp
+
+#include "neutrino.hpp"
+#include "data_classes.hpp"
+#include <atomic>
+
+namespace nu
+{
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////// "exchange" class /////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class exchange
+/// ### Frame exchange.
+/// Declares a lock-free triple buffer of OpenGL buffers.
+/// To be used to hand off rendered data from a compute thread to the render thread.
+class exchange : public neutrino                                                                    /// @brief **Frame exchange.**
+{
+private:
+  nu::float4*                      source;                                                          ///< @brief **Source data.**
+  size_t                           size;                                                            ///< @brief **Slot size [bytes].**
+  GLuint                           slot[3];                                                         ///< @brief **Slot OpenGL buffers.**
+  cl_mem                           slot_buffer[3];                                                  ///< @brief **Slot OpenCL buffers (interop).**
+  std::vector<nu_float4_structure> slot_data[3];                                                    ///< @brief **Slot host data (non-interop).**
+  size_t                           slot_generation[3];                                              ///< @brief **Slot generations.**
+  std::atomic<GLuint>              middle;                                                          ///< @brief **Middle slot index | NU_EXCHANGE_FRESH flag.**
+  GLuint                           back;                                                            ///< @brief **Back slot index (compute thread).**
+  GLuint                           front;                                                           ///< @brief **Front slot index (render thread).**
+
+public:
+  std::atomic<size_t>              published;                                                       ///< @brief **Last published generation (compute thread) [#].**
+  std::atomic<size_t>              generation;                                                      ///< @brief **Front slot generation (render thread) [#].**
+  bool                             ready;                                                           ///< @brief **Exchange "ready" flag.**
+
+  /// @brief **Class constructor.**
+  /// @details It does nothing. The slots are created by the @link init @endlink method.
+  exchange ();
+
+  /// @brief **Exchange initializer.**
+  /// @details Creates the three slots, of the size of the source data, initialized with the
+  /// source data. The source data must have been already set as kernel argument. To be invoked
+  /// on the render thread.
+  void init (
+             nu::float4* loc_source                                                                 ///< Source data.
+            );
+
+  /// @brief **Publisher.**
+  /// @details Copies the source data in the back slot and publishes it as the latest frame.
+  /// In interop mode, the source buffer and the back slot are acquired together for the copy.
+  /// Waits for the copy to complete. To be invoked on the compute thread, after the release of
+  /// the data (@link opencl::release @endlink).
+  void publish ();
+
+  /// @brief **Updater.**
+  /// @details Takes the latest published slot as front slot, if a new one has been published
+  /// since the last update. Returns true if the front slot has changed. To be invoked on the
+  /// render thread, before the plot.
+  bool update ();
+
+  /// @brief **Binder.**
+  /// @details Binds the front slot as shader argument of the given layout index, in place of the
+  /// source data. To be invoked on the render thread, before the plot.
+  void bind (
+             GLuint loc_layout_index                                                                ///< OpenGL shader layout index.
+            );
+
+  /// @brief **Class destructor.**
+  /// @details Releases the slots.
+  ~exchange ();
+};
+}
+#endif
@@ -8,13 +8,18 @@
 /// got methods to set arguments on the OpenCL kernel: this operation tells Neutrino which are the
 /// arguments present in the @link thekernel @endlink function of the kernel source file.
 /// The argument in the kernel object must correspond to the argument in the OpenCL kernel
-/// source file.
+/// source file. The kernel source files can be watched for changes, to hot reload the kernel
+/// while the simulation is running (@link watch @endlink).
 
 #ifndef kernel_hpp
 #define kernel_hpp
 
 #include "neutrino.hpp"
 #include "data_classes.hpp"
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <filesystem>
 
 namespace nu
 {
@@ -30,11 +35,86 @@ class kernel : public neutrino
 private:
   cl_device_id*            device_id;                                                               ///< @brief **Device ID array.**
 
+  /// @brief **Fusion preamble generator.**
+  /// @details Generates the "NU_ARGS" (kernel parameter list) and "NU_PASS" (kernel argument
+  /// names) macros from the data container: argument "i" is the i-th container object.
+  std::string preamble ();
+
+  /// @brief **Fused entry point generator.**
+  /// @details Generates the @link thekernel @endlink function calling the fused device functions
+  /// in sequence, on the same work-item.
+  std::string entry ();
+
+  /// @brief **Precision preamble generator.**
+  /// @details Generates the "NU_ACCUMULATOR" macro, for mixed precision kernels accumulating in
+  /// double precision: "double" (with the cl_khr_fp64 extension enabled) if the device supports
+  /// double precision, "float" otherwise.
+  std::string precision ();
+
+  /// @brief **Argument binder.**
+  /// @details Sets a data buffer as argument on all kernel entry points having that argument
+  /// index: entry points with fewer parameters are skipped.
+  void        bind (
+                    GLuint  loc_layout_index,                                                       ///< Layout index.
+                    cl_mem* loc_buffer                                                              ///< Data buffer.
+                   );
+
+  /// @brief **Program compiler.**
+  /// @details Creates an OpenCL program from the given kernel sources (plus the precision
+  /// preamble and the fusion preamble and entry point, if any) and builds it. On error, returns
+  /// the error code and the compiler log, with a NULL program. Does not print nor exit: it can run on the watcher thread.
+  cl_int      compile (
+                       std::vector<std::string> loc_kernel_source,                                  ///< Kernel sources.
+                       cl_program*              loc_program,                                        ///< Built program.
+                       std::string&             loc_log                                             ///< Compiler log.
+                      );
+
+  /// @brief **Compiler options generator.**
+  /// @details Generates the "-D" options of the device macros (if @link specialize @endlink is
+  /// set) and of the user macros (see @link define @endlink), appended to the @link
+  /// compiler_options @endlink at each build.
+  std::string options ();
+
+  /// @brief **Argument rebinder.**
+  /// @details Sets the buffers of all bound arguments (see @link bind @endlink) on the given entry
+  /// points, at their layout indices. Returns the first OpenCL error code (e.g. an edited kernel
+  /// with a different argument signature), without exiting: it is used by @link reload @endlink.
+  cl_int      rebind (
+                      std::vector<cl_kernel>& loc_entry_id,                                         ///< Entry point ids.
+                      std::vector<cl_uint>&   loc_entry_args                                        ///< Entry point number of arguments.
+                     );
+
+  /// @brief **Source file watcher loop.**
+  /// @details Polls the modification time of the source files every @link
+  /// NU_KERNEL_WATCH_PERIOD @endlink and rebuilds the program when they change, for @link reload
+  /// @endlink. Runs on the watcher thread.
+  void        loop ();
+
+  std::vector<cl_uint>                         entry_args;                                          ///< @brief **Number of arguments of each entry point [#].**
+  std::vector<std::string>                     source_file;                                         ///< @brief **Kernel source file names.**
+  std::vector<size_t>                          source_index;                                        ///< @brief **Kernel source indices of the source files [#].**
+  std::vector<cl_mem*>                         bound_buffer;                                        ///< @brief **Bound argument buffers, per layout index (NULL = unbound).**
+  std::vector<std::filesystem::file_time_type> source_time;                                         ///< @brief **Kernel source file modification times.**
+  std::vector<std::string>                     pending_source;                                      ///< @brief **Changed kernel sources, waiting for reload.**
+  cl_program                                   pending_program;                                     ///< @brief **Rebuilt program, waiting for reload (NULL = build error).**
+  std::string                                  pending_log;                                         ///< @brief **Rebuilt program compiler log.**
+  std::thread                                  watcher;                                             ///< @brief **Source file watcher thread.**
+  std::mutex                                   pending_lock;                                        ///< @brief **Rebuilt program and kernel sources lock.**
+  std::atomic<bool>                            pending;                                             ///< @brief **"Rebuilt program" flag.**
+  std::atomic<bool>                            watching;                                            ///< @brief **"Watcher running" flag.**
+  std::vector<std::string>                     define_name;                                         ///< @brief **User macro names.**
+  std::vector<std::string>                     define_value;                                        ///< @brief **User macro values.**
+
 public:
-  cl_kernel                kernel_id;                                                               ///< @brief **Kernel id.**
+  cl_kernel                kernel_id;                                                               ///< @brief **Kernel id (default entry point).**
+  std::vector<std::string> entry_name;                                                              ///< @brief **Kernel entry point names [std::string].**
+  std::vector<cl_kernel>   entry_id;                                                                ///< @brief **Kernel entry point ids.**
   std::vector<std::string> kernel_source;                                                           ///< @brief **Kernel source array [std::string].**
   std::string              compiler_options;                                                        ///< @brief **OpenCL JIT complier options string [std::string].**
   std::string              compiler_log;                                                            ///< @brief **OpenCL JIT compiler error log [std::string].**
+  bool                     specialize;                                                              ///< @brief **Device specialization flag (device macros).**
+  std::vector<std::string> fused_function;                                                          ///< @brief **Fused device function names [std::string].**
+  std::string              fused_state;                                                             ///< @brief **Fused private state type [std::string].**
   cl_program               program;                                                                 ///< @brief **Kernel program.**
   size_t                   size_i;                                                                  ///< @brief **Kernel size (i-index) [#].**
   size_t                   size_j;                                                                  ///< @brief **Kernel size (j-index) [#].**
@@ -56,14 +136,94 @@ public:
                   std::string loc_kernel_file_name                                                  ///< OpenCL kernel file name.
                  );
 
+  /// @brief **Kernel entry point adder function.**
+  /// @details Adds the name of a "__kernel" function to be created from the program, so that
+  /// several entry points share the same compiled binary. NU_KERNEL_ALL creates all the entry
+  /// points in the program. If no entry is added, only @link thekernel @endlink is created.
+  /// The default @link kernel_id @endlink is @link thekernel @endlink, if present, otherwise the
+  /// first entry point. Container objects are set as arguments on all entry points, with the
+  /// same layout: the parameter list of each entry point must be a prefix of it.
+  void addentry (
+                 std::string loc_entry_name                                                         ///< OpenCL kernel entry point name.
+                );
+
+  /// @brief **Kernel entry point getter function.**
+  /// @details Returns the kernel id of an entry point, by name.
+  cl_kernel getentry (
+                      std::string loc_entry_name                                                    ///< OpenCL kernel entry point name.
+                     );
+
+  /// @brief **Kernel fusion function.**
+  /// @details Fuses several per-element device functions, sharing the same NDRange, into one
+  /// generated @link thekernel @endlink entry point: the functions are called in sequence by each
+  /// work-item, therefore a time step made of N element-wise phases needs a single launch and
+  /// the intermediate fields can be kept in registers instead of global memory.
+  /// Each device function must be declared in the kernel sources as:
+  ///
+  ///     void phase (NU_ARGS, state_type* s)
+  ///
+  /// being "NU_ARGS" a macro expanding to the kernel parameter list ("arg_0", "arg_1", ...)
+  /// generated from the data container and "state_type" a user defined private structure holding
+  /// the intermediates (the "state_type* s" parameter is omitted if no state type is given).
+  /// The "NU_PASS" macro expands to the argument names, to call other functions. Phases reading
+  /// other elements' results of a previous phase (e.g. neighbours) can not be fused, because
+  /// there is no global synchronization between work-items.
+  void fuse (
+             std::vector<std::string> loc_function,                                                 ///< Device function names (in execution order).
+             std::string              loc_state                                                     ///< Private state type ("" = no state).
+            );
+
+  /// @brief **Kernel macro definer.**
+  /// @details Defines a compile-time constant (e.g. a mesh size) as a "-D" compiler option, so
+  /// that the kernel can be specialized and its loops unrolled at JIT time. Defining the same
+  /// macro again replaces its value; an empty value defines the macro alone.
+  void define (
+               std::string loc_name,                                                                ///< Macro name.
+               std::string loc_value                                                                ///< Macro value.
+              );
+
+  /// @overload define(std::string loc_name, double loc_value)
+  /// @details Defines a numeric compile-time constant (integers are printed without decimals).
+  void define (
+               std::string loc_name,                                                                ///< Macro name.
+               double      loc_value                                                                ///< Macro value.
+              );
+
   /// @brief **OpenCL kernel builder.**
-  /// @details Creates an OpenCL program from the kernel sources and builds it.
+  /// @details Creates an OpenCL program from the kernel sources and builds it. If @link
+  /// specialize @endlink is set, the program is specialized for the selected device with the
+  /// macros: NU_DEVICE_FLOAT_WIDTH (preferred float vector width), NU_DEVICE_COMPUTE_UNITS,
+  /// NU_DEVICE_LOCAL_MEM (local memory size [bytes]), NU_DEVICE_MAX_GROUP (maximum work-group
+  /// size), NU_DEVICE_GROUP_SIZE (chosen work-group size: largest power of 2 within the device
+  /// limit and @link NU_KERNEL_GROUP_SIZE @endlink), NU_DEVICE_FP64 (double precision available:
+  /// 1 or 0) and NU_KERNEL_SIZE_I, NU_KERNEL_SIZE_J, NU_KERNEL_SIZE_K (kernel sizes).
   void build (
               size_t loc_kernel_size_i,                                                             ///< OpenCL kernel size (i-index).
               size_t loc_kernel_size_j,                                                             ///< OpenCL kernel size (j-index).
               size_t loc_kernel_size_k                                                              ///< OpenCL kernel size (k-index).
              );
 
+  /// @brief **Source file watcher.**
+  /// @details Starts (or stops) a background thread watching the kernel source files for changes.
+  /// The changed sources are rebuilt in background and swapped by the @link reload @endlink
+  /// method, between launches. Only the sources added from file (see @link addsource @endlink)
+  /// are read again: the ones pushed in @link kernel_source @endlink directly are kept.
+  void watch (
+              bool loc_watch                                                                        ///< "Watch" flag.
+             );
+
+  /// @brief **Hot reloader.**
+  /// @details Swaps the rebuilt program, if any, in place of the current one: the same entry
+  /// points are created from it and the data objects are set again as their arguments, on the
+  /// same device buffers, so that the simulation state is preserved. On build error (or if the
+  /// bound arguments cannot be set on the rebuilt entry points, e.g. after a change of argument
+  /// signature), sets the @link compiler_log @endlink, prints a warning and keeps the current
+  /// program, without exiting.
+  /// Returns true if the kernel has been swapped. Called by @link opencl::execute @endlink. The
+  /// entry point ids previously returned by @link getentry @endlink are no longer valid after a
+  /// swap.
+  bool reload ();
+
   /// @brief **Kernel argument setter function.**
   /// @details Sets an argument on the Neutrino kernel object. The argument in the kernel object
   /// must correspond to the argument in the OpenCL kernel source file.
@@ -192,6 +352,134 @@ public:
                GLuint      loc_layout_index                                                         ///< Layout index.
               );
 
+  /// @overload setarg(nu::half1* loc_data, cl_uint loc_layout_index)
+  /// @details Sets an argument on the Neutrino kernel object. The argument in the kernel object
+  /// must correspond to the argument in the OpenCL kernel source file.
+  /// This operation tells Neutrino which are the arguments present in the @link thekernel @endlink
+  /// function of the kernel source file.
+  /// The setter function has two arguments:
+  /// - **loc_data**, which contains the user data to be exchanged between the host PC and the
+  ///   client GPU.
+  /// - **loc_layout_index**, which is an integer incremental number starting from 0 and specified
+  ///   by the user for each instace of this function. This number tells Neutrino the place of the
+  ///   argument in the @link thekernel @endlink function of the kernel source file.
+  void setarg (
+               nu::half1* loc_data,                                                                 ///< nu::half1 data.
+               GLuint     loc_layout_index                                                          ///< Layout index.
+              );
+
+  /// @overload setarg(nu::half4* loc_data, cl_uint loc_layout_index)
+  /// @details Sets an argument on the Neutrino kernel object. The argument in the kernel object
+  /// must correspond to the argument in the OpenCL kernel source file.
+  /// This operation tells Neutrino which are the arguments present in the @link thekernel @endlink
+  /// function of the kernel source file.
+  /// The setter function has two arguments:
+  /// - **loc_data**, which contains the user data to be exchanged between the host PC and the
+  ///   client GPU.
+  /// - **loc_layout_index**, which is an integer incremental number starting from 0 and specified
+  ///   by the user for each instace of this function. This number tells Neutrino the place of the
+  ///   argument in the @link thekernel @endlink function of the kernel source file.
+  void setarg (
+               nu::half4* loc_data,                                                                 ///< nu::half4 data.
+               GLuint     loc_layout_index                                                          ///< Layout index.
+              );
+
+  /// @overload setarg(nu::short4* loc_data, cl_uint loc_layout_index)
+  /// @details Sets an argument on the Neutrino kernel object. The argument in the kernel object
+  /// must correspond to the argument in the OpenCL kernel source file.
+  /// This operation tells Neutrino which are the arguments present in the @link thekernel @endlink
+  /// function of the kernel source file.
+  /// The setter function has two arguments:
+  /// - **loc_data**, which contains the user data to be exchanged between the host PC and the
+  ///   client GPU.
+  /// - **loc_layout_index**, which is an integer incremental number starting from 0 and specified
+  ///   by the user for each instace of this function. This number tells Neutrino the place of the
+  ///   argument in the @link thekernel @endlink function of the kernel source file.
+  void setarg (
+               nu::short4* loc_data,                                                                ///< nu::short4 data.
+               GLuint      loc_layout_index                                                         ///< Layout index.
+              );
+
+  /// @overload setarg(nu::uchar4* loc_data, cl_uint loc_layout_index)
+  /// @details Sets an argument on the Neutrino kernel object. The argument in the kernel object
+  /// must correspond to the argument in the OpenCL kernel source file.
+  /// This operation tells Neutrino which are the arguments present in the @link thekernel @endlink
+  /// function of the kernel source file.
+  /// The setter function has two arguments:
+  /// - **loc_data**, which contains the user data to be exchanged between the host PC and the
+  ///   client GPU.
+  /// - **loc_layout_index**, which is an integer incremental number starting from 0 and specified
+  ///   by the user for each instace of this function. This number tells Neutrino the place of the
+  ///   argument in the @link thekernel @endlink function of the kernel source file.
+  void setarg (
+               nu::uchar4* loc_data,                                                                ///< nu::uchar4 data.
+               GLuint      loc_layout_index                                                         ///< Layout index.
+              );
+
+  /// @overload setarg(nu::double1* loc_data, cl_uint loc_layout_index)
+  /// @details Sets an argument on the Neutrino kernel object. The argument in the kernel object
+  /// must correspond to the argument in the OpenCL kernel source file.
+  /// This operation tells Neutrino which are the arguments present in the @link thekernel @endlink
+  /// function of the kernel source file.
+  /// The setter function has two arguments:
+  /// - **loc_data**, which contains the user data to be exchanged between the host PC and the
+  ///   client GPU.
+  /// - **loc_layout_index**, which is an integer incremental number starting from 0 and specified
+  ///   by the user for each instace of this function. This number tells Neutrino the place of the
+  ///   argument in the @link thekernel @endlink function of the kernel source file.
+  void setarg (
+               nu::double1* loc_data,                                                               ///< nu::double1 data.
+               GLuint       loc_layout_index                                                        ///< Layout index.
+              );
+
+  /// @overload setarg(nu::double2* loc_data, cl_uint loc_layout_index)
+  /// @details Sets an argument on the Neutrino kernel object. The argument in the kernel object
+  /// must correspond to the argument in the OpenCL kernel source file.
+  /// This operation tells Neutrino which are the arguments present in the @link thekernel @endlink
+  /// function of the kernel source file.
+  /// The setter function has two arguments:
+  /// - **loc_data**, which contains the user data to be exchanged between the host PC and the
+  ///   client GPU.
+  /// - **loc_layout_index**, which is an integer incremental number starting from 0 and specified
+  ///   by the user for each instace of this function. This number tells Neutrino the place of the
+  ///   argument in the @link thekernel @endlink function of the kernel source file.
+  void setarg (
+               nu::double2* loc_data,                                                               ///< nu::double2 data.
+               GLuint       loc_layout_index                                                        ///< Layout index.
+              );
+
+  /// @overload setarg(nu::double3* loc_data, cl_uint loc_layout_index)
+  /// @details Sets an argument on the Neutrino kernel object. The argument in the kernel object
+  /// must correspond to the argument in the OpenCL kernel source file.
+  /// This operation tells Neutrino which are the arguments present in the @link thekernel @endlink
+  /// function of the kernel source file.
+  /// The setter function has two arguments:
+  /// - **loc_data**, which contains the user data to be exchanged between the host PC and the
+  ///   client GPU.
+  /// - **loc_layout_index**, which is an integer incremental number starting from 0 and specified
+  ///   by the user for each instace of this function. This number tells Neutrino the place of the
+  ///   argument in the @link thekernel @endlink function of the kernel source file.
+  void setarg (
+               nu::double3* loc_data,                                                               ///< nu::double3 data.
+               GLuint       loc_layout_index                                                        ///< Layout index.
+              );
+
+  /// @overload setarg(nu::double4* loc_data, cl_uint loc_layout_index)
+  /// @details Sets an argument on the Neutrino kernel object. The argument in the kernel object
+  /// must correspond to the argument in the OpenCL kernel source file.
+  /// This operation tells Neutrino which are the arguments present in the @link thekernel @endlink
+  /// function of the kernel source file.
+  /// The setter function has two arguments:
+  /// - **loc_data**, which contains the user data to be exchanged between the host PC and the
+  ///   client GPU.
+  /// - **loc_layout_index**, which is an integer incremental number starting from 0 and specified
+  ///   by the user for each instace of this function. This number tells Neutrino the place of the
+  ///   argument in the @link thekernel @endlink function of the kernel source file.
+  void setarg (
+               nu::double4* loc_data,                                                               ///< nu::double4 data.
+               GLuint       loc_layout_index                                                        ///< Layout index.
+              );
+
   /// @brief **Class destructor.**
   /// @details Releases the OpenCL kernel object, releases the OpenCL kernel event,
   /// releases the OpenCL program, releases the device ID array.
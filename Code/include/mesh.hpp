@@ -14,6 +14,7 @@
 #include "neutrino.hpp"
 #include "data_classes.hpp"
 #include <gmsh.h>
+#include <array>
 
 /// @brief    **Data structure. Internally used by Neutrino.**
 /// @details  This structure is used as data storage in the node array. It is tightly packed to be
@@ -251,6 +252,9 @@ public:
   std::vector<nu_float4_structure>  neighbour_link;                                                 ///< Neighbour links.
   std::vector<GLfloat>              neighbour_length;                                               ///< Neighbour link lengths.
 
+  std::vector<GLint>                edge;                                                           ///< Edge node index pairs (GL_LINES).
+  std::vector<GLint>                triangle;                                                       ///< Boundary triangle node index triples (GL_TRIANGLES).
+
   mesh (
         std::string loc_file_name                                                                   ///< GMSH .msh file name.
        );
@@ -0,0 +1,168 @@
+/// @file     multidevice.hpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Declaration of a "multidevice" domain decomposition class.
+///
+/// @details  A Neutrino "multidevice" runs the same kernel on several OpenCL devices (e.g. two
+/// GPUs and a CPU, or the CPU sub-devices) sharing one OpenCL context, each one on a partition of
+/// a mesh. The mesh nodes are ordered by a breadth-first visit of the @link mesh::neighbour
+/// @endlink connectivity and cut in contiguous partitions, sized proportionally to the device
+/// weights (compute units times clock frequency, by default). Each partition stores its own nodes
+/// followed by its "halo": the neighbours owned by other partitions. After each step, the halo
+/// nodes are packed on the owner device and copied to the devices needing them, on the device
+/// queues, synchronized by events.
+///
+/// The kernel runs on the owned nodes of each partition (global size = number of owned nodes)
+/// and receives the partition local connectivity and fields as arguments:
+///
+///     __kernel void thekernel (__global int*    neighbour,        // Local neighbour indices.
+///                              __global int*    neighbour_offset, // Local neighbour end offsets.
+///                              __global float4* neighbour_link,   // Neighbour links.
+///                              __global float*  neighbour_length, // Neighbour link lengths.
+///                              __global float4* field_0,          // Fields (owned + halo), in
+///                              __global float4* field_1, ...)     // "addfield" order.
+///
+/// The multidevice context has no OpenGL interoperability: the fields are brought back to the
+/// host by @link gather @endlink, e.g. for plotting.
+///
+/// A scaling run, on the CPU split in N sub-devices (one compute unit each) standing in for N
+/// devices, compares the step time of N = 1, 2, 4... partitions on the same mesh:
+///
+///     cl_device_partition_property prop[] = {CL_DEVICE_PARTITION_EQUALLY, 1, 0};
+///     cl_uint                      n;
+///     clCreateSubDevices (cpu, prop, 0, NULL, &n);                // Getting number of sub-devices.
+///     std::vector<cl_device_id>    sub (n);
+///     clCreateSubDevices (cpu, prop, n, sub.data (), NULL);       // Creating sub-devices.
+///     sub.resize (N);                                             // Using N of them.
+///     M->init (sub); M->partition (mesh); M->addfield (position); M->addsource ("kernel.cl");
+///     M->build ();
+///     for(s = 0; s < steps; s++) {M->step (); t += M->step_time; h += M->halo_time;}
+///     std::cout << N << " " << t/steps << " " << h/steps << " " << M->halo_size << std::endl;
+
+#ifndef multidevice_hpp
+#define multidevice_hpp
+
+#include "neutrino.hpp"
+#include "data_classes.hpp"
+#include "mesh.hpp"
+#include <chrono>
+
+namespace nu
+{
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////// "multidevice" class ///////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class multidevice
+/// ### Multi-device domain decomposition.
+/// Declares a multi-device domain decomposition of a mesh.
+/// To be used to run a kernel on several OpenCL devices at once.
+class multidevice : public neutrino                                                                 ///< @brief **Multi-device domain decomposition.**
+{
+private:
+  cl_context                       context;                                                         ///< @brief **Multi-device OpenCL context.**
+  std::vector<cl_command_queue>    queue;                                                           ///< @brief **Device queues (profiling).**
+  cl_program                       program;                                                         ///< @brief **Kernel program (all devices).**
+  cl_program                       pack_program;                                                    ///< @brief **Halo pack program (all devices).**
+  std::vector<cl_kernel>           kernel;                                                          ///< @brief **Partition kernels.**
+  std::vector<cl_kernel>           pack_kernel;                                                     ///< @brief **Partition halo pack kernels.**
+  std::vector<std::string>         kernel_source;                                                   ///< @brief **Kernel sources.**
+  std::vector<nu::float4*>         field;                                                           ///< @brief **Fields (host data).**
+  std::vector<std::vector<GLint> > node;                                                            ///< @brief **Partition global node indices (owned, then halo).**
+  std::vector<size_t>              owned;                                                           ///< @brief **Partition number of owned nodes [#].**
+  std::vector<std::vector<GLint> > local_neighbour;                                                 ///< @brief **Partition local neighbour indices.**
+  std::vector<std::vector<GLint> > local_offset;                                                    ///< @brief **Partition local neighbour end offsets.**
+  std::vector<std::vector<nu_float4_structure> > local_link;                                        ///< @brief **Partition neighbour links.**
+  std::vector<std::vector<GLfloat> > local_length;                                                  ///< @brief **Partition neighbour link lengths.**
+  std::vector<cl_mem>              neighbour_buffer;                                                ///< @brief **Partition neighbour buffers.**
+  std::vector<cl_mem>              offset_buffer;                                                   ///< @brief **Partition neighbour offset buffers.**
+  std::vector<cl_mem>              link_buffer;                                                     ///< @brief **Partition neighbour link buffers.**
+  std::vector<cl_mem>              length_buffer;                                                   ///< @brief **Partition neighbour length buffers.**
+  std::vector<std::vector<cl_mem> > field_buffer;                                                   ///< @brief **Partition field buffers [partition][field].**
+  std::vector<size_t>              halo_source;                                                     ///< @brief **Halo exchange source (owner) partitions.**
+  std::vector<size_t>              halo_target;                                                     ///< @brief **Halo exchange target partitions.**
+  std::vector<size_t>              halo_start;                                                      ///< @brief **Halo exchange first target local index.**
+  std::vector<std::vector<GLint> > halo_index;                                                      ///< @brief **Halo exchange source local indices.**
+  std::vector<cl_mem>              halo_index_buffer;                                               ///< @brief **Halo exchange source local index buffers.**
+  std::vector<cl_mem>              halo_send_buffer;                                                ///< @brief **Halo exchange packed send buffers (all fields).**
+
+  /// @brief **Build releaser.**
+  /// @details Releases the programs, kernels and buffers created by @link build @endlink, if any.
+  void release ();
+
+  /// @brief **Halo exchange.**
+  /// @details Packs the halo nodes of all fields on the owner devices and copies them to the
+  /// target devices, after the kernels: the packs wait for the partition kernel events (NULL
+  /// = no kernel on that partition). Does nothing if no fields have been added.
+  void exchange (
+                 std::vector<cl_event>& loc_kernel_event                                            ///< Partition kernel events.
+                );
+
+public:
+  std::vector<cl_device_id>        device;                                                          ///< @brief **Devices (one partition each).**
+  std::vector<double>              weight;                                                          ///< @brief **Device weights (partition sizes) [].**
+  std::vector<double>              compute_time;                                                    ///< @brief **Last step device kernel time [s].**
+  double                           step_time;                                                       ///< @brief **Last step time (kernels + halo exchange) [s].**
+  double                           halo_time;                                                       ///< @brief **Last step halo exchange time (step - slowest kernel) [s].**
+  size_t                           halo_size;                                                       ///< @brief **Total number of halo nodes [#].**
+  std::vector<GLint>               part;                                                            ///< @brief **Node partition indices.**
+  std::string                      compiler_options;                                                ///< @brief **OpenCL JIT compiler options.**
+  bool                             ready;                                                           ///< @brief **Multidevice "ready" flag.**
+
+  /// @brief **Class constructor.**
+  /// @details It does nothing. The context is created by the @link init @endlink method.
+  multidevice ();
+
+  /// @brief **Multidevice initializer.**
+  /// @details Creates one OpenCL context and one profiling queue per device. The devices must
+  /// belong to the same platform. The default device @link weight @endlink is the number of
+  /// compute units times the clock frequency.
+  void init (
+             std::vector<cl_device_id> loc_device                                                   ///< Devices.
+            );
+
+  /// @brief **Mesh partitioner.**
+  /// @details Partitions the mesh nodes among the devices, proportionally to their @link weight
+  /// @endlink, and builds the partition local connectivity and the halo exchange lists.
+  void partition (
+                  nu::mesh* loc_mesh                                                                ///< Mesh.
+                 );
+
+  /// @brief **Field adder.**
+  /// @details Adds a node field (one entry per mesh node), exchanged at each step. The fields are
+  /// passed to the kernel after the connectivity, in the order they are added.
+  void addfield (
+                 nu::float4* loc_field                                                              ///< Field.
+                );
+
+  /// @brief **Kernel source adder.**
+  /// @details Loads an OpenCL kernel source from its file.
+  void addsource (
+                  std::string loc_kernel_file_name                                                  ///< OpenCL kernel file name.
+                 );
+
+  /// @brief **Multidevice builder.**
+  /// @details Builds the kernel program for all devices and creates the partition buffers, from
+  /// the host data of the fields. Each field must have one entry per mesh node. A previous build,
+  /// if any, is released first.
+  void build ();
+
+  /// @brief **Step.**
+  /// @details Runs the kernel on all partitions at once, then exchanges the halo nodes. Updates
+  /// the @link compute_time @endlink, @link halo_time @endlink and @link step_time @endlink
+  /// scaling figures.
+  void step ();
+
+  /// @brief **Field writer.**
+  /// @details Writes the host data of all fields to the partitions (owned and halo nodes).
+  void write ();
+
+  /// @brief **Field gatherer.**
+  /// @details Reads the owned nodes of all fields from the partitions to the host data.
+  void gather ();
+
+  /// @brief **Class destructor.**
+  /// @details Releases the OpenCL objects.
+  ~multidevice ();
+};
+}
+#endif
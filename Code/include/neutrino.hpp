@@ -57,11 +57,62 @@
 #define NU_IOD                            0.02f                                                     ///< Intraocular distance.
 #define NU_SCREEN_DISTANCE                -2.5f                                                     ///< Screen distance.
 #define NU_LINE_WIDTH                     3                                                         ///< Line width [px].
+#define NU_CAMERA_BLOCK                   "nu_camera"                                               ///< Camera uniform block name (GLSL std140).
+#define NU_CAMERA_BINDING                 0                                                         ///< Camera uniform buffer binding point.
+#define NU_CULL_GROUP_SIZE                256                                                       ///< Culling compute shader work-group size [#].
+#define NU_CULL_MAX_LEVEL                 8                                                         ///< Maximum level of detail decimation level (1 point every 2^level).
+#define NU_PACING_MAX_STEPS               1000                                                      ///< Maximum number of compute steps per rendered frame [#].
+#define NU_PACING_SMOOTHING               0.1                                                       ///< Frame pacing time smoothing factor (exponential moving average) [].
+#define NU_CAPTURE_FPS                    30                                                        ///< Frame capture video frame rate (Y4M header) [frames/s].
+#define NU_CAPTURE_QUEUE                  8                                                         ///< Frame capture maximum number of queued frames [#].
+#define NU_EXCHANGE_FRESH                 4                                                         ///< Frame exchange "fresh slot" flag (bit above the slot index).
+#define NU_SHADER_WATCH_PERIOD            500                                                       ///< Shader source file watcher polling period [ms].
+#define NU_KERNEL_WATCH_PERIOD            500                                                       ///< Kernel source file watcher polling period [ms].
+#define NU_KERNEL_GROUP_SIZE              256                                                       ///< Specialized kernel work-group size upper bound [#].
+#define NU_SNAPSHOT_MAGIC                 "NUSNAPSH"                                                ///< Snapshot file magic string (8 characters).
+#define NU_SNAPSHOT_VERSION               1                                                         ///< Snapshot file format version.
+#define NU_SNAPSHOT_ALIGN                 4096                                                      ///< Snapshot file data block alignment [bytes].
+#define NU_OUTPUT_RING                    4                                                         ///< Output ring of pinned staging buffers [#].
+#define NU_LOAD_GRAIN                     1048576                                                   ///< Minimum data loader work per thread [bytes].
+#define NU_POOL_BLOCK                     67108864                                                  ///< Default device memory pool block size [bytes].
+#define NU_ENV_PLATFORM                   "NU_PLATFORM"                                             ///< Platform choice environment variable (name, "?" = query).
+#define NU_ENV_DEVICE                     "NU_DEVICE"                                               ///< Device choice environment variable (index 1..N, "?" = query).
+#define NU_ENV_DEVICE_TYPE                "NU_DEVICE_TYPE"                                          ///< Device type environment variable (CPU, GPU, ACCELERATOR, DEFAULT, ALL).
+#define NU_ENV_VERBOSE                    "NU_VERBOSE"                                              ///< Enumeration details environment variable ("0" = off).
+#define NU_SELECT_QUERY                   "?"                                                       ///< Platform/device choice asking the user on the console.
+#define NU_SELECT_INTEROP_WEIGHT          2.0                                                       ///< Device score multiplier for OpenCL/GL interoperability.
+#define NU_ENV_SUBDEVICES                 "NU_SUBDEVICES"                                           ///< Sub-device choice environment variable ("numa" or number of sub-devices).
+#define NU_SUBDEVICES_NUMA                "numa"                                                    ///< Sub-device choice partitioning the device by NUMA affinity domain.
 #define NU_KERNEL_NAME                    "thekernel"                                               ///< OpenCL kernel function name.
+#define NU_KERNEL_ALL                     "*"                                                       ///< OpenCL kernel entry name selecting all entries.
 #define NU_MAX_TEXT_SIZE                  128                                                       ///< Maximum number of characters in a text string.
 #define NU_MAX_MESSAGE_SIZE               128                                                       ///< Maximum number of characters in a text message.
 #define NU_MAX_PATH_SIZE                  32768                                                     ///< Maximum number of characters in a text file path.
 
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////// SPARSE MATRIX PARAMETERS /////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+#define NU_SPARSE_SLICE                   32                                                        ///< SELL-C slice height (rows per slice) [#].
+#define NU_SPARSE_ELL_MAX_FILL            1.25f                                                     ///< Maximum ELL padding ratio (stored/nonzeros) [].
+#define NU_SPARSE_SELL_MAX_FILL           1.50f                                                     ///< Maximum SELL-C padding ratio (stored/nonzeros) [].
+#define NU_SPARSE_CSR_VECTOR_THRESHOLD    16.0f                                                     ///< Mean row length above which CSR uses one work-group per row [#].
+#define NU_SPARSE_CSR_VECTOR_SIZE         32                                                        ///< CSR "vector" kernel work-group size [#].
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////// LINEAR SOLVER PARAMETERS /////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+#define NU_SOLVER_GROUP_SIZE              256                                                       ///< Solver work-group size (power of 2) [#].
+#define NU_SOLVER_MAX_GROUPS              256                                                       ///< Maximum number of solver work-groups [#].
+#define NU_SOLVER_TOLERANCE               1.0e-6f                                                   ///< Default relative residual tolerance [].
+#define NU_SOLVER_MAX_ITERATIONS          1000                                                      ///< Default maximum number of iterations [#].
+#define NU_SOLVER_CHECK_INTERVAL          10                                                        ///< Default convergence check interval [#].
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////// RANDOM NUMBER GENERATOR PARAMETERS /////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+#define NU_RANDOM_SEED                    0                                                         ///< Default random number generator seed.
+#define NU_RANDOM_ROUNDS                  10                                                        ///< Philox4x32 rounds (10 = Crush-resistant) [#].
+
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////// GAMEPAD PARAMETERS ////////////////////////////////////////
 //////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -109,6 +160,61 @@ typedef enum
   NU_ALL                                                                                            ///< OpenCL NU_ALL devices.
 } compute_device_type;
 
+// Render modes:
+typedef enum
+{
+  NU_RENDER_SYNC,                                                                                   ///< CPU/GPU serialized at each GL/CL command (glFinish/clFinish).
+  NU_RENDER_PIPELINED,                                                                              ///< CPU/GPU synchronized only at the CL/GL interop hand-off.
+  NU_RENDER_THREADED                                                                                ///< Compute on its own thread, frames handed off to the GL thread (nu::exchange).
+} render_mode;
+
+// Sparse matrix storage formats:
+typedef enum
+{
+  NU_SPARSE_AUTO,                                                                                   ///< Storage format chosen from row-length statistics.
+  NU_CSR,                                                                                           ///< Compressed Sparse Row storage format.
+  NU_ELL,                                                                                           ///< ELLPACK storage format.
+  NU_SELL                                                                                           ///< Sliced ELLPACK (SELL-C) storage format.
+} sparse_format;
+
+// Linear solver types:
+typedef enum
+{
+  NU_CG,                                                                                            ///< Jacobi preconditioned Conjugate Gradient.
+  NU_BICGSTAB                                                                                       ///< Jacobi preconditioned BiCGSTAB.
+} solver_type;
+
+// Plot primitives:
+typedef enum
+{
+  NU_PLOT_POINTS,                                                                                   ///< Points (GL_POINTS, expanded by geometry shader if any).
+  NU_PLOT_LINES,                                                                                    ///< Indexed lines (GL_LINES, from element buffer).
+  NU_PLOT_TRIANGLES,                                                                                ///< Indexed triangles (GL_TRIANGLES, from element buffer).
+  NU_PLOT_GLYPHS                                                                                    ///< Instanced glyphs (GL_TRIANGLES, one instance per point).
+} plot_primitive;
+
+// Window modes:
+typedef enum
+{
+  NU_WINDOW_VISIBLE,                                                                                ///< Visible GLFW window.
+  NU_WINDOW_OFFSCREEN                                                                               ///< Hidden GLFW window, rendering in an offscreen framebuffer.
+} window_mode;
+
+// Frame capture formats:
+typedef enum
+{
+  NU_CAPTURE_RAW,                                                                                   ///< Raw RGBA frames, appended in a single file.
+  NU_CAPTURE_PNG,                                                                                   ///< One PNG file per frame (uncompressed deflate).
+  NU_CAPTURE_Y4M                                                                                    ///< YUV4MPEG2 (4:4:4) video stream, in a single file.
+} capture_format;
+
+// Time-series output formats:
+typedef enum
+{
+  NU_OUTPUT_RAW,                                                                                    ///< Raw binary records, with a text index.
+  NU_OUTPUT_XDMF                                                                                    ///< Raw binary records, with an XDMF temporal collection (ParaView).
+} output_format;
+
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////// OpenCL/GL interoperability ///////////////////////////////////
 //////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -124,12 +230,15 @@ typedef enum
   #define NU_INTEROP "cl_khr_gl_sharing"
 #endif
 
+#define NU_GL_EVENT "cl_khr_gl_event"                                                               ///< OpenCL event from OpenGL sync object extension.
+
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////// Standard C/C++ header files //////////////////////////////////
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 #include <stdlib.h>
 #include <stdarg.h>
 #include <errno.h>
+#include <string.h>
 #include <string>
 #include <vector>
 #include <tuple>
@@ -137,6 +246,7 @@ typedef enum
 #include <fstream>
 #include <cerrno>
 #include <algorithm>
+#include <atomic>
 
 #ifdef __APPLE__                                                                                    // Detecting Mac OS...
   #include <math.h>
@@ -244,6 +354,9 @@ private:
 
 public:
   static bool                   interop;                                                            ///< @brief **Use OpenCL-OpenGL interop.**
+  static render_mode            render;                                                             ///< @brief **Render mode.**
+  static size_t                 steps;                                                              ///< @brief **Kernel launches since last "toc" [#].**
+  static double                 step_rate;                                                          ///< @brief **Kernel launches per second [#/s].**
   static double                 tic;                                                                ///< @brief **Tic application time [s].**
   static double                 toc;                                                                ///< @brief **Toc application time [s].**
   static double                 loop_time;                                                          ///< @brief **Loop time [s].**
@@ -253,10 +366,13 @@ public:
   static cl_context             context_id;                                                         ///< @brief **OpenCL context ID.**
   static cl_platform_id         platform_id;                                                        ///< @brief **OpenCL platform ID.**
   static cl_device_id           device_id;                                                          ///< @brief **OpenCL device ID.**
+  static std::vector<cl_device_id> subdevice_id;                                                    ///< @brief **OpenCL sub-device ID array (empty = no sub-devices).**
   static cl_command_queue       queue_id;                                                           ///< @brief **OpenCL queue ID.**
   static std::vector<cl_kernel> kernel_id;                                                          ///< @brief **OpenCL kernel ID array.**
   static GLFWwindow*            glfw_window;                                                        ///< @brief **Window handle.**
   static bool                   init_done;                                                          ///< @brief **init_done flag.**
+  static std::atomic<GLsync>    gl_fence;                                                           ///< @brief **Last frame fence of the render thread (NU_RENDER_THREADED).**
+  static std::atomic<GLsync>    gl_spent;                                                           ///< @brief **Consumed frame fence, deleted by the render thread.**
 
   /// @brief **Class constructor.**
   /// @details Resets interop, tic, toc, loop_time, context_id, platform_id and device_id to their
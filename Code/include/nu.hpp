@@ -11,7 +11,16 @@
 
 // INCLUDES:
   #include "mesh.hpp"                                                                               // Neutrino's mesh context declarations.
+  #include "sparse.hpp"                                                                             // Neutrino's sparse matrix declarations.
+  #include "solver.hpp"                                                                             // Neutrino's linear solver declarations.
+  #include "random.hpp"                                                                             // Neutrino's random number generator declarations.
   #include "opengl.hpp"                                                                             // Neutrino's OpenGL context declarations.
   #include "opencl.hpp"                                                                             // Neutrino's OpenCL context declarations.
+  #include "capture.hpp"                                                                            // Neutrino's frame capture declarations.
+  #include "exchange.hpp"                                                                           // Neutrino's frame exchange declarations.
+  #include "snapshot.hpp"                                                                           // Neutrino's checkpoint snapshot declarations.
+  #include "output.hpp"                                                                             // Neutrino's time-series output declarations.
+  #include "multidevice.hpp"                                                                        // Neutrino's multi-device declarations.
+  #include "pool.hpp"                                                                               // Neutrino's device memory pool declarations.
 
 #endif
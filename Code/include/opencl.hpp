@@ -21,6 +21,16 @@
 #include "kernel.hpp"
 #include "data_classes.hpp"
 
+/// @brief    **Function pointer. Internally used by Neutrino.**
+/// @details  Pointer to the "clCreateEventFromGLsyncKHR" function of the @link NU_GL_EVENT
+/// @endlink extension, which creates an OpenCL event linked to an OpenGL fence sync object. It is
+/// queried at runtime because not all OpenCL headers declare it.
+typedef cl_event (CL_API_CALL* nu_gl_event)(
+                                            cl_context loc_context,                                 ///< OpenCL context.
+                                            GLsync     loc_sync,                                    ///< OpenGL sync object.
+                                            cl_int*    loc_error                                    ///< Error code.
+                                           );
+
 namespace nu
 {
 ///////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -35,6 +45,9 @@ class opencl : public neutrino
 private:
   cl_device_type device_type;                                                                       ///< @brief **OpenCL device type.**
   std::string    device_type_text;                                                                  ///< @brief **OpenCL device text description.**
+  bool           gl_event;                                                                          ///< @brief **OpenCL event from OpenGL sync flag.**
+  bool           gl_event_warned;                                                                   ///< @brief **Missing OpenCL event from OpenGL sync warning flag.**
+  nu_gl_event    create_gl_event;                                                                   ///< @brief **clCreateEventFromGLsyncKHR function.**
 
   /// @brief **get_platforms_number** function.
   /// @details It gets the number of OpenCL platforms found on the host PC.
@@ -61,6 +74,50 @@ private:
                                 cl_uint loc_platform_index                                          ///< Platform ID.
                                );
 
+  /// @brief **score** function.
+  /// @details It scores a device for the automatic selection: compute units times clock
+  /// frequency, weighted by the (logarithmic) global memory size and by the OpenCL/GL
+  /// interoperability support (@link NU_SELECT_INTEROP_WEIGHT @endlink). Unavailable devices
+  /// score 0.
+  double         score (
+                        device* loc_device,                                                         ///< OpenCL device.
+                        bool    loc_platform_interop                                                ///< Platform interoperability flag.
+                       );
+
+  /// @brief **subdivide** function.
+  /// @details It partitions a device in sub-devices, according to @link subdevice_choice
+  /// @endlink: by NUMA affinity domain (@link NU_SUBDEVICES_NUMA @endlink, falling back to the
+  /// next partitionable domain) or in a given number of sub-devices with equal compute units. It
+  /// returns the sub-device IDs, empty if the device cannot be partitioned.
+  std::vector<cl_device_id> subdivide (
+                                       cl_device_id loc_device_id                                   ///< OpenCL device ID.
+                                      );
+
+  /// @brief **launch** function.
+  /// @details It enqueues one entry point of a kernel object, using the kernel object sizes.
+  void           launch (
+                         nu::kernel* loc_kernel,                                                    ///< OpenCL kernel.
+                         cl_kernel   loc_kernel_id,                                                 ///< OpenCL kernel entry point.
+                         kernel_mode loc_kernel_mode                                                ///< OpenCL kernel mode.
+                        );
+
+  /// @brief **split** function.
+  /// @details It enqueues one entry point of a kernel object split along its i-index among the
+  /// sub-device queues (global work offsets). The parts start after the previous commands on the
+  /// OpenCL queue and the kernel event is a barrier on it, completing with the last part.
+  void           split (
+                        nu::kernel* loc_kernel,                                                     ///< OpenCL kernel.
+                        cl_kernel   loc_kernel_id,                                                  ///< OpenCL kernel entry point.
+                        cl_uint     loc_dimension,                                                  ///< Kernel dimension.
+                        size_t*     loc_size                                                        ///< Kernel size array.
+                       );
+
+  /// @brief **batch** function.
+  /// @details It adds the buffers of all data objects to the queue batch, without any OpenGL call.
+  /// Used in NU_RENDER_THREADED render mode, where the OpenGL context is current on the render
+  /// thread only.
+  void           batch ();
+
 public:
   cl_uint                platforms_number;                                                          ///< @brief **Existing OpenCL platforms number.**
   cl_uint                selected_platform;                                                         ///< @brief **Selected platform index.**
@@ -72,6 +129,11 @@ public:
   cl_context             context_id;                                                                ///< @brief **OpenCL context ID.**
   static queue*          opencl_queue;                                                              ///< @brief **OpenCL queue**.
   static bool            init_done;                                                                 ///< @brief **init_done flag.**
+  static std::string     platform_choice;                                                           ///< @brief **Platform choice (name substring, "" = automatic, "?" = query).**
+  static std::string     device_choice;                                                             ///< @brief **Device choice (index 1..N, "" = automatic, "?" = query).**
+  static bool            verbose;                                                                   ///< @brief **Enumeration "verbose" flag.**
+  static std::string     subdevice_choice;                                                          ///< @brief **Sub-device choice ("" = none, "numa" = by NUMA node, N = N equal parts).**
+  static std::vector<cl_command_queue> subqueue;                                                    ///< @brief **Sub-device queues (0 = OpenCL queue).**
 
   /// @brief **Class constructor.**
   /// @details It initializes the opencl_platform, platforms_number, devices_number,
@@ -86,6 +148,16 @@ public:
   /// platform and lists its extensions, it sets the OpenCL device and lists its extensions,
   /// it identifies the operating system of hte host PC and it creates the OpenCL context.
   /// The OpenCL context must be created after the OpenGL context.
+  /// The platform and the device are selected without user interaction: by the @link
+  /// platform_choice @endlink and @link device_choice @endlink settings, overridden by the
+  /// NU_PLATFORM and NU_DEVICE environment variables, otherwise automatically as the best
+  /// scoring device (see @link score @endlink) among the ones of the requested type (overridden
+  /// by the NU_DEVICE_TYPE environment variable). A "?" choice asks the user on the console. The
+  /// platform and device properties are printed only if @link verbose @endlink (or NU_VERBOSE) is
+  /// set. If @link subdevice_choice @endlink (or NU_SUBDEVICES) is set, the selected device is
+  /// partitioned (see @link subdivide @endlink) and the context is created on its sub-devices,
+  /// without OpenCL/GL interoperability: each kernel launch is then split along its i-index among
+  /// the sub-devices, one queue each, so that each NUMA node works on its own memory.
   void init (
              compute_device_type loc_device_type                                                    ///< Compute device type.
             );
@@ -96,8 +168,19 @@ public:
               size_t loc_i
              );
 
+  /// @brief **Acquire function.**
+  /// @details Acquires all shared buffers for OpenCL with a single enqueue. In NU_RENDER_THREADED
+  /// render mode, the acquisition waits on the device for the last frame fenced by the render
+  /// thread (@link opengl::refresh @endlink), if the device supports the @link NU_GL_EVENT
+  /// @endlink extension.
   void acquire ();
 
+  /// @brief **Release function.**
+  /// @details Releases all shared buffers from OpenCL with a single enqueue. When the
+  /// @link NU_GL_EVENT @endlink extension is available, the OpenGL to OpenCL hand-off in
+  /// @link acquire @endlink waits on an OpenCL event made from an OpenGL fence (no host wait) and
+  /// the OpenCL to OpenGL hand-off here is a flush, implicitly synchronized by the extension.
+  /// Otherwise, glFinish/clFinish (or a fence wait in NU_RENDER_PIPELINED mode) are used.
   void release ();
 
   /// @brief Kernel execution function.
@@ -116,8 +199,18 @@ public:
   /// Inside a kernel instead, notice there are memory [barriers]
   /// (https://www.khronos.org/registry/OpenCL/sdk/1.0/docs/man/xhtml/barrier.html) in order to
   /// synchronize different OpenCL work-items within a given OpenCL work-group.
+  /// A hot reloaded kernel (see @link kernel::watch @endlink) is swapped here, before the launch.
+  void execute (
+                nu::kernel* loc_kernel,                                                             ///< OpenCL kernel.
+                kernel_mode loc_kernel_mode                                                         ///< OpenCL kernel mode.
+               );
+
+  /// @overload execute(nu::kernel* loc_kernel, std::string loc_entry_name, kernel_mode loc_kernel_mode)
+  /// @details Executes a named entry point of a kernel object (see @link kernel::addentry
+  /// @endlink): all entry points share the same program, arguments and sizes.
   void execute (
                 nu::kernel* loc_kernel,                                                             ///< OpenCL kernel.
+                std::string loc_entry_name,                                                         ///< OpenCL kernel entry point name.
                 kernel_mode loc_kernel_mode                                                         ///< OpenCL kernel mode.
                );
 
@@ -11,6 +11,20 @@
 #include "linear_algebra.hpp"
 #include "projective_geometry.hpp"
 
+/// @brief    **Data structure. Internally used by Neutrino.**
+/// @details  This structure is used as data storage in the camera uniform buffer shared by all
+/// shader programs. Its layout matches the GLSL "std140" layout of the @link NU_CAMERA_BLOCK
+/// @endlink uniform block.
+typedef struct _nu_camera_structure
+{
+  GLfloat V_mat[16];                                                                                ///< View matrix.
+  GLfloat P_mat[16];                                                                                ///< Projection matrix.
+  GLfloat size_x;                                                                                   ///< Framebuffer x-size [px_float].
+  GLfloat size_y;                                                                                   ///< Framebuffer y-size [px_float].
+  GLfloat AR;                                                                                       ///< Framebuffer aspect ratio [].
+  GLfloat padding;                                                                                  ///< std140 padding.
+} nu_camera_structure;
+
 namespace nu
 {
 
@@ -61,12 +75,28 @@ private:
   GLuint           shaded_shader;                                                                   ///< @brief **Shaded shader program.**
   GLuint           text_shader;                                                                     ///< @brief **Point shader program.**
   projection_mode  PR_mode;                                                                         ///< @brief **Projection mode.**
+  GLuint              camera_ubo;                                                                   ///< @brief **Camera uniform buffer object.**
+  nu_camera_structure camera;                                                                       ///< @brief **Camera uniform buffer content (last upload).**
+  bool                camera_valid;                                                                 ///< @brief **Camera uniform buffer "valid" flag.**
+  GLfloat             pacing_fps;                                                                   ///< @brief **Frame pacing target frame rate (0 = no pacing) [frames/s].**
+  size_t              pacing_steps;                                                                 ///< @brief **Frame pacing compute steps per frame [#].**
+  double              step_time;                                                                    ///< @brief **Frame pacing compute time per step [s].**
+  double              render_time;                                                                  ///< @brief **Frame pacing render time per frame [s].**
+  double              compute_tic;                                                                  ///< @brief **Frame pacing compute start time [s].**
+  double              render_tic;                                                                   ///< @brief **Frame pacing render start time [s].**
+  bool                computing;                                                                    ///< @brief **Frame pacing "computing" flag.**
 
   /////////////////////////////////////////////////////////////////////////////////////////////////////
   ////////////////////////////////////////// PRIVATE METHODS //////////////////////////////////////////
   /////////////////////////////////////////////////////////////////////////////////////////////////////
+  /// @brief **OpenGL finish method.**
+  /// @details It waits for OpenGL to finish, only in NU_RENDER_SYNC render mode.
+  void finish ();
+
   /// @brief **OpenGL shader set method.**
-  /// @details It sets an OpenGL shader.
+  /// @details It sets an OpenGL shader and its camera state: through the shared camera uniform
+  /// buffer (uploaded only when changed) if the shader declares it, otherwise through the
+  /// uniform locations cached at @link shader::build @endlink.
   void set_shader (
                    nu::shader* loc_shader,                                                          ///< Shader.
                    float       view_matrix[16],                                                     ///< View matrix.
@@ -76,6 +106,16 @@ private:
                    float       framebuffer_AR                                                       ///< Framebuffer aspect ratio.
                   );
 
+  /// @brief **OpenGL draw method.**
+  /// @details It issues the draw call of a shader according to its plot primitive: points,
+  /// indexed lines or triangles from the shader element buffer, or instanced glyphs. With frustum
+  /// culling, the points are culled for the given camera and drawn by glDrawElementsIndirect.
+  void draw (
+             nu::shader* loc_shader,                                                                ///< Shader.
+             float       view_matrix[16],                                                           ///< View matrix.
+             float       projection_matrix[16]                                                      ///< Projection matrix.
+            );
+
   /////////////////////////////////////////////////////////////////////////////////////////////////////
   //////////////////////////////////////////// CALLBACKS //////////////////////////////////////////////
   /////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -191,6 +231,10 @@ public:
   int         framebuffer_size_y;                                                                   ///< @brief **Window y-size [px].**
   float       aspect_ratio;                                                                         ///< @brief **Window aspect ratio [].**
   static bool init_done;                                                                            ///< @brief **init_done flag.**
+  window_mode mode;                                                                                 ///< @brief **Window mode.**
+  GLuint      offscreen_fbo;                                                                        ///< @brief **Offscreen framebuffer (0 = default framebuffer).**
+  GLuint      offscreen_color;                                                                      ///< @brief **Offscreen color renderbuffer.**
+  GLuint      offscreen_depth;                                                                      ///< @brief **Offscreen depth renderbuffer.**
 
   /// @details Quaternion used in the implementation of an [arcball]
   /// (https://en.wikibooks.org/wiki/OpenGL_Programming/Modern_OpenGL_Tutorial_Arcball) pointing the
@@ -325,11 +369,27 @@ public:
          float       loc_pan_z_initial                                                              ///< Initial pan-z coordinate.
         );
 
+  /// @overload
+  /// @details In NU_WINDOW_OFFSCREEN mode the GLFW window is hidden and the graphics is rendered
+  /// in an offscreen framebuffer of the given size (e.g. for frame capture on headless servers).
+  opengl(
+         std::string loc_title,                                                                     ///< Window title.
+         int         loc_window_size_x,                                                             ///< Window (or offscreen framebuffer) x-size [px].
+         int         loc_window_size_y,                                                             ///< Window (or offscreen framebuffer) y-size [px].
+         float       loc_orbit_x_initial,                                                           ///< Initial "near clipping-plane" x-coordinate.
+         float       loc_orbit_y_initial,                                                           ///< Initial "near clipping-plane" y-coordinate.
+         float       loc_pan_x_initial,                                                             ///< Initial pan-x coordinate.
+         float       loc_pan_y_initial,                                                             ///< Initial pan-y coordinate.
+         float       loc_pan_z_initial,                                                             ///< Initial pan-z coordinate.
+         window_mode loc_window_mode                                                                ///< Window mode.
+        );
+
   /////////////////////////////////////////////////////////////////////////////////////////////////////
   /////////////////////////////////////////// PUBLIC METHODS //////////////////////////////////////////
   /////////////////////////////////////////////////////////////////////////////////////////////////////
   /// @brief **GUI initialization.**
-  /// @details Initializes GLFW, GLAD and OpenGL contexts.
+  /// @details Initializes GLFW, GLAD and OpenGL contexts. In NU_WINDOW_OFFSCREEN mode it also
+  /// creates the offscreen framebuffer.
   void init (
              std::string loc_title,                                                                 ///< Windows title.
              int         loc_window_size_x,                                                         ///< Window x-size [px].
@@ -338,7 +398,8 @@ public:
              float       loc_orbit_y_initial,                                                       ///< Initial "near clipping-plane" y-coordinate.
              float       loc_pan_x_initial,                                                         ///< Initial pan-x coordinate.
              float       loc_pan_y_initial,                                                         ///< Initial pan-x coordinate.
-             float       loc_pan_z_initial                                                          ///< Initial pan-x coordinate.
+             float       loc_pan_z_initial,                                                         ///< Initial pan-x coordinate.
+             window_mode loc_window_mode                                                            ///< Window mode.
             );
 
   /// @brief **GUI poll events function.**
@@ -396,8 +457,48 @@ public:
   /// present in the framebuffer.
   void clear ();
 
+  /// @brief **Render mode setter.**
+  /// @details Sets the render mode: NU_RENDER_SYNC (default) serializes CPU and GPU at each
+  /// GL/CL command, NU_RENDER_PIPELINED lets them overlap and synchronizes only at the CL/GL
+  /// interop hand-off (@link opencl::acquire @endlink and @link opencl::release @endlink),
+  /// NU_RENDER_THREADED runs the computation on its own thread and hands off the frames to the
+  /// render thread through an @link exchange @endlink. The achieved loop time and kernel launch rate are reported by @link get_toc @endlink.
+  void set_render (
+                   render_mode loc_render_mode                                                      ///< Render mode.
+                  );
+
+  /// @brief **Frame pacing setter.**
+  /// @details Decouples the rendering rate from the simulation rate: the application loop asks
+  /// @link pace @endlink how many compute steps to run before rendering each frame. The number
+  /// of steps adapts to fill the frame time of the target frame rate, from the measured compute
+  /// time per step and render time per frame. A zero target frame rate disables the pacing (one
+  /// step per frame). Disabling vsync lets the frames be swapped without waiting for the monitor
+  /// vertical retrace:
+  ///
+  ///     gui->set_pacing (60.0f, false);
+  ///     while(!gui->closed ())
+  ///     {
+  ///       n = gui->pace ();
+  ///       cl->acquire ();
+  ///       for(k = 0; k < n; k++) cl->execute (K, NU_DONT_WAIT);
+  ///       cl->release ();
+  ///       gui->clear (); gui->plot (S); gui->refresh (); gui->poll_events ();
+  ///     }
+  void set_pacing (
+                   GLfloat loc_target_fps,                                                          ///< Target frame rate (0 = no pacing) [frames/s].
+                   bool    loc_vsync                                                                ///< Vsync flag.
+                  );
+
+  /// @brief **Frame pacing function.**
+  /// @details Returns the number of compute steps to run before the next rendered frame and
+  /// starts measuring their compute time (up to the next @link clear @endlink, which waits for
+  /// the OpenCL queue to finish, so that the kernel execution is measured, not just its enqueue).
+  size_t pace ();
+
   /// @brief **GUI "plot" function.**
-  /// Plots graphics in the GUI. TO be invoked by the user.
+  /// Plots graphics in the GUI. TO be invoked by the user. The primitive is chosen by the shader
+  /// (see @link shader::setindex @endlink and @link shader::setglyph @endlink). A hot reloaded
+  /// shader program (see @link shader::watch @endlink) is swapped here, between frames.
   void plot (
              nu::shader* loc_shader                                                                 ///< OpenGL shader.
             );
@@ -408,7 +509,9 @@ public:
   /// @brief **Refresh retpoline.**
   /// @details ** To be invoked by the user in order to refresh the window. It redraws the current
   /// graphics in the framebuffer. Also automatically invoked by the @link refresh_callback @endlink
-  /// function when the window needs to be refreshed.
+  /// function when the window needs to be refreshed. In NU_RENDER_THREADED render mode with
+  /// interop, it also fences the frame for the next @link opencl::acquire @endlink of the compute
+  /// thread.
   void refresh ();
 
   /// @brief **Window resize retpoline.**
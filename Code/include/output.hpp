@@ -0,0 +1,133 @@
+/// @file     output.hpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Declaration of a time-series "output" class.
+///
+/// @details  A Neutrino "output" streams some selected data objects to disk every time it is
+/// invoked, e.g. every N steps for post-processing, without stalling the computation. The device
+/// buffers are read with non-blocking reads into a ring of @link NU_OUTPUT_RING @endlink pinned
+/// staging buffers and written by a background thread: the computation stalls only when all the
+/// staging buffers are waiting for the disk (back-pressure). The data are appended to a single
+/// binary file (<prefix>.bin), described either by a text index (<prefix>.idx, NU_OUTPUT_RAW) or
+/// by an [XDMF](https://www.xdmf.org) temporal collection (<prefix>.xmf, NU_OUTPUT_XDMF) pointing
+/// into the binary file, which can be opened in ParaView. For XDMF, a float4 data object must be
+/// given as the node positions (@link setpoints @endlink). To be invoked between kernel launches
+/// (outside of the @link opencl::acquire @endlink and @link opencl::release @endlink calls):
+///
+///     O->init ("run", NU_OUTPUT_XDMF);
+///     O->setpoints (position);
+///     O->addfield (velocity, "velocity");
+///     ...
+///     if(step%100 == 0) O->write (time);
+///     ...
+///     O->close ();
+
+#ifndef output_hpp
+#define output_hpp
+
+#include "neutrino.hpp"
+#include "data_classes.hpp"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+
+namespace nu
+{
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////// "output" class /////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class output
+/// ### Time-series output.
+/// Declares a time-series output.
+/// To be used to stream data objects to disk during a run.
+class output : public neutrino                                                                      ///< @brief **Time-series output.**
+{
+private:
+  std::string                       file_name;                                                      ///< @brief **Output file name prefix.**
+  FILE*                             file;                                                           ///< @brief **Binary data file.**
+  std::ofstream                     index;                                                          ///< @brief **Text index file (NU_OUTPUT_RAW).**
+  std::ofstream                     xdmf;                                                           ///< @brief **XDMF file (NU_OUTPUT_XDMF).**
+  std::vector<nu::data*>            field;                                                          ///< @brief **Output data objects.**
+  std::vector<std::string>          field_name;                                                     ///< @brief **Output data object names.**
+  std::vector<size_t>               field_offset;                                                   ///< @brief **Data object offset in a staging buffer [bytes].**
+  nu::float4*                       points;                                                         ///< @brief **Node positions (NU_OUTPUT_XDMF).**
+  std::vector<cl_mem>               slot;                                                           ///< @brief **Pinned staging buffers.**
+  std::vector<char*>                slot_data;                                                      ///< @brief **Pinned staging buffer host pointers.**
+  std::vector<size_t>               free_slot;                                                      ///< @brief **Free staging buffer indices.**
+  std::deque<size_t>                queued_slot;                                                    ///< @brief **Queued staging buffer indices.**
+  std::deque<double>                queued_time;                                                    ///< @brief **Queued output times.**
+  std::deque<cl_event>              queued_event;                                                   ///< @brief **Queued read events.**
+  size_t                            slot_size;                                                      ///< @brief **Staging buffer size [bytes].**
+  size_t                            file_size;                                                      ///< @brief **Binary data file size [bytes].**
+  std::thread                       writer;                                                         ///< @brief **Writer thread.**
+  std::mutex                        slot_lock;                                                      ///< @brief **Staging buffer lock.**
+  std::condition_variable           slot_signal;                                                    ///< @brief **Staging buffer signal.**
+  bool                              stop;                                                           ///< @brief **Writer thread "stop" flag.**
+
+  /// @brief **Staging buffer allocator.**
+  /// @details Lays out the data objects in a staging buffer and allocates the pinned staging
+  /// buffers, at the first write (when the device buffers exist).
+  void allocate ();
+
+  /// @brief **Writer thread loop.**
+  /// @details Waits for the reads of the queued staging buffers and writes them, until stopped.
+  void loop ();
+
+  /// @brief **Record writer.**
+  /// @details Appends a staging buffer to the binary file and describes it in the index (or XDMF)
+  /// file. Runs on the writer thread.
+  void record (
+               char*  loc_data,                                                                     ///< Staging buffer.
+               double loc_time                                                                      ///< Output time.
+              );
+
+public:
+  output_format                     format;                                                         ///< @brief **Output format.**
+  size_t                            written;                                                        ///< @brief **Number of written records [#].**
+  size_t                            stalls;                                                         ///< @brief **Number of writes stalled by the disk (back-pressure) [#].**
+  bool                              ready;                                                          ///< @brief **Output "ready" flag.**
+
+  /// @brief **Class constructor.**
+  /// @details It does nothing. The output is started by the @link init @endlink method.
+  output ();
+
+  /// @brief **Output initializer.**
+  /// @details Opens the output files and starts the writer thread.
+  void init (
+             std::string   loc_file_name,                                                           ///< Output file name prefix.
+             output_format loc_format                                                               ///< Output format.
+            );
+
+  /// @brief **Field adder.**
+  /// @details Selects a data object for output, with its name in the index (or XDMF) file.
+  void addfield (
+                 nu::data*   loc_data,                                                              ///< Data object.
+                 std::string loc_name                                                               ///< Data object name.
+                );
+
+  /// @brief **Node position setter.**
+  /// @details Selects the float4 data object holding the node positions (x, y, z, w), used as
+  /// the XDMF geometry (one vertex per node). It is also written at each record.
+  void setpoints (
+                  nu::float4* loc_points                                                            ///< Node positions.
+                 );
+
+  /// @brief **Record writer.**
+  /// @details Enqueues the reads of the selected data objects into a free staging buffer and
+  /// queues it to the writer thread. Waits only if all the staging buffers are queued.
+  void write (
+              double loc_time                                                                       ///< Output time.
+             );
+
+  /// @brief **Output terminator.**
+  /// @details Waits for the writer thread to write all queued records, closes the output files
+  /// and releases the staging buffers.
+  void close ();
+
+  /// @brief **Class destructor.**
+  /// @details Terminates the output, if still running.
+  ~output ();
+};
+}
+#endif
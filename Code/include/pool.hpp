@@ -0,0 +1,122 @@
+/// @file     pool.hpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Declaration of a device memory "pool" class.
+///
+/// @details  A Neutrino "pool" suballocates device buffers from a few large device memory blocks,
+/// by means of OpenCL sub-buffers (clCreateSubBuffer), instead of creating a buffer per data
+/// object. It is meant for applications creating many small buffers (e.g. per-group fields,
+/// temporaries). The sub-buffer offsets respect the device base address alignment
+/// (CL_DEVICE_MEM_BASE_ADDR_ALIGN). Recycled sub-buffers return their region to the pool, merged
+/// with the adjacent free regions, so temporaries reuse the same device memory. The pool tracks
+/// the used and peak device memory against the device global memory size and frees all its
+/// sub-buffers and blocks on destruction. Pooled data objects are compute only: in the OpenCL/GL
+/// interoperability modality, their buffers must be shared with OpenGL and they are left to the
+/// @link kernel::setarg @endlink method. To be invoked before the kernel arguments are set:
+///
+///     M->init (NU_POOL_BLOCK);
+///     M->add (field);
+///     K->setarg (field, 0);
+///     ...
+///     cl_mem T = M->allocate (bytes);
+///     ...
+///     M->recycle (T);
+
+#ifndef pool_hpp
+#define pool_hpp
+
+#include "neutrino.hpp"
+#include "data_classes.hpp"
+#include <map>
+
+/// @brief    **Pool region. Internally used by Neutrino.**
+/// @details  Describes a region of a device memory block of a @link nu::pool @endlink.
+typedef struct _nu_pool_region
+{
+  size_t block;                                                                                     ///< Block index.
+  size_t offset;                                                                                    ///< Region offset in the block [bytes].
+  size_t size;                                                                                      ///< Region size [bytes].
+} nu_pool_region;
+
+namespace nu
+{
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////// "pool" class //////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class pool
+/// ### Device memory pool.
+/// Declares a device memory pool.
+/// To be used to suballocate many small device buffers from a few large ones.
+class pool : public neutrino                                                                        ///< @brief **Device memory pool.**
+{
+private:
+  std::vector<cl_mem>                    block;                                                     ///< @brief **Device memory blocks.**
+  std::vector<size_t>                    block_size;                                                ///< @brief **Device memory block sizes [bytes].**
+  std::vector<std::map<size_t, size_t> > hole;                                                      ///< @brief **Free regions of each block (offset -> size) [bytes].**
+  std::map<cl_mem, nu_pool_region>       region;                                                    ///< @brief **Regions of the live sub-buffers.**
+  std::vector<nu::data*>                 pooled;                                                    ///< @brief **Pooled data objects.**
+  size_t                                 block_default;                                             ///< @brief **Default block size [bytes].**
+  size_t                                 align;                                                     ///< @brief **Sub-buffer offset alignment [bytes].**
+  size_t                                 max_alloc;                                                 ///< @brief **Maximum device buffer size [bytes].**
+
+  /// @brief **Block adder.**
+  /// @details Creates a new device memory block, large enough for the requested size, checking
+  /// it against the device global memory size. Returns its index.
+  size_t grow (
+               size_t loc_size                                                                      ///< Requested size [bytes].
+              );
+
+public:
+  size_t                                 used;                                                      ///< @brief **Used device memory [bytes].**
+  size_t                                 peak;                                                      ///< @brief **Peak used device memory [bytes].**
+  size_t                                 reserved;                                                  ///< @brief **Reserved device memory (all blocks) [bytes].**
+  size_t                                 capacity;                                                  ///< @brief **Device global memory size [bytes].**
+  bool                                   ready;                                                     ///< @brief **Pool "ready" flag.**
+
+  /// @brief **Class constructor.**
+  /// @details It does nothing. The pool is started by the @link init @endlink method.
+  pool ();
+
+  /// @brief **Pool initializer.**
+  /// @details Gets the device alignment and memory limits. The blocks are created on demand, of
+  /// the given size (or larger, for larger requests). To be invoked after the OpenCL context
+  /// initialization.
+  void init (
+             size_t loc_block_size                                                                  ///< Default block size [bytes].
+            );
+
+  /// @brief **Sub-buffer allocator.**
+  /// @details Suballocates a device buffer of the given size from the first free region large
+  /// enough (creating a new block if none) and returns it as an OpenCL sub-buffer.
+  cl_mem allocate (
+                   size_t loc_size                                                                  ///< Buffer size [bytes].
+                  );
+
+  /// @brief **Sub-buffer recycler.**
+  /// @details Releases a sub-buffer created by the @link allocate @endlink method and returns its
+  /// region to the pool, for reuse.
+  void recycle (
+                cl_mem loc_buffer                                                                   ///< Sub-buffer.
+               );
+
+  /// @brief **Data object adder.**
+  /// @details Suballocates the device buffer of a data object (not yet set as kernel argument),
+  /// uploads its host data and sets its "ready" flag: the @link kernel::setarg @endlink method
+  /// then binds the pooled buffer. Does nothing in the OpenCL/GL interoperability modality.
+  void add (
+            nu::data* loc_data                                                                      ///< Data object.
+           );
+
+  /// @brief **Data object remover.**
+  /// @details Recycles the pooled device buffer of a data object and resets its "ready" flag.
+  void remove (
+               nu::data* loc_data                                                                   ///< Data object.
+              );
+
+  /// @brief **Class destructor.**
+  /// @details Releases all the live sub-buffers and the device memory blocks, and resets the
+  /// device buffer and the "ready" flag of the data objects still pooled.
+  ~pool ();
+};
+}
+#endif
@@ -32,11 +32,23 @@
 class queue : public neutrino                                                                       /// @brief **OpenCL queue.**
 {
 private:
+  /// @brief **OpenGL finish function.**
+  /// @details Waits for OpenGL to finish, only in NU_RENDER_SYNC render mode and out of batch
+  /// mode: otherwise the hand-off is synchronized once by @link opencl::acquire @endlink and
+  /// @link opencl::release @endlink.
+  void finish_gl ();
+
+  /// @brief **OpenCL finish function.**
+  /// @details Waits for OpenCL to finish, only in NU_RENDER_SYNC render mode and out of batch
+  /// mode.
+  void finish_cl ();
 
 public:
-  cl_command_queue queue_id;                                                                        ///< @brief **OpenCL queue.**
-  cl_context       context_id;                                                                      ///< @brief **OpenCL context.**
-  cl_device_id     device_id;                                                                       ///< @brief **OpenCL device id.**
+  cl_command_queue    queue_id;                                                                     ///< @brief **OpenCL queue.**
+  cl_context          context_id;                                                                   ///< @brief **OpenCL context.**
+  cl_device_id        device_id;                                                                    ///< @brief **OpenCL device id.**
+  bool                batched;                                                                      ///< @brief **Batch mode flag.**
+  std::vector<cl_mem> batch;                                                                        ///< @brief **Batched OpenGL shared buffers.**
 
   /// @brief **Class constructor.**
   /// @details Sets queue_id, context_id and device_id to NULL default values.
@@ -109,6 +121,70 @@ public:
    GLuint      loc_layout_index                                                                     ///< Layout index.
   );
 
+  /// @overload read(nu::half1* loc_data, cl_uint loc_layout_index)
+  /// @details Reads data from the OpenCL queue.
+  void read
+  (
+   nu::half1* loc_data,                                                                             ///< nu::half1 object.
+   GLuint     loc_layout_index                                                                      ///< Layout index.
+  );
+
+  /// @overload read(nu::half4* loc_data, cl_uint loc_layout_index)
+  /// @details Reads data from the OpenCL queue.
+  void read
+  (
+   nu::half4* loc_data,                                                                             ///< nu::half4 object.
+   GLuint     loc_layout_index                                                                      ///< Layout index.
+  );
+
+  /// @overload read(nu::short4* loc_data, cl_uint loc_layout_index)
+  /// @details Reads data from the OpenCL queue.
+  void read
+  (
+   nu::short4* loc_data,                                                                            ///< nu::short4 object.
+   GLuint      loc_layout_index                                                                     ///< Layout index.
+  );
+
+  /// @overload read(nu::uchar4* loc_data, cl_uint loc_layout_index)
+  /// @details Reads data from the OpenCL queue.
+  void read
+  (
+   nu::uchar4* loc_data,                                                                            ///< nu::uchar4 object.
+   GLuint      loc_layout_index                                                                     ///< Layout index.
+  );
+
+  /// @overload read(nu::double1* loc_data, cl_uint loc_layout_index)
+  /// @details Reads data from the OpenCL queue.
+  void read
+  (
+   nu::double1* loc_data,                                                                           ///< nu::double1 object.
+   GLuint       loc_layout_index                                                                    ///< Layout index.
+  );
+
+  /// @overload read(nu::double2* loc_data, cl_uint loc_layout_index)
+  /// @details Reads data from the OpenCL queue.
+  void read
+  (
+   nu::double2* loc_data,                                                                           ///< nu::double2 object.
+   GLuint       loc_layout_index                                                                    ///< Layout index.
+  );
+
+  /// @overload read(nu::double3* loc_data, cl_uint loc_layout_index)
+  /// @details Reads data from the OpenCL queue.
+  void read
+  (
+   nu::double3* loc_data,                                                                           ///< nu::double3 object.
+   GLuint       loc_layout_index                                                                    ///< Layout index.
+  );
+
+  /// @overload read(nu::double4* loc_data, cl_uint loc_layout_index)
+  /// @details Reads data from the OpenCL queue.
+  void read
+  (
+   nu::double4* loc_data,                                                                           ///< nu::double4 object.
+   GLuint       loc_layout_index                                                                    ///< Layout index.
+  );
+
   /////////////////////////////////////////////////////////////////////////////////////////////////////
   ////////////////////////////////////////// write "functions" ////////////////////////////////////////
   /////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -176,6 +252,70 @@ public:
    GLuint      loc_layout_index                                                                     ///< Layout index.
   );
 
+  /// @overload write(nu::half1* loc_data, cl_uint loc_layout_index)
+  /// @details Writes data from the OpenCL queue.
+  void write
+  (
+   nu::half1* loc_data,                                                                             ///< nu::half1 object.
+   GLuint     loc_layout_index                                                                      ///< Layout index.
+  );
+
+  /// @overload write(nu::half4* loc_data, cl_uint loc_layout_index)
+  /// @details Writes data from the OpenCL queue.
+  void write
+  (
+   nu::half4* loc_data,                                                                             ///< nu::half4 object.
+   GLuint     loc_layout_index                                                                      ///< Layout index.
+  );
+
+  /// @overload write(nu::short4* loc_data, cl_uint loc_layout_index)
+  /// @details Writes data from the OpenCL queue.
+  void write
+  (
+   nu::short4* loc_data,                                                                            ///< nu::short4 object.
+   GLuint      loc_layout_index                                                                     ///< Layout index.
+  );
+
+  /// @overload write(nu::uchar4* loc_data, cl_uint loc_layout_index)
+  /// @details Writes data from the OpenCL queue.
+  void write
+  (
+   nu::uchar4* loc_data,                                                                            ///< nu::uchar4 object.
+   GLuint      loc_layout_index                                                                     ///< Layout index.
+  );
+
+  /// @overload write(nu::double1* loc_data, cl_uint loc_layout_index)
+  /// @details Writes data from the OpenCL queue.
+  void write
+  (
+   nu::double1* loc_data,                                                                           ///< nu::double1 object.
+   GLuint       loc_layout_index                                                                    ///< Layout index.
+  );
+
+  /// @overload write(nu::double2* loc_data, cl_uint loc_layout_index)
+  /// @details Writes data from the OpenCL queue.
+  void write
+  (
+   nu::double2* loc_data,                                                                           ///< nu::double2 object.
+   GLuint       loc_layout_index                                                                    ///< Layout index.
+  );
+
+  /// @overload write(nu::double3* loc_data, cl_uint loc_layout_index)
+  /// @details Writes data from the OpenCL queue.
+  void write
+  (
+   nu::double3* loc_data,                                                                           ///< nu::double3 object.
+   GLuint       loc_layout_index                                                                    ///< Layout index.
+  );
+
+  /// @overload write(nu::double4* loc_data, cl_uint loc_layout_index)
+  /// @details Writes data from the OpenCL queue.
+  void write
+  (
+   nu::double4* loc_data,                                                                           ///< nu::double4 object.
+   GLuint       loc_layout_index                                                                    ///< Layout index.
+  );
+
   /////////////////////////////////////////////////////////////////////////////////////////////////////
   ///////////////////////////////////////// acquire "functions" ///////////////////////////////////////
   /////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -243,6 +383,70 @@ public:
    GLuint      loc_layout_index                                                                     ///< OpenGL shader layout index.
   );
 
+  /// @overload acquire(nu::half1* loc_data, GLuint loc_layout_index)
+  /// @details Enables OpenCL exclusive data access. It locks data access to OpenGL.
+  void acquire
+  (
+   nu::half1* loc_data,                                                                             ///< Data object.
+   GLuint     loc_layout_index                                                                      ///< OpenGL shader layout index.
+  );
+
+  /// @overload acquire(nu::half4* loc_data, GLuint loc_layout_index)
+  /// @details Enables OpenCL exclusive data access. It locks data access to OpenGL.
+  void acquire
+  (
+   nu::half4* loc_data,                                                                             ///< Data object.
+   GLuint     loc_layout_index                                                                      ///< OpenGL shader layout index.
+  );
+
+  /// @overload acquire(nu::short4* loc_data, GLuint loc_layout_index)
+  /// @details Enables OpenCL exclusive data access. It locks data access to OpenGL.
+  void acquire
+  (
+   nu::short4* loc_data,                                                                            ///< Data object.
+   GLuint      loc_layout_index                                                                     ///< OpenGL shader layout index.
+  );
+
+  /// @overload acquire(nu::uchar4* loc_data, GLuint loc_layout_index)
+  /// @details Enables OpenCL exclusive data access. It locks data access to OpenGL.
+  void acquire
+  (
+   nu::uchar4* loc_data,                                                                            ///< Data object.
+   GLuint      loc_layout_index                                                                     ///< OpenGL shader layout index.
+  );
+
+  /// @overload acquire(nu::double1* loc_data, GLuint loc_layout_index)
+  /// @details Enables OpenCL exclusive data access. It locks data access to OpenGL.
+  void acquire
+  (
+   nu::double1* loc_data,                                                                           ///< Data object.
+   GLuint       loc_layout_index                                                                    ///< OpenGL shader layout index.
+  );
+
+  /// @overload acquire(nu::double2* loc_data, GLuint loc_layout_index)
+  /// @details Enables OpenCL exclusive data access. It locks data access to OpenGL.
+  void acquire
+  (
+   nu::double2* loc_data,                                                                           ///< Data object.
+   GLuint       loc_layout_index                                                                    ///< OpenGL shader layout index.
+  );
+
+  /// @overload acquire(nu::double3* loc_data, GLuint loc_layout_index)
+  /// @details Enables OpenCL exclusive data access. It locks data access to OpenGL.
+  void acquire
+  (
+   nu::double3* loc_data,                                                                           ///< Data object.
+   GLuint       loc_layout_index                                                                    ///< OpenGL shader layout index.
+  );
+
+  /// @overload acquire(nu::double4* loc_data, GLuint loc_layout_index)
+  /// @details Enables OpenCL exclusive data access. It locks data access to OpenGL.
+  void acquire
+  (
+   nu::double4* loc_data,                                                                           ///< Data object.
+   GLuint       loc_layout_index                                                                    ///< OpenGL shader layout index.
+  );
+
   /////////////////////////////////////////////////////////////////////////////////////////////////////
   ///////////////////////////////////////// release "functions" ///////////////////////////////////////
   /////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -310,6 +514,84 @@ public:
    GLuint      loc_layout_index                                                                     ///< OpenGL shader layout index.
   );
 
+  /// @overload release(nu::half1* loc_data, GLuint loc_layout_index)
+  /// @details Disables OpenCL exclusive data access. It opens data access to OpenGL.
+  void release
+  (
+   nu::half1* loc_data,                                                                             ///< Data object.
+   GLuint     loc_layout_index                                                                      ///< OpenGL shader layout index.
+  );
+
+  /// @overload release(nu::half4* loc_data, GLuint loc_layout_index)
+  /// @details Disables OpenCL exclusive data access. It opens data access to OpenGL.
+  void release
+  (
+   nu::half4* loc_data,                                                                             ///< Data object.
+   GLuint     loc_layout_index                                                                      ///< OpenGL shader layout index.
+  );
+
+  /// @overload release(nu::short4* loc_data, GLuint loc_layout_index)
+  /// @details Disables OpenCL exclusive data access. It opens data access to OpenGL.
+  void release
+  (
+   nu::short4* loc_data,                                                                            ///< Data object.
+   GLuint      loc_layout_index                                                                     ///< OpenGL shader layout index.
+  );
+
+  /// @overload release(nu::uchar4* loc_data, GLuint loc_layout_index)
+  /// @details Disables OpenCL exclusive data access. It opens data access to OpenGL.
+  void release
+  (
+   nu::uchar4* loc_data,                                                                            ///< Data object.
+   GLuint      loc_layout_index                                                                     ///< OpenGL shader layout index.
+  );
+
+  /// @overload release(nu::double1* loc_data, GLuint loc_layout_index)
+  /// @details Disables OpenCL exclusive data access. It opens data access to OpenGL.
+  void release
+  (
+   nu::double1* loc_data,                                                                           ///< Data object.
+   GLuint       loc_layout_index                                                                    ///< OpenGL shader layout index.
+  );
+
+  /// @overload release(nu::double2* loc_data, GLuint loc_layout_index)
+  /// @details Disables OpenCL exclusive data access. It opens data access to OpenGL.
+  void release
+  (
+   nu::double2* loc_data,                                                                           ///< Data object.
+   GLuint       loc_layout_index                                                                    ///< OpenGL shader layout index.
+  );
+
+  /// @overload release(nu::double3* loc_data, GLuint loc_layout_index)
+  /// @details Disables OpenCL exclusive data access. It opens data access to OpenGL.
+  void release
+  (
+   nu::double3* loc_data,                                                                           ///< Data object.
+   GLuint       loc_layout_index                                                                    ///< OpenGL shader layout index.
+  );
+
+  /// @overload release(nu::double4* loc_data, GLuint loc_layout_index)
+  /// @details Disables OpenCL exclusive data access. It opens data access to OpenGL.
+  void release
+  (
+   nu::double4* loc_data,                                                                           ///< Data object.
+   GLuint       loc_layout_index                                                                    ///< OpenGL shader layout index.
+  );
+
+  /// @brief **Batched acquire function.**
+  /// @details In batch mode (@link batched @endlink set) the acquire methods do not enqueue any
+  /// OpenCL command: they only collect the OpenGL shared buffers. This method acquires all of them
+  /// with a single enqueue, waiting for the given events (e.g. an OpenGL fence event).
+  void acquire_batch
+  (
+   cl_uint         loc_events,                                                                      ///< Number of events in wait list.
+   const cl_event* loc_event_list                                                                   ///< Wait list.
+  );
+
+  /// @brief **Batched release function.**
+  /// @details Releases all the OpenGL shared buffers collected in batch mode with a single enqueue.
+  void release_batch ();
+
   /// @brief **Class destructor.**
   /// @details Releases the OpenCL queue.
   ~queue();
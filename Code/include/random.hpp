@@ -0,0 +1,115 @@
+/// @file     random.hpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Declaration of a "random" number generator class.
+///
+/// @details  A Neutrino "random" generator is a counter-based
+/// [Philox4x32](https://www.thesalmons.org/john/random123/papers/random123sc11.pdf) pseudo random
+/// number generator. Each random number is a pure function of a key (the seed) and of a counter
+/// (element index, step, stream), therefore no generator state has to be stored or updated on the
+/// client GPU and the sequence does not depend on the work-group size. The same device functions
+/// can be used from the user's kernels by adding the @link random::source @endlink string to the
+/// kernel sources, before the user's source files:
+///
+///     K->kernel_source.push_back (R->source);
+///     K->addsource ("mykernel.cl");
+///
+/// then, in the kernel: `float4 u = nu_uniform4 ((uint4)(i, step, 0, stream), (uint2)(seed, 0));`.
+
+#ifndef random_hpp
+#define random_hpp
+
+#include "neutrino.hpp"
+#include "data_classes.hpp"
+
+namespace nu
+{
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////// "random" class //////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class random
+/// ### Counter-based random number generator.
+/// Declares a Philox4x32 random number generator.
+/// To be used to fill buffers with random numbers directly on the client GPU.
+class random : public neutrino                                                                      /// @brief **Random number generator.**
+{
+private:
+  cl_program  program;                                                                              ///< @brief **Generator program.**
+  cl_kernel   uniform_kernel;                                                                       ///< @brief **Uniform distribution kernel.**
+  cl_kernel   normal_kernel;                                                                        ///< @brief **Normal distribution kernel.**
+
+  /// @brief **Buffer filler.**
+  /// @details Sets the generator key and counter on a fill kernel, enqueues it and advances the
+  /// @link step @endlink counter.
+  void fill (
+             cl_kernel loc_kernel,                                                                  ///< Fill kernel.
+             cl_mem    loc_buffer,                                                                  ///< Data buffer.
+             size_t    loc_size,                                                                    ///< Number of values [#].
+             GLfloat   loc_a,                                                                       ///< First distribution parameter.
+             GLfloat   loc_b                                                                        ///< Second distribution parameter.
+            );
+
+public:
+  std::string source;                                                                               ///< @brief **OpenCL device functions source.**
+  cl_ulong    seed;                                                                                 ///< @brief **Generator seed (key).**
+  cl_uint     stream;                                                                               ///< @brief **Generator stream.**
+  cl_ulong    step;                                                                                 ///< @brief **Generator step (incremented by each fill).**
+  bool        ready;                                                                                ///< @brief **Generator program "ready" flag.**
+
+  /// @brief **Class constructor.**
+  /// @details Sets the device functions @link source @endlink and the default seed. The
+  /// generator program is built by the @link init @endlink method, after the initialization of the
+  /// @link opencl @endlink object.
+  random ();
+
+  /// @brief **Generator initializer.**
+  /// @details Sets the seed and the stream and builds the generator program. Different streams
+  /// with the same seed give independent sequences (e.g. one per simulation replica).
+  void init (
+             cl_ulong loc_seed,                                                                     ///< Generator seed.
+             cl_uint  loc_stream                                                                    ///< Generator stream.
+            );
+
+  /// @brief **Uniform distribution filler.**
+  /// @details Fills the data buffer with uniformly distributed numbers in (min, max). The data
+  /// must have been already set as kernel argument (its OpenCL buffer must exist) and, in
+  /// interoperability modality, it must have been acquired. Enqueued without waiting.
+  void uniform (
+                nu::float1* loc_data,                                                               ///< Data.
+                GLfloat     loc_min,                                                                ///< Minimum value.
+                GLfloat     loc_max                                                                 ///< Maximum value.
+               );
+
+  /// @overload uniform(cl_mem loc_buffer, size_t loc_size, GLfloat loc_min, GLfloat loc_max)
+  /// @details Fills a raw OpenCL buffer of **GLfloat** numbers.
+  void uniform (
+                cl_mem  loc_buffer,                                                                 ///< Data buffer.
+                size_t  loc_size,                                                                   ///< Number of values [#].
+                GLfloat loc_min,                                                                    ///< Minimum value.
+                GLfloat loc_max                                                                     ///< Maximum value.
+               );
+
+  /// @brief **Normal distribution filler.**
+  /// @details Fills the data buffer with normally distributed numbers (Box-Muller transform).
+  /// Same buffer requirements of @link uniform @endlink.
+  void normal (
+               nu::float1* loc_data,                                                                ///< Data.
+               GLfloat     loc_mean,                                                                ///< Mean value.
+               GLfloat     loc_deviation                                                            ///< Standard deviation.
+              );
+
+  /// @overload normal(cl_mem loc_buffer, size_t loc_size, GLfloat loc_mean, GLfloat loc_deviation)
+  /// @details Fills a raw OpenCL buffer of **GLfloat** numbers.
+  void normal (
+               cl_mem  loc_buffer,                                                                  ///< Data buffer.
+               size_t  loc_size,                                                                    ///< Number of values [#].
+               GLfloat loc_mean,                                                                    ///< Mean value.
+               GLfloat loc_deviation                                                                ///< Standard deviation.
+              );
+
+  /// @brief **Class destructor.**
+  /// @details Releases the generator kernels and the generator program.
+  ~random ();
+};
+}
+#endif
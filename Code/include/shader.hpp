@@ -9,13 +9,21 @@
 /// [fragment](https://www.khronos.org/opengl/wiki/Fragment_Shader)
 /// type for graphics rendition of OpenCL data. The @link setarg @endlink methods of this class
 /// is used to tell Neutrino which arguments are presents in the source file of each shader of
-/// interest.
+/// interest. The linked programs can be cached as driver binaries (@link setcache @endlink) and
+/// the source files can be watched for changes, to hot reload the shader while running
+/// (@link watch @endlink).
 
 #ifndef shader_hpp
 #define shader_hpp
 
 #include "neutrino.hpp"
 #include "data_classes.hpp"
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <filesystem>
+#include <sstream>
+#include <iomanip>
 
 namespace nu
 {
@@ -28,35 +36,160 @@ namespace nu
 class shader : public neutrino                                                                      /// @brief **OpenGL nu::shader.**
 {
 private:
+  std::vector<std::string>                     source_file;                                         ///< @brief **Shader source file names.**
+  std::vector<shader_type>                     source_type;                                         ///< @brief **Shader source types.**
+  std::vector<std::string>                     source;                                              ///< @brief **Shader sources.**
+  std::vector<std::filesystem::file_time_type> source_time;                                         ///< @brief **Shader source file modification times.**
+  std::vector<std::string>                     pending_source;                                      ///< @brief **Changed shader sources, waiting for reload.**
+  std::string                                  cache_path;                                          ///< @brief **Program binary cache directory ("" = no cache).**
+  std::thread                                  watcher;                                             ///< @brief **Source file watcher thread.**
+  std::mutex                                   pending_lock;                                        ///< @brief **Changed shader sources lock.**
+  std::atomic<bool>                            pending;                                             ///< @brief **"Changed shader sources" flag.**
+  std::atomic<bool>                            watching;                                            ///< @brief **"Watcher running" flag.**
 
   /// @brief    **OpenGL nu::shader compilation.**
-  /// @details  It compiles an OpenGL shader.
+  /// @details  It compiles an OpenGL shader from its source. Returns 0 on compilation error,
+  /// after printing the compiler log.
   GLuint compile (
-                  std::string loc_shader_filename,                                                  ///< Shader file name.
+                  std::string loc_shader_source,                                                    ///< Shader source.
                   shader_type loc_shader_type                                                       ///< Shader type.
                  );
 
+  /// @brief    **OpenGL nu::shader linker.**
+  /// @details  Compiles the given sources and links them in the current program, or loads the
+  /// program binary from the cache when available. Returns false on compilation or link error,
+  /// after printing the log.
+  bool link (
+             std::vector<std::string>& loc_source                                                   ///< Shader sources.
+            );
+
+  /// @brief    **OpenGL nu::shader uniform resolver.**
+  /// @details  Resolves the camera uniform locations (or the camera uniform block) and the active
+  /// attribute locations (see @link glyph_attribute @endlink) of the program.
+  void resolve ();
+
+  /// @brief    **OpenGL nu::shader argument binder.**
+  /// @details  Names all data objects and binds them as program attributes, before the link.
+  void bindargs ();
+
+  /// @brief    **Source file watcher loop.**
+  /// @details  Polls the modification time of the source files every @link
+  /// NU_SHADER_WATCH_PERIOD @endlink, reads the changed sources and flags them for @link reload
+  /// @endlink. Runs on the watcher thread.
+  void loop ();
+
 public:
-  GLuint  program;                                                                                  ///< @brief **OpenGL program.**
-  GLsizei size;                                                                                     ///< @brief **OpenGL shader argument size.**
+  GLuint         program;                                                                           ///< @brief **OpenGL program.**
+  GLsizei        size;                                                                              ///< @brief **OpenGL shader argument size.**
+  GLint          V_mat_location;                                                                    ///< @brief **"V_mat" uniform location (-1 = not used).**
+  GLint          P_mat_location;                                                                    ///< @brief **"P_mat" uniform location (-1 = not used).**
+  GLint          size_x_location;                                                                   ///< @brief **"size_x" uniform location (-1 = not used).**
+  GLint          size_y_location;                                                                   ///< @brief **"size_y" uniform location (-1 = not used).**
+  GLint          AR_location;                                                                       ///< @brief **"AR" uniform location (-1 = not used).**
+  GLuint         camera_block;                                                                      ///< @brief **Camera uniform block index (GL_INVALID_INDEX = not used).**
+  plot_primitive primitive;                                                                         ///< @brief **Plot primitive.**
+  GLuint         element_buffer;                                                                    ///< @brief **OpenGL element buffer (0 = not used).**
+  GLsizei        element_size;                                                                      ///< @brief **Number of element buffer indices [#].**
+  GLsizei        glyph_size;                                                                        ///< @brief **Number of vertices per glyph instance [#].**
+  std::vector<GLuint> glyph_attribute;                                                              ///< @brief **Per-instance (active) attribute locations of the glyphs.**
+  bool           culling;                                                                           ///< @brief **Frustum culling flag.**
+  GLuint         cull_program;                                                                      ///< @brief **Culling compute program.**
+  GLuint         cull_position;                                                                     ///< @brief **Culling position buffer.**
+  GLsizei        cull_size;                                                                         ///< @brief **Culling capacity (positions and element buffer size) [#].**
+  GLuint         command_buffer;                                                                    ///< @brief **Indirect draw command buffer.**
+  GLuint         cull_binding;                                                                      ///< @brief **Culling first storage buffer binding point.**
+  GLfloat        lod_distance;                                                                      ///< @brief **Level of detail distance (0 = no decimation).**
+  GLint          cull_V_mat_location;                                                               ///< @brief **Culling "V_mat" uniform location.**
+  GLint          cull_P_mat_location;                                                               ///< @brief **Culling "P_mat" uniform location.**
+  GLint          cull_points_location;                                                              ///< @brief **Culling "points" uniform location.**
+  GLint          cull_lod_location;                                                                 ///< @brief **Culling "lod_distance" uniform location.**
 
   /// @brief **Class constructor.**
   /// @details It does nothing.
   shader ();
 
   /// @brief **Shader source adder function.**
-  /// @details Loads an OpenGL shader source from its corresponding source file.
+  /// @details Loads an OpenGL shader source from its corresponding source file. The source is
+  /// compiled by the @link build @endlink method.
   void addsource (
                   std::string loc_shader_filename,                                                  ///< GLSL shader file name.
                   shader_type loc_shader_type                                                       ///< GLSL shader type.
                  );
 
   /// @brief    **OpenGL shader builder.**
-  /// @details  It builds an OpenGL shader.
+  /// @details  It builds an OpenGL shader. The locations of the camera uniforms ("V_mat",
+  /// "P_mat", "size_x", "size_y", "AR") are resolved here, once. A shader can instead declare
+  /// the camera state as the uniform block shared by all shader programs:
+  ///
+  ///     layout (std140) uniform nu_camera {mat4 V_mat; mat4 P_mat; float size_x; float size_y; float AR;};
+  ///
+  /// in which case it is bound to @link NU_CAMERA_BINDING @endlink and no per-program uniform is
+  /// set at plot time. If a binary cache has been set, the linked program is loaded from (or
+  /// saved to) the cache, skipping the compilation of the sources.
   void build (
               size_t loc_points                                                                     ///< Number of points to be rendered...
              );
 
+  /// @brief    **Program binary cache setter.**
+  /// @details  Sets the directory of the program binary cache. The cached binaries are keyed by
+  /// a hash of the shader sources, of the attribute bindings (argument names and locations) and
+  /// of the OpenGL driver (vendor, renderer and version) strings, so that a change of any of them
+  /// rebuilds the program. To be invoked before the @link build @endlink method.
+  void setcache (
+                 std::string loc_cache_path                                                         ///< Program binary cache directory.
+                );
+
+  /// @brief    **Source file watcher.**
+  /// @details  Starts (or stops) a background thread watching the source files for changes. The
+  /// changed sources are rebuilt by the @link reload @endlink method, between frames.
+  void watch (
+              bool loc_watch                                                                        ///< "Watch" flag.
+             );
+
+  /// @brief    **Hot reloader.**
+  /// @details  Rebuilds the program from the changed sources, if any, and swaps it in place of
+  /// the current one. On compilation or link error, prints the log and keeps the current program.
+  /// Returns true if the program has been swapped. Called by the plot, on the OpenGL thread.
+  bool reload ();
+
+  /// @brief    **OpenGL element buffer setter.**
+  /// @details  Uploads an index vector (e.g. @link mesh::edge @endlink or @link mesh::triangle
+  /// @endlink) in an OpenGL element buffer and sets the @link NU_PLOT_LINES @endlink or
+  /// @link NU_PLOT_TRIANGLES @endlink primitive: the plot draws the indexed primitives directly,
+  /// without any geometry shader expansion of points. The indices refer to the shader arguments.
+  void setindex (
+                 std::vector<GLint>& loc_index,                                                     ///< Node index vector.
+                 plot_primitive      loc_primitive                                                  ///< Plot primitive.
+                );
+
+  /// @brief    **OpenGL glyph setter.**
+  /// @details  Sets the @link NU_PLOT_GLYPHS @endlink primitive: each point is drawn as an
+  /// instance of a glyph made of the given number of GL_TRIANGLES vertices. The shader arguments
+  /// are per-instance attributes (at the active attribute locations of the program, bound by
+  /// @link setarg @endlink and resolved at each link), the glyph vertices are generated by the
+  /// vertex shader from gl_VertexID.
+  void setglyph (
+                 GLsizei loc_glyph_size                                                             ///< Number of vertices per glyph.
+                );
+
+  /// @brief    **Frustum culling setter.**
+  /// @details  Builds a compute pass that, before each plot, culls the points lying outside the
+  /// view frustum and decimates the points farther than the level of detail distance (one point
+  /// every 2^level, doubling the distance at each level). The surviving point indices are written
+  /// in a compacted element buffer drawn by glDrawElementsIndirect, with the count set on the
+  /// GPU. Only for the @link NU_PLOT_POINTS @endlink primitive. Needs OpenGL 4.3.
+  void setculling (
+                   nu::float4* loc_position,                                                        ///< Point positions (shader argument).
+                   GLfloat     loc_lod_distance                                                     ///< Level of detail distance (0 = no decimation).
+                  );
+
+  /// @brief    **Frustum culling pass.**
+  /// @details  Runs the culling compute pass for the given camera. Called by the plot.
+  void cull (
+             float loc_view_matrix[16],                                                             ///< View matrix.
+             float loc_projection_matrix[16]                                                        ///< Projection matrix.
+            );
+
   /////////////////////////////////////////////////////////////////////////////////////////////////////
   /////////////////////////////////////// setarg "functions" //////////////////////////////////////////
   /////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -116,8 +249,65 @@ public:
                GLuint      loc_layout_index                                                         ///< Data layout index.
               );
 
+  /// @overload setarg(nu::half1* loc_data, GLuint loc_layout_index)
+  /// @details Sets an argument in the OpenGL shader.
+  void setarg (
+               nu::half1* loc_data,                                                                 ///< Data object.
+               GLuint     loc_layout_index                                                          ///< Data layout index.
+              );
+
+  /// @overload setarg(nu::half4* loc_data, GLuint loc_layout_index)
+  /// @details Sets an argument in the OpenGL shader.
+  void setarg (
+               nu::half4* loc_data,                                                                 ///< Data object.
+               GLuint     loc_layout_index                                                          ///< Data layout index.
+              );
+
+  /// @overload setarg(nu::short4* loc_data, GLuint loc_layout_index)
+  /// @details Sets an argument in the OpenGL shader.
+  void setarg (
+               nu::short4* loc_data,                                                                ///< Data object.
+               GLuint      loc_layout_index                                                         ///< Data layout index.
+              );
+
+  /// @overload setarg(nu::uchar4* loc_data, GLuint loc_layout_index)
+  /// @details Sets an argument in the OpenGL shader.
+  void setarg (
+               nu::uchar4* loc_data,                                                                ///< Data object.
+               GLuint      loc_layout_index                                                         ///< Data layout index.
+              );
+
+  /// @overload setarg(nu::double1* loc_data, GLuint loc_layout_index)
+  /// @details Sets an argument in the OpenGL shader.
+  void setarg (
+               nu::double1* loc_data,                                                               ///< Data object.
+               GLuint       loc_layout_index                                                        ///< Data layout index.
+              );
+
+  /// @overload setarg(nu::double2* loc_data, GLuint loc_layout_index)
+  /// @details Sets an argument in the OpenGL shader.
+  void setarg (
+               nu::double2* loc_data,                                                               ///< Data object.
+               GLuint       loc_layout_index                                                        ///< Data layout index.
+              );
+
+  /// @overload setarg(nu::double3* loc_data, GLuint loc_layout_index)
+  /// @details Sets an argument in the OpenGL shader.
+  void setarg (
+               nu::double3* loc_data,                                                               ///< Data object.
+               GLuint       loc_layout_index                                                        ///< Data layout index.
+              );
+
+  /// @overload setarg(nu::double4* loc_data, GLuint loc_layout_index)
+  /// @details Sets an argument in the OpenGL shader.
+  void setarg (
+               nu::double4* loc_data,                                                               ///< Data object.
+               GLuint       loc_layout_index                                                        ///< Data layout index.
+              );
+
   /// @brief **Class destructor.**
-  /// @details It does nothing.
+  /// @details Stops the source file watcher and deletes the element buffer and the culling
+  /// objects, if any.
   ~shader ();
 };
 }
@@ -0,0 +1,87 @@
+/// @file     snapshot.hpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Declaration of a checkpoint "snapshot" class.
+///
+/// @details  A Neutrino "snapshot" saves the state of a run (the device buffers of all the data
+/// objects of the @link neutrino::container @endlink) to a single binary file and restores it, to
+/// restart long runs after a crash or a preemption. The file is made of a versioned header, a
+/// table with the type, element size and number of elements of each data object and the data
+/// blocks, aligned to @link NU_SNAPSHOT_ALIGN @endlink bytes. The device buffers are read with
+/// non-blocking reads into a host staging area and written to disk by a background thread, so the
+/// computation goes on while the file is written: the following kernels are enqueued after the
+/// reads, therefore the snapshot is consistent. The file is written to a temporary file and
+/// renamed when complete, so a crash during the save leaves the previous snapshot intact. The
+/// restore maps the file in memory and uploads the data blocks directly into the device buffers.
+/// To be invoked between kernel launches (outside of the @link opencl::acquire @endlink and
+/// @link opencl::release @endlink calls):
+///
+///     P->save ("run.nusnap");
+///     ...
+///     P->restore ("run.nusnap");
+
+#ifndef snapshot_hpp
+#define snapshot_hpp
+
+#include "neutrino.hpp"
+#include "data_classes.hpp"
+#include <thread>
+#include <atomic>
+
+namespace nu
+{
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////// "snapshot" class ////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class snapshot
+/// ### Checkpoint snapshot.
+/// Declares a checkpoint snapshot.
+/// To be used to save and restore the state of a run.
+class snapshot : public neutrino                                                                    ///< @brief **Checkpoint snapshot.**
+{
+private:
+  std::vector<char>     staging;                                                                    ///< @brief **Host staging area (header, table and data blocks).**
+  std::thread           writer;                                                                     ///< @brief **Writer thread.**
+  cl_event              event;                                                                      ///< @brief **Last buffer read event.**
+
+  /// @brief **Writer thread function.**
+  /// @details Waits for the buffer reads and writes the staging area to a temporary file, then
+  /// renames it as the snapshot file.
+  void write (
+              std::string loc_file_name                                                             ///< Snapshot file name.
+             );
+
+public:
+  std::atomic<bool> saving;                                                                         ///< @brief **"Save in progress" flag.**
+  std::atomic<bool> failed;                                                                         ///< @brief **"Last save failed" flag.**
+
+  /// @brief **Class constructor.**
+  /// @details Resets the snapshot.
+  snapshot ();
+
+  /// @brief **Snapshot saver.**
+  /// @details Enqueues the reads of all the device buffers and returns: the file is written by a
+  /// background thread. Waits for the previous save, if still in progress.
+  void save (
+             std::string loc_file_name                                                              ///< Snapshot file name.
+            );
+
+  /// @brief **Save waiter.**
+  /// @details Waits for the save in progress, if any.
+  void wait ();
+
+  /// @brief **Snapshot restorer.**
+  /// @details Maps the snapshot file in memory and uploads its data blocks into the device
+  /// buffers (and into the host data) of all the data objects. The container must hold the same
+  /// data objects, with the same types and sizes, as when the snapshot was saved: otherwise it
+  /// exits with an error.
+  void restore (
+                std::string loc_file_name                                                           ///< Snapshot file name.
+               );
+
+  /// @brief **Class destructor.**
+  /// @details Waits for the save in progress, if any.
+  ~snapshot ();
+};
+}
+#endif
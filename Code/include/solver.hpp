@@ -0,0 +1,112 @@
+/// @file     solver.hpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Declaration of a "solver" class for sparse linear systems.
+///
+/// @details  A Neutrino "solver" solves the linear system A*x = b, being A a @link nu::sparse
+/// @endlink matrix, by means of Jacobi preconditioned Krylov iterative methods:
+/// [Conjugate Gradient](https://en.wikipedia.org/wiki/Conjugate_gradient_method) (CG) for
+/// symmetric positive definite matrices and
+/// [BiCGSTAB](https://en.wikipedia.org/wiki/Biconjugate_gradient_stabilized_method) for
+/// general matrices. The whole iteration runs on the client GPU: the vector updates are fused
+/// together with the dot products that follow them, the scalars of the method are computed and
+/// kept in device memory, and only the residual norm is read back by the host PC, once every
+/// @link check_interval @endlink iterations.
+
+#ifndef solver_hpp
+#define solver_hpp
+
+#include "neutrino.hpp"
+#include "data_classes.hpp"
+#include "sparse.hpp"
+
+namespace nu
+{
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////// "solver" class //////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class solver
+/// ### Sparse linear solver.
+/// Declares a device-resident Krylov solver.
+/// To be used to solve sparse linear systems on the client GPU.
+class solver : public neutrino                                                                      /// @brief **Sparse linear solver.**
+{
+private:
+  nu::sparse*            matrix;                                                                    ///< @brief **System matrix.**
+  cl_program             program;                                                                   ///< @brief **Solver program.**
+  std::vector<cl_kernel> kernel;                                                                    ///< @brief **Solver kernels.**
+  cl_mem                 inverse_diagonal;                                                          ///< @brief **Jacobi preconditioner (inverse diagonal).**
+  cl_mem                 partial;                                                                   ///< @brief **Work-group partial sums.**
+  cl_mem                 scalar;                                                                    ///< @brief **Method scalars (alpha, beta, rho, ...).**
+  std::vector<cl_mem>    work;                                                                      ///< @brief **Work vectors.**
+  size_t                 size;                                                                      ///< @brief **System size [#].**
+  size_t                 group_size;                                                                ///< @brief **Work-group size [#].**
+  size_t                 groups;                                                                    ///< @brief **Number of work-groups [#].**
+
+  /// @brief **Kernel enqueuer.**
+  /// @details Enqueues a solver kernel, either on all work-groups or on a single work-group.
+  void enqueue (
+                cl_kernel loc_kernel,                                                               ///< Kernel.
+                size_t    loc_groups                                                                ///< Number of work-groups.
+               );
+
+  /// @brief **Scalar reduction.**
+  /// @details Reduces the work-group partial sums and updates the method scalars on the client.
+  void reduce (
+               cl_int loc_sums,                                                                     ///< Number of partial sums.
+               cl_int loc_mode                                                                      ///< Scalar update mode.
+              );
+
+  /// @brief **Residual reader.**
+  /// @details Reads back the relative residual norm ||r||/||b||. It is the only host sync.
+  float check ();
+
+public:
+  solver_type            type;                                                                      ///< @brief **Solver type.**
+  float                  tolerance;                                                                 ///< @brief **Relative residual tolerance [].**
+  size_t                 max_iterations;                                                            ///< @brief **Maximum number of iterations [#].**
+  size_t                 check_interval;                                                            ///< @brief **Convergence check interval [#].**
+  size_t                 iterations;                                                                ///< @brief **Iterations done by last solve [#].**
+  float                  residual;                                                                  ///< @brief **Relative residual of last solve [].**
+
+  /// @brief **Class constructor.**
+  /// @details Sets the default @link tolerance @endlink, @link max_iterations @endlink and
+  /// @link check_interval @endlink values. The device buffers are created by the @link init
+  /// @endlink method, after the initialization of the @link opencl @endlink object.
+  solver ();
+
+  /// @brief **Solver initializer.**
+  /// @details Creates the work vectors, builds the solver program and computes the Jacobi
+  /// preconditioner. The matrix must have been already initialized.
+  void   init (
+               nu::sparse* loc_matrix,                                                              ///< System matrix.
+               solver_type loc_type                                                                 ///< Solver type.
+              );
+
+  /// @brief **Preconditioner update.**
+  /// @details Recomputes the Jacobi preconditioner from the matrix diagonal. To be called each
+  /// time the matrix values are re-assembled.
+  void   precondition ();
+
+  /// @brief **Linear system solver.**
+  /// @details Solves A*x = b, using x as initial guess. Both vectors must have been already set
+  /// as kernel arguments (their OpenCL buffers must exist) and, in interoperability modality, they
+  /// must have been acquired. Returns the number of iterations done.
+  size_t solve (
+                nu::float1* loc_x,                                                                  ///< Solution (initial guess).
+                nu::float1* loc_b                                                                   ///< Right hand side.
+               );
+
+  /// @overload solve(cl_mem loc_x, cl_mem loc_b)
+  /// @details Solves A*x = b, using raw OpenCL buffers.
+  size_t solve (
+                cl_mem loc_x,                                                                       ///< Solution buffer (initial guess).
+                cl_mem loc_b                                                                        ///< Right hand side buffer.
+               );
+
+  /// @brief **Class destructor.**
+  /// @details Releases the work vectors, the solver kernels and the solver program.
+  ~solver ();
+};
+}
+#endif
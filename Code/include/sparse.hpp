@@ -0,0 +1,162 @@
+/// @file     sparse.hpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Declaration of a "sparse" matrix class.
+///
+/// @details  A Neutrino "sparse" matrix is a square matrix whose nonzero pattern is given by the
+/// node connectivity of a @link nu::mesh @endlink (each node coupled with itself and with its
+/// neighbours), or by any user supplied CSR pattern. The pattern is assembled on the host PC in
+/// [Compressed Sparse Row](https://en.wikipedia.org/wiki/Sparse_matrix) (CSR) form, then it is
+/// packed on the client GPU either in CSR, ELLPACK (ELL) or sliced ELLPACK (SELL-C) form,
+/// depending on the row-length statistics of the pattern. The matrix-vector product (SpMV) is
+/// done by a dedicated OpenCL program owned by the matrix, therefore it can run on the same
+/// buffers used by the user's kernels without exporting them to another library.
+
+#ifndef sparse_hpp
+#define sparse_hpp
+
+#include "neutrino.hpp"
+#include "data_classes.hpp"
+#include "mesh.hpp"
+
+namespace nu
+{
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////// "sparse" class //////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @class sparse
+/// ### Sparse matrix.
+/// Declares a square sparse matrix of **GLfloat** numbers.
+/// To be used to run sparse matrix-vector products on the client GPU.
+class sparse : public neutrino                                                                      /// @brief **Sparse matrix.**
+{
+private:
+  std::vector<GLint>   slice_offset;                                                                ///< @brief **SELL-C slice offsets [#].**
+  std::vector<GLint>   slice_width;                                                                 ///< @brief **SELL-C slice widths [#].**
+  std::vector<GLint>   packed_column;                                                               ///< @brief **Column indices in device format [#].**
+  std::vector<GLfloat> packed_value;                                                                ///< @brief **Values in device format.**
+  std::vector<GLint>   position;                                                                    ///< @brief **CSR index to device format index map [#].**
+  cl_mem               row_offset_buffer;                                                           ///< @brief **CSR row offset buffer.**
+  cl_mem               slice_offset_buffer;                                                         ///< @brief **SELL-C slice offset buffer.**
+  cl_mem               slice_width_buffer;                                                          ///< @brief **SELL-C slice width buffer.**
+  cl_mem               column_buffer;                                                               ///< @brief **Column index buffer.**
+  cl_mem               value_buffer;                                                                ///< @brief **Value buffer.**
+  size_t               global_size;                                                                 ///< @brief **SpMV kernel global size [#].**
+  size_t               local_size;                                                                  ///< @brief **SpMV kernel local size [#].**
+
+  /// @brief **Row-length statistics function.**
+  /// @details Computes the minimum, maximum, mean and standard deviation of the row lengths.
+  void analyse ();
+
+  /// @brief **Format selector function.**
+  /// @details Chooses the device storage format from the row-length statistics: ELL is chosen if
+  /// its padding stays below @link NU_SPARSE_ELL_MAX_FILL @endlink, otherwise SELL-C is chosen if
+  /// its padding stays below @link NU_SPARSE_SELL_MAX_FILL @endlink, otherwise CSR is chosen.
+  sparse_format choose ();
+
+  /// @brief **Packing function.**
+  /// @details Packs the CSR host pattern in the selected device storage format.
+  void pack ();
+
+  /// @brief **SpMV program builder.**
+  /// @details Builds the SpMV OpenCL program and creates the kernel for the selected format.
+  void compile ();
+
+public:
+  sparse_format        format;                                                                      ///< @brief **Device storage format.**
+  size_t               rows;                                                                        ///< @brief **Number of rows (and columns) [#].**
+  size_t               nonzeros;                                                                    ///< @brief **Number of stored nonzeros [#].**
+  size_t               row_min;                                                                     ///< @brief **Minimum row length [#].**
+  size_t               row_max;                                                                     ///< @brief **Maximum row length [#].**
+  float                row_mean;                                                                    ///< @brief **Mean row length [#].**
+  float                row_deviation;                                                               ///< @brief **Row length standard deviation [#].**
+  float                fill;                                                                        ///< @brief **Device padding ratio (stored/nonzeros) [].**
+  std::vector<GLint>   row_offset;                                                                  ///< @brief **CSR row offsets (rows + 1) [#].**
+  std::vector<GLint>   column;                                                                      ///< @brief **CSR column indices [#].**
+  std::vector<GLfloat> value;                                                                       ///< @brief **CSR values.**
+  cl_program           program;                                                                     ///< @brief **SpMV program.**
+  cl_kernel            kernel_id;                                                                   ///< @brief **SpMV kernel id.**
+  bool                 ready;                                                                       ///< @brief **Device buffers "ready" flag.**
+
+  /// @brief **Class constructor.**
+  /// @details Resets the matrix to an empty pattern. The device buffers are created by the
+  /// @link init @endlink method, after the initialization of the @link opencl @endlink object.
+  sparse ();
+
+  /// @brief **Pattern builder from mesh.**
+  /// @details Builds the CSR pattern from the neighbour connectivity of a processed mesh:
+  /// the matrix has one row per mesh node, each row contains the node itself (diagonal) and
+  /// its neighbours. All values are reset to zero.
+  void    build (
+                 nu::mesh* loc_mesh                                                                 ///< Processed mesh.
+                );
+
+  /// @overload build(size_t loc_rows, std::vector<GLint> loc_row_offset, std::vector<GLint> loc_column)
+  /// @details Builds the pattern from a user CSR pattern: the row offsets must be (rows + 1)
+  /// long, starting from 0. All values are reset to zero.
+  void    build (
+                 size_t             loc_rows,                                                       ///< Number of rows [#].
+                 std::vector<GLint> loc_row_offset,                                                 ///< CSR row offsets.
+                 std::vector<GLint> loc_column                                                      ///< CSR column indices.
+                );
+
+  /// @brief **CSR index function.**
+  /// @details Returns the CSR index of the (row, column) entry, or -1 if the entry is not in the
+  /// pattern. Column indices are sorted within each row, therefore it runs a binary search.
+  GLint   index (
+                 size_t loc_row,                                                                    ///< Row index.
+                 size_t loc_column                                                                  ///< Column index.
+                );
+
+  /// @brief **Value setter function.**
+  /// @details Sets the value of the (row, column) entry. The entry must be in the pattern.
+  void    set (
+               size_t  loc_row,                                                                     ///< Row index.
+               size_t  loc_column,                                                                  ///< Column index.
+               GLfloat loc_value                                                                    ///< Value.
+              );
+
+  /// @brief **Value accumulator function.**
+  /// @details Adds a contribution to the (row, column) entry (finite element style assembly).
+  /// The entry must be in the pattern.
+  void    add (
+               size_t  loc_row,                                                                     ///< Row index.
+               size_t  loc_column,                                                                  ///< Column index.
+               GLfloat loc_value                                                                    ///< Value.
+              );
+
+  /// @brief **Sparse matrix initializer.**
+  /// @details Computes the row-length statistics, selects the device storage format (unless
+  /// imposed by the user), packs the pattern, creates the device buffers and builds the SpMV
+  /// program. It must be called after the initialization of the @link opencl @endlink object.
+  void    init (
+                sparse_format loc_format                                                            ///< Storage format (NU_SPARSE_AUTO = automatic).
+               );
+
+  /// @brief **Value writer function.**
+  /// @details Scatters the CSR host values in the device format and writes them on the client.
+  /// To be called each time the values are re-assembled on the host.
+  void    write ();
+
+  /// @brief **Sparse matrix-vector product.**
+  /// @details Computes y = A*x on the client. Both vectors must have been already set as kernel
+  /// arguments (their OpenCL buffers must exist) and, in interoperability modality, they must
+  /// have been acquired. The product is enqueued without waiting for its completion.
+  void    spmv (
+                nu::float1* loc_x,                                                                  ///< Input vector.
+                nu::float1* loc_y                                                                   ///< Output vector.
+               );
+
+  /// @overload spmv(cl_mem loc_x, cl_mem loc_y)
+  /// @details Computes y = A*x on the client, using raw OpenCL buffers.
+  void    spmv (
+                cl_mem loc_x,                                                                       ///< Input vector buffer.
+                cl_mem loc_y                                                                        ///< Output vector buffer.
+               );
+
+  /// @brief **Class destructor.**
+  /// @details Releases the device buffers, the SpMV kernel and the SpMV program.
+  ~sparse ();
+};
+}
+#endif
@@ -0,0 +1,415 @@
+/// @file     capture.cpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Definition of a frame "capture" class.
+
+#include "capture.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////// PNG encoder //////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// Minimal PNG encoder: RGBA 8 bit, no filter, "stored" (uncompressed) deflate blocks.
+static uint32_t nu_png_crc (
+                            const GLubyte* loc_data,                                                // Data.
+                            size_t         loc_size,                                                // Data size [bytes].
+                            uint32_t       loc_crc                                                  // Initial CRC.
+                           )
+{
+  size_t i;                                                                                         // Byte index.
+  int    k;                                                                                         // Bit index.
+
+  for(i = 0; i < loc_size; i++)
+  {
+    loc_crc ^= loc_data[i];                                                                         // Adding byte...
+
+    for(k = 0; k < 8; k++)
+    {
+      loc_crc = (loc_crc >> 1) ^ (0xEDB88320u & (0u - (loc_crc & 1u)));                             // Updating CRC (reflected polynomial)...
+    }
+  }
+
+  return loc_crc;
+}
+
+static void nu_png_put32 (
+                          std::vector<GLubyte>& loc_buffer,                                         // Buffer.
+                          uint32_t              loc_value                                           // Value (written big-endian).
+                         )
+{
+  loc_buffer.push_back ((GLubyte)(loc_value >> 24));
+  loc_buffer.push_back ((GLubyte)(loc_value >> 16));
+  loc_buffer.push_back ((GLubyte)(loc_value >> 8));
+  loc_buffer.push_back ((GLubyte)(loc_value));
+}
+
+static void nu_png_chunk (
+                          std::ofstream&              loc_file,                                     // PNG file.
+                          const char*                 loc_type,                                     // Chunk type.
+                          const std::vector<GLubyte>& loc_data                                      // Chunk data.
+                         )
+{
+  std::vector<GLubyte> loc_buffer;                                                                  // Chunk buffer.
+  uint32_t             loc_crc;                                                                     // Chunk CRC.
+
+  nu_png_put32 (loc_buffer, (uint32_t)loc_data.size ());                                            // Setting chunk length...
+  loc_buffer.insert (loc_buffer.end (), loc_type, loc_type + 4);                                    // Setting chunk type...
+  loc_buffer.insert (loc_buffer.end (), loc_data.begin (), loc_data.end ());                        // Setting chunk data...
+  loc_crc = nu_png_crc (loc_buffer.data () + 4, loc_buffer.size () - 4, 0xFFFFFFFFu) ^ 0xFFFFFFFFu; // Computing CRC (type + data)...
+  nu_png_put32 (loc_buffer, loc_crc);                                                               // Setting chunk CRC...
+  loc_file.write ((const char*)loc_buffer.data (), loc_buffer.size ());                             // Writing chunk...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////// "capture" class ////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+nu::capture::capture ()
+{
+  pbo[0]     = 0;                                                                                   // Resetting pixel buffer...
+  pbo[1]     = 0;                                                                                   // Resetting pixel buffer...
+  fence[0]   = NULL;                                                                                // Resetting fence...
+  fence[1]   = NULL;                                                                                // Resetting fence...
+  pending[0] = false;                                                                               // Resetting "pending read" flag...
+  pending[1] = false;                                                                               // Resetting "pending read" flag...
+  pbo_index  = 0;                                                                                   // Resetting pixel buffer index...
+  stop       = false;                                                                               // Resetting "stop" flag...
+  format     = NU_CAPTURE_RAW;                                                                      // Setting default format...
+  size_x     = 0;                                                                                   // Resetting frame x-size...
+  size_y     = 0;                                                                                   // Resetting frame y-size...
+  captured   = 0;                                                                                   // Resetting captured frames...
+  ready      = false;                                                                               // Resetting "ready" flag...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////// init ////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::capture::init (
+                        nu::opengl*    loc_gui,                                                     // GUI.
+                        std::string    loc_file_name,                                               // Capture file name.
+                        capture_format loc_format                                                   // Capture format.
+                       )
+{
+  size_t i;                                                                                         // Pixel buffer index.
+
+  neutrino::action ("initializing frame capture...");                                               // Printing message...
+
+  format    = loc_format;                                                                           // Setting capture format...
+  file_name = loc_file_name;                                                                        // Setting capture file name...
+  size_x    = loc_gui->framebuffer_size_x;                                                          // Setting frame x-size...
+  size_y    = loc_gui->framebuffer_size_y;                                                          // Setting frame y-size...
+  captured  = 0;                                                                                    // Resetting captured frames...
+  stop      = false;                                                                                // Resetting "stop" flag...
+
+  // Opening capture file (PNG frames are written in one file each):
+  if(format != NU_CAPTURE_PNG)
+  {
+    file.open (file_name, std::ios::out | std::ios::binary | std::ios::trunc);                      // Opening file...
+
+    if(!file.is_open ())
+    {
+      neutrino::error ("unable to open capture file!");                                             // Printing message...
+      exit (EXIT_FAILURE);                                                                          // Exiting...
+    }
+  }
+
+  if(format == NU_CAPTURE_Y4M)
+  {
+    file << "YUV4MPEG2 W" << size_x << " H" << size_y << " F" << NU_CAPTURE_FPS << ":1 Ip A1:1 C444\n";
+  }
+
+  // Creating pixel buffers:
+  glGenBuffers (2, pbo);                                                                            // Generating pixel buffers...
+
+  for(i = 0; i < 2; i++)
+  {
+    glBindBuffer (GL_PIXEL_PACK_BUFFER, pbo[i]);                                                    // Binding pixel buffer...
+    glBufferData (GL_PIXEL_PACK_BUFFER, 4*size_x*size_y, NULL, GL_STREAM_READ);                     // Allocating pixel buffer...
+    pending[i] = false;                                                                             // Resetting "pending read" flag...
+  }
+
+  glBindBuffer (GL_PIXEL_PACK_BUFFER, 0);                                                           // Unbinding pixel buffer...
+  pbo_index = 0;                                                                                    // Resetting pixel buffer index...
+
+  writer    = std::thread (&nu::capture::loop, this);                                               // Starting writer thread...
+  ready     = true;                                                                                 // Setting "ready" flag...
+
+  neutrino::done ();                                                                                // Printing message...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////// grab ////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::capture::grab ()
+{
+  size_t i;                                                                                         // Current pixel buffer index.
+
+  if(!ready)
+  {
+    return;
+  }
+
+  i          = pbo_index;                                                                           // Getting current pixel buffer index...
+
+  // Starting asynchronous read of the current frame:
+  glPixelStorei (GL_PACK_ALIGNMENT, 1);                                                             // Setting tight packing...
+  glBindBuffer (GL_PIXEL_PACK_BUFFER, pbo[i]);                                                      // Binding pixel buffer...
+  glReadPixels (0, 0, size_x, size_y, GL_RGBA, GL_UNSIGNED_BYTE, 0);                                // Reading pixels in pixel buffer...
+  glBindBuffer (GL_PIXEL_PACK_BUFFER, 0);                                                           // Unbinding pixel buffer...
+  fence[i]   = glFenceSync (GL_SYNC_GPU_COMMANDS_COMPLETE, 0);                                      // Inserting read fence...
+  pending[i] = true;                                                                                // Setting "pending read" flag...
+
+  // Collecting the previous frame (already read by the GPU, most likely):
+  pbo_index  = 1 - i;                                                                               // Swapping pixel buffers...
+
+  if(pending[pbo_index])
+  {
+    collect (pbo_index);                                                                            // Collecting previous frame...
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////// collect //////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::capture::collect (
+                           size_t loc_index                                                         // Pixel buffer index.
+                          )
+{
+  GLubyte*             loc_pixels;                                                                  // Mapped pixels.
+  std::vector<GLubyte> loc_frame;                                                                   // Frame.
+
+  glClientWaitSync (fence[loc_index], GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);              // Waiting for read fence...
+  glDeleteSync (fence[loc_index]);                                                                  // Deleting read fence...
+  fence[loc_index]   = NULL;                                                                        // Resetting fence...
+
+  glBindBuffer (GL_PIXEL_PACK_BUFFER, pbo[loc_index]);                                              // Binding pixel buffer...
+  loc_pixels         = (GLubyte*)glMapBufferRange (GL_PIXEL_PACK_BUFFER, 0, 4*size_x*size_y, GL_MAP_READ_BIT);
+
+  if(loc_pixels != NULL)
+  {
+    loc_frame.assign (loc_pixels, loc_pixels + 4*size_x*size_y);                                    // Copying frame...
+    glUnmapBuffer (GL_PIXEL_PACK_BUFFER);                                                           // Unmapping pixel buffer...
+  }
+
+  glBindBuffer (GL_PIXEL_PACK_BUFFER, 0);                                                           // Unbinding pixel buffer...
+  pending[loc_index] = false;                                                                       // Resetting "pending read" flag...
+
+  if(loc_frame.empty ())
+  {
+    neutrino::warning ("unable to map capture pixel buffer, frame skipped!");                       // Printing message...
+    return;
+  }
+
+  // Queuing frame (waiting if the writer thread is too late):
+  std::unique_lock<std::mutex> loc_lock (frames_lock);
+  frames_signal.wait (loc_lock, [this] {return frames.size () < NU_CAPTURE_QUEUE;});
+  frames.push_back (std::move (loc_frame));                                                         // Queuing frame...
+  captured++;                                                                                       // Incrementing captured frames...
+  loc_lock.unlock ();
+  frames_signal.notify_all ();                                                                      // Waking up writer thread...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////// loop ////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::capture::loop ()
+{
+  std::vector<GLubyte> loc_frame;                                                                   // Frame.
+  size_t               loc_frame_index;                                                             // Frame index.
+
+  loc_frame_index = 0;                                                                              // Resetting frame index...
+
+  while(true)
+  {
+    std::unique_lock<std::mutex> loc_lock (frames_lock);
+    frames_signal.wait (loc_lock, [this] {return stop || !frames.empty ();});
+
+    if(frames.empty ())
+    {
+      break;                                                                                        // Stopping (all frames written)...
+    }
+
+    loc_frame = std::move (frames.front ());                                                        // Getting frame...
+    frames.pop_front ();                                                                            // Dequeuing frame...
+    loc_lock.unlock ();
+    frames_signal.notify_all ();                                                                    // Waking up collector...
+
+    write (loc_frame, loc_frame_index);                                                             // Writing frame...
+    loc_frame_index++;                                                                              // Incrementing frame index...
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////// write ///////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::capture::write (
+                         std::vector<GLubyte>& loc_frame,                                           // Frame (bottom-up RGBA).
+                         size_t                loc_frame_index                                      // Frame index.
+                        )
+{
+  int                  i;                                                                           // Row index.
+  int                  j;                                                                           // Column index.
+  size_t               k;                                                                           // Pixel index.
+  size_t               loc_size;                                                                    // Number of pixels.
+  int                  R;                                                                           // Red component.
+  int                  G;                                                                           // Green component.
+  int                  B;                                                                           // Blue component.
+  std::vector<GLubyte> loc_buffer;                                                                  // Encoding buffer.
+  std::vector<GLubyte> loc_header;                                                                  // PNG header chunk.
+  std::vector<GLubyte> loc_data;                                                                    // PNG image data chunk.
+  size_t               loc_row;                                                                     // Bytes per row (PNG filter byte included).
+  size_t               loc_block;                                                                   // Deflate block size [bytes].
+  size_t               n;                                                                           // Deflate block offset [bytes].
+  uint32_t             loc_a;                                                                       // Adler-32 "a" sum.
+  uint32_t             loc_b;                                                                       // Adler-32 "b" sum.
+  std::ofstream        loc_file;                                                                    // PNG file.
+  std::string          loc_number;                                                                  // PNG file number.
+  const GLubyte        loc_signature[8] = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};            // PNG signature.
+
+  loc_size = (size_t)size_x*size_y;                                                                 // Computing number of pixels...
+
+  switch(format)
+  {
+    case NU_CAPTURE_RAW:
+      file.write ((const char*)loc_frame.data (), loc_frame.size ());                               // Writing raw frame...
+      break;
+
+    case NU_CAPTURE_Y4M:
+      loc_buffer.resize (3*loc_size);                                                               // Allocating Y, U and V planes...
+
+      // Converting RGB to YCbCr (BT.601, studio swing), flipping rows top-down:
+      for(i = 0; i < size_y; i++)
+      {
+        for(j = 0; j < size_x; j++)
+        {
+          k                          = 4*((size_t)(size_y - 1 - i)*size_x + j);                     // Getting source pixel...
+          R                          = loc_frame[k + 0];
+          G                          = loc_frame[k + 1];
+          B                          = loc_frame[k + 2];
+          k                          = (size_t)i*size_x + j;                                        // Getting destination pixel...
+          loc_buffer[k]              = (GLubyte)(((66*R + 129*G + 25*B + 128) >> 8) + 16);
+          loc_buffer[loc_size + k]   = (GLubyte)(((-38*R - 74*G + 112*B + 128) >> 8) + 128);
+          loc_buffer[2*loc_size + k] = (GLubyte)(((112*R - 94*G - 18*B + 128) >> 8) + 128);
+        }
+      }
+
+      file << "FRAME\n";                                                                            // Writing frame header...
+      file.write ((const char*)loc_buffer.data (), loc_buffer.size ());                             // Writing frame planes...
+      break;
+
+    case NU_CAPTURE_PNG:
+      loc_row = 4*(size_t)size_x + 1;                                                               // Computing row size...
+      loc_buffer.reserve (loc_row*size_y);                                                          // Allocating filtered image...
+
+      // Building filtered image (filter "none"), flipping rows top-down:
+      for(i = 0; i < size_y; i++)
+      {
+        loc_buffer.push_back (0);                                                                   // Setting row filter byte...
+        loc_buffer.insert (
+                           loc_buffer.end (),
+                           loc_frame.begin () + 4*(size_t)(size_y - 1 - i)*size_x,
+                           loc_frame.begin () + 4*(size_t)(size_y - 1 - i)*size_x + (loc_row - 1)
+                          );                                                                        // Copying row...
+      }
+
+      // Building zlib stream of stored deflate blocks:
+      loc_data.push_back (0x78);                                                                    // Setting zlib CMF...
+      loc_data.push_back (0x01);                                                                    // Setting zlib FLG...
+
+      for(n = 0; n < loc_buffer.size (); n += loc_block)
+      {
+        loc_block = std::min ((size_t)65535, loc_buffer.size () - n);                               // Computing block size...
+        loc_data.push_back ((n + loc_block == loc_buffer.size ()) ? 1 : 0);                         // Setting "final block" flag...
+        loc_data.push_back ((GLubyte)(loc_block & 0xFF));                                           // Setting block size (LSB)...
+        loc_data.push_back ((GLubyte)(loc_block >> 8));                                             // Setting block size (MSB)...
+        loc_data.push_back ((GLubyte)(~loc_block & 0xFF));                                          // Setting block size complement (LSB)...
+        loc_data.push_back ((GLubyte)((~loc_block >> 8) & 0xFF));                                   // Setting block size complement (MSB)...
+        loc_data.insert (loc_data.end (), loc_buffer.begin () + n, loc_buffer.begin () + n + loc_block);
+      }
+
+      // Computing Adler-32 checksum:
+      loc_a = 1;
+      loc_b = 0;
+
+      for(k = 0; k < loc_buffer.size (); k++)
+      {
+        loc_a = (loc_a + loc_buffer[k])%65521;
+        loc_b = (loc_b + loc_a)%65521;
+      }
+
+      nu_png_put32 (loc_data, (loc_b << 16) | loc_a);                                               // Setting zlib checksum...
+
+      // Building header (RGBA, 8 bit, no interlace):
+      nu_png_put32 (loc_header, (uint32_t)size_x);                                                  // Setting width...
+      nu_png_put32 (loc_header, (uint32_t)size_y);                                                  // Setting height...
+      loc_header.insert (loc_header.end (), {8, 6, 0, 0, 0});                                       // Setting bit depth, color type, compression, filter, interlace...
+
+      loc_number = std::to_string (loc_frame_index);                                                // Getting frame number...
+      loc_number = std::string (6 - std::min ((size_t)6, loc_number.size ()), '0') + loc_number;    // Padding frame number...
+      loc_file.open (file_name + "_" + loc_number + ".png", std::ios::out | std::ios::binary);      // Opening PNG file...
+
+      if(!loc_file.is_open ())
+      {
+        neutrino::warning ("unable to open PNG capture file, frame skipped!");                      // Printing message...
+        break;
+      }
+
+      loc_file.write ((const char*)loc_signature, 8);                                               // Writing PNG signature...
+      nu_png_chunk (loc_file, "IHDR", loc_header);                                                  // Writing header...
+      nu_png_chunk (loc_file, "IDAT", loc_data);                                                    // Writing image data...
+      nu_png_chunk (loc_file, "IEND", std::vector<GLubyte> ());                                     // Writing end...
+      loc_file.close ();                                                                            // Closing PNG file...
+      break;
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////// close ///////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::capture::close ()
+{
+  size_t i;                                                                                         // Pixel buffer index.
+
+  if(!ready)
+  {
+    return;
+  }
+
+  neutrino::action ("terminating frame capture...");                                                // Printing message...
+
+  // Collecting the last frame:
+  for(i = 0; i < 2; i++)
+  {
+    if(pending[pbo_index])
+    {
+      collect (pbo_index);                                                                          // Collecting frame...
+    }
+
+    pbo_index = 1 - pbo_index;                                                                      // Swapping pixel buffers...
+  }
+
+  // Stopping writer thread, after all queued frames have been written:
+  {
+    std::lock_guard<std::mutex> loc_lock (frames_lock);
+    stop = true;                                                                                    // Setting "stop" flag...
+  }
+
+  frames_signal.notify_all ();                                                                      // Waking up writer thread...
+  writer.join ();                                                                                   // Waiting for writer thread...
+
+  if(file.is_open ())
+  {
+    file.close ();                                                                                  // Closing capture file...
+  }
+
+  glDeleteBuffers (2, pbo);                                                                         // Deleting pixel buffers...
+  ready = false;                                                                                    // Resetting "ready" flag...
+
+  neutrino::done ();                                                                                // Printing message...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////// DESTRUCTOR ////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+nu::capture::~capture ()
+{
+  close ();                                                                                         // Terminating capture...
+}
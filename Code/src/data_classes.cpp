@@ -4,81 +4,642 @@
 /// @brief    Definitions of classes used for data storage.
 
 #include "data_classes.hpp"
+#include "neutrino.hpp"
+#include <thread>
+#include <functional>
+#include <cstdint>
+
+#if defined(__linux__) || defined(__APPLE__)
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <fcntl.h>
+  #include <unistd.h>
+#endif
 
 std::vector<nu::data*> nu::data::container;                                                         // Neutrino data array.
 
-///////////////////////////////////////////////////////////////////////////////////////////////////////
-//////////////////////////////////////////////// "int" class //////////////////////////////////////////
-///////////////////////////////////////////////////////////////////////////////////////////////////////
-nu::int1::int1(
-               size_t loc_layout                                                                    // Kernel argument layout index.
-              )
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////// Data loaders //////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// Builds a full file name from a directory and a file name:
+static std::string nu_path (
+                            std::string loc_file_directory,                                         // File directory.
+                            std::string loc_file_name                                               // File name.
+                           )
 {
-  size_t i;                                                                                         // Data vector current index.
-
-  i                              = nu::data::container.size ();                                     // Getting data vector current index...
-  nu::data::container.push_back (this);
-  nu::data::container[i]->type   = NU_INT;                                                          // Setting Neutrino data type...
-  nu::data::container[i]->layout = loc_layout;                                                      // Setting kernel argument layout index...
-  ready                          = false;                                                           // Resetting "ready" flag...
+  #ifdef WIN32
+    return loc_file_directory + std::string ("\\") + loc_file_name;                                 // Backslash.
+  #else
+    return loc_file_directory + std::string ("/") + loc_file_name;                                  // Slash.
+  #endif
 }
 
-void nu::int1::read
-(
- std::string loc_file_directory,                                                                    // File directory.
- std::string loc_file_name                                                                          // File name.
-)
+// Maps a file in memory (reads it, where memory mapping is not available). Throws errno on error:
+static const char* nu_map (
+                           std::string        loc_full_name,                                        // Full file name.
+                           size_t*            loc_size,                                             // File size [bytes].
+                           std::vector<char>& loc_read                                              // Read file (no memory mapping).
+                          )
 {
-  // EZOR 13MAY2021 to be modified according to std::vector data.
-  //size_t      i;                                                                                    // Data index.
-  //GLint       loc_data;                                                                             // File data.
+  const char* loc_map = NULL;                                                                       // Mapped file.
 
-  std::string loc_full_name;                                                                        // Full file name.
+  *loc_size = 0;
 
-  #ifdef __linux__
-    loc_full_name = loc_file_directory +                                                            // Data directory.
-                    std::string ("/") +                                                             // Slash.
-                    loc_file_name;                                                                  // Data file name.
-  #endif
+  #if defined(__linux__) || defined(__APPLE__)
+    int         loc_descriptor;                                                                     // File descriptor.
+    struct stat loc_stat;                                                                           // File status.
+    int         loc_errno;                                                                          // Error number.
+
+    (void)loc_read;                                                                                 // Not used with memory mapping...
+    loc_descriptor = open (loc_full_name.c_str (), O_RDONLY);                                       // Opening file...
+
+    if(loc_descriptor < 0)
+    {
+      throw(errno);                                                                                 // Throwing error in case of a reading problem...
+    }
+
+    if(fstat (loc_descriptor, &loc_stat) != 0)
+    {
+      loc_errno = errno;                                                                            // Saving error number (close may change it)...
+      close (loc_descriptor);                                                                       // Closing file...
+      throw(loc_errno);                                                                             // Throwing error in case of a reading problem...
+    }
 
-  #ifdef __APPLE__
-    loc_full_name = loc_file_directory +                                                            // Data directory.
-                    std::string ("/") +                                                             // Slash.
-                    loc_file_name;                                                                  // Data file name.
+    *loc_size = (size_t)loc_stat.st_size;                                                           // Getting file size...
+
+    if(*loc_size > 0)
+    {
+      loc_map = (const char*)mmap (NULL, *loc_size, PROT_READ, MAP_PRIVATE, loc_descriptor, 0);     // Mapping file...
+
+      if(loc_map == (const char*)MAP_FAILED)
+      {
+        loc_errno = errno;                                                                          // Saving error number (close may change it)...
+        close (loc_descriptor);                                                                     // Closing file...
+        throw(loc_errno);                                                                           // Throwing error in case of a reading problem...
+      }
+
+      madvise ((void*)loc_map, *loc_size, MADV_SEQUENTIAL);                                         // Advising sequential access...
+    }
+
+    close (loc_descriptor);                                                                         // Closing file (the mapping stays)...
+  #else
+    std::ifstream loc_file (loc_full_name, std::ios::binary | std::ios::ate);                       // File.
+
+    if(!loc_file)
+    {
+      throw(errno);                                                                                 // Throwing error in case of a reading problem...
+    }
+
+    *loc_size = (size_t)loc_file.tellg ();                                                          // Getting file size...
+    loc_read.resize (*loc_size);
+    loc_file.seekg (0);
+    loc_file.read (loc_read.data (), *loc_size);                                                    // Reading file...
+    loc_map   = loc_read.data ();
   #endif
 
-  #ifdef WIN32
-    loc_full_name = loc_file_directory +                                                            // Data directory.
-                    std::string ("\\") +                                                            // Backslash.
-                    loc_file_name;                                                                  // Data file name.
+  return loc_map;
+}
+
+// Unmaps a file mapped by "nu_map":
+static void nu_unmap (
+                      const char* loc_map,                                                          // Mapped file.
+                      size_t      loc_size                                                          // File size [bytes].
+                     )
+{
+  #if defined(__linux__) || defined(__APPLE__)
+    if(loc_size > 0)
+    {
+      munmap ((void*)loc_map, loc_size);                                                            // Unmapping file...
+    }
   #endif
+}
 
-  std::ifstream loc_file (loc_full_name);                                                           // File.
+// Runs a function on contiguous ranges of [0, size), one per thread:
+static void nu_parallel (
+                         size_t                               loc_size,                             // Range size.
+                         size_t                               loc_grain,                            // Minimum range size per thread.
+                         std::function<void (size_t, size_t)> loc_function                          // Function (range begin, range end).
+                        )
+{
+  std::vector<std::thread> loc_thread;                                                              // Threads.
+  size_t                   loc_threads;                                                             // Number of threads.
+  size_t                   t;                                                                       // Thread index.
+
+  loc_threads = std::max ((size_t)std::thread::hardware_concurrency (), (size_t)1);
+  loc_threads = std::max (std::min (loc_threads, loc_size/std::max (loc_grain, (size_t)1)), (size_t)1);
 
-  if(loc_file)                                                                                      // Checking file...
+  for(t = 1; t < loc_threads; t++)
   {
-    /* EZOR 18NOV2020 to be modified according to std::vector data.
-       for(i = 0; i < size; i++)
-       {
-       if(loc_file >> loc_data)
-       {
-        container[i] = loc_data;                                                                         // Setting data...
-       }
+    loc_thread.push_back (std::thread (loc_function, loc_size*t/loc_threads, loc_size*(t + 1)/loc_threads));
+  }
 
-       else
-       {
-        container[i] = 0;                                                                                // Resetting data...
-       }
-       }
+  loc_function (0, loc_size/loc_threads);                                                           // Running first range on this thread...
 
-       loc_file.close ();                                                                              // Closing file...
-     */
+  for(t = 0; t < loc_thread.size (); t++)
+  {
+    loc_thread[t].join ();                                                                          // Waiting for thread...
   }
+}
 
-  else
+// Uploads the host data into the device buffer, if already created:
+static void nu_upload (
+                       cl_mem      loc_buffer,                                                      // Device buffer.
+                       const void* loc_host,                                                        // Host data.
+                       size_t      loc_bytes                                                        // Host data size [bytes].
+                      )
+{
+  if(loc_bytes == 0)
+  {
+    return;
+  }
+
+  if(neutrino::interop)
+  {
+    glFinish ();                                                                                    // Waiting for OpenGL to finish...
+    clEnqueueAcquireGLObjects (neutrino::queue_id, 1, &loc_buffer, 0, NULL, NULL);                  // Acquiring shared buffer...
+  }
+
+  clEnqueueWriteBuffer (neutrino::queue_id, loc_buffer, CL_TRUE, 0, loc_bytes, loc_host, 0, NULL, NULL);
+
+  if(neutrino::interop)
+  {
+    clEnqueueReleaseGLObjects (neutrino::queue_id, 1, &loc_buffer, 0, NULL, NULL);                  // Releasing shared buffer...
+  }
+
+  clFinish (neutrino::queue_id);                                                                    // Waiting for OpenCL to finish...
+}
+
+// Parses an integer number:
+static void nu_parse (
+                      const char* loc_text,                                                         // Number text.
+                      GLint*      loc_value                                                         // Number.
+                     )
+{
+  *loc_value = (GLint)strtol (loc_text, NULL, 10);
+}
+
+// Parses a floating point number:
+static void nu_parse (
+                      const char* loc_text,                                                         // Number text.
+                      GLfloat*    loc_value                                                         // Number.
+                     )
+{
+  *loc_value = strtof (loc_text, NULL);
+}
+
+// Parses a double precision floating point number:
+static void nu_parse (
+                      const char* loc_text,                                                         // Number text.
+                      GLdouble*   loc_value                                                         // Number.
+                     )
+{
+  *loc_value = strtod (loc_text, NULL);
+}
+
+// Parses a half precision floating point number:
+static void nu_parse (
+                      const char* loc_text,                                                         // Number text.
+                      GLhalf*     loc_value                                                         // Number.
+                     )
+{
+  *loc_value = nu::half (strtof (loc_text, NULL));
+}
+
+// Parses a 16-bit integer number (saturated):
+static void nu_parse (
+                      const char* loc_text,                                                         // Number text.
+                      GLshort*    loc_value                                                         // Number.
+                     )
+{
+  *loc_value = (GLshort)std::min (std::max (strtol (loc_text, NULL, 10), -32768L), 32767L);
+}
+
+// Parses a normalized [0, 1] number into an 8-bit integer number (saturated):
+static void nu_parse (
+                      const char* loc_text,                                                         // Number text.
+                      GLubyte*    loc_value                                                         // Number.
+                     )
+{
+  *loc_value = (GLubyte)lrintf (std::min (std::max (strtof (loc_text, NULL), 0.0f), 1.0f)*255.0f);
+}
+
+// Checks for a separator character (spaces, commas, semicolons):
+static bool nu_separator (
+                          char loc_character                                                        // Character.
+                         )
+{
+  return (loc_character == ' ') || (loc_character == '\t') || (loc_character == ',') ||
+         (loc_character == ';') || (loc_character == '\r');
+}
+
+// Checks for a data line (starting with a number, comments and headers excluded):
+static bool nu_data_line (
+                          const char* loc_line,                                                     // Line begin.
+                          const char* loc_end                                                       // Line end.
+                         )
+{
+  while((loc_line < loc_end) && nu_separator (*loc_line))
+  {
+    loc_line++;                                                                                     // Skipping separators...
+  }
+
+  return (loc_line < loc_end) &&
+         (isdigit ((unsigned char)*loc_line) || (*loc_line == '-') || (*loc_line == '+') || (*loc_line == '.'));
+}
+
+// Loads binary data (raw elements), truncated or zero filled to the data size:
+template <typename T>
+static void nu_load (
+                     std::string     loc_full_name,                                                 // Full file name.
+                     std::vector<T>& loc_data,                                                      // Data.
+                     cl_mem          loc_buffer,                                                    // Device buffer.
+                     bool            loc_ready                                                      // Device buffer "ready" flag.
+                    )
+{
+  std::vector<char> loc_read;                                                                       // Read file (no memory mapping).
+  const char*       loc_map;                                                                        // Mapped file.
+  size_t            loc_size;                                                                       // File size [bytes].
+  size_t            loc_count;                                                                      // Number of elements in the file [#].
+
+  loc_map   = nu_map (loc_full_name, &loc_size, loc_read);                                          // Mapping file...
+  loc_count = loc_size/sizeof(T);                                                                   // Getting number of elements...
+
+  if(loc_data.empty () && !loc_ready)
+  {
+    loc_data.resize (loc_count);                                                                    // Sizing data as the file...
+  }
+
+  loc_count = std::min (loc_count, loc_data.size ());
+
+  // Copying elements (in parallel, to spread the page faults):
+  nu_parallel (loc_data.size (), NU_LOAD_GRAIN/sizeof(T), [&](size_t loc_begin, size_t loc_end)
+  {
+    size_t loc_copy = (loc_begin < loc_count) ? std::min (loc_end, loc_count) - loc_begin : 0;
+
+    memcpy ((void*)(loc_data.data () + loc_begin), loc_map + loc_begin*sizeof(T), loc_copy*sizeof(T));
+    memset ((void*)(loc_data.data () + loc_begin + loc_copy), 0, (loc_end - loc_begin - loc_copy)*sizeof(T));
+  });
+
+  nu_unmap (loc_map, loc_size);                                                                     // Unmapping file...
+
+  if(loc_ready)
+  {
+    nu_upload (loc_buffer, loc_data.data (), loc_data.size ()*sizeof(T));                           // Uploading data...
+  }
+}
+
+// Reads text data (one element per line, components separated by spaces, commas or semicolons),
+// truncated or zero filled to the data size, with a multithreaded parser:
+template <typename T, typename S>
+static void nu_read (
+                     std::string     loc_full_name,                                                 // Full file name.
+                     std::vector<T>& loc_data,                                                      // Data.
+                     cl_mem          loc_buffer,                                                    // Device buffer.
+                     bool            loc_ready                                                      // Device buffer "ready" flag.
+                    )
+{
+  std::vector<char>   loc_read;                                                                     // Read file (no memory mapping).
+  const char*         loc_map;                                                                      // Mapped file.
+  size_t              loc_size;                                                                     // File size [bytes].
+  size_t              loc_chunks;                                                                   // Number of chunks [#].
+  std::vector<size_t> loc_begin;                                                                    // Chunk begin offsets [bytes].
+  std::vector<size_t> loc_lines;                                                                    // Chunk data lines [#].
+  size_t              loc_total;                                                                    // Total data lines [#].
+  size_t              c;                                                                            // Chunk index.
+
+  loc_map    = nu_map (loc_full_name, &loc_size, loc_read);                                         // Mapping file...
+
+  // Splitting the file in chunks, at line boundaries:
+  loc_chunks = std::max ((size_t)std::thread::hardware_concurrency (), (size_t)1);
+  loc_chunks = std::max (std::min (loc_chunks, loc_size/NU_LOAD_GRAIN), (size_t)1);
+
+  for(c = 0; c <= loc_chunks; c++)
+  {
+    size_t loc_offset = loc_size*c/loc_chunks;                                                      // Chunk begin offset.
+
+    while((c > 0) && (c < loc_chunks) && (loc_offset < loc_size) && (loc_map[loc_offset - 1] != '\n'))
+    {
+      loc_offset++;                                                                                 // Moving to next line...
+    }
+
+    loc_begin.push_back (loc_offset);
+  }
+
+  // Counting data lines in each chunk (in parallel):
+  loc_lines.assign (loc_chunks, 0);
+
+  nu_parallel (loc_chunks, 1, [&](size_t loc_first, size_t loc_last)
+  {
+    for(size_t k = loc_first; k < loc_last; k++)
+    {
+      const char* loc_line = loc_map + loc_begin[k];
+      const char* loc_end  = loc_map + loc_begin[k + 1];
+
+      while(loc_line < loc_end)
+      {
+        const char* loc_eol = (const char*)memchr (loc_line, '\n', loc_end - loc_line);
+
+        loc_eol       = (loc_eol == NULL) ? loc_end : loc_eol;
+        loc_lines[k] += nu_data_line (loc_line, loc_eol) ? 1 : 0;
+        loc_line      = loc_eol + 1;
+      }
+    }
+  });
+
+  loc_total = 0;
+
+  for(c = 0; c < loc_chunks; c++)
+  {
+    size_t loc_count = loc_lines[c];
+
+    loc_lines[c] = loc_total;                                                                       // Setting chunk first element index...
+    loc_total   += loc_count;
+  }
+
+  if(loc_data.empty () && !loc_ready)
   {
-    throw(errno);                                                                                   // Throwing error in case of a reading problem...
+    loc_data.resize (loc_total);                                                                    // Sizing data as the file...
   }
+
+  memset ((void*)loc_data.data (), 0, loc_data.size ()*sizeof(T));                                  // Zero filling data...
+
+  // Parsing data lines in each chunk (in parallel):
+  nu_parallel (loc_chunks, 1, [&](size_t loc_first, size_t loc_last)
+  {
+    char loc_token[NU_MAX_TEXT_SIZE];                                                               // Number text.
+
+    for(size_t k = loc_first; k < loc_last; k++)
+    {
+      const char* loc_line  = loc_map + loc_begin[k];
+      const char* loc_end   = loc_map + loc_begin[k + 1];
+      size_t      loc_index = loc_lines[k];
+
+      while((loc_line < loc_end) && (loc_index < loc_data.size ()))
+      {
+        const char* loc_eol = (const char*)memchr (loc_line, '\n', loc_end - loc_line);
+
+        loc_eol = (loc_eol == NULL) ? loc_end : loc_eol;
+
+        if(nu_data_line (loc_line, loc_eol))
+        {
+          S*     loc_value = (S*)&loc_data[loc_index];                                              // Element components.
+          size_t loc_component;                                                                     // Component index.
+
+          for(loc_component = 0; loc_component < sizeof(T)/sizeof(S); loc_component++)
+          {
+            while((loc_line < loc_eol) && nu_separator (*loc_line))
+            {
+              loc_line++;                                                                           // Skipping separators...
+            }
+
+            if(loc_line >= loc_eol)
+            {
+              break;                                                                                // Missing components stay zero...
+            }
+
+            size_t loc_length = 0;
+
+            while((loc_line < loc_eol) && !nu_separator (*loc_line))
+            {
+              if(loc_length < NU_MAX_TEXT_SIZE - 1)
+              {
+                loc_token[loc_length++] = *loc_line;                                                // Copying number text...
+              }
+
+              loc_line++;
+            }
+
+            loc_token[loc_length] = '\0';
+            nu_parse (loc_token, &loc_value[loc_component]);                                        // Parsing number...
+          }
+
+          loc_index++;
+        }
+
+        loc_line = loc_eol + 1;
+      }
+    }
+  });
+
+  nu_unmap (loc_map, loc_size);                                                                     // Unmapping file...
+
+  if(loc_ready)
+  {
+    nu_upload (loc_buffer, loc_data.data (), loc_data.size ()*sizeof(T));                           // Uploading data...
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////// "data" class //////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::data::access (
+                       void**   loc_host,                                                           // Host data.
+                       size_t*  loc_element,                                                        // Element size [bytes].
+                       size_t*  loc_count,                                                          // Number of elements [#].
+                       cl_mem** loc_buffer,                                                         // Device buffer.
+                       bool**   loc_ready                                                           // Buffer "ready" flag.
+                      )
+{
+  switch(type)
+  {
+    case NU_INT:
+      *loc_host    = ((nu::int1*)this)->data.data ();
+      *loc_element = sizeof(GLint);
+      *loc_count   = ((nu::int1*)this)->data.size ();
+      *loc_buffer  = &((nu::int1*)this)->buffer;
+      *loc_ready   = &((nu::int1*)this)->ready;
+      break;
+
+    case NU_INT2:
+      *loc_host    = ((nu::int2*)this)->data.data ();
+      *loc_element = sizeof(nu_int2_structure);
+      *loc_count   = ((nu::int2*)this)->data.size ();
+      *loc_buffer  = &((nu::int2*)this)->buffer;
+      *loc_ready   = &((nu::int2*)this)->ready;
+      break;
+
+    case NU_INT3:
+      *loc_host    = ((nu::int3*)this)->data.data ();
+      *loc_element = sizeof(nu_int3_structure);
+      *loc_count   = ((nu::int3*)this)->data.size ();
+      *loc_buffer  = &((nu::int3*)this)->buffer;
+      *loc_ready   = &((nu::int3*)this)->ready;
+      break;
+
+    case NU_INT4:
+      *loc_host    = ((nu::int4*)this)->data.data ();
+      *loc_element = sizeof(nu_int4_structure);
+      *loc_count   = ((nu::int4*)this)->data.size ();
+      *loc_buffer  = &((nu::int4*)this)->buffer;
+      *loc_ready   = &((nu::int4*)this)->ready;
+      break;
+
+    case NU_FLOAT:
+      *loc_host    = ((nu::float1*)this)->data.data ();
+      *loc_element = sizeof(GLfloat);
+      *loc_count   = ((nu::float1*)this)->data.size ();
+      *loc_buffer  = &((nu::float1*)this)->buffer;
+      *loc_ready   = &((nu::float1*)this)->ready;
+      break;
+
+    case NU_FLOAT2:
+      *loc_host    = ((nu::float2*)this)->data.data ();
+      *loc_element = sizeof(nu_float2_structure);
+      *loc_count   = ((nu::float2*)this)->data.size ();
+      *loc_buffer  = &((nu::float2*)this)->buffer;
+      *loc_ready   = &((nu::float2*)this)->ready;
+      break;
+
+    case NU_FLOAT3:
+      *loc_host    = ((nu::float3*)this)->data.data ();
+      *loc_element = sizeof(nu_float3_structure);
+      *loc_count   = ((nu::float3*)this)->data.size ();
+      *loc_buffer  = &((nu::float3*)this)->buffer;
+      *loc_ready   = &((nu::float3*)this)->ready;
+      break;
+
+    case NU_FLOAT4:
+      *loc_host    = ((nu::float4*)this)->data.data ();
+      *loc_element = sizeof(nu_float4_structure);
+      *loc_count   = ((nu::float4*)this)->data.size ();
+      *loc_buffer  = &((nu::float4*)this)->buffer;
+      *loc_ready   = &((nu::float4*)this)->ready;
+      break;
+
+    case NU_HALF:
+      *loc_host    = ((nu::half1*)this)->data.data ();
+      *loc_element = sizeof(GLhalf);
+      *loc_count   = ((nu::half1*)this)->data.size ();
+      *loc_buffer  = &((nu::half1*)this)->buffer;
+      *loc_ready   = &((nu::half1*)this)->ready;
+      break;
+
+    case NU_HALF4:
+      *loc_host    = ((nu::half4*)this)->data.data ();
+      *loc_element = sizeof(nu_half4_structure);
+      *loc_count   = ((nu::half4*)this)->data.size ();
+      *loc_buffer  = &((nu::half4*)this)->buffer;
+      *loc_ready   = &((nu::half4*)this)->ready;
+      break;
+
+    case NU_SHORT4:
+      *loc_host    = ((nu::short4*)this)->data.data ();
+      *loc_element = sizeof(nu_short4_structure);
+      *loc_count   = ((nu::short4*)this)->data.size ();
+      *loc_buffer  = &((nu::short4*)this)->buffer;
+      *loc_ready   = &((nu::short4*)this)->ready;
+      break;
+
+    case NU_UCHAR4:
+      *loc_host    = ((nu::uchar4*)this)->data.data ();
+      *loc_element = sizeof(nu_uchar4_structure);
+      *loc_count   = ((nu::uchar4*)this)->data.size ();
+      *loc_buffer  = &((nu::uchar4*)this)->buffer;
+      *loc_ready   = &((nu::uchar4*)this)->ready;
+      break;
+
+    case NU_DOUBLE:
+      *loc_host    = ((nu::double1*)this)->data.data ();
+      *loc_element = sizeof(GLdouble);
+      *loc_count   = ((nu::double1*)this)->data.size ();
+      *loc_buffer  = &((nu::double1*)this)->buffer;
+      *loc_ready   = &((nu::double1*)this)->ready;
+      break;
+
+    case NU_DOUBLE2:
+      *loc_host    = ((nu::double2*)this)->data.data ();
+      *loc_element = sizeof(nu_double2_structure);
+      *loc_count   = ((nu::double2*)this)->data.size ();
+      *loc_buffer  = &((nu::double2*)this)->buffer;
+      *loc_ready   = &((nu::double2*)this)->ready;
+      break;
+
+    case NU_DOUBLE3:
+      *loc_host    = ((nu::double3*)this)->data.data ();
+      *loc_element = sizeof(nu_double3_structure);
+      *loc_count   = ((nu::double3*)this)->data.size ();
+      *loc_buffer  = &((nu::double3*)this)->buffer;
+      *loc_ready   = &((nu::double3*)this)->ready;
+      break;
+
+    case NU_DOUBLE4:
+      *loc_host    = ((nu::double4*)this)->data.data ();
+      *loc_element = sizeof(nu_double4_structure);
+      *loc_count   = ((nu::double4*)this)->data.size ();
+      *loc_buffer  = &((nu::double4*)this)->buffer;
+      *loc_ready   = &((nu::double4*)this)->ready;
+      break;
+  }
+}
+
+cl_int nu::data::share (
+                        std::vector<nu::data*>& loc_data,                                           // Data objects.
+                        bool                    loc_acquire                                         // "Acquire" flag (false = release).
+                       )
+{
+  std::vector<cl_mem> loc_buffer;                                                                   // Shared buffers.
+  void*               loc_host;                                                                     // Host data.
+  size_t              loc_element;                                                                  // Element size [bytes].
+  size_t              loc_count;                                                                    // Number of elements [#].
+  cl_mem*             loc_mem;                                                                      // Device buffer.
+  bool*               loc_ready;                                                                    // Buffer "ready" flag.
+  size_t              i;                                                                            // Data object index.
+
+  if(!neutrino::interop)
+  {
+    return CL_SUCCESS;                                                                              // Nothing to share...
+  }
+
+  for(i = 0; i < loc_data.size (); i++)
+  {
+    loc_data[i]->access (&loc_host, &loc_element, &loc_count, &loc_mem, &loc_ready);
+    loc_buffer.push_back (*loc_mem);                                                                // Adding shared buffer...
+  }
+
+  if(loc_buffer.empty ())
+  {
+    return CL_SUCCESS;
+  }
+
+  if(loc_acquire)
+  {
+    glFinish ();                                                                                    // Waiting for OpenGL to finish...
+    return clEnqueueAcquireGLObjects (neutrino::queue_id, (cl_uint)loc_buffer.size (), loc_buffer.data (), 0, NULL, NULL);
+  }
+
+  return clEnqueueReleaseGLObjects (neutrino::queue_id, (cl_uint)loc_buffer.size (), loc_buffer.data (), 0, NULL, NULL);
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////// "int" class //////////////////////////////////////////
+///////////////////////////////////////////////////////////////////////////////////////////////////////
+nu::int1::int1(
+               size_t loc_layout                                                                    // Kernel argument layout index.
+              )
+{
+  size_t i;                                                                                         // Data vector current index.
+
+  i                              = nu::data::container.size ();                                     // Getting data vector current index...
+  nu::data::container.push_back (this);
+  nu::data::container[i]->type   = NU_INT;                                                          // Setting Neutrino data type...
+  nu::data::container[i]->layout = loc_layout;                                                      // Setting kernel argument layout index...
+  ready                          = false;                                                           // Resetting "ready" flag...
+}
+
+void nu::int1::read (
+                     std::string loc_file_directory,                                                // File directory.
+                     std::string loc_file_name                                                      // File name.
+                    )
+{
+  nu_read<GLint, GLint> (nu_path (loc_file_directory, loc_file_name), data, buffer, ready);
+}
+
+void nu::int1::load (
+                     std::string loc_file_directory,                                                // File directory.
+                     std::string loc_file_name                                                      // File name.
+                    )
+{
+  nu_load<GLint> (nu_path (loc_file_directory, loc_file_name), data, buffer, ready);
 }
 
 nu::int1::~int1()
@@ -102,6 +663,22 @@ nu::int2::int2 (
   ready                          = false;                                                           // Resetting "ready" flag...
 }
 
+void nu::int2::read (
+                     std::string loc_file_directory,                                                // File directory.
+                     std::string loc_file_name                                                      // File name.
+                    )
+{
+  nu_read<nu_int2_structure, GLint> (nu_path (loc_file_directory, loc_file_name), data, buffer, ready);
+}
+
+void nu::int2::load (
+                     std::string loc_file_directory,                                                // File directory.
+                     std::string loc_file_name                                                      // File name.
+                    )
+{
+  nu_load<nu_int2_structure> (nu_path (loc_file_directory, loc_file_name), data, buffer, ready);
+}
+
 nu::int2::~int2 ()
 {
   // Doing nothing!
@@ -123,6 +700,22 @@ nu::int3::int3 (
   ready                          = false;                                                           // Resetting "ready" flag...
 }
 
+void nu::int3::read (
+                     std::string loc_file_directory,                                                // File directory.
+                     std::string loc_file_name                                                      // File name.
+                    )
+{
+  nu_read<nu_int3_structure, GLint> (nu_path (loc_file_directory, loc_file_name), data, buffer, ready);
+}
+
+void nu::int3::load (
+                     std::string loc_file_directory,                                                // File directory.
+                     std::string loc_file_name                                                      // File name.
+                    )
+{
+  nu_load<nu_int3_structure> (nu_path (loc_file_directory, loc_file_name), data, buffer, ready);
+}
+
 nu::int3::~int3 ()
 {
   // Doing nothing!
@@ -144,6 +737,22 @@ nu::int4::int4 (
   ready                          = false;                                                           // Resetting "ready" flag...
 }
 
+void nu::int4::read (
+                     std::string loc_file_directory,                                                // File directory.
+                     std::string loc_file_name                                                      // File name.
+                    )
+{
+  nu_read<nu_int4_structure, GLint> (nu_path (loc_file_directory, loc_file_name), data, buffer, ready);
+}
+
+void nu::int4::load (
+                     std::string loc_file_directory,                                                // File directory.
+                     std::string loc_file_name                                                      // File name.
+                    )
+{
+  nu_load<nu_int4_structure> (nu_path (loc_file_directory, loc_file_name), data, buffer, ready);
+}
+
 nu::int4::~int4 ()
 {
   // Doing nothing!
@@ -165,6 +774,22 @@ nu::float1::float1 (
   ready                          = false;                                                           // Resetting "ready" flag...
 }
 
+void nu::float1::read (
+                       std::string loc_file_directory,                                              // File directory.
+                       std::string loc_file_name                                                    // File name.
+                      )
+{
+  nu_read<GLfloat, GLfloat> (nu_path (loc_file_directory, loc_file_name), data, buffer, ready);
+}
+
+void nu::float1::load (
+                       std::string loc_file_directory,                                              // File directory.
+                       std::string loc_file_name                                                    // File name.
+                      )
+{
+  nu_load<GLfloat> (nu_path (loc_file_directory, loc_file_name), data, buffer, ready);
+}
+
 nu::float1::~float1 ()
 {
   // Doing nothing!
@@ -186,6 +811,22 @@ nu::float2::float2 (
   ready                          = false;                                                           // Resetting "ready" flag...
 }
 
+void nu::float2::read (
+                       std::string loc_file_directory,                                              // File directory.
+                       std::string loc_file_name                                                    // File name.
+                      )
+{
+  nu_read<nu_float2_structure, GLfloat> (nu_path (loc_file_directory, loc_file_name), data, buffer, ready);
+}
+
+void nu::float2::load (
+                       std::string loc_file_directory,                                              // File directory.
+                       std::string loc_file_name                                                    // File name.
+                      )
+{
+  nu_load<nu_float2_structure> (nu_path (loc_file_directory, loc_file_name), data, buffer, ready);
+}
+
 nu::float2::~float2 ()
 {
   // Doing nothing!
@@ -207,6 +848,22 @@ nu::float3::float3 (
   ready                          = false;                                                           // Resetting "ready" flag...
 }
 
+void nu::float3::read (
+                       std::string loc_file_directory,                                              // File directory.
+                       std::string loc_file_name                                                    // File name.
+                      )
+{
+  nu_read<nu_float3_structure, GLfloat> (nu_path (loc_file_directory, loc_file_name), data, buffer, ready);
+}
+
+void nu::float3::load (
+                       std::string loc_file_directory,                                              // File directory.
+                       std::string loc_file_name                                                    // File name.
+                      )
+{
+  nu_load<nu_float3_structure> (nu_path (loc_file_directory, loc_file_name), data, buffer, ready);
+}
+
 nu::float3::~float3 ()
 {
   // Doing nothing!
@@ -228,7 +885,390 @@ nu::float4::float4 (
   ready                          = false;                                                           // Resetting "ready" flag...
 }
 
+void nu::float4::read (
+                       std::string loc_file_directory,                                              // File directory.
+                       std::string loc_file_name                                                    // File name.
+                      )
+{
+  nu_read<nu_float4_structure, GLfloat> (nu_path (loc_file_directory, loc_file_name), data, buffer, ready);
+}
+
+void nu::float4::load (
+                       std::string loc_file_directory,                                              // File directory.
+                       std::string loc_file_name                                                    // File name.
+                      )
+{
+  nu_load<nu_float4_structure> (nu_path (loc_file_directory, loc_file_name), data, buffer, ready);
+}
+
 nu::float4::~float4 ()
 {
   // Doing nothing!
 }
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////// "half1" class ///////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+nu::half1::half1 (
+                    size_t loc_layout                                                               // Kernel argument layout index.
+                   )
+{
+  size_t i;                                                                                         // Data vector current index.
+
+  i                              = nu::data::container.size ();                                     // Getting data vector current index...
+  nu::data::container.push_back (this);
+  nu::data::container[i]->type   = NU_HALF;                                                         // Setting Neutrino data type...
+  nu::data::container[i]->layout = loc_layout;                                                      // Setting kernel argument layout index...
+  ready                          = false;                                                           // Resetting "ready" flag...
+}
+
+void nu::half1::read (
+                       std::string loc_file_directory,                                              // File directory.
+                       std::string loc_file_name                                                    // File name.
+                      )
+{
+  nu_read<GLhalf, GLhalf> (nu_path (loc_file_directory, loc_file_name), data, buffer, ready);
+}
+
+void nu::half1::load (
+                       std::string loc_file_directory,                                              // File directory.
+                       std::string loc_file_name                                                    // File name.
+                      )
+{
+  nu_load<GLhalf> (nu_path (loc_file_directory, loc_file_name), data, buffer, ready);
+}
+
+nu::half1::~half1 ()
+{
+  // Doing nothing!
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////// "half4" class ///////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+nu::half4::half4 (
+                    size_t loc_layout                                                               // Kernel argument layout index.
+                   )
+{
+  size_t i;                                                                                         // Data vector current index.
+
+  i                              = nu::data::container.size ();                                     // Getting data vector current index...
+  nu::data::container.push_back (this);
+  nu::data::container[i]->type   = NU_HALF4;                                                        // Setting Neutrino data type...
+  nu::data::container[i]->layout = loc_layout;                                                      // Setting kernel argument layout index...
+  ready                          = false;                                                           // Resetting "ready" flag...
+}
+
+void nu::half4::read (
+                       std::string loc_file_directory,                                              // File directory.
+                       std::string loc_file_name                                                    // File name.
+                      )
+{
+  nu_read<nu_half4_structure, GLhalf> (nu_path (loc_file_directory, loc_file_name), data, buffer, ready);
+}
+
+void nu::half4::load (
+                       std::string loc_file_directory,                                              // File directory.
+                       std::string loc_file_name                                                    // File name.
+                      )
+{
+  nu_load<nu_half4_structure> (nu_path (loc_file_directory, loc_file_name), data, buffer, ready);
+}
+
+nu::half4::~half4 ()
+{
+  // Doing nothing!
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////// "short4" class ///////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+nu::short4::short4 (
+                    size_t loc_layout                                                               // Kernel argument layout index.
+                   )
+{
+  size_t i;                                                                                         // Data vector current index.
+
+  i                              = nu::data::container.size ();                                     // Getting data vector current index...
+  nu::data::container.push_back (this);
+  nu::data::container[i]->type   = NU_SHORT4;                                                       // Setting Neutrino data type...
+  nu::data::container[i]->layout = loc_layout;                                                      // Setting kernel argument layout index...
+  ready                          = false;                                                           // Resetting "ready" flag...
+}
+
+void nu::short4::read (
+                       std::string loc_file_directory,                                              // File directory.
+                       std::string loc_file_name                                                    // File name.
+                      )
+{
+  nu_read<nu_short4_structure, GLshort> (nu_path (loc_file_directory, loc_file_name), data, buffer, ready);
+}
+
+void nu::short4::load (
+                       std::string loc_file_directory,                                              // File directory.
+                       std::string loc_file_name                                                    // File name.
+                      )
+{
+  nu_load<nu_short4_structure> (nu_path (loc_file_directory, loc_file_name), data, buffer, ready);
+}
+
+nu::short4::~short4 ()
+{
+  // Doing nothing!
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////// "uchar4" class ///////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+nu::uchar4::uchar4 (
+                    size_t loc_layout                                                               // Kernel argument layout index.
+                   )
+{
+  size_t i;                                                                                         // Data vector current index.
+
+  i                              = nu::data::container.size ();                                     // Getting data vector current index...
+  nu::data::container.push_back (this);
+  nu::data::container[i]->type   = NU_UCHAR4;                                                       // Setting Neutrino data type...
+  nu::data::container[i]->layout = loc_layout;                                                      // Setting kernel argument layout index...
+  ready                          = false;                                                           // Resetting "ready" flag...
+}
+
+void nu::uchar4::read (
+                       std::string loc_file_directory,                                              // File directory.
+                       std::string loc_file_name                                                    // File name.
+                      )
+{
+  nu_read<nu_uchar4_structure, GLubyte> (nu_path (loc_file_directory, loc_file_name), data, buffer, ready);
+}
+
+void nu::uchar4::load (
+                       std::string loc_file_directory,                                              // File directory.
+                       std::string loc_file_name                                                    // File name.
+                      )
+{
+  nu_load<nu_uchar4_structure> (nu_path (loc_file_directory, loc_file_name), data, buffer, ready);
+}
+
+nu::uchar4::~uchar4 ()
+{
+  // Doing nothing!
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////// "double1" class ///////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+nu::double1::double1 (
+                    size_t loc_layout                                                               // Kernel argument layout index.
+                   )
+{
+  size_t i;                                                                                         // Data vector current index.
+
+  i                              = nu::data::container.size ();                                     // Getting data vector current index...
+  nu::data::container.push_back (this);
+  nu::data::container[i]->type   = NU_DOUBLE;                                                       // Setting Neutrino data type...
+  nu::data::container[i]->layout = loc_layout;                                                      // Setting kernel argument layout index...
+  ready                          = false;                                                           // Resetting "ready" flag...
+}
+
+void nu::double1::read (
+                       std::string loc_file_directory,                                              // File directory.
+                       std::string loc_file_name                                                    // File name.
+                      )
+{
+  nu_read<GLdouble, GLdouble> (nu_path (loc_file_directory, loc_file_name), data, buffer, ready);
+}
+
+void nu::double1::load (
+                       std::string loc_file_directory,                                              // File directory.
+                       std::string loc_file_name                                                    // File name.
+                      )
+{
+  nu_load<GLdouble> (nu_path (loc_file_directory, loc_file_name), data, buffer, ready);
+}
+
+nu::double1::~double1 ()
+{
+  // Doing nothing!
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////// "double2" class ///////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+nu::double2::double2 (
+                    size_t loc_layout                                                               // Kernel argument layout index.
+                   )
+{
+  size_t i;                                                                                         // Data vector current index.
+
+  i                              = nu::data::container.size ();                                     // Getting data vector current index...
+  nu::data::container.push_back (this);
+  nu::data::container[i]->type   = NU_DOUBLE2;                                                      // Setting Neutrino data type...
+  nu::data::container[i]->layout = loc_layout;                                                      // Setting kernel argument layout index...
+  ready                          = false;                                                           // Resetting "ready" flag...
+}
+
+void nu::double2::read (
+                       std::string loc_file_directory,                                              // File directory.
+                       std::string loc_file_name                                                    // File name.
+                      )
+{
+  nu_read<nu_double2_structure, GLdouble> (nu_path (loc_file_directory, loc_file_name), data, buffer, ready);
+}
+
+void nu::double2::load (
+                       std::string loc_file_directory,                                              // File directory.
+                       std::string loc_file_name                                                    // File name.
+                      )
+{
+  nu_load<nu_double2_structure> (nu_path (loc_file_directory, loc_file_name), data, buffer, ready);
+}
+
+nu::double2::~double2 ()
+{
+  // Doing nothing!
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////// "double3" class ///////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+nu::double3::double3 (
+                    size_t loc_layout                                                               // Kernel argument layout index.
+                   )
+{
+  size_t i;                                                                                         // Data vector current index.
+
+  i                              = nu::data::container.size ();                                     // Getting data vector current index...
+  nu::data::container.push_back (this);
+  nu::data::container[i]->type   = NU_DOUBLE3;                                                      // Setting Neutrino data type...
+  nu::data::container[i]->layout = loc_layout;                                                      // Setting kernel argument layout index...
+  ready                          = false;                                                           // Resetting "ready" flag...
+}
+
+void nu::double3::read (
+                       std::string loc_file_directory,                                              // File directory.
+                       std::string loc_file_name                                                    // File name.
+                      )
+{
+  nu_read<nu_double3_structure, GLdouble> (nu_path (loc_file_directory, loc_file_name), data, buffer, ready);
+}
+
+void nu::double3::load (
+                       std::string loc_file_directory,                                              // File directory.
+                       std::string loc_file_name                                                    // File name.
+                      )
+{
+  nu_load<nu_double3_structure> (nu_path (loc_file_directory, loc_file_name), data, buffer, ready);
+}
+
+nu::double3::~double3 ()
+{
+  // Doing nothing!
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////// "double4" class ///////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+nu::double4::double4 (
+                    size_t loc_layout                                                               // Kernel argument layout index.
+                   )
+{
+  size_t i;                                                                                         // Data vector current index.
+
+  i                              = nu::data::container.size ();                                     // Getting data vector current index...
+  nu::data::container.push_back (this);
+  nu::data::container[i]->type   = NU_DOUBLE4;                                                      // Setting Neutrino data type...
+  nu::data::container[i]->layout = loc_layout;                                                      // Setting kernel argument layout index...
+  ready                          = false;                                                           // Resetting "ready" flag...
+}
+
+void nu::double4::read (
+                       std::string loc_file_directory,                                              // File directory.
+                       std::string loc_file_name                                                    // File name.
+                      )
+{
+  nu_read<nu_double4_structure, GLdouble> (nu_path (loc_file_directory, loc_file_name), data, buffer, ready);
+}
+
+void nu::double4::load (
+                       std::string loc_file_directory,                                              // File directory.
+                       std::string loc_file_name                                                    // File name.
+                      )
+{
+  nu_load<nu_double4_structure> (nu_path (loc_file_directory, loc_file_name), data, buffer, ready);
+}
+
+nu::double4::~double4 ()
+{
+  // Doing nothing!
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////// Half precision conversion /////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+GLhalf nu::half (
+                 GLfloat loc_value                                                                  // Single precision number.
+                )
+{
+  uint32_t loc_bits;                                                                                // Single precision bits.
+  uint32_t loc_sign;                                                                                // Half precision sign bit.
+  uint32_t loc_abs;                                                                                 // Single precision absolute value bits.
+  GLfloat  loc_subnormal;                                                                           // Subnormal absolute value.
+
+  memcpy (&loc_bits, &loc_value, sizeof(loc_bits));
+  loc_sign = (loc_bits >> 16) & 0x8000;
+  loc_abs  = loc_bits & 0x7FFFFFFF;
+
+  if(loc_abs > 0x7F800000)
+  {
+    return (GLhalf)(loc_sign | 0x7E00);                                                             // NaN...
+  }
+
+  if(loc_abs >= 0x477FF000)
+  {
+    return (GLhalf)(loc_sign | 0x7C00);                                                             // Infinity (or overflow)...
+  }
+
+  if(loc_abs < 0x38800000)
+  {
+    memcpy (&loc_subnormal, &loc_abs, sizeof(loc_subnormal));
+    return (GLhalf)(loc_sign | (uint32_t)lrintf (loc_subnormal*16777216.0f));                       // Subnormal (rounding to nearest even)...
+  }
+
+  // Rebiasing the exponent and rounding the mantissa to nearest even:
+  return (GLhalf)(loc_sign | ((loc_abs - 0x38000000 + 0x0FFF + ((loc_abs >> 13) & 1)) >> 13));
+}
+
+GLfloat nu::single (
+                    GLhalf loc_value                                                                // Half precision number.
+                   )
+{
+  uint32_t loc_sign;                                                                                // Single precision sign bit.
+  uint32_t loc_exponent;                                                                            // Half precision exponent.
+  uint32_t loc_mantissa;                                                                            // Half precision mantissa.
+  uint32_t loc_bits;                                                                                // Single precision bits.
+  GLfloat  loc_single;                                                                              // Single precision number.
+
+  loc_sign     = ((uint32_t)loc_value & 0x8000) << 16;
+  loc_exponent = ((uint32_t)loc_value >> 10) & 0x1F;
+  loc_mantissa = (uint32_t)loc_value & 0x03FF;
+
+  if(loc_exponent == 0)
+  {
+    loc_single = ldexpf ((GLfloat)loc_mantissa, -24);                                               // Subnormal (or zero)...
+    return loc_sign ? -loc_single : loc_single;
+  }
+
+  if(loc_exponent == 31)
+  {
+    loc_bits = loc_sign | 0x7F800000 | (loc_mantissa << 13);                                        // Infinity (or NaN)...
+  }
+
+  else
+  {
+    loc_bits = loc_sign | ((loc_exponent + 112) << 23) | (loc_mantissa << 13);                      // Normal number...
+  }
+
+  memcpy (&loc_single, &loc_bits, sizeof(loc_single));
+
+  return loc_single;
+}
@@ -512,7 +512,7 @@ void device::init
   double_fp_config              = get_cl_device_fp_config                                           // Getting device information...
                                   (
                                    loc_device_id,                                                   // OpenCL device id [cl_device_id].
-                                   CL_DEVICE_COMPILER_AVAILABLE                                     // Parameter of interest [cl_device_info].
+                                   CL_DEVICE_DOUBLE_FP_CONFIG                                       // Parameter of interest [cl_device_info].
                                   );
   endian_little                 = get_cl_bool                                                       // Getting device information...
                                   (
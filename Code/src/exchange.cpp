@@ -0,0 +1,168 @@
+/// @file     exchange.cpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Definition of a frame "exchange" class.
+
+#include "exchange.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////// EXCHANGE ////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+nu::exchange::exchange ()
+{
+  size_t i;                                                                                         // Slot index.
+
+  for(i = 0; i < 3; i++)
+  {
+    slot[i]            = 0;                                                                         // Resetting slot OpenGL buffer...
+    slot_buffer[i]     = NULL;                                                                      // Resetting slot OpenCL buffer...
+    slot_generation[i] = 0;                                                                         // Resetting slot generation...
+  }
+
+  source     = NULL;                                                                                // Resetting source data...
+  size       = 0;                                                                                   // Resetting slot size...
+  middle     = 1;                                                                                   // Setting middle slot index...
+  back       = 0;                                                                                   // Setting back slot index...
+  front      = 2;                                                                                   // Setting front slot index...
+  published  = 0;                                                                                   // Resetting published generation...
+  generation = 0;                                                                                   // Resetting front slot generation...
+  ready      = false;                                                                               // Resetting "ready" flag...
+}
+
+void nu::exchange::init (
+                         nu::float4* loc_source                                                     // Source data.
+                        )
+{
+  cl_int loc_error;                                                                                 // Error code.
+  size_t i;                                                                                         // Slot index.
+
+  neutrino::action ("initializing frame exchange...");                                              // Printing message...
+
+  if(!loc_source->ready)
+  {
+    neutrino::error ("source data not set as kernel argument!");                                    // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  source = loc_source;                                                                              // Setting source data...
+  size   = sizeof(nu_float4_structure)*source->data.size ();                                        // Setting slot size...
+
+  glGenBuffers (3, slot);                                                                           // Generating slot buffers...
+
+  for(i = 0; i < 3; i++)
+  {
+    glBindBuffer (GL_ARRAY_BUFFER, slot[i]);                                                        // Binding slot buffer...
+    glBufferData (GL_ARRAY_BUFFER, size, source->data.data (), GL_DYNAMIC_DRAW);                    // Initializing slot with source data...
+
+    if(neutrino::interop)
+    {
+      slot_buffer[i] = clCreateFromGLBuffer (neutrino::context_id, CL_MEM_WRITE_ONLY, slot[i], &loc_error);
+      neutrino::check_error (loc_error);                                                            // Checking returned error code...
+    }
+
+    else
+    {
+      slot_data[i] = source->data;                                                                  // Initializing slot host data...
+    }
+  }
+
+  glBindBuffer (GL_ARRAY_BUFFER, 0);                                                                // Unbinding slot buffer...
+  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+
+  middle     = 1;                                                                                   // Setting middle slot index...
+  back       = 0;                                                                                   // Setting back slot index...
+  front      = 2;                                                                                   // Setting front slot index...
+  published  = 0;                                                                                   // Resetting published generation...
+  generation = 0;                                                                                   // Resetting front slot generation...
+  ready      = true;                                                                                // Setting "ready" flag...
+
+  neutrino::done ();                                                                                // Printing message...
+}
+
+void nu::exchange::publish ()
+{
+  GLuint loc_old;                                                                                   // Previous middle slot.
+  cl_mem loc_shared[2];                                                                             // Shared buffers (source and back slot).
+
+  if(neutrino::interop)
+  {
+    loc_shared[0] = source->buffer;                                                                 // Setting source buffer...
+    loc_shared[1] = slot_buffer[back];                                                              // Setting back slot buffer...
+
+    // Copying source data in back slot, on the device (both shared buffers acquired for the copy):
+    neutrino::check_error (clEnqueueAcquireGLObjects (neutrino::queue_id, 2, loc_shared, 0, NULL, NULL));
+    neutrino::check_error (clEnqueueCopyBuffer (neutrino::queue_id, source->buffer, slot_buffer[back], 0, 0, size, 0, NULL, NULL));
+    neutrino::check_error (clEnqueueReleaseGLObjects (neutrino::queue_id, 2, loc_shared, 0, NULL, NULL));
+    neutrino::check_error (clFinish (neutrino::queue_id));                                          // Waiting for the copy to complete...
+  }
+
+  else
+  {
+    // Reading source data in back slot, on the host:
+    neutrino::check_error (clEnqueueReadBuffer (neutrino::queue_id, source->buffer, CL_TRUE, 0, size, slot_data[back].data (), 0, NULL, NULL));
+  }
+
+  slot_generation[back] = ++published;                                                              // Setting back slot generation...
+  loc_old               = middle.exchange (back | NU_EXCHANGE_FRESH, std::memory_order_acq_rel);    // Publishing back slot as middle slot...
+  back                  = loc_old & ~NU_EXCHANGE_FRESH;                                             // Taking previous middle slot as back slot...
+}
+
+bool nu::exchange::update ()
+{
+  GLsync loc_fence;                                                                                 // Front slot fence.
+  GLuint loc_old;                                                                                   // Previous middle slot.
+
+  if(!(middle.load (std::memory_order_acquire) & NU_EXCHANGE_FRESH))
+  {
+    return false;                                                                                   // Nothing new published: keeping front slot...
+  }
+
+  // Waiting for OpenGL to finish with the front slot, before handing it to the compute thread:
+  loc_fence = glFenceSync (GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+  glClientWaitSync (loc_fence, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+  glDeleteSync (loc_fence);
+
+  loc_old = middle.exchange (front, std::memory_order_acq_rel);                                     // Handing front slot as middle slot...
+  front   = loc_old & ~NU_EXCHANGE_FRESH;                                                           // Taking previous middle slot as front slot...
+
+  if(!neutrino::interop)
+  {
+    glBindBuffer (GL_ARRAY_BUFFER, slot[front]);                                                    // Binding front slot...
+    glBufferSubData (GL_ARRAY_BUFFER, 0, size, slot_data[front].data ());                           // Uploading front slot host data...
+    glBindBuffer (GL_ARRAY_BUFFER, 0);                                                              // Unbinding front slot...
+  }
+
+  generation = slot_generation[front];                                                              // Setting front slot generation...
+
+  return true;
+}
+
+void nu::exchange::bind (
+                         GLuint loc_layout_index                                                    // OpenGL shader layout index.
+                        )
+{
+  glBindVertexArray (source->vao);                                                                  // Binding source VAO...
+  glBindBufferBase (GL_SHADER_STORAGE_BUFFER, loc_layout_index, slot[front]);                       // Binding front slot as SSBO...
+  glBindBuffer (GL_ARRAY_BUFFER, slot[front]);                                                      // Binding front slot as VBO...
+  glVertexAttribPointer (loc_layout_index, 4, GL_FLOAT, GL_FALSE, 0, 0);                            // Setting attribute format...
+  glEnableVertexAttribArray (loc_layout_index);                                                     // Enabling attribute...
+  glBindBuffer (GL_ARRAY_BUFFER, 0);                                                                // Unbinding front slot...
+}
+
+nu::exchange::~exchange ()
+{
+  size_t i;                                                                                         // Slot index.
+
+  if(ready)
+  {
+    for(i = 0; i < 3; i++)
+    {
+      if(slot_buffer[i] != NULL)
+      {
+        clReleaseMemObject (slot_buffer[i]);                                                        // Releasing slot OpenCL buffer...
+      }
+    }
+
+    glDeleteBuffers (3, slot);                                                                      // Deleting slot OpenGL buffers...
+  }
+}
@@ -16,9 +16,14 @@ nu::kernel::kernel ()
   size_k           = 0;                                                                             // Initializing kernel size (k-index)...
   event            = NULL;                                                                          // Initializing kernel event...
   kernel_id        = NULL;                                                                          // Initializing kernel id...
+  pending_program  = NULL;                                                                          // Initializing rebuilt program...
+  pending          = false;                                                                         // Initializing "rebuilt program" flag...
+  watching         = false;                                                                         // Initializing "watcher running" flag...
 
   neutrino::action ("initializing OpenCL kernel object...");                                        // Printing message...
   compiler_options = "";                                                                            // Setting no options...
+  specialize       = false;                                                                         // Setting no device specialization...
+  fused_state      = "";                                                                            // Setting no fused state...
   neutrino::done ();                                                                                // Printing message...
 }
 
@@ -29,141 +34,540 @@ void nu::kernel::addsource (
                             std::string loc_kernel_file_name                                        // OpenCL kernel file name.
                            )
 {
-  std::string loc_kernel_source;
+  std::string     loc_kernel_source;
+  std::error_code loc_error;                                                                        // File system error code.
 
   neutrino::action ("loading OpenCL kernel source from file...");                                   // Printing message...
   loc_kernel_source  = neutrino::read_file (loc_kernel_file_name);                                  // Loading kernel source...
   loc_kernel_source += '\n';                                                                        // Appending \n...
+  source_index.push_back (kernel_source.size ());                                                   // Adding kernel source index...
   kernel_source.push_back (loc_kernel_source);                                                      // Adding kernel source...
+  source_file.push_back (loc_kernel_file_name);                                                     // Adding kernel source file name...
+  source_time.push_back (std::filesystem::last_write_time (loc_kernel_file_name, loc_error));       // Getting modification time...
   neutrino::done ();                                                                                // Printing message...
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////
-//////////////////////////////////////////////// build ///////////////////////////////////////////////
+////////////////////////////////////////////// addentry //////////////////////////////////////////////
 //////////////////////////////////////////////////////////////////////////////////////////////////////
-void nu::kernel::build (
-                        size_t loc_kernel_size_i,                                                   // OpenCL kernel size (i-index).
-                        size_t loc_kernel_size_j,                                                   // OpenCL kernel size (j-index).
-                        size_t loc_kernel_size_k                                                    // OpenCL kernel size (k-index).
-                       )
+void nu::kernel::addentry (
+                           std::string loc_entry_name                                               // OpenCL kernel entry point name.
+                          )
+{
+  neutrino::action ("adding OpenCL kernel entry point...");                                         // Printing message...
+  entry_name.push_back (loc_entry_name);                                                            // Adding entry point name...
+  neutrino::done ();                                                                                // Printing message...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////// getentry //////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+cl_kernel nu::kernel::getentry (
+                                std::string loc_entry_name                                          // OpenCL kernel entry point name.
+                               )
 {
-  cl_int  loc_error;                                                                                // Error code.
-  char*   loc_options;                                                                              // Options temporary char buffer.
-  char**  loc_kernel_source;                                                                        // Source file temporary char buffer.
-  size_t* loc_kernel_source_size;                                                                   // Source file as string.
-  size_t  loc_log_size;                                                                             // OpenCL JIT compiler log size.
-  GLuint  i;                                                                                        // Index.
-  size_i                                = loc_kernel_size_i;                                        // Getting OpenCL kernel size (i-index)...
-  size_j                                = loc_kernel_size_j;                                        // Getting OpenCL kernel size (j-index)...
-  size_k                                = loc_kernel_size_k;                                        // Getting OpenCL kernel size (k-index)...
-
-  loc_options                           = new char[compiler_options.size () + 1]();                 // Building temporary options char buffer...
-  loc_options[compiler_options.size ()] = '\0';                                                     // Null terminating options string...
-  compiler_options.copy (loc_options, compiler_options.size ());                                    // Building options string...
-  loc_kernel_source_size                = new size_t[kernel_source.size ()]();                      // Building temporary kernel source char buffer size...
-  loc_kernel_source                     = new char*[kernel_source.size ()]();                       // Building temporary kernel source char buffer...
-
-  neutrino::action ("linking OpenCL kernel sources...");                                            // Printing message...
-
-  for(i = 0; i < kernel_source.size (); i++)
+  size_t i;                                                                                         // Index.
+
+  for(i = 0; i < entry_id.size (); i++)
   {
-    loc_kernel_source_size[i] = kernel_source[i].size ();                                           // Getting source size...
-    loc_kernel_source[i]      = new char[loc_kernel_source_size[i]]();                              // Building temporary source char buffer...
-    kernel_source[i].copy (loc_kernel_source[i], kernel_source[i].size ());                         // Building string source buffer...
+    if(entry_name[i] == loc_entry_name)
+    {
+      return entry_id[i];                                                                           // Returning entry point...
+    }
   }
 
-  neutrino::done ();                                                                                // Printing message...
+  neutrino::error ("OpenCL kernel entry point not found!");                                         // Printing message...
+  exit (EXIT_FAILURE);                                                                              // Exiting...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////// bind ////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::kernel::bind (
+                       GLuint  loc_layout_index,                                                    // Layout index.
+                       cl_mem* loc_buffer                                                           // Data buffer.
+                      )
+{
+  cl_int loc_error;                                                                                 // Error code.
+  size_t i;                                                                                         // Index.
+
+  if(loc_layout_index >= bound_buffer.size ())
+  {
+    bound_buffer.resize (loc_layout_index + 1, NULL);                                               // Extending bound argument buffers...
+  }
+
+  bound_buffer[loc_layout_index] = loc_buffer;                                                      // Recording bound argument buffer...
+
+  for(i = 0; i < entry_id.size (); i++)
+  {
+    if(loc_layout_index < entry_args[i])                                                            // Skipping entry points without this argument...
+    {
+      loc_error = clSetKernelArg
+                  (
+                   entry_id[i],                                                                     // Kernel id.
+                   loc_layout_index,                                                                // Layout index.
+                   sizeof(cl_mem),                                                                  // Data size.
+                   loc_buffer                                                                       // Data value.
+                  );
+
+      neutrino::check_error (loc_error);                                                            // Checking returned error code...
+    }
+  }
+}
 
-  neutrino::action ("creating OpenCL program from kernel sources...");                              // Printing message...
-  program = clCreateProgramWithSource
-            (
-             neutrino::context_id,                                                                  // OpenCL context ID.
-             (cl_uint)kernel_source.size (),                                                        // Number of program sources.
-             (const char**)loc_kernel_source,                                                       // Program source.
-             loc_kernel_source_size,                                                                // Source size.
-             &loc_error                                                                             // Error code.
-            );
-  neutrino::check_error (loc_error);                                                                // Checking error...
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////// fuse ////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::kernel::fuse (
+                       std::vector<std::string> loc_function,                                       // Device function names.
+                       std::string              loc_state                                           // Private state type.
+                      )
+{
+  neutrino::action ("setting OpenCL kernel fusion...");                                             // Printing message...
+  fused_function = loc_function;                                                                    // Setting fused device functions...
+  fused_state    = loc_state;                                                                       // Setting fused private state type...
   neutrino::done ();                                                                                // Printing message...
+}
 
-  delete[] loc_kernel_source;                                                                       // Deleting buffer...
-  delete loc_kernel_source_size;                                                                    // Deleting buffer...
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////// preamble //////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+std::string nu::kernel::preamble ()
+{
+  std::string loc_args;                                                                             // Kernel parameter list.
+  std::string loc_pass;                                                                             // Kernel argument names.
+  std::string loc_type;                                                                             // Kernel parameter type.
+  size_t      i;                                                                                    // Index.
 
-  neutrino::action ("building OpenCL program...");                                                  // Printing message...
+  for(i = 0; i < neutrino::container.size (); i++)
+  {
+    switch(neutrino::container[i]->type)
+    {
+      case NU_INT:
+        loc_type = "__global int*";
+        break;
 
-  // Creating device ID list:
-  device_id    = new cl_device_id[1];                                                               // OpenCL device ID.
-  device_id[0] = neutrino::device_id;                                                               // Getting device ID.
+      case NU_INT2:
+        loc_type = "__global int2*";
+        break;
 
-  // Building OpenCL program:
-  loc_error    = clBuildProgram
+      case NU_INT3:
+        loc_type = "__global int*";                                                                 // Tightly packed: use vload3/vstore3.
+        break;
+
+      case NU_INT4:
+        loc_type = "__global int4*";
+        break;
+
+      case NU_FLOAT:
+        loc_type = "__global float*";
+        break;
+
+      case NU_FLOAT2:
+        loc_type = "__global float2*";
+        break;
+
+      case NU_FLOAT3:
+        loc_type = "__global float*";                                                               // Tightly packed: use vload3/vstore3.
+        break;
+
+      case NU_FLOAT4:
+        loc_type = "__global float4*";
+        break;
+
+      case NU_HALF:
+        loc_type = "__global half*";                                                                // Use vload_half/vstore_half.
+        break;
+
+      case NU_HALF4:
+        loc_type = "__global half*";                                                                // Packed: use vload_half4/vstore_half4.
+        break;
+
+      case NU_SHORT4:
+        loc_type = "__global short4*";
+        break;
+
+      case NU_UCHAR4:
+        loc_type = "__global uchar4*";
+        break;
+
+      case NU_DOUBLE:
+        loc_type = "__global double*";
+        break;
+
+      case NU_DOUBLE2:
+        loc_type = "__global double2*";
+        break;
+
+      case NU_DOUBLE3:
+        loc_type = "__global double*";                                                              // Tightly packed: use vload3/vstore3.
+        break;
+
+      case NU_DOUBLE4:
+        loc_type = "__global double4*";
+        break;
+    }
+
+    if(i > 0)
+    {
+      loc_args += ", ";                                                                             // Adding separator...
+      loc_pass += ", ";                                                                             // Adding separator...
+    }
+
+    loc_args += loc_type + " arg_" + std::to_string (i);                                            // Adding parameter...
+    loc_pass += "arg_" + std::to_string (i);                                                        // Adding argument...
+  }
+
+  return "#define NU_ARGS " + loc_args + "\n#define NU_PASS " + loc_pass + "\n";
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////// precision /////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+std::string nu::kernel::precision ()
+{
+  cl_device_fp_config loc_fp64 = 0;                                                                 // Double precision floating point capabilities.
+
+  clGetDeviceInfo (neutrino::device_id, CL_DEVICE_DOUBLE_FP_CONFIG, sizeof(cl_device_fp_config), &loc_fp64, NULL);
+
+  if(loc_fp64 != 0)
+  {
+    return "#pragma OPENCL EXTENSION cl_khr_fp64 : enable\n#define NU_ACCUMULATOR double\n";
+  }
+
+  return "#define NU_ACCUMULATOR float\n";                                                          // Falling back to single precision accumulations...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////// entry ///////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+std::string nu::kernel::entry ()
+{
+  std::string loc_entry;                                                                            // Fused entry point source.
+  size_t      i;                                                                                    // Index.
+
+  loc_entry = "__kernel void " + std::string (NU_KERNEL_NAME) + " (NU_ARGS)\n{\n";
+
+  if(!fused_state.empty ())
+  {
+    loc_entry += "  " + fused_state + " nu_state;\n";                                               // Declaring private state...
+  }
+
+  for(i = 0; i < fused_function.size (); i++)
+  {
+    loc_entry += "  " + fused_function[i] + " (NU_PASS";                                            // Calling device function...
+    loc_entry += fused_state.empty () ? ");\n" : ", &nu_state);\n";                                 // Passing private state...
+  }
+
+  loc_entry += "}\n";
+
+  return loc_entry;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////// define ///////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::kernel::define (
+                         std::string loc_name,                                                      // Macro name.
+                         std::string loc_value                                                      // Macro value.
+                        )
+{
+  size_t i;                                                                                         // Index.
+
+  for(i = 0; i < define_name.size (); i++)
+  {
+    if(define_name[i] == loc_name)
+    {
+      define_value[i] = loc_value;                                                                  // Replacing macro value...
+      return;
+    }
+  }
+
+  define_name.push_back (loc_name);                                                                 // Adding macro name...
+  define_value.push_back (loc_value);                                                               // Adding macro value...
+}
+
+void nu::kernel::define (
+                         std::string loc_name,                                                      // Macro name.
+                         double      loc_value                                                      // Macro value.
+                        )
+{
+  char loc_text[NU_MAX_TEXT_SIZE];                                                                  // Macro value text.
+
+  snprintf (loc_text, sizeof(loc_text), "%.9g", loc_value);                                         // Printing value (integers without decimals)...
+  define (loc_name, std::string (loc_text));                                                        // Adding macro...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////// options //////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+std::string nu::kernel::options ()
+{
+  std::string         loc_options;                                                                  // Generated options.
+  cl_uint             loc_width     = 1;                                                            // Preferred float vector width.
+  cl_uint             loc_units     = 1;                                                            // Compute units.
+  cl_ulong            loc_local     = 0;                                                            // Local memory size [bytes].
+  size_t              loc_max_group = 1;                                                            // Maximum work-group size.
+  size_t              loc_group     = 1;                                                            // Chosen work-group size.
+  cl_device_fp_config loc_fp64      = 0;                                                            // Double precision floating point capabilities.
+  size_t              i;                                                                            // Index.
+
+  if(specialize)
+  {
+    clGetDeviceInfo (neutrino::device_id, CL_DEVICE_PREFERRED_VECTOR_WIDTH_FLOAT, sizeof(cl_uint), &loc_width, NULL);
+    clGetDeviceInfo (neutrino::device_id, CL_DEVICE_MAX_COMPUTE_UNITS, sizeof(cl_uint), &loc_units, NULL);
+    clGetDeviceInfo (neutrino::device_id, CL_DEVICE_LOCAL_MEM_SIZE, sizeof(cl_ulong), &loc_local, NULL);
+    clGetDeviceInfo (neutrino::device_id, CL_DEVICE_MAX_WORK_GROUP_SIZE, sizeof(size_t), &loc_max_group, NULL);
+    clGetDeviceInfo (neutrino::device_id, CL_DEVICE_DOUBLE_FP_CONFIG, sizeof(cl_device_fp_config), &loc_fp64, NULL);
+
+    // Choosing work-group size (largest power of 2 within the device and Neutrino limits):
+    while((2*loc_group <= loc_max_group) && (2*loc_group <= NU_KERNEL_GROUP_SIZE))
+    {
+      loc_group *= 2;
+    }
+
+    loc_options += " -D NU_DEVICE_FLOAT_WIDTH=" + std::to_string (std::max (loc_width, (cl_uint)1));
+    loc_options += " -D NU_DEVICE_COMPUTE_UNITS=" + std::to_string (loc_units);
+    loc_options += " -D NU_DEVICE_LOCAL_MEM=" + std::to_string (loc_local);
+    loc_options += " -D NU_DEVICE_MAX_GROUP=" + std::to_string (loc_max_group);
+    loc_options += " -D NU_DEVICE_GROUP_SIZE=" + std::to_string (loc_group);
+    loc_options += " -D NU_DEVICE_FP64=" + std::string ((loc_fp64 != 0) ? "1" : "0");
+    loc_options += " -D NU_KERNEL_SIZE_I=" + std::to_string (size_i);
+    loc_options += " -D NU_KERNEL_SIZE_J=" + std::to_string (size_j);
+    loc_options += " -D NU_KERNEL_SIZE_K=" + std::to_string (size_k);
+  }
+
+  for(i = 0; i < define_name.size (); i++)
+  {
+    loc_options += " -D " + define_name[i];                                                         // Adding user macro name...
+
+    if(!define_value[i].empty ())
+    {
+      loc_options += "=" + define_value[i];                                                         // Adding user macro value...
+    }
+  }
+
+  return loc_options;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////// compile //////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+cl_int nu::kernel::compile (
+                            std::vector<std::string> loc_kernel_source,                             // Kernel sources.
+                            cl_program*              loc_program,                                   // Built program.
+                            std::string&             loc_log                                        // Compiler log.
+                           )
+{
+  cl_int                   loc_error;                                                               // Error code.
+  std::vector<std::string> loc_source = loc_kernel_source;                                          // Program sources.
+  std::vector<const char*> loc_source_c;                                                            // Program sources, C style strings.
+  std::vector<size_t>      loc_source_size;                                                         // Program source sizes.
+  std::string              loc_options = compiler_options + options ();                             // Compiler options (user + generated).
+  size_t                   loc_log_size;                                                            // OpenCL JIT compiler log size.
+  size_t                   i;                                                                       // Index.
+
+  if(!fused_function.empty ())
+  {
+    loc_source.insert (loc_source.begin (), preamble ());                                           // Prepending fusion macros...
+    loc_source.push_back (entry ());                                                                // Appending fused entry point...
+  }
+
+  loc_source.insert (loc_source.begin (), precision ());                                            // Prepending precision macros...
+
+  for(i = 0; i < loc_source.size (); i++)
+  {
+    loc_source_c.push_back (loc_source[i].c_str ());                                                // Getting source...
+    loc_source_size.push_back (loc_source[i].size ());                                              // Getting source size...
+  }
+
+  // Creating OpenCL program from kernel sources:
+  *loc_program = clCreateProgramWithSource
                  (
-                  program,                                                                          // Program.
-                  1,                                                                                // Number of devices.
-                  device_id,                                                                        // Device ID.
-                  loc_options,                                                                      // Including header files from kernel's directory.
-                  NULL,                                                                             // Notification routine.
-                  NULL                                                                              // Notification argument.
+                  neutrino::context_id,                                                             // OpenCL context ID.
+                  (cl_uint)loc_source.size (),                                                      // Number of program sources.
+                  loc_source_c.data (),                                                             // Program source.
+                  loc_source_size.data (),                                                          // Source size.
+                  &loc_error                                                                        // Error code.
                  );
 
-  delete loc_options;
+  if(loc_error != CL_SUCCESS)
+  {
+    loc_log      = neutrino::get_error (loc_error);                                                 // Setting compiler log...
+    *loc_program = NULL;                                                                            // Resetting program...
+    return loc_error;
+  }
+
+  // Building OpenCL program:
+  loc_error = clBuildProgram
+              (
+               *loc_program,                                                                        // Program.
+               neutrino::subdevice_id.empty () ? 1 : (cl_uint)neutrino::subdevice_id.size (),       // Number of devices.
+               neutrino::subdevice_id.empty () ? &neutrino::device_id : neutrino::subdevice_id.data (), // Device IDs.
+               loc_options.c_str (),                                                                // Compiler options.
+               NULL,                                                                                // Notification routine.
+               NULL                                                                                 // Notification argument.
+              );
 
   if(loc_error != CL_SUCCESS)                                                                       // Checking compiled kernel...
   {
-    neutrino::error (neutrino::get_error (loc_error));                                              // Printing message...
+    // Getting OpenCL compiler log size:
+    clGetProgramBuildInfo (*loc_program, neutrino::device_id, CL_PROGRAM_BUILD_LOG, 0, NULL, &loc_log_size);
 
-    // Getting OpenCL compiler information:
-    loc_error = clGetProgramBuildInfo
-                (
-                 program,                                                                           // Program.
-                 device_id[0],                                                                      // Device ID.
-                 CL_PROGRAM_BUILD_LOG,                                                              // Build log parameter.
-                 0,                                                                                 // Dummy parameter size.
-                 NULL,                                                                              // Dummy parameter value.
-                 &loc_log_size                                                                      // Size of log.
-                );
-
-    char* loc_log_buffer = new char[loc_log_size + 1]();                                            // Allocating log buffer...
+    std::string loc_log_buffer (loc_log_size + 1, '\0');                                            // Log buffer.
 
     // Reading OpenCL compiler error log:
-    loc_error    = clGetProgramBuildInfo
-                   (
-                    program,                                                                        // Program.
-                    device_id[0],                                                                   // Device ID.
-                    CL_PROGRAM_BUILD_LOG,                                                           // Build log parameter.
-                    loc_log_size + 1,                                                               // Log size.
-                    loc_log_buffer,                                                                 // The log.
-                    NULL                                                                            // Dummy size parameter.
-                   );
-
-    compiler_log = loc_log_buffer;                                                                  // Setting compiler log...
+    clGetProgramBuildInfo (*loc_program, neutrino::device_id, CL_PROGRAM_BUILD_LOG, loc_log_size + 1, &loc_log_buffer[0], NULL);
+
+    loc_log      = loc_log_buffer.c_str ();                                                         // Setting compiler log (without null terminator)...
+    clReleaseProgram (*loc_program);                                                                // Releasing program...
+    *loc_program = NULL;                                                                            // Resetting program...
+  }
+
+  return loc_error;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////// build ///////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::kernel::build (
+                        size_t loc_kernel_size_i,                                                   // OpenCL kernel size (i-index).
+                        size_t loc_kernel_size_j,                                                   // OpenCL kernel size (j-index).
+                        size_t loc_kernel_size_k                                                    // OpenCL kernel size (k-index).
+                       )
+{
+  cl_int              loc_error;                                                                    // Error code.
+  GLuint              i;                                                                            // Index.
+  cl_uint             loc_entries;                                                                  // Number of entry points.
+  size_t              loc_name_size;                                                                // Entry point name size.
+  cl_device_fp_config loc_fp64 = 0;                                                                 // Double precision floating point capabilities.
+
+  size_i       = loc_kernel_size_i;                                                                 // Getting OpenCL kernel size (i-index)...
+  size_j       = loc_kernel_size_j;                                                                 // Getting OpenCL kernel size (j-index)...
+  size_k       = loc_kernel_size_k;                                                                 // Getting OpenCL kernel size (k-index)...
+
+  // Creating device ID list:
+  device_id    = new cl_device_id[1];                                                               // OpenCL device ID.
+  device_id[0] = neutrino::device_id;                                                               // Getting device ID.
+
+  // Checking double precision support, if any double precision data object:
+  clGetDeviceInfo (neutrino::device_id, CL_DEVICE_DOUBLE_FP_CONFIG, sizeof(cl_device_fp_config), &loc_fp64, NULL);
+
+  for(i = 0; i < neutrino::container.size (); i++)
+  {
+    switch(neutrino::container[i]->type)
+    {
+      case NU_DOUBLE:
+      case NU_DOUBLE2:
+      case NU_DOUBLE3:
+      case NU_DOUBLE4:
+        if(loc_fp64 == 0)
+        {
+          neutrino::error ("double precision data objects need a device with double precision support (cl_khr_fp64)!");
+          exit (EXIT_FAILURE);                                                                      // Exiting...
+        }
+
+        break;
+
+      default:
+        break;
+    }
+  }
+
+  neutrino::action ("building OpenCL program from kernel sources...");                              // Printing message...
+  loc_error    = compile (kernel_source, &program, compiler_log);                                   // Building OpenCL program...
+
+  if(loc_error != CL_SUCCESS)                                                                       // Checking compiled kernel...
+  {
+    neutrino::error (neutrino::get_error (loc_error));                                              // Printing message...
     std::cout << "" << std::endl;                                                                   // Printing message...
     std::cout << "See error log:" << std::endl;                                                     // Printing message...
     std::cout << "" << std::endl;                                                                   // Printing message...
     std::cout << compiler_log << std::endl;                                                         // Printing log...
-    delete[] (loc_log_buffer);                                                                      // Deleting log buffer...
-    exit (loc_error);                                                                               // Exiting...
+    exit (loc_error);                                                                               // Exiting (no previous kernel to fall back on)...
   }
 
   neutrino::done ();                                                                                // Printing message...
 
-  neutrino::action ("generating OpenCL kernel ID...");                                              // Printing message...
+  neutrino::action ("generating OpenCL kernel IDs...");                                             // Printing message...
 
-  // Creating OpenCL kernel:
-  kernel_id = clCreateKernel
-              (
-               program,                                                                             // OpenCL kernel program.
-               NU_KERNEL_NAME,                                                                      // Kernel name.
-               &loc_error                                                                           // Error code.
-              );
+  if(entry_name.empty ())
+  {
+    entry_name.push_back (NU_KERNEL_NAME);                                                          // Setting default entry point...
+  }
+
+  if((entry_name.size () == 1) && (entry_name[0] == NU_KERNEL_ALL))
+  {
+    // Getting number of entry points in program:
+    loc_error = clCreateKernelsInProgram (program, 0, NULL, &loc_entries);
+    neutrino::check_error (loc_error);                                                              // Checking error...
+
+    entry_id.resize (loc_entries);                                                                  // Allocating entry points...
+    entry_name.resize (loc_entries);                                                                // Allocating entry point names...
+
+    // Creating all OpenCL kernels:
+    loc_error = clCreateKernelsInProgram (program, loc_entries, entry_id.data (), NULL);
+    neutrino::check_error (loc_error);                                                              // Checking error...
+
+    for(i = 0; i < loc_entries; i++)
+    {
+      // Getting entry point name size:
+      loc_error = clGetKernelInfo (entry_id[i], CL_KERNEL_FUNCTION_NAME, 0, NULL, &loc_name_size);
+      neutrino::check_error (loc_error);                                                            // Checking error...
+
+      std::string loc_name (loc_name_size, '\0');                                                   // Entry point name buffer.
+
+      // Getting entry point name:
+      loc_error = clGetKernelInfo (entry_id[i], CL_KERNEL_FUNCTION_NAME, loc_name_size, &loc_name[0], NULL);
+      neutrino::check_error (loc_error);                                                            // Checking error...
+
+      entry_name[i] = loc_name.c_str ();                                                            // Setting entry point name (without null terminator)...
+    }
+  }
+
+  else
+  {
+    entry_id.resize (entry_name.size ());                                                           // Allocating entry points...
+
+    for(i = 0; i < entry_name.size (); i++)
+    {
+      // Creating OpenCL kernel:
+      entry_id[i] = clCreateKernel
+                    (
+                     program,                                                                       // OpenCL kernel program.
+                     entry_name[i].c_str (),                                                        // Kernel name.
+                     &loc_error                                                                     // Error code.
+                    );
+
+      neutrino::check_error (loc_error);                                                            // Checking error...
+    }
+  }
+
+  entry_args.resize (entry_id.size ());                                                             // Allocating number of arguments...
+  kernel_id = entry_id[0];                                                                          // Setting default entry point...
 
-  neutrino::check_error (loc_error);                                                                // Checking error...
+  for(i = 0; i < entry_id.size (); i++)
+  {
+    // Getting number of arguments:
+    loc_error = clGetKernelInfo (entry_id[i], CL_KERNEL_NUM_ARGS, sizeof(cl_uint), &entry_args[i], NULL);
+    neutrino::check_error (loc_error);                                                              // Checking error...
+
+    if(entry_name[i] == NU_KERNEL_NAME)
+    {
+      kernel_id = entry_id[i];                                                                      // Setting "thekernel" as default entry point...
+    }
+  }
 
   neutrino::done ();                                                                                // Printing message...
 
-  // Pushing kernel object:
-  neutrino::action ("pushing OpenCL kernel ID...");                                                 // Printing message...
-  neutrino::kernel_id.push_back (kernel_id);                                                        // Pushing kernel object...
+  // Pushing kernel objects:
+  neutrino::action ("pushing OpenCL kernel IDs...");                                                // Printing message...
+
+  for(i = 0; i < entry_id.size (); i++)
+  {
+    neutrino::kernel_id.push_back (entry_id[i]);                                                    // Pushing kernel object...
+  }
+
   neutrino::done ();                                                                                // Printing message...
 
   // Setting kernel arguments:
@@ -172,55 +576,1079 @@ void nu::kernel::build (
     switch(container[i]->type)
     {
       case NU_INT:
-        ((nu::int1*)neutrino::container[i])->name   = std::string ("arg_") + std::to_string (i);
+        ((nu::int1*)neutrino::container[i])->name    = std::string ("arg_") + std::to_string (i);
         this->setarg ((nu::int1*)neutrino::container[i], i);
         break;
 
       case NU_INT2:
-        ((nu::int2*)neutrino::container[i])->name   = std::string ("arg_") + std::to_string (i);
+        ((nu::int2*)neutrino::container[i])->name    = std::string ("arg_") + std::to_string (i);
         this->setarg ((nu::int2*)neutrino::container[i], i);
         break;
 
-      case NU_INT3:
-        ((nu::int3*)neutrino::container[i])->name   = std::string ("arg_") + std::to_string (i);
-        this->setarg ((nu::int3*)neutrino::container[i], i);
-        break;
+      case NU_INT3:
+        ((nu::int3*)neutrino::container[i])->name    = std::string ("arg_") + std::to_string (i);
+        this->setarg ((nu::int3*)neutrino::container[i], i);
+        break;
+
+      case NU_INT4:
+        ((nu::int4*)neutrino::container[i])->name    = std::string ("arg_") + std::to_string (i);
+        this->setarg ((nu::int4*)neutrino::container[i], i);
+        break;
+
+      case NU_FLOAT:
+        ((nu::float1*)neutrino::container[i])->name  = std::string ("arg_") + std::to_string (i);
+        this->setarg ((nu::float1*)neutrino::container[i], i);
+        break;
+
+      case NU_FLOAT2:
+        ((nu::float2*)neutrino::container[i])->name  = std::string ("arg_") + std::to_string (i);
+        this->setarg ((nu::float2*)neutrino::container[i], i);
+        break;
+
+      case NU_FLOAT3:
+        ((nu::float3*)neutrino::container[i])->name  = std::string ("arg_") + std::to_string (i);
+        this->setarg ((nu::float3*)neutrino::container[i], i);
+        break;
+
+      case NU_FLOAT4:
+        ((nu::float4*)neutrino::container[i])->name  = std::string ("arg_") + std::to_string (i);
+        this->setarg ((nu::float4*)neutrino::container[i], i);
+        break;
+
+      case NU_HALF:
+        ((nu::half1*)neutrino::container[i])->name   = std::string ("arg_") + std::to_string (i);
+        this->setarg ((nu::half1*)neutrino::container[i], i);
+        break;
+
+      case NU_HALF4:
+        ((nu::half4*)neutrino::container[i])->name   = std::string ("arg_") + std::to_string (i);
+        this->setarg ((nu::half4*)neutrino::container[i], i);
+        break;
+
+      case NU_SHORT4:
+        ((nu::short4*)neutrino::container[i])->name  = std::string ("arg_") + std::to_string (i);
+        this->setarg ((nu::short4*)neutrino::container[i], i);
+        break;
+
+      case NU_UCHAR4:
+        ((nu::uchar4*)neutrino::container[i])->name  = std::string ("arg_") + std::to_string (i);
+        this->setarg ((nu::uchar4*)neutrino::container[i], i);
+        break;
+
+      case NU_DOUBLE:
+        ((nu::double1*)neutrino::container[i])->name = std::string ("arg_") + std::to_string (i);
+        this->setarg ((nu::double1*)neutrino::container[i], i);
+        break;
+
+      case NU_DOUBLE2:
+        ((nu::double2*)neutrino::container[i])->name = std::string ("arg_") + std::to_string (i);
+        this->setarg ((nu::double2*)neutrino::container[i], i);
+        break;
+
+      case NU_DOUBLE3:
+        ((nu::double3*)neutrino::container[i])->name = std::string ("arg_") + std::to_string (i);
+        this->setarg ((nu::double3*)neutrino::container[i], i);
+        break;
+
+      case NU_DOUBLE4:
+        ((nu::double4*)neutrino::container[i])->name = std::string ("arg_") + std::to_string (i);
+        this->setarg ((nu::double4*)neutrino::container[i], i);
+        break;
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////// setarg "nu::int1" overload ///////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::kernel::setarg
+(
+ nu::int1* loc_data,                                                                                // nu::int1 data.
+ cl_uint   loc_layout_index                                                                         // Layout index.
+)
+{
+  cl_int loc_error;                                                                                 // Error code.
+
+  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+
+  neutrino::action ("setting kernel argument...");                                                  // Printing message...
+
+  loc_data->layout = loc_layout_index;                                                              // Setting layout index.
+
+  if(!loc_data->ready)
+  {
+    // Generating VAO...
+    glGenVertexArrays
+    (
+     1,                                                                                             // Number of VAOs to generate.
+     &loc_data->vao                                                                                 // VAOs array.
+    );
+
+    // Binding node VAO...
+    glBindVertexArray
+    (
+     loc_data->vao                                                                                  // VAOs array.
+    );
+
+    // Generating SSBO:
+    glGenBuffers
+    (
+     1,                                                                                             // Number of SSBOs to generate.
+     &loc_data->ssbo                                                                                // SSBOs array.
+    );
+
+    // Binding SSBO:
+    glBindBuffer
+    (
+     GL_SHADER_STORAGE_BUFFER,                                                                      // SSBO target.
+     loc_data->ssbo                                                                                 // SSBO to bind.
+    );
+
+    // Creating and initializing a buffer object's data store:
+    glBufferData
+    (
+     GL_SHADER_STORAGE_BUFFER,                                                                      // SSBO target.
+     sizeof(GL_INT)*loc_data->data.size (),                                                         // SSBO size.
+     loc_data->data.data (),                                                                        // SSBO data.
+     GL_DYNAMIC_DRAW                                                                                // SSBO usage.
+    );
+
+    // Binding buffer object to an indexed buffer target:
+    glBindBufferBase (
+                      GL_SHADER_STORAGE_BUFFER,                                                     // SSBO target.
+                      loc_layout_index,                                                             // SSBO index.
+                      loc_data->ssbo                                                                // SSBO buffer.
+                     );
+
+    // Specifying the format for attribute in vertex shader:
+    glVertexAttribPointer
+    (
+     loc_layout_index,                                                                              // VAO index.
+     1,                                                                                             // VAO's number of components.
+     GL_FLOAT,                                                                                      // Data type.
+     GL_FALSE,                                                                                      // Not using normalized numbers.
+     0,                                                                                             // Data stride.
+     0                                                                                              // Data offset.
+    );
+
+    // Enabling attribute in vertex shader:
+    glEnableVertexAttribArray
+    (
+     loc_layout_index                                                                               // VAO index.
+    );
+
+    // Binding SSBO:
+    glBindBuffer
+    (
+     GL_SHADER_STORAGE_BUFFER,                                                                      // SSBO target.
+     loc_data->ssbo                                                                                 // SSBO to bind.
+    );
+
+    glFinish ();                                                                                    // Waiting for OpenGL to finish...
+
+    if(neutrino::interop)                                                                           // Checking for interoperability...
+    {
+      // Creating OpenCL buffer from OpenGL buffer:
+      loc_data->buffer = clCreateFromGLBuffer
+                         (
+                          neutrino::context_id,                                                     // OpenCL context.
+                          CL_MEM_READ_WRITE,                                                        // Memory flags.
+                          loc_data->ssbo,                                                           // VBO.
+                          &loc_error                                                                // Returned error.
+                         );
+    }
+
+    else
+    {
+      // Creating OpenCL memory buffer:
+      loc_data->buffer = clCreateBuffer
+                         (
+                          neutrino::context_id,                                                     // OpenCL context.
+                          CL_MEM_READ_WRITE |                                                       // Memory flag.
+                          CL_MEM_COPY_HOST_PTR,                                                     // Memory flag.
+                          sizeof(GL_INT)*loc_data->data.size (),                                    // Data buffer size.
+                          loc_data->data.data (),                                                   // Data buffer.
+                          &loc_error                                                                // Error code.
+                         );
+    }
+
+    neutrino::check_error (loc_error);                                                              // Checking returned error code...
+    loc_data->ready = true;                                                                         // Setting "ready" flag...
+  }
+
+  bind (loc_layout_index, &loc_data->buffer);                                                       // Setting argument on all entry points...
+  clFinish (neutrino::queue_id);                                                                    // Waiting for OpenCL to finish...
+  neutrino::done ();                                                                                // Printing message...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////// setarg "nu::int2" overload ///////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::kernel::setarg
+(
+ nu::int2* loc_data,                                                                                // nu::int2 data.
+ cl_uint   loc_layout_index                                                                         // Layout index.
+)
+{
+  cl_int loc_error;                                                                                 // Error code.
+
+  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+
+  neutrino::action ("setting kernel argument...");                                                  // Printing message...
+
+  loc_data->layout = loc_layout_index;                                                              // Setting layout index.
+
+  if(!loc_data->ready)
+  {
+    // Generating VAO...
+    glGenVertexArrays
+    (
+     1,                                                                                             // Number of VAOs to generate.
+     &loc_data->vao                                                                                 // VAOs array.
+    );
+
+    // Binding node VAO...
+    glBindVertexArray
+    (
+     loc_data->vao                                                                                  // VAOs array.
+    );
+
+    // Generating SSBO:
+    glGenBuffers
+    (
+     1,                                                                                             // Number of SSBOs to generate.
+     &loc_data->ssbo                                                                                // SSBOs array.
+    );
+
+    // Binding SSBO:
+    glBindBuffer
+    (
+     GL_SHADER_STORAGE_BUFFER,                                                                      // SSBO target.
+     loc_data->ssbo                                                                                 // SSBO to bind.
+    );
+
+    // Creating and initializing a buffer object's data store:
+    glBufferData
+    (
+     GL_SHADER_STORAGE_BUFFER,                                                                      // SSBO target.
+     sizeof(nu_int2_structure)*loc_data->data.size (),                                              // SSBO size.
+     loc_data->data.data (),                                                                        // SSBO data.
+     GL_DYNAMIC_DRAW                                                                                // SSBO usage.
+    );
+
+    // Binding buffer object to an indexed buffer target:
+    glBindBufferBase (
+                      GL_SHADER_STORAGE_BUFFER,                                                     // SSBO target.
+                      loc_layout_index,                                                             // SSBO index.
+                      loc_data->ssbo                                                                // SSBO buffer.
+                     );
+
+    // Specifying the format for attribute in vertex shader:
+    glVertexAttribPointer
+    (
+     loc_layout_index,                                                                              // VAO index.
+     1,                                                                                             // VAO's number of components.
+     GL_FLOAT,                                                                                      // Data type.
+     GL_FALSE,                                                                                      // Not using normalized numbers.
+     0,                                                                                             // Data stride.
+     0                                                                                              // Data offset.
+    );
+
+    // Enabling attribute in vertex shader:
+    glEnableVertexAttribArray
+    (
+     loc_layout_index                                                                               // VAO index.
+    );
+
+    // Binding SSBO:
+    glBindBuffer
+    (
+     GL_SHADER_STORAGE_BUFFER,                                                                      // SSBO target.
+     loc_data->ssbo                                                                                 // SSBO to bind.
+    );
+
+    glFinish ();                                                                                    // Waiting for OpenGL to finish...
+
+    if(neutrino::interop)                                                                           // Checking for interoperability...
+    {
+      // Creating OpenCL buffer from OpenGL buffer:
+      loc_data->buffer = clCreateFromGLBuffer
+                         (
+                          neutrino::context_id,                                                     // OpenCL context.
+                          CL_MEM_READ_WRITE,                                                        // Memory flags.
+                          loc_data->ssbo,                                                           // VBO.
+                          &loc_error                                                                // Returned error.
+                         );
+    }
+
+    else
+    {
+      // Creating OpenCL memory buffer:
+      loc_data->buffer = clCreateBuffer
+                         (
+                          neutrino::context_id,                                                     // OpenCL context.
+                          CL_MEM_READ_WRITE |                                                       // Memory flag.
+                          CL_MEM_COPY_HOST_PTR,                                                     // Memory flag.
+                          sizeof(nu_int2_structure)*loc_data->data.size (),                         // Data buffer size.
+                          loc_data->data.data (),                                                   // Data buffer.
+                          &loc_error                                                                // Error code.
+                         );
+    }
+
+    neutrino::check_error (loc_error);                                                              // Checking returned error code...
+    loc_data->ready = true;                                                                         // Setting "ready" flag...
+  }
+
+  bind (loc_layout_index, &loc_data->buffer);                                                       // Setting argument on all entry points...
+  clFinish (neutrino::queue_id);                                                                    // Waiting for OpenCL to finish...
+  neutrino::done ();                                                                                // Printing message...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////// setarg "nu::int3" overload ///////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::kernel::setarg
+(
+ nu::int3* loc_data,                                                                                // nu::int3 data.
+ cl_uint   loc_layout_index                                                                         // Layout index.
+)
+{
+  cl_int loc_error;                                                                                 // Error code.
+
+  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+
+  neutrino::action ("setting kernel argument...");                                                  // Printing message...
+
+  loc_data->layout = loc_layout_index;                                                              // Setting layout index.
+
+  if(!loc_data->ready)
+  {
+    // Generating VAO...
+    glGenVertexArrays
+    (
+     1,                                                                                             // Number of VAOs to generate.
+     &loc_data->vao                                                                                 // VAOs array.
+    );
+
+    // Binding node VAO...
+    glBindVertexArray
+    (
+     loc_data->vao                                                                                  // VAOs array.
+    );
+
+    // Generating SSBO:
+    glGenBuffers
+    (
+     1,                                                                                             // Number of SSBOs to generate.
+     &loc_data->ssbo                                                                                // SSBOs array.
+    );
+
+    // Binding SSBO:
+    glBindBuffer
+    (
+     GL_SHADER_STORAGE_BUFFER,                                                                      // SSBO target.
+     loc_data->ssbo                                                                                 // SSBO to bind.
+    );
+
+    // Creating and initializing a buffer object's data store:
+    glBufferData
+    (
+     GL_SHADER_STORAGE_BUFFER,                                                                      // SSBO target.
+     sizeof(nu_int3_structure)*loc_data->data.size (),                                              // SSBO size.
+     loc_data->data.data (),                                                                        // SSBO data.
+     GL_DYNAMIC_DRAW                                                                                // SSBO usage.
+    );
+
+    // Binding buffer object to an indexed buffer target:
+    glBindBufferBase (
+                      GL_SHADER_STORAGE_BUFFER,                                                     // SSBO target.
+                      loc_layout_index,                                                             // SSBO index.
+                      loc_data->ssbo                                                                // SSBO buffer.
+                     );
+
+    // Specifying the format for attribute in vertex shader:
+    glVertexAttribPointer
+    (
+     loc_layout_index,                                                                              // VAO index.
+     1,                                                                                             // VAO's number of components.
+     GL_FLOAT,                                                                                      // Data type.
+     GL_FALSE,                                                                                      // Not using normalized numbers.
+     0,                                                                                             // Data stride.
+     0                                                                                              // Data offset.
+    );
+
+    // Enabling attribute in vertex shader:
+    glEnableVertexAttribArray
+    (
+     loc_layout_index                                                                               // VAO index.
+    );
+
+    // Binding SSBO:
+    glBindBuffer
+    (
+     GL_SHADER_STORAGE_BUFFER,                                                                      // SSBO target.
+     loc_data->ssbo                                                                                 // SSBO to bind.
+    );
+
+    glFinish ();                                                                                    // Waiting for OpenGL to finish...
+
+    if(neutrino::interop)                                                                           // Checking for interoperability...
+    {
+      // Creating OpenCL buffer from OpenGL buffer:
+      loc_data->buffer = clCreateFromGLBuffer
+                         (
+                          neutrino::context_id,                                                     // OpenCL context.
+                          CL_MEM_READ_WRITE,                                                        // Memory flags.
+                          loc_data->ssbo,                                                           // VBO.
+                          &loc_error                                                                // Returned error.
+                         );
+    }
+
+    else
+    {
+      // Creating OpenCL memory buffer:
+      loc_data->buffer = clCreateBuffer
+                         (
+                          neutrino::context_id,                                                     // OpenCL context.
+                          CL_MEM_READ_WRITE |                                                       // Memory flag.
+                          CL_MEM_COPY_HOST_PTR,                                                     // Memory flag.
+                          sizeof(nu_int3_structure)*loc_data->data.size (),                         // Data buffer size.
+                          loc_data->data.data (),                                                   // Data buffer.
+                          &loc_error                                                                // Error code.
+                         );
+    }
+
+    neutrino::check_error (loc_error);                                                              // Checking returned error code...
+    loc_data->ready = true;                                                                         // Setting "ready" flag...
+  }
+
+  bind (loc_layout_index, &loc_data->buffer);                                                       // Setting argument on all entry points...
+  clFinish (neutrino::queue_id);                                                                    // Waiting for OpenCL to finish...
+  neutrino::done ();                                                                                // Printing message...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////// setarg "nu::int4" overload ///////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::kernel::setarg
+(
+ nu::int4* loc_data,                                                                                // nu::int4 data.
+ cl_uint   loc_layout_index                                                                         // Layout index.
+)
+{
+  cl_int loc_error;                                                                                 // Error code.
+
+  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+
+  neutrino::action ("setting kernel argument...");                                                  // Printing message...
+
+  loc_data->layout = loc_layout_index;                                                              // Setting layout index.
+
+  if(!loc_data->ready)
+  {
+    // Generating VAO...
+    glGenVertexArrays
+    (
+     1,                                                                                             // Number of VAOs to generate.
+     &loc_data->vao                                                                                 // VAOs array.
+    );
+
+    // Binding node VAO...
+    glBindVertexArray
+    (
+     loc_data->vao                                                                                  // VAOs array.
+    );
+
+    // Generating SSBO:
+    glGenBuffers
+    (
+     1,                                                                                             // Number of SSBOs to generate.
+     &loc_data->ssbo                                                                                // SSBOs array.
+    );
+
+    // Binding SSBO:
+    glBindBuffer
+    (
+     GL_SHADER_STORAGE_BUFFER,                                                                      // SSBO target.
+     loc_data->ssbo                                                                                 // SSBO to bind.
+    );
+
+    // Creating and initializing a buffer object's data store:
+    glBufferData
+    (
+     GL_SHADER_STORAGE_BUFFER,                                                                      // SSBO target.
+     sizeof(nu_int4_structure)*loc_data->data.size (),                                              // SSBO size.
+     loc_data->data.data (),                                                                        // SSBO data.
+     GL_DYNAMIC_DRAW                                                                                // SSBO usage.
+    );
+
+    // Binding buffer object to an indexed buffer target:
+    glBindBufferBase (
+                      GL_SHADER_STORAGE_BUFFER,                                                     // SSBO target.
+                      loc_layout_index,                                                             // SSBO index.
+                      loc_data->ssbo                                                                // SSBO buffer.
+                     );
+
+    // Specifying the format for attribute in vertex shader:
+    glVertexAttribPointer
+    (
+     loc_layout_index,                                                                              // VAO index.
+     1,                                                                                             // VAO's number of components.
+     GL_FLOAT,                                                                                      // Data type.
+     GL_FALSE,                                                                                      // Not using normalized numbers.
+     0,                                                                                             // Data stride.
+     0                                                                                              // Data offset.
+    );
+
+    // Enabling attribute in vertex shader:
+    glEnableVertexAttribArray
+    (
+     loc_layout_index                                                                               // VAO index.
+    );
+
+    // Binding SSBO:
+    glBindBuffer
+    (
+     GL_SHADER_STORAGE_BUFFER,                                                                      // SSBO target.
+     loc_data->ssbo                                                                                 // SSBO to bind.
+    );
+
+    glFinish ();                                                                                    // Waiting for OpenGL to finish...
+
+    if(neutrino::interop)                                                                           // Checking for interoperability...
+    {
+      // Creating OpenCL buffer from OpenGL buffer:
+      loc_data->buffer = clCreateFromGLBuffer
+                         (
+                          neutrino::context_id,                                                     // OpenCL context.
+                          CL_MEM_READ_WRITE,                                                        // Memory flags.
+                          loc_data->ssbo,                                                           // VBO.
+                          &loc_error                                                                // Returned error.
+                         );
+    }
+
+    else
+    {
+      // Creating OpenCL memory buffer:
+      loc_data->buffer = clCreateBuffer
+                         (
+                          neutrino::context_id,                                                     // OpenCL context.
+                          CL_MEM_READ_WRITE |                                                       // Memory flag.
+                          CL_MEM_COPY_HOST_PTR,                                                     // Memory flag.
+                          sizeof(nu_int4_structure)*loc_data->data.size (),                         // Data buffer size.
+                          loc_data->data.data (),                                                   // Data buffer.
+                          &loc_error                                                                // Error code.
+                         );
+    }
+
+    neutrino::check_error (loc_error);                                                              // Checking returned error code...
+    loc_data->ready = true;                                                                         // Setting "ready" flag...
+  }
+
+  bind (loc_layout_index, &loc_data->buffer);                                                       // Setting argument on all entry points...
+  clFinish (neutrino::queue_id);                                                                    // Waiting for OpenCL to finish...
+  neutrino::done ();                                                                                // Printing message...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////// setarg "nu::float1" overload ////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::kernel::setarg
+(
+ nu::float1* loc_data,                                                                              // nu::float1 data.
+ GLuint      loc_layout_index                                                                       // Layout index.
+)
+{
+  cl_int loc_error;                                                                                 // Error code.
+
+  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+
+  neutrino::action ("setting kernel argument...");                                                  // Printing message...
+
+  loc_data->layout = loc_layout_index;                                                              // Setting layout index.
+
+  if(!loc_data->ready)
+  {
+    // Generating VAO...
+    glGenVertexArrays
+    (
+     1,                                                                                             // Number of VAOs to generate.
+     &loc_data->vao                                                                                 // VAOs array.
+    );
+
+    // Binding node VAO...
+    glBindVertexArray
+    (
+     loc_data->vao                                                                                  // VAOs array.
+    );
+
+    // Generating SSBO:
+    glGenBuffers
+    (
+     1,                                                                                             // Number of SSBOs to generate.
+     &loc_data->ssbo                                                                                // SSBOs array.
+    );
+
+    // Binding SSBO:
+    glBindBuffer
+    (
+     GL_SHADER_STORAGE_BUFFER,                                                                      // SSBO target.
+     loc_data->ssbo                                                                                 // SSBO to bind.
+    );
+
+    // Creating and initializing a buffer object's data store:
+    glBufferData
+    (
+     GL_SHADER_STORAGE_BUFFER,                                                                      // SSBO target.
+     sizeof(GL_FLOAT)*loc_data->data.size (),                                                       // SSBO size.
+     loc_data->data.data (),                                                                        // SSBO data.
+     GL_DYNAMIC_DRAW                                                                                // SSBO usage.
+    );
+
+    // Binding buffer object to an indexed buffer target:
+    glBindBufferBase (
+                      GL_SHADER_STORAGE_BUFFER,                                                     // SSBO target.
+                      loc_layout_index,                                                             // SSBO index.
+                      loc_data->ssbo                                                                // SSBO buffer.
+                     );
+
+    // Specifying the format for attribute in vertex shader:
+    glVertexAttribPointer
+    (
+     loc_layout_index,                                                                              // VAO index.
+     1,                                                                                             // VAO's number of components.
+     GL_FLOAT,                                                                                      // Data type.
+     GL_FALSE,                                                                                      // Not using normalized numbers.
+     0,                                                                                             // Data stride.
+     0                                                                                              // Data offset.
+    );
+
+    // Enabling attribute in vertex shader:
+    glEnableVertexAttribArray
+    (
+     loc_layout_index                                                                               // VAO index.
+    );
+
+    // Binding SSBO:
+    glBindBuffer
+    (
+     GL_SHADER_STORAGE_BUFFER,                                                                      // SSBO target.
+     loc_data->ssbo                                                                                 // SSBO to bind.
+    );
+
+    glFinish ();                                                                                    // Waiting for OpenGL to finish...
+
+    if(neutrino::interop)                                                                           // Checking for interoperability...
+    {
+      // Creating OpenCL buffer from OpenGL buffer:
+      loc_data->buffer = clCreateFromGLBuffer
+                         (
+                          neutrino::context_id,                                                     // OpenCL context.
+                          CL_MEM_READ_WRITE,                                                        // Memory flags.
+                          loc_data->ssbo,                                                           // VBO.
+                          &loc_error                                                                // Returned error.
+                         );
+    }
+
+    else
+    {
+      // Creating OpenCL memory buffer:
+      loc_data->buffer = clCreateBuffer
+                         (
+                          neutrino::context_id,                                                     // OpenCL context.
+                          CL_MEM_READ_WRITE |                                                       // Memory flag.
+                          CL_MEM_COPY_HOST_PTR,                                                     // Memory flag.
+                          sizeof(GL_FLOAT)*loc_data->data.size (),                                  // Data buffer size.
+                          loc_data->data.data (),                                                   // Data buffer.
+                          &loc_error                                                                // Error code.
+                         );
+    }
+
+    neutrino::check_error (loc_error);                                                              // Checking returned error code...
+    loc_data->ready = true;                                                                         // Setting "ready" flag...
+  }
+
+  bind (loc_layout_index, &loc_data->buffer);                                                       // Setting argument on all entry points...
+  clFinish (neutrino::queue_id);                                                                    // Waiting for OpenCL to finish...
+  neutrino::done ();                                                                                // Printing message...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////// setarg "nu::float2" overload /////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::kernel::setarg
+(
+ nu::float2* loc_data,                                                                              // nu::float2 data.
+ cl_uint     loc_layout_index                                                                       // Layout index.
+)
+{
+  cl_int loc_error;                                                                                 // Error code.
+
+  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+
+  neutrino::action ("setting kernel argument...");                                                  // Printing message...
+
+  loc_data->layout = loc_layout_index;                                                              // Setting layout index.
+
+  if(!loc_data->ready)
+  {
+    // Generating VAO...
+    glGenVertexArrays
+    (
+     1,                                                                                             // Number of VAOs to generate.
+     &loc_data->vao                                                                                 // VAOs array.
+    );
+
+    // Binding node VAO...
+    glBindVertexArray
+    (
+     loc_data->vao                                                                                  // VAOs array.
+    );
+
+    // Generating SSBO:
+    glGenBuffers
+    (
+     1,                                                                                             // Number of SSBOs to generate.
+     &loc_data->ssbo                                                                                // SSBOs array.
+    );
+
+    // Binding SSBO:
+    glBindBuffer
+    (
+     GL_SHADER_STORAGE_BUFFER,                                                                      // SSBO target.
+     loc_data->ssbo                                                                                 // SSBO to bind.
+    );
+
+    // Creating and initializing a buffer object's data store:
+    glBufferData
+    (
+     GL_SHADER_STORAGE_BUFFER,                                                                      // SSBO target.
+     sizeof(nu_float2_structure)*loc_data->data.size (),                                            // SSBO size.
+     loc_data->data.data (),                                                                        // SSBO data.
+     GL_DYNAMIC_DRAW                                                                                // SSBO usage.
+    );
+
+    // Binding buffer object to an indexed buffer target:
+    glBindBufferBase (
+                      GL_SHADER_STORAGE_BUFFER,                                                     // SSBO target.
+                      loc_layout_index,                                                             // SSBO index.
+                      loc_data->ssbo                                                                // SSBO buffer.
+                     );
+
+    // Specifying the format for attribute in vertex shader:
+    glVertexAttribPointer
+    (
+     loc_layout_index,                                                                              // VAO index.
+     1,                                                                                             // VAO's number of components.
+     GL_FLOAT,                                                                                      // Data type.
+     GL_FALSE,                                                                                      // Not using normalized numbers.
+     0,                                                                                             // Data stride.
+     0                                                                                              // Data offset.
+    );
+
+    // Enabling attribute in vertex shader:
+    glEnableVertexAttribArray
+    (
+     loc_layout_index                                                                               // VAO index.
+    );
+
+    // Binding SSBO:
+    glBindBuffer
+    (
+     GL_SHADER_STORAGE_BUFFER,                                                                      // SSBO target.
+     loc_data->ssbo                                                                                 // SSBO to bind.
+    );
+
+    glFinish ();                                                                                    // Waiting for OpenGL to finish...
+
+    if(neutrino::interop)                                                                           // Checking for interoperability...
+    {
+      // Creating OpenCL buffer from OpenGL buffer:
+      loc_data->buffer = clCreateFromGLBuffer
+                         (
+                          neutrino::context_id,                                                     // OpenCL context.
+                          CL_MEM_READ_WRITE,                                                        // Memory flags.
+                          loc_data->ssbo,                                                           // VBO.
+                          &loc_error                                                                // Returned error.
+                         );
+    }
+
+    else
+    {
+      // Creating OpenCL memory buffer:
+      loc_data->buffer = clCreateBuffer
+                         (
+                          neutrino::context_id,                                                     // OpenCL context.
+                          CL_MEM_READ_WRITE |                                                       // Memory flag.
+                          CL_MEM_COPY_HOST_PTR,                                                     // Memory flag.
+                          sizeof(nu_float2_structure)*loc_data->data.size (),                       // Data buffer size.
+                          loc_data->data.data (),                                                   // Data buffer.
+                          &loc_error                                                                // Error code.
+                         );
+    }
+
+    neutrino::check_error (loc_error);                                                              // Checking returned error code...
+    loc_data->ready = true;                                                                         // Setting "ready" flag...
+  }
+
+  bind (loc_layout_index, &loc_data->buffer);                                                       // Setting argument on all entry points...
+  clFinish (neutrino::queue_id);                                                                    // Waiting for OpenCL to finish...
+  neutrino::done ();                                                                                // Printing message...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////// setarg "nu::float3" overload /////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::kernel::setarg
+(
+ nu::float3* loc_data,                                                                              // nu::float3 data.
+ cl_uint     loc_layout_index                                                                       // Layout index.
+)
+{
+  cl_int loc_error;                                                                                 // Error code.
+
+  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+
+  neutrino::action ("setting kernel argument...");                                                  // Printing message...
+
+  loc_data->layout = loc_layout_index;                                                              // Setting layout index.
+
+  if(!loc_data->ready)
+  {
+    // Generating VAO...
+    glGenVertexArrays
+    (
+     1,                                                                                             // Number of VAOs to generate.
+     &loc_data->vao                                                                                 // VAOs array.
+    );
+
+    // Binding node VAO...
+    glBindVertexArray
+    (
+     loc_data->vao                                                                                  // VAOs array.
+    );
+
+    // Generating SSBO:
+    glGenBuffers
+    (
+     1,                                                                                             // Number of SSBOs to generate.
+     &loc_data->ssbo                                                                                // SSBOs array.
+    );
+
+    // Binding SSBO:
+    glBindBuffer
+    (
+     GL_SHADER_STORAGE_BUFFER,                                                                      // SSBO target.
+     loc_data->ssbo                                                                                 // SSBO to bind.
+    );
+
+    // Creating and initializing a buffer object's data store:
+    glBufferData
+    (
+     GL_SHADER_STORAGE_BUFFER,                                                                      // SSBO target.
+     sizeof(nu_float3_structure)*loc_data->data.size (),                                            // SSBO size.
+     loc_data->data.data (),                                                                        // SSBO data.
+     GL_DYNAMIC_DRAW                                                                                // SSBO usage.
+    );
+
+    // Binding buffer object to an indexed buffer target:
+    glBindBufferBase (
+                      GL_SHADER_STORAGE_BUFFER,                                                     // SSBO target.
+                      loc_layout_index,                                                             // SSBO index.
+                      loc_data->ssbo                                                                // SSBO buffer.
+                     );
+
+    // Specifying the format for attribute in vertex shader:
+    glVertexAttribPointer
+    (
+     loc_layout_index,                                                                              // VAO index.
+     1,                                                                                             // VAO's number of components.
+     GL_FLOAT,                                                                                      // Data type.
+     GL_FALSE,                                                                                      // Not using normalized numbers.
+     0,                                                                                             // Data stride.
+     0                                                                                              // Data offset.
+    );
+
+    // Enabling attribute in vertex shader:
+    glEnableVertexAttribArray
+    (
+     loc_layout_index                                                                               // VAO index.
+    );
+
+    // Binding SSBO:
+    glBindBuffer
+    (
+     GL_SHADER_STORAGE_BUFFER,                                                                      // SSBO target.
+     loc_data->ssbo                                                                                 // SSBO to bind.
+    );
+
+    glFinish ();                                                                                    // Waiting for OpenGL to finish...
+
+    if(neutrino::interop)                                                                           // Checking for interoperability...
+    {
+      // Creating OpenCL buffer from OpenGL buffer:
+      loc_data->buffer = clCreateFromGLBuffer
+                         (
+                          neutrino::context_id,                                                     // OpenCL context.
+                          CL_MEM_READ_WRITE,                                                        // Memory flags.
+                          loc_data->ssbo,                                                           // VBO.
+                          &loc_error                                                                // Returned error.
+                         );
+    }
+
+    else
+    {
+      // Creating OpenCL memory buffer:
+      loc_data->buffer = clCreateBuffer
+                         (
+                          neutrino::context_id,                                                     // OpenCL context.
+                          CL_MEM_READ_WRITE |                                                       // Memory flag.
+                          CL_MEM_COPY_HOST_PTR,                                                     // Memory flag.
+                          sizeof(nu_float3_structure)*loc_data->data.size (),                       // Data buffer size.
+                          loc_data->data.data (),                                                   // Data buffer.
+                          &loc_error                                                                // Error code.
+                         );
+    }
+
+    neutrino::check_error (loc_error);                                                              // Checking returned error code...
+    loc_data->ready = true;                                                                         // Setting "ready" flag...
+  }
+
+  bind (loc_layout_index, &loc_data->buffer);                                                       // Setting argument on all entry points...
+  clFinish (neutrino::queue_id);                                                                    // Waiting for OpenCL to finish...
+  neutrino::done ();                                                                                // Printing message...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////// setarg "nu::float4" overload /////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::kernel::setarg
+(
+ nu::float4* loc_data,                                                                              // nu::float4 data.
+ cl_uint     loc_layout_index                                                                       // Layout index.
+)
+{
+  cl_int loc_error;                                                                                 // Error code.
+
+  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+
+  neutrino::action ("setting kernel argument...");                                                  // Printing message...
+
+  loc_data->layout = loc_layout_index;                                                              // Setting layout index.
+
+  if(!loc_data->ready)
+  {
+    // Generating VAO...
+    glGenVertexArrays
+    (
+     1,                                                                                             // Number of VAOs to generate.
+     &loc_data->vao                                                                                 // VAOs array.
+    );
+
+    // Binding node VAO...
+    glBindVertexArray
+    (
+     loc_data->vao                                                                                  // VAOs array.
+    );
+
+    // Generating SSBO:
+    glGenBuffers
+    (
+     1,                                                                                             // Number of SSBOs to generate.
+     &loc_data->ssbo                                                                                // SSBOs array.
+    );
+
+    // Binding SSBO:
+    glBindBuffer
+    (
+     GL_SHADER_STORAGE_BUFFER,                                                                      // SSBO target.
+     loc_data->ssbo                                                                                 // SSBO to bind.
+    );
+
+    // Creating and initializing a buffer object's data store:
+    glBufferData
+    (
+     GL_SHADER_STORAGE_BUFFER,                                                                      // SSBO target.
+     sizeof(nu_float4_structure)*loc_data->data.size (),                                            // SSBO size.
+     loc_data->data.data (),                                                                        // SSBO data.
+     GL_DYNAMIC_DRAW                                                                                // SSBO usage.
+    );
+
+    // Binding buffer object to an indexed buffer target:
+    glBindBufferBase (
+                      GL_SHADER_STORAGE_BUFFER,                                                     // SSBO target.
+                      loc_layout_index,                                                             // SSBO index.
+                      loc_data->ssbo                                                                // SSBO buffer.
+                     );
+
+    // Specifying the format for attribute in vertex shader:
+    glVertexAttribPointer
+    (
+     loc_layout_index,                                                                              // VAO index.
+     1,                                                                                             // VAO's number of components.
+     GL_FLOAT,                                                                                      // Data type.
+     GL_FALSE,                                                                                      // Not using normalized numbers.
+     0,                                                                                             // Data stride.
+     0                                                                                              // Data offset.
+    );
 
-      case NU_INT4:
-        ((nu::int4*)neutrino::container[i])->name   = std::string ("arg_") + std::to_string (i);
-        this->setarg ((nu::int4*)neutrino::container[i], i);
-        break;
+    // Enabling attribute in vertex shader:
+    glEnableVertexAttribArray
+    (
+     loc_layout_index                                                                               // VAO index.
+    );
 
-      case NU_FLOAT:
-        ((nu::float1*)neutrino::container[i])->name = std::string ("arg_") + std::to_string (i);
-        this->setarg ((nu::float1*)neutrino::container[i], i);
-        break;
+    // Binding SSBO:
+    glBindBuffer
+    (
+     GL_SHADER_STORAGE_BUFFER,                                                                      // SSBO target.
+     loc_data->ssbo                                                                                 // SSBO to bind.
+    );
 
-      case NU_FLOAT2:
-        ((nu::float2*)neutrino::container[i])->name = std::string ("arg_") + std::to_string (i);
-        this->setarg ((nu::float2*)neutrino::container[i], i);
-        break;
+    glFinish ();                                                                                    // Waiting for OpenGL to finish...
 
-      case NU_FLOAT3:
-        ((nu::float3*)neutrino::container[i])->name = std::string ("arg_") + std::to_string (i);
-        this->setarg ((nu::float3*)neutrino::container[i], i);
-        break;
+    if(neutrino::interop)                                                                           // Checking for interoperability...
+    {
+      // Creating OpenCL buffer from OpenGL buffer:
+      loc_data->buffer = clCreateFromGLBuffer
+                         (
+                          neutrino::context_id,                                                     // OpenCL context.
+                          CL_MEM_READ_WRITE,                                                        // Memory flags.
+                          loc_data->ssbo,                                                           // VBO.
+                          &loc_error                                                                // Returned error.
+                         );
+    }
 
-      case NU_FLOAT4:
-        ((nu::float4*)neutrino::container[i])->name = std::string ("arg_") + std::to_string (i);
-        this->setarg ((nu::float4*)neutrino::container[i], i);
-        break;
+    else
+    {
+      // Creating OpenCL memory buffer:
+      loc_data->buffer = clCreateBuffer
+                         (
+                          neutrino::context_id,                                                     // OpenCL context.
+                          CL_MEM_READ_WRITE |                                                       // Memory flag.
+                          CL_MEM_COPY_HOST_PTR,                                                     // Memory flag.
+                          sizeof(nu_float4_structure)*loc_data->data.size (),                       // Data buffer size.
+                          loc_data->data.data (),                                                   // Data buffer.
+                          &loc_error                                                                // Error code.
+                         );
     }
+
+    neutrino::check_error (loc_error);                                                              // Checking returned error code...
+    loc_data->ready = true;                                                                         // Setting "ready" flag...
   }
+
+  bind (loc_layout_index, &loc_data->buffer);                                                       // Setting argument on all entry points...
+  clFinish (neutrino::queue_id);                                                                    // Waiting for OpenCL to finish...
+  neutrino::done ();                                                                                // Printing message...
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////
-///////////////////////////////////////// setarg "nu::int1" overload ///////////////////////////////////
+//////////////////////////////////// setarg "nu::half1" overload /////////////////////////////////////
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 void nu::kernel::setarg
 (
- nu::int1* loc_data,                                                                                // nu::int1 data.
- cl_uint   loc_layout_index                                                                         // Layout index.
+ nu::half1* loc_data,                                                                               // nu::half1 data.
+ cl_uint    loc_layout_index                                                                        // Layout index.
 )
 {
   cl_int loc_error;                                                                                 // Error code.
@@ -264,7 +1692,7 @@ void nu::kernel::setarg
     glBufferData
     (
      GL_SHADER_STORAGE_BUFFER,                                                                      // SSBO target.
-     sizeof(GL_INT)*loc_data->data.size (),                                                         // SSBO size.
+     sizeof(GLhalf)*loc_data->data.size (),                                                         // SSBO size.
      loc_data->data.data (),                                                                        // SSBO data.
      GL_DYNAMIC_DRAW                                                                                // SSBO usage.
     );
@@ -281,7 +1709,7 @@ void nu::kernel::setarg
     (
      loc_layout_index,                                                                              // VAO index.
      1,                                                                                             // VAO's number of components.
-     GL_FLOAT,                                                                                      // Data type.
+     GL_HALF_FLOAT,                                                                                 // Data type.
      GL_FALSE,                                                                                      // Not using normalized numbers.
      0,                                                                                             // Data stride.
      0                                                                                              // Data offset.
@@ -322,7 +1750,7 @@ void nu::kernel::setarg
                           neutrino::context_id,                                                     // OpenCL context.
                           CL_MEM_READ_WRITE |                                                       // Memory flag.
                           CL_MEM_COPY_HOST_PTR,                                                     // Memory flag.
-                          sizeof(GL_INT)*loc_data->data.size (),                                    // Data buffer size.
+                          sizeof(GLhalf)*loc_data->data.size (),                                    // Data buffer size.
                           loc_data->data.data (),                                                   // Data buffer.
                           &loc_error                                                                // Error code.
                          );
@@ -332,26 +1760,18 @@ void nu::kernel::setarg
     loc_data->ready = true;                                                                         // Setting "ready" flag...
   }
 
-  loc_error = clSetKernelArg
-              (
-               kernel_id,                                                                           // Kernel id.
-               loc_layout_index,                                                                    // Layout index.
-               sizeof(cl_mem),                                                                      // Data size.
-               &loc_data->buffer                                                                    // Data value.
-              );
-
-  neutrino::check_error (loc_error);                                                                // Checking returned error code...
+  bind (loc_layout_index, &loc_data->buffer);                                                       // Setting argument on all entry points...
   clFinish (neutrino::queue_id);                                                                    // Waiting for OpenCL to finish...
   neutrino::done ();                                                                                // Printing message...
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////
-/////////////////////////////////////////// setarg "nu::int2" overload ///////////////////////////////////
+//////////////////////////////////// setarg "nu::half4" overload /////////////////////////////////////
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 void nu::kernel::setarg
 (
- nu::int2* loc_data,                                                                                // nu::int2 data.
- cl_uint   loc_layout_index                                                                         // Layout index.
+ nu::half4* loc_data,                                                                               // nu::half4 data.
+ cl_uint    loc_layout_index                                                                        // Layout index.
 )
 {
   cl_int loc_error;                                                                                 // Error code.
@@ -395,7 +1815,7 @@ void nu::kernel::setarg
     glBufferData
     (
      GL_SHADER_STORAGE_BUFFER,                                                                      // SSBO target.
-     sizeof(nu_int2_structure)*loc_data->data.size (),                                              // SSBO size.
+     sizeof(nu_half4_structure)*loc_data->data.size (),                                             // SSBO size.
      loc_data->data.data (),                                                                        // SSBO data.
      GL_DYNAMIC_DRAW                                                                                // SSBO usage.
     );
@@ -411,8 +1831,8 @@ void nu::kernel::setarg
     glVertexAttribPointer
     (
      loc_layout_index,                                                                              // VAO index.
-     1,                                                                                             // VAO's number of components.
-     GL_FLOAT,                                                                                      // Data type.
+     4,                                                                                             // VAO's number of components.
+     GL_HALF_FLOAT,                                                                                 // Data type.
      GL_FALSE,                                                                                      // Not using normalized numbers.
      0,                                                                                             // Data stride.
      0                                                                                              // Data offset.
@@ -453,7 +1873,7 @@ void nu::kernel::setarg
                           neutrino::context_id,                                                     // OpenCL context.
                           CL_MEM_READ_WRITE |                                                       // Memory flag.
                           CL_MEM_COPY_HOST_PTR,                                                     // Memory flag.
-                          sizeof(nu_int2_structure)*loc_data->data.size (),                         // Data buffer size.
+                          sizeof(nu_half4_structure)*loc_data->data.size (),                        // Data buffer size.
                           loc_data->data.data (),                                                   // Data buffer.
                           &loc_error                                                                // Error code.
                          );
@@ -463,26 +1883,18 @@ void nu::kernel::setarg
     loc_data->ready = true;                                                                         // Setting "ready" flag...
   }
 
-  loc_error = clSetKernelArg
-              (
-               kernel_id,                                                                           // Kernel id.
-               loc_layout_index,                                                                    // Layout index.
-               sizeof(cl_mem),                                                                      // Data size.
-               &loc_data->buffer                                                                    // Data value.
-              );
-
-  neutrino::check_error (loc_error);                                                                // Checking returned error code...
+  bind (loc_layout_index, &loc_data->buffer);                                                       // Setting argument on all entry points...
   clFinish (neutrino::queue_id);                                                                    // Waiting for OpenCL to finish...
   neutrino::done ();                                                                                // Printing message...
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////
-/////////////////////////////////////////// setarg "nu::int3" overload ///////////////////////////////////
+//////////////////////////////////// setarg "nu::short4" overload ////////////////////////////////////
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 void nu::kernel::setarg
 (
- nu::int3* loc_data,                                                                                // nu::int3 data.
- cl_uint   loc_layout_index                                                                         // Layout index.
+ nu::short4* loc_data,                                                                              // nu::short4 data.
+ cl_uint     loc_layout_index                                                                       // Layout index.
 )
 {
   cl_int loc_error;                                                                                 // Error code.
@@ -526,7 +1938,7 @@ void nu::kernel::setarg
     glBufferData
     (
      GL_SHADER_STORAGE_BUFFER,                                                                      // SSBO target.
-     sizeof(nu_int3_structure)*loc_data->data.size (),                                              // SSBO size.
+     sizeof(nu_short4_structure)*loc_data->data.size (),                                            // SSBO size.
      loc_data->data.data (),                                                                        // SSBO data.
      GL_DYNAMIC_DRAW                                                                                // SSBO usage.
     );
@@ -539,12 +1951,11 @@ void nu::kernel::setarg
                      );
 
     // Specifying the format for attribute in vertex shader:
-    glVertexAttribPointer
+    glVertexAttribIPointer
     (
      loc_layout_index,                                                                              // VAO index.
-     1,                                                                                             // VAO's number of components.
-     GL_FLOAT,                                                                                      // Data type.
-     GL_FALSE,                                                                                      // Not using normalized numbers.
+     4,                                                                                             // VAO's number of components.
+     GL_SHORT,                                                                                      // Data type.
      0,                                                                                             // Data stride.
      0                                                                                              // Data offset.
     );
@@ -584,7 +1995,7 @@ void nu::kernel::setarg
                           neutrino::context_id,                                                     // OpenCL context.
                           CL_MEM_READ_WRITE |                                                       // Memory flag.
                           CL_MEM_COPY_HOST_PTR,                                                     // Memory flag.
-                          sizeof(nu_int3_structure)*loc_data->data.size (),                         // Data buffer size.
+                          sizeof(nu_short4_structure)*loc_data->data.size (),                       // Data buffer size.
                           loc_data->data.data (),                                                   // Data buffer.
                           &loc_error                                                                // Error code.
                          );
@@ -594,26 +2005,18 @@ void nu::kernel::setarg
     loc_data->ready = true;                                                                         // Setting "ready" flag...
   }
 
-  loc_error = clSetKernelArg
-              (
-               kernel_id,                                                                           // Kernel id.
-               loc_layout_index,                                                                    // Layout index.
-               sizeof(cl_mem),                                                                      // Data size.
-               &loc_data->buffer                                                                    // Data value.
-              );
-
-  neutrino::check_error (loc_error);                                                                // Checking returned error code...
+  bind (loc_layout_index, &loc_data->buffer);                                                       // Setting argument on all entry points...
   clFinish (neutrino::queue_id);                                                                    // Waiting for OpenCL to finish...
   neutrino::done ();                                                                                // Printing message...
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////
-/////////////////////////////////////////// setarg "nu::int4" overload ///////////////////////////////////
+//////////////////////////////////// setarg "nu::uchar4" overload ////////////////////////////////////
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 void nu::kernel::setarg
 (
- nu::int4* loc_data,                                                                                // nu::int4 data.
- cl_uint   loc_layout_index                                                                         // Layout index.
+ nu::uchar4* loc_data,                                                                              // nu::uchar4 data.
+ cl_uint     loc_layout_index                                                                       // Layout index.
 )
 {
   cl_int loc_error;                                                                                 // Error code.
@@ -657,7 +2060,7 @@ void nu::kernel::setarg
     glBufferData
     (
      GL_SHADER_STORAGE_BUFFER,                                                                      // SSBO target.
-     sizeof(nu_int4_structure)*loc_data->data.size (),                                              // SSBO size.
+     sizeof(nu_uchar4_structure)*loc_data->data.size (),                                            // SSBO size.
      loc_data->data.data (),                                                                        // SSBO data.
      GL_DYNAMIC_DRAW                                                                                // SSBO usage.
     );
@@ -673,9 +2076,9 @@ void nu::kernel::setarg
     glVertexAttribPointer
     (
      loc_layout_index,                                                                              // VAO index.
-     1,                                                                                             // VAO's number of components.
-     GL_FLOAT,                                                                                      // Data type.
-     GL_FALSE,                                                                                      // Not using normalized numbers.
+     4,                                                                                             // VAO's number of components.
+     GL_UNSIGNED_BYTE,                                                                              // Data type.
+     GL_TRUE,                                                                                       // Not using normalized numbers.
      0,                                                                                             // Data stride.
      0                                                                                              // Data offset.
     );
@@ -715,7 +2118,7 @@ void nu::kernel::setarg
                           neutrino::context_id,                                                     // OpenCL context.
                           CL_MEM_READ_WRITE |                                                       // Memory flag.
                           CL_MEM_COPY_HOST_PTR,                                                     // Memory flag.
-                          sizeof(nu_int4_structure)*loc_data->data.size (),                         // Data buffer size.
+                          sizeof(nu_uchar4_structure)*loc_data->data.size (),                       // Data buffer size.
                           loc_data->data.data (),                                                   // Data buffer.
                           &loc_error                                                                // Error code.
                          );
@@ -725,26 +2128,18 @@ void nu::kernel::setarg
     loc_data->ready = true;                                                                         // Setting "ready" flag...
   }
 
-  loc_error = clSetKernelArg
-              (
-               kernel_id,                                                                           // Kernel id.
-               loc_layout_index,                                                                    // Layout index.
-               sizeof(cl_mem),                                                                      // Data size.
-               &loc_data->buffer                                                                    // Data value.
-              );
-
-  neutrino::check_error (loc_error);                                                                // Checking returned error code...
+  bind (loc_layout_index, &loc_data->buffer);                                                       // Setting argument on all entry points...
   clFinish (neutrino::queue_id);                                                                    // Waiting for OpenCL to finish...
   neutrino::done ();                                                                                // Printing message...
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////
-//////////////////////////////////////// setarg "nu::float1" overload ////////////////////////////////////
+/////////////////////////////////// setarg "nu::double1" overload ////////////////////////////////////
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 void nu::kernel::setarg
 (
- nu::float1* loc_data,                                                                              // nu::float1 data.
- GLuint      loc_layout_index                                                                       // Layout index.
+ nu::double1* loc_data,                                                                             // nu::double1 data.
+ cl_uint      loc_layout_index                                                                      // Layout index.
 )
 {
   cl_int loc_error;                                                                                 // Error code.
@@ -788,7 +2183,7 @@ void nu::kernel::setarg
     glBufferData
     (
      GL_SHADER_STORAGE_BUFFER,                                                                      // SSBO target.
-     sizeof(GL_FLOAT)*loc_data->data.size (),                                                       // SSBO size.
+     sizeof(GLdouble)*loc_data->data.size (),                                                       // SSBO size.
      loc_data->data.data (),                                                                        // SSBO data.
      GL_DYNAMIC_DRAW                                                                                // SSBO usage.
     );
@@ -801,12 +2196,11 @@ void nu::kernel::setarg
                      );
 
     // Specifying the format for attribute in vertex shader:
-    glVertexAttribPointer
+    glVertexAttribLPointer
     (
      loc_layout_index,                                                                              // VAO index.
      1,                                                                                             // VAO's number of components.
-     GL_FLOAT,                                                                                      // Data type.
-     GL_FALSE,                                                                                      // Not using normalized numbers.
+     GL_DOUBLE,                                                                                     // Data type.
      0,                                                                                             // Data stride.
      0                                                                                              // Data offset.
     );
@@ -846,7 +2240,7 @@ void nu::kernel::setarg
                           neutrino::context_id,                                                     // OpenCL context.
                           CL_MEM_READ_WRITE |                                                       // Memory flag.
                           CL_MEM_COPY_HOST_PTR,                                                     // Memory flag.
-                          sizeof(GL_FLOAT)*loc_data->data.size (),                                  // Data buffer size.
+                          sizeof(GLdouble)*loc_data->data.size (),                                  // Data buffer size.
                           loc_data->data.data (),                                                   // Data buffer.
                           &loc_error                                                                // Error code.
                          );
@@ -856,26 +2250,18 @@ void nu::kernel::setarg
     loc_data->ready = true;                                                                         // Setting "ready" flag...
   }
 
-  loc_error = clSetKernelArg
-              (
-               kernel_id,                                                                           // Kernel id.
-               loc_layout_index,                                                                    // Layout index.
-               sizeof(cl_mem),                                                                      // Data size.
-               &loc_data->buffer                                                                    // Data value.
-              );
-
-  neutrino::check_error (loc_error);                                                                // Checking returned error code...
+  bind (loc_layout_index, &loc_data->buffer);                                                       // Setting argument on all entry points...
   clFinish (neutrino::queue_id);                                                                    // Waiting for OpenCL to finish...
   neutrino::done ();                                                                                // Printing message...
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////
-/////////////////////////////////////// setarg "nu::float2" overload /////////////////////////////////////
+/////////////////////////////////// setarg "nu::double2" overload ////////////////////////////////////
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 void nu::kernel::setarg
 (
- nu::float2* loc_data,                                                                              // nu::float2 data.
- cl_uint     loc_layout_index                                                                       // Layout index.
+ nu::double2* loc_data,                                                                             // nu::double2 data.
+ cl_uint      loc_layout_index                                                                      // Layout index.
 )
 {
   cl_int loc_error;                                                                                 // Error code.
@@ -919,7 +2305,7 @@ void nu::kernel::setarg
     glBufferData
     (
      GL_SHADER_STORAGE_BUFFER,                                                                      // SSBO target.
-     sizeof(nu_float2_structure)*loc_data->data.size (),                                            // SSBO size.
+     sizeof(nu_double2_structure)*loc_data->data.size (),                                           // SSBO size.
      loc_data->data.data (),                                                                        // SSBO data.
      GL_DYNAMIC_DRAW                                                                                // SSBO usage.
     );
@@ -932,12 +2318,11 @@ void nu::kernel::setarg
                      );
 
     // Specifying the format for attribute in vertex shader:
-    glVertexAttribPointer
+    glVertexAttribLPointer
     (
      loc_layout_index,                                                                              // VAO index.
-     1,                                                                                             // VAO's number of components.
-     GL_FLOAT,                                                                                      // Data type.
-     GL_FALSE,                                                                                      // Not using normalized numbers.
+     2,                                                                                             // VAO's number of components.
+     GL_DOUBLE,                                                                                     // Data type.
      0,                                                                                             // Data stride.
      0                                                                                              // Data offset.
     );
@@ -977,7 +2362,7 @@ void nu::kernel::setarg
                           neutrino::context_id,                                                     // OpenCL context.
                           CL_MEM_READ_WRITE |                                                       // Memory flag.
                           CL_MEM_COPY_HOST_PTR,                                                     // Memory flag.
-                          sizeof(nu_float2_structure)*loc_data->data.size (),                       // Data buffer size.
+                          sizeof(nu_double2_structure)*loc_data->data.size (),                      // Data buffer size.
                           loc_data->data.data (),                                                   // Data buffer.
                           &loc_error                                                                // Error code.
                          );
@@ -987,26 +2372,18 @@ void nu::kernel::setarg
     loc_data->ready = true;                                                                         // Setting "ready" flag...
   }
 
-  loc_error = clSetKernelArg
-              (
-               kernel_id,                                                                           // Kernel id.
-               loc_layout_index,                                                                    // Layout index.
-               sizeof(cl_mem),                                                                      // Data size.
-               &loc_data->buffer                                                                    // Data value.
-              );
-
-  neutrino::check_error (loc_error);                                                                // Checking returned error code...
+  bind (loc_layout_index, &loc_data->buffer);                                                       // Setting argument on all entry points...
   clFinish (neutrino::queue_id);                                                                    // Waiting for OpenCL to finish...
   neutrino::done ();                                                                                // Printing message...
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////
-/////////////////////////////////////// setarg "nu::float3" overload /////////////////////////////////////
+/////////////////////////////////// setarg "nu::double3" overload ////////////////////////////////////
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 void nu::kernel::setarg
 (
- nu::float3* loc_data,                                                                              // nu::float3 data.
- cl_uint     loc_layout_index                                                                       // Layout index.
+ nu::double3* loc_data,                                                                             // nu::double3 data.
+ cl_uint      loc_layout_index                                                                      // Layout index.
 )
 {
   cl_int loc_error;                                                                                 // Error code.
@@ -1050,7 +2427,7 @@ void nu::kernel::setarg
     glBufferData
     (
      GL_SHADER_STORAGE_BUFFER,                                                                      // SSBO target.
-     sizeof(nu_float3_structure)*loc_data->data.size (),                                            // SSBO size.
+     sizeof(nu_double3_structure)*loc_data->data.size (),                                           // SSBO size.
      loc_data->data.data (),                                                                        // SSBO data.
      GL_DYNAMIC_DRAW                                                                                // SSBO usage.
     );
@@ -1063,12 +2440,11 @@ void nu::kernel::setarg
                      );
 
     // Specifying the format for attribute in vertex shader:
-    glVertexAttribPointer
+    glVertexAttribLPointer
     (
      loc_layout_index,                                                                              // VAO index.
-     1,                                                                                             // VAO's number of components.
-     GL_FLOAT,                                                                                      // Data type.
-     GL_FALSE,                                                                                      // Not using normalized numbers.
+     3,                                                                                             // VAO's number of components.
+     GL_DOUBLE,                                                                                     // Data type.
      0,                                                                                             // Data stride.
      0                                                                                              // Data offset.
     );
@@ -1108,7 +2484,7 @@ void nu::kernel::setarg
                           neutrino::context_id,                                                     // OpenCL context.
                           CL_MEM_READ_WRITE |                                                       // Memory flag.
                           CL_MEM_COPY_HOST_PTR,                                                     // Memory flag.
-                          sizeof(nu_float3_structure)*loc_data->data.size (),                       // Data buffer size.
+                          sizeof(nu_double3_structure)*loc_data->data.size (),                      // Data buffer size.
                           loc_data->data.data (),                                                   // Data buffer.
                           &loc_error                                                                // Error code.
                          );
@@ -1118,26 +2494,18 @@ void nu::kernel::setarg
     loc_data->ready = true;                                                                         // Setting "ready" flag...
   }
 
-  loc_error = clSetKernelArg
-              (
-               kernel_id,                                                                           // Kernel id.
-               loc_layout_index,                                                                    // Layout index.
-               sizeof(cl_mem),                                                                      // Data size.
-               &loc_data->buffer                                                                    // Data value.
-              );
-
-  neutrino::check_error (loc_error);                                                                // Checking returned error code...
+  bind (loc_layout_index, &loc_data->buffer);                                                       // Setting argument on all entry points...
   clFinish (neutrino::queue_id);                                                                    // Waiting for OpenCL to finish...
   neutrino::done ();                                                                                // Printing message...
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////
-/////////////////////////////////////// setarg "nu::float4" overload /////////////////////////////////////
+/////////////////////////////////// setarg "nu::double4" overload ////////////////////////////////////
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 void nu::kernel::setarg
 (
- nu::float4* loc_data,                                                                              // nu::float4 data.
- cl_uint     loc_layout_index                                                                       // Layout index.
+ nu::double4* loc_data,                                                                             // nu::double4 data.
+ cl_uint      loc_layout_index                                                                      // Layout index.
 )
 {
   cl_int loc_error;                                                                                 // Error code.
@@ -1181,7 +2549,7 @@ void nu::kernel::setarg
     glBufferData
     (
      GL_SHADER_STORAGE_BUFFER,                                                                      // SSBO target.
-     sizeof(nu_float4_structure)*loc_data->data.size (),                                            // SSBO size.
+     sizeof(nu_double4_structure)*loc_data->data.size (),                                           // SSBO size.
      loc_data->data.data (),                                                                        // SSBO data.
      GL_DYNAMIC_DRAW                                                                                // SSBO usage.
     );
@@ -1194,12 +2562,11 @@ void nu::kernel::setarg
                      );
 
     // Specifying the format for attribute in vertex shader:
-    glVertexAttribPointer
+    glVertexAttribLPointer
     (
      loc_layout_index,                                                                              // VAO index.
-     1,                                                                                             // VAO's number of components.
-     GL_FLOAT,                                                                                      // Data type.
-     GL_FALSE,                                                                                      // Not using normalized numbers.
+     4,                                                                                             // VAO's number of components.
+     GL_DOUBLE,                                                                                     // Data type.
      0,                                                                                             // Data stride.
      0                                                                                              // Data offset.
     );
@@ -1239,7 +2606,7 @@ void nu::kernel::setarg
                           neutrino::context_id,                                                     // OpenCL context.
                           CL_MEM_READ_WRITE |                                                       // Memory flag.
                           CL_MEM_COPY_HOST_PTR,                                                     // Memory flag.
-                          sizeof(nu_float4_structure)*loc_data->data.size (),                       // Data buffer size.
+                          sizeof(nu_double4_structure)*loc_data->data.size (),                      // Data buffer size.
                           loc_data->data.data (),                                                   // Data buffer.
                           &loc_error                                                                // Error code.
                          );
@@ -1249,31 +2616,243 @@ void nu::kernel::setarg
     loc_data->ready = true;                                                                         // Setting "ready" flag...
   }
 
-  loc_error = clSetKernelArg
-              (
-               kernel_id,                                                                           // Kernel id.
-               loc_layout_index,                                                                    // Layout index.
-               sizeof(cl_mem),                                                                      // Data size.
-               &loc_data->buffer                                                                    // Data value.
-              );
-
-  neutrino::check_error (loc_error);                                                                // Checking returned error code...
+  bind (loc_layout_index, &loc_data->buffer);                                                       // Setting argument on all entry points...
   clFinish (neutrino::queue_id);                                                                    // Waiting for OpenCL to finish...
   neutrino::done ();                                                                                // Printing message...
 }
 
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////// rebind ///////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+cl_int nu::kernel::rebind (
+                           std::vector<cl_kernel>& loc_entry_id,                                    // Entry point ids.
+                           std::vector<cl_uint>&   loc_entry_args                                   // Entry point number of arguments.
+                          )
+{
+  cl_int loc_error = CL_SUCCESS;                                                                    // Error code.
+  size_t i;                                                                                         // Layout index.
+  size_t j;                                                                                         // Entry point index.
+
+  for(i = 0; (i < bound_buffer.size ()) && (loc_error == CL_SUCCESS); i++)
+  {
+    for(j = 0; (j < loc_entry_id.size ()) && (bound_buffer[i] != NULL) && (loc_error == CL_SUCCESS); j++)
+    {
+      if(i < loc_entry_args[j])                                                                     // Skipping entry points without this argument...
+      {
+        loc_error = clSetKernelArg (loc_entry_id[j], (cl_uint)i, sizeof(cl_mem), bound_buffer[i]);  // Setting argument...
+      }
+    }
+  }
+
+  return loc_error;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////// loop ////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::kernel::loop ()
+{
+  std::filesystem::file_time_type loc_time;                                                         // Source file modification time.
+  std::vector<std::string>        loc_source;                                                       // Changed sources.
+  std::error_code                 loc_error;                                                        // File system error code.
+  cl_program                      loc_program;                                                      // Rebuilt program.
+  std::string                     loc_log;                                                          // Compiler log.
+  bool                            loc_changed;                                                      // "Changed sources" flag.
+  size_t                          i;                                                                // Source index.
+
+  while(watching)
+  {
+    std::this_thread::sleep_for (std::chrono::milliseconds (NU_KERNEL_WATCH_PERIOD));               // Waiting for next poll...
+    loc_changed = false;                                                                            // Resetting "changed sources" flag...
+
+    for(i = 0; i < source_file.size (); i++)
+    {
+      loc_time = std::filesystem::last_write_time (source_file[i], loc_error);                      // Getting modification time...
+
+      if(!loc_error && (loc_time != source_time[i]))
+      {
+        source_time[i] = loc_time;                                                                  // Updating modification time...
+        loc_changed    = true;                                                                      // Setting "changed sources" flag...
+      }
+    }
+
+    if(loc_changed)
+    {
+      {
+        std::lock_guard<std::mutex> loc_lock (pending_lock);                                        // Locking kernel sources...
+        loc_source = kernel_source;                                                                 // Keeping non-file sources...
+      }
+
+      for(i = 0; i < source_file.size (); i++)
+      {
+        loc_source[source_index[i]] = neutrino::read_file (source_file[i]) + '\n';                  // Reading source...
+      }
+
+      loc_log = "";                                                                                 // Resetting compiler log...
+      compile (loc_source, &loc_program, loc_log);                                                  // Rebuilding program (in background)...
+
+      std::lock_guard<std::mutex> loc_lock (pending_lock);                                          // Locking rebuilt program...
+
+      if(pending_program != NULL)
+      {
+        clReleaseProgram (pending_program);                                                         // Releasing superseded program...
+      }
+
+      pending_program = loc_program;                                                                // Setting rebuilt program (NULL on error)...
+      pending_source  = loc_source;                                                                 // Setting changed sources...
+      pending_log     = loc_log;                                                                    // Setting compiler log...
+      pending         = true;                                                                       // Setting "rebuilt program" flag...
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////// watch ///////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::kernel::watch (
+                        bool loc_watch                                                              // "Watch" flag.
+                       )
+{
+  if(loc_watch && !watching)
+  {
+    watching = true;                                                                                // Setting "watcher running" flag...
+    watcher  = std::thread (&nu::kernel::loop, this);                                               // Starting watcher thread...
+  }
+
+  if(!loc_watch && watching)
+  {
+    watching = false;                                                                               // Resetting "watcher running" flag...
+    watcher.join ();                                                                                // Waiting for watcher thread...
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////// reload ///////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+bool nu::kernel::reload ()
+{
+  cl_program               loc_program;                                                             // Rebuilt program.
+  std::vector<std::string> loc_source;                                                              // Changed sources.
+  std::vector<cl_kernel>   loc_entry_id;                                                            // Rebuilt entry points.
+  std::vector<cl_uint>     loc_entry_args;                                                          // Rebuilt entry point number of arguments.
+  cl_int                   loc_error = CL_SUCCESS;                                                  // Error code.
+  size_t                   i;                                                                       // Entry point index.
+  size_t                   j;                                                                       // Kernel id index.
+
+  if(!pending)
+  {
+    return false;                                                                                   // Nothing rebuilt: keeping kernel...
+  }
+
+  {
+    std::lock_guard<std::mutex> loc_lock (pending_lock);                                            // Locking rebuilt program...
+    loc_program     = pending_program;                                                              // Getting rebuilt program...
+    loc_source      = pending_source;                                                               // Getting changed sources...
+    compiler_log    = pending_log;                                                                  // Getting compiler log...
+    pending_program = NULL;                                                                         // Resetting rebuilt program...
+    pending         = false;                                                                        // Resetting "rebuilt program" flag...
+  }
+
+  if(loc_program == NULL)
+  {
+    neutrino::warning ("OpenCL kernel not reloaded: keeping the current one! See error log:");      // Printing message...
+    std::cout << compiler_log << std::endl;                                                         // Printing log...
+    return false;
+  }
+
+  // Creating the same entry points from the rebuilt program:
+  for(i = 0; (i < entry_name.size ()) && (loc_error == CL_SUCCESS); i++)
+  {
+    loc_entry_id.push_back (clCreateKernel (loc_program, entry_name[i].c_str (), &loc_error));
+    loc_entry_args.push_back (0);
+
+    if(loc_error == CL_SUCCESS)
+    {
+      loc_error = clGetKernelInfo (loc_entry_id[i], CL_KERNEL_NUM_ARGS, sizeof(cl_uint), &loc_entry_args[i], NULL);
+    }
+  }
+
+  if(loc_error == CL_SUCCESS)
+  {
+    loc_error = rebind (loc_entry_id, loc_entry_args);                                              // Restoring bound arguments...
+  }
+
+  if(loc_error != CL_SUCCESS)
+  {
+    for(i = 0; i < loc_entry_id.size (); i++)
+    {
+      if(loc_entry_id[i] != NULL)
+      {
+        clReleaseKernel (loc_entry_id[i]);                                                          // Releasing rebuilt entry point...
+      }
+    }
+
+    clReleaseProgram (loc_program);                                                                 // Releasing rebuilt program...
+    compiler_log = neutrino::get_error (loc_error);                                                 // Setting compiler log...
+    neutrino::warning ("OpenCL kernel not reloaded: entry point or arguments mismatch!");           // Printing message...
+    return false;
+  }
+
+  // Swapping entry points (the device buffers are untouched):
+  for(i = 0; i < entry_id.size (); i++)
+  {
+    for(j = 0; j < neutrino::kernel_id.size (); j++)
+    {
+      if(neutrino::kernel_id[j] == entry_id[i])
+      {
+        neutrino::kernel_id[j] = loc_entry_id[i];                                                   // Replacing kernel object...
+      }
+    }
+
+    if(kernel_id == entry_id[i])
+    {
+      kernel_id = loc_entry_id[i];                                                                  // Replacing default entry point...
+    }
+
+    clReleaseKernel (entry_id[i]);                                                                  // Releasing previous entry point...
+  }
+
+  clReleaseProgram (program);                                                                       // Releasing previous program...
+  program       = loc_program;                                                                      // Setting rebuilt program...
+  entry_id      = loc_entry_id;                                                                     // Setting rebuilt entry points...
+  entry_args    = loc_entry_args;                                                                   // Setting rebuilt number of arguments...
+
+  {
+    std::lock_guard<std::mutex> loc_lock (pending_lock);                                            // Locking kernel sources...
+    kernel_source = loc_source;                                                                     // Setting changed sources...
+  }
+
+  neutrino::action ("reloading OpenCL kernel...");                                                  // Printing message...
+  neutrino::done ();                                                                                // Printing message...
+
+  return true;
+}
+
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////// DESTRUCTOR ////////////////////////////////////////////
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 nu::kernel::~kernel ()
 {
   cl_int loc_error;                                                                                 // Error code.
+  size_t i;                                                                                         // Index.
+
+  watch (false);                                                                                    // Stopping source file watcher...
+
+  if(pending_program != NULL)
+  {
+    clReleaseProgram (pending_program);                                                             // Releasing rebuilt program, not swapped...
+  }
 
   glFinish ();                                                                                      // Waiting for OpenGL to finish...
 
-  neutrino::action ("releasing OpenCL kernel...");                                                  // Printing message...
-  loc_error = clReleaseKernel (kernel_id);                                                          // Releasing OpenCL kernel...
-  neutrino::check_error (loc_error);                                                                // Checking error code...
+  neutrino::action ("releasing OpenCL kernels...");                                                 // Printing message...
+
+  for(i = 0; i < entry_id.size (); i++)
+  {
+    loc_error = clReleaseKernel (entry_id[i]);                                                      // Releasing OpenCL kernel...
+    neutrino::check_error (loc_error);                                                              // Checking error code...
+  }
+
   neutrino::done ();                                                                                // Printing message...
 
   neutrino::action ("releasing OpenCL kernel event...");                                            // Printing message...
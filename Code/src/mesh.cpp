@@ -77,6 +77,13 @@ void nu::mesh::process (
   GLfloat             loc_link_z;                                                                   // Link "z" coordinate.
   GLfloat             loc_link_w;                                                                   // Link "w" coordinate.
 
+  // FACE VARIABLES:
+  std::vector<std::vector<size_t> > loc_face_table;                                                 // Element type faces (local node indices).
+  std::vector<std::array<GLint, 8> > loc_face;                                                      // Element faces (sorted key, ordered nodes).
+  std::array<GLint, 8>              loc_face_node;                                                  // Face (sorted key, ordered nodes).
+  size_t                            f;                                                              // Face index.
+  size_t                            g;                                                              // Face group end index.
+
   neutrino::action ("finding mesh nodes in the given physical group...");                           // Printing message...
 
   // Clearing arrays:
@@ -90,6 +97,8 @@ void nu::mesh::process (
   neighbour_offset.clear ();                                                                        // Clearing neighbour offset indices...
   neighbour_link.clear ();                                                                          // Clearing neighbour links...
   neighbour_length.clear ();                                                                        // Clearing neighbour link lengths...
+  edge.clear ();                                                                                    // Clearing edge indices...
+  triangle.clear ();                                                                                // Clearing triangle indices...
 
   for(e = 0; e < entities; e++)
   {
@@ -320,6 +329,109 @@ void nu::mesh::process (
   }
 
   neutrino::done ();                                                                                // Printing message...
+
+  neutrino::action ("building rendering index vectors...");                                         // Printing message...
+
+  // Building edge vector (each neighbour link once):
+  for(i = 0; i < neighbour.size (); i++)
+  {
+    if(neighbour_center[i] < neighbour[i])
+    {
+      edge.push_back (neighbour_center[i]);                                                         // Setting edge first node...
+      edge.push_back (neighbour[i]);                                                                // Setting edge second node...
+    }
+  }
+
+  // Setting element type faces (GMSH node ordering, outward orientation):
+  switch(loc_element_type)
+  {
+    case 2:
+      loc_face_table = {{0, 1, 2}};                                                                 // 3-node triangle.
+      break;
+
+    case 3:
+      loc_face_table = {{0, 1, 2, 3}};                                                              // 4-node quadrangle.
+      break;
+
+    case 4:
+      loc_face_table = {{0, 2, 1}, {0, 1, 3}, {0, 3, 2}, {1, 2, 3}};                                // 4-node tetrahedron.
+      break;
+
+    case 5:
+      loc_face_table = {
+        {0, 3, 2, 1}, {4, 5, 6, 7}, {0, 1, 5, 4}, {1, 2, 6, 5}, {2, 3, 7, 6}, {3, 0, 4, 7}
+      };                                                                                            // 8-node hexahedron.
+      break;
+
+    case 6:
+      loc_face_table = {{0, 2, 1}, {3, 4, 5}, {0, 1, 4, 3}, {1, 2, 5, 4}, {2, 0, 3, 5}};            // 6-node prism.
+      break;
+
+    case 7:
+      loc_face_table = {{0, 3, 2, 1}, {0, 1, 4}, {1, 2, 4}, {2, 3, 4}, {3, 0, 4}};                  // 5-node pyramid.
+      break;
+
+    default:
+      loc_face_table.clear ();                                                                      // No faces (e.g. lines).
+      break;
+  }
+
+  // For each "k" element:
+  for(k = 0; k < loc_element_size; k++)
+  {
+    m_min = (k == 0) ? 0 : element_offset[k - 1];                                                   // Setting minimum element offset index...
+
+    // For each "f" face of the "k" element:
+    for(f = 0; f < loc_face_table.size (); f++)
+    {
+      loc_face_node.fill (-1);                                                                      // Resetting face nodes...
+
+      for(n = 0; n < loc_face_table[f].size (); n++)
+      {
+        loc_face_node[n]     = element[m_min + loc_face_table[f][n]];                               // Setting face key node...
+        loc_face_node[n + 4] = loc_face_node[n];                                                    // Setting face ordered node...
+      }
+
+      std::sort (loc_face_node.begin (), loc_face_node.begin () + 4);                               // Sorting face key...
+      loc_face.push_back (loc_face_node);                                                           // Adding face...
+    }
+  }
+
+  // Keeping only the boundary faces (not shared by two elements) of volume elements:
+  if(loc_type_dimension == 3)
+  {
+    std::sort (loc_face.begin (), loc_face.end ());                                                 // Sorting faces by key...
+  }
+
+  f = 0;                                                                                            // Resetting face index...
+
+  while(f < loc_face.size ())
+  {
+    g = f + 1;                                                                                      // Initializing face group end index...
+
+    while((loc_type_dimension == 3) && (g < loc_face.size ()) &&
+          std::equal (loc_face[g].begin (), loc_face[g].begin () + 4, loc_face[f].begin ()))
+    {
+      g++;                                                                                          // Finding faces with the same key...
+    }
+
+    if(g == (f + 1))
+    {
+      loc_face_node = loc_face[f];                                                                  // Getting face nodes...
+
+      // Splitting face in triangles (fan):
+      for(n = 6; (n < 8) && (loc_face_node[n] != -1); n++)
+      {
+        triangle.push_back (loc_face_node[4]);                                                      // Setting triangle first node...
+        triangle.push_back (loc_face_node[n - 1]);                                                  // Setting triangle second node...
+        triangle.push_back (loc_face_node[n]);                                                      // Setting triangle third node...
+      }
+    }
+
+    f = g;                                                                                          // Moving to next face group...
+  }
+
+  neutrino::done ();                                                                                // Printing message...
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////
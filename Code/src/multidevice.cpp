@@ -0,0 +1,703 @@
+/// @file     multidevice.cpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Definition of a "multidevice" domain decomposition class.
+
+#include "multidevice.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////// Halo pack kernel //////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+static const char* nu_pack_source = R"(
+__kernel void nu_pack (
+                       __global const float4* field,
+                       __global const int*    index,
+                       __global float4*       send,
+                       const uint             offset,
+                       const uint             size
+                      )
+{
+  uint i = get_global_id (0);
+
+  if(i < size)
+  {
+    send[offset + i] = field[index[i]];
+  }
+}
+)";
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////// multidevice /////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+nu::multidevice::multidevice ()
+{
+  context          = NULL;                                                                          // Resetting context...
+  program          = NULL;                                                                          // Resetting kernel program...
+  pack_program     = NULL;                                                                          // Resetting halo pack program...
+  step_time        = 0.0;                                                                           // Resetting step time...
+  halo_time        = 0.0;                                                                           // Resetting halo exchange time...
+  halo_size        = 0;                                                                             // Resetting number of halo nodes...
+  compiler_options = "";                                                                            // Setting no options...
+  ready            = false;                                                                         // Resetting "ready" flag...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////// init ////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::multidevice::init (
+                            std::vector<cl_device_id> loc_device                                    // Devices.
+                           )
+{
+  cl_int  loc_error;                                                                                // Error code.
+  cl_uint loc_units;                                                                                // Device compute units.
+  cl_uint loc_clock;                                                                                // Device clock frequency [MHz].
+  size_t  i;                                                                                        // Device index.
+
+  neutrino::action ("creating multi-device OpenCL context...");                                     // Printing message...
+
+  if(loc_device.empty ())
+  {
+    neutrino::error ("no OpenCL devices given!");                                                   // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  device  = loc_device;                                                                             // Setting devices...
+  context = clCreateContext (NULL, (cl_uint)device.size (), device.data (), NULL, NULL, &loc_error);
+  neutrino::check_error (loc_error);                                                                // Checking returned error code...
+
+  for(i = 0; i < device.size (); i++)
+  {
+    queue.push_back (clCreateCommandQueue (context, device[i], CL_QUEUE_PROFILING_ENABLE, &loc_error));
+    neutrino::check_error (loc_error);                                                              // Checking returned error code...
+
+    // Setting default device weight:
+    neutrino::check_error (clGetDeviceInfo (device[i], CL_DEVICE_MAX_COMPUTE_UNITS, sizeof(cl_uint), &loc_units, NULL));
+    neutrino::check_error (clGetDeviceInfo (device[i], CL_DEVICE_MAX_CLOCK_FREQUENCY, sizeof(cl_uint), &loc_clock, NULL));
+    weight.push_back ((double)loc_units*(double)std::max (loc_clock, (cl_uint)1));
+  }
+
+  compute_time.assign (device.size (), 0.0);                                                        // Resetting device kernel times...
+
+  neutrino::done ();                                                                                // Printing message...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////// partition //////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::multidevice::partition (
+                                 nu::mesh* loc_mesh                                                 // Mesh.
+                                )
+{
+  size_t                            loc_nodes;                                                      // Number of nodes.
+  size_t                            loc_parts;                                                      // Number of partitions.
+  std::vector<GLint>                loc_start;                                                      // Global adjacency start offsets.
+  std::vector<GLint>                loc_adjacent;                                                   // Global adjacency link indices.
+  std::vector<GLint>                loc_order;                                                      // Breadth-first node order.
+  std::vector<GLint>                loc_level;                                                      // Breadth-first visit flags.
+  std::vector<GLint>                loc_local;                                                      // Node local index (owner partition).
+  std::vector<GLint>                loc_map;                                                        // Node local index (current partition).
+  std::vector<std::pair<GLint, GLint> > loc_halo;                                                   // Halo nodes (owner, global index).
+  double                            loc_total;                                                      // Total weight.
+  double                            loc_sum;                                                        // Cumulative weight.
+  size_t                            loc_head;                                                       // Breadth-first queue head.
+  size_t                            loc_begin;                                                      // Partition first ordered node.
+  size_t                            loc_end;                                                        // Partition last ordered node + 1.
+  GLint                             loc_seed;                                                       // Breadth-first seed node.
+  GLint                             g;                                                              // Global node index.
+  GLint                             n;                                                              // Global neighbour index.
+  size_t                            i;                                                              // Index.
+  size_t                            k;                                                              // Link index.
+  size_t                            p;                                                              // Partition index.
+  size_t                            s;                                                              // Pass index.
+
+  neutrino::action ("partitioning mesh among devices...");                                          // Printing message...
+
+  loc_nodes = loc_mesh->node_coordinates.size ();                                                   // Getting number of nodes...
+  loc_parts = device.size ();                                                                       // Getting number of partitions...
+
+  // Building global adjacency (by link center):
+  loc_start.assign (loc_nodes + 1, 0);
+
+  for(k = 0; k < loc_mesh->neighbour.size (); k++)
+  {
+    loc_start[loc_mesh->neighbour_center[k] + 1]++;                                                 // Counting links...
+  }
+
+  for(i = 0; i < loc_nodes; i++)
+  {
+    loc_start[i + 1] += loc_start[i];                                                               // Accumulating link counts...
+  }
+
+  loc_adjacent.resize (loc_mesh->neighbour.size ());
+  loc_map = loc_start;                                                                              // Using as fill cursor...
+
+  for(k = 0; k < loc_mesh->neighbour.size (); k++)
+  {
+    loc_adjacent[loc_map[loc_mesh->neighbour_center[k]]++] = (GLint)k;                              // Setting link (in mesh order)...
+  }
+
+  // Ordering nodes breadth-first, from a pseudo-peripheral seed (second visit from the last node):
+  loc_seed = 0;                                                                                     // Setting seed node...
+
+  for(s = 0; s < 2; s++)
+  {
+    loc_order.clear ();
+    loc_level.assign (loc_nodes, 0);
+
+    for(i = 0; i <= loc_nodes; i++)
+    {
+      g = (i == 0) ? loc_seed : (GLint)(i - 1);                                                     // Setting next unvisited component seed...
+
+      if((loc_nodes == 0) || loc_level[g])
+      {
+        continue;
+      }
+
+      loc_level[g] = 1;                                                                             // Visiting seed...
+      loc_order.push_back (g);
+      loc_head     = loc_order.size () - 1;                                                         // Setting queue head...
+
+      while(loc_head < loc_order.size ())
+      {
+        g = loc_order[loc_head++];                                                                  // Dequeuing node...
+
+        for(k = loc_start[g]; k < (size_t)loc_start[g + 1]; k++)
+        {
+          n = loc_mesh->neighbour[loc_adjacent[k]];                                                 // Getting neighbour...
+
+          if(!loc_level[n])
+          {
+            loc_level[n] = 1;                                                                       // Visiting neighbour...
+            loc_order.push_back (n);                                                                // Enqueuing neighbour...
+          }
+        }
+      }
+    }
+
+    if(!loc_order.empty ())
+    {
+      loc_seed = loc_order.back ();                                                                 // Setting farthest node as new seed...
+    }
+  }
+
+  // Cutting the order in contiguous partitions, proportionally to the device weights:
+  part.assign (loc_nodes, 0);
+  loc_local.assign (loc_nodes, 0);
+  node.assign (loc_parts, std::vector<GLint>());
+  owned.assign (loc_parts, 0);
+  loc_total = 0.0;
+
+  for(p = 0; p < loc_parts; p++)
+  {
+    loc_total += weight[p];                                                                         // Summing weights...
+  }
+
+  loc_sum   = 0.0;
+  loc_begin = 0;
+
+  for(p = 0; p < loc_parts; p++)
+  {
+    loc_sum += weight[p];                                                                           // Accumulating weights...
+    loc_end  = (p == loc_parts - 1) ? loc_nodes : (size_t)(loc_nodes*loc_sum/loc_total + 0.5);
+
+    for(i = loc_begin; i < loc_end; i++)
+    {
+      g            = loc_order[i];                                                                  // Getting node...
+      part[g]      = (GLint)p;                                                                      // Setting node partition...
+      loc_local[g] = (GLint)node[p].size ();                                                        // Setting node local index...
+      node[p].push_back (g);                                                                        // Adding owned node...
+    }
+
+    owned[p]  = node[p].size ();                                                                    // Setting number of owned nodes...
+    loc_begin = loc_end;
+  }
+
+  // Building partition local connectivity and halo exchange lists:
+  local_neighbour.assign (loc_parts, std::vector<GLint>());
+  local_offset.assign (loc_parts, std::vector<GLint>());
+  local_link.assign (loc_parts, std::vector<nu_float4_structure>());
+  local_length.assign (loc_parts, std::vector<GLfloat>());
+  halo_source.clear ();
+  halo_target.clear ();
+  halo_start.clear ();
+  halo_index.clear ();
+  halo_size = 0;
+  loc_map.assign (loc_nodes, -1);
+
+  for(p = 0; p < loc_parts; p++)
+  {
+    loc_halo.clear ();
+
+    for(i = 0; i < owned[p]; i++)
+    {
+      loc_map[node[p][i]] = (GLint)i;                                                               // Mapping owned node...
+    }
+
+    for(i = 0; i < owned[p]; i++)
+    {
+      g = node[p][i];
+
+      for(k = loc_start[g]; k < (size_t)loc_start[g + 1]; k++)
+      {
+        n = loc_mesh->neighbour[loc_adjacent[k]];
+
+        if(loc_map[n] < 0)
+        {
+          loc_map[n] = -2;                                                                          // Marking halo node...
+          loc_halo.push_back (std::make_pair (part[n], n));                                         // Adding halo node...
+        }
+      }
+    }
+
+    std::sort (loc_halo.begin (), loc_halo.end ());                                                 // Grouping halo nodes by owner...
+
+    for(i = 0; i < loc_halo.size (); i++)
+    {
+      if((i == 0) || (loc_halo[i].first != loc_halo[i - 1].first))
+      {
+        halo_source.push_back (loc_halo[i].first);                                                  // Adding exchange source...
+        halo_target.push_back (p);                                                                  // Adding exchange target...
+        halo_start.push_back (node[p].size ());                                                     // Adding exchange first target index...
+        halo_index.push_back (std::vector<GLint>());
+      }
+
+      loc_map[loc_halo[i].second] = (GLint)node[p].size ();                                         // Mapping halo node...
+      halo_index.back ().push_back (loc_local[loc_halo[i].second]);                                 // Adding source local index...
+      node[p].push_back (loc_halo[i].second);                                                       // Adding halo node...
+    }
+
+    halo_size += loc_halo.size ();                                                                  // Counting halo nodes...
+
+    for(i = 0; i < owned[p]; i++)
+    {
+      g = node[p][i];
+
+      for(k = loc_start[g]; k < (size_t)loc_start[g + 1]; k++)
+      {
+        local_neighbour[p].push_back (loc_map[loc_mesh->neighbour[loc_adjacent[k]]]);               // Setting local neighbour...
+        local_link[p].push_back (loc_mesh->neighbour_link[loc_adjacent[k]]);                        // Setting neighbour link...
+        local_length[p].push_back (loc_mesh->neighbour_length[loc_adjacent[k]]);                    // Setting neighbour length...
+      }
+
+      local_offset[p].push_back ((GLint)local_neighbour[p].size ());                                // Setting local neighbour end offset...
+    }
+
+    for(i = 0; i < node[p].size (); i++)
+    {
+      loc_map[node[p][i]] = -1;                                                                     // Resetting map...
+    }
+  }
+
+  neutrino::done ();                                                                                // Printing message...
+
+  for(p = 0; p < loc_parts; p++)
+  {
+    std::cout << "        --> partition " << p << ": " << owned[p] << " nodes, ";                   // Printing message...
+    std::cout << node[p].size () - owned[p] << " halo nodes" << std::endl;                          // Printing message...
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////// addfield //////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::multidevice::addfield (
+                                nu::float4* loc_field                                               // Field.
+                               )
+{
+  field.push_back (loc_field);                                                                      // Adding field...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////// addsource //////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::multidevice::addsource (
+                                 std::string loc_kernel_file_name                                   // OpenCL kernel file name.
+                                )
+{
+  neutrino::action ("loading OpenCL kernel source from file...");                                   // Printing message...
+  kernel_source.push_back (neutrino::read_file (loc_kernel_file_name) + '\n');                      // Adding kernel source...
+  neutrino::done ();                                                                                // Printing message...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////// build ////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::multidevice::build ()
+{
+  cl_int                   loc_error;                                                               // Error code.
+  std::vector<const char*> loc_source;                                                              // Kernel sources, C style strings.
+  size_t                   loc_log_size;                                                            // OpenCL JIT compiler log size.
+  std::string              loc_log;                                                                 // OpenCL JIT compiler log.
+  std::vector<nu_float4_structure> loc_data;                                                        // Partition field data.
+  std::vector<GLint>       loc_neighbour;                                                           // Partition local neighbour indices (padded).
+  std::vector<GLint>       loc_offset;                                                              // Partition local neighbour end offsets (padded).
+  std::vector<nu_float4_structure> loc_link;                                                        // Partition neighbour links (padded).
+  std::vector<GLfloat>     loc_length;                                                              // Partition neighbour link lengths (padded).
+  cl_uint                  loc_arg;                                                                 // Kernel argument index.
+  size_t                   i;                                                                       // Index.
+  size_t                   f;                                                                       // Field index.
+  size_t                   p;                                                                       // Partition index.
+
+  for(f = 0; f < field.size (); f++)
+  {
+    if(field[f]->data.size () != part.size ())
+    {
+      neutrino::error ("field size does not match the number of mesh nodes!");                      // Printing message...
+      exit (EXIT_FAILURE);                                                                          // Exiting...
+    }
+  }
+
+  release ();                                                                                       // Releasing previous build, if any...
+
+  neutrino::action ("building multi-device OpenCL program...");                                     // Printing message...
+
+  for(i = 0; i < kernel_source.size (); i++)
+  {
+    loc_source.push_back (kernel_source[i].c_str ());                                               // Getting source...
+  }
+
+  program   = clCreateProgramWithSource (context, (cl_uint)loc_source.size (), loc_source.data (), NULL, &loc_error);
+  neutrino::check_error (loc_error);                                                                // Checking returned error code...
+  loc_error = clBuildProgram (program, (cl_uint)device.size (), device.data (), compiler_options.c_str (), NULL, NULL);
+
+  if(loc_error != CL_SUCCESS)
+  {
+    neutrino::error (neutrino::get_error (loc_error));                                              // Printing message...
+
+    for(p = 0; p < device.size (); p++)
+    {
+      clGetProgramBuildInfo (program, device[p], CL_PROGRAM_BUILD_LOG, 0, NULL, &loc_log_size);
+      loc_log.assign (loc_log_size + 1, '\0');
+      clGetProgramBuildInfo (program, device[p], CL_PROGRAM_BUILD_LOG, loc_log_size + 1, &loc_log[0], NULL);
+      std::cout << loc_log.c_str () << std::endl;                                                   // Printing log...
+    }
+
+    exit (loc_error);                                                                               // Exiting...
+  }
+
+  pack_program = clCreateProgramWithSource (context, 1, &nu_pack_source, NULL, &loc_error);
+  neutrino::check_error (loc_error);                                                                // Checking returned error code...
+  neutrino::check_error (clBuildProgram (pack_program, (cl_uint)device.size (), device.data (), "", NULL, NULL));
+
+  neutrino::done ();                                                                                // Printing message...
+
+  neutrino::action ("creating partition buffers...");                                               // Printing message...
+
+  field_buffer.assign (device.size (), std::vector<cl_mem>());
+
+  for(p = 0; p < device.size (); p++)
+  {
+    // Creating connectivity buffers (at least one entry, also for isolated partitions):
+    loc_neighbour = local_neighbour[p];
+    loc_link      = local_link[p];
+    loc_length    = local_length[p];
+    loc_offset    = local_offset[p];
+    loc_neighbour.push_back (0);
+    loc_link.push_back ({0.0f, 0.0f, 0.0f, 0.0f});
+    loc_length.push_back (0.0f);
+    loc_offset.push_back (0);
+
+    neighbour_buffer.push_back (clCreateBuffer (context, CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR, sizeof(GLint)*loc_neighbour.size (), loc_neighbour.data (), &loc_error));
+    neutrino::check_error (loc_error);                                                              // Checking returned error code...
+    offset_buffer.push_back (clCreateBuffer (context, CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR, sizeof(GLint)*loc_offset.size (), loc_offset.data (), &loc_error));
+    neutrino::check_error (loc_error);                                                              // Checking returned error code...
+    link_buffer.push_back (clCreateBuffer (context, CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR, sizeof(nu_float4_structure)*loc_link.size (), loc_link.data (), &loc_error));
+    neutrino::check_error (loc_error);                                                              // Checking returned error code...
+    length_buffer.push_back (clCreateBuffer (context, CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR, sizeof(GLfloat)*loc_length.size (), loc_length.data (), &loc_error));
+    neutrino::check_error (loc_error);                                                              // Checking returned error code...
+
+    // Creating field buffers (owned + halo nodes):
+    for(f = 0; f < field.size (); f++)
+    {
+      loc_data.resize (std::max (node[p].size (), (size_t)1));
+
+      for(i = 0; i < node[p].size (); i++)
+      {
+        loc_data[i] = field[f]->data[node[p][i]];                                                   // Scattering field data...
+      }
+
+      field_buffer[p].push_back (clCreateBuffer (context, CL_MEM_READ_WRITE | CL_MEM_COPY_HOST_PTR, sizeof(nu_float4_structure)*loc_data.size (), loc_data.data (), &loc_error));
+      neutrino::check_error (loc_error);                                                            // Checking returned error code...
+    }
+
+    // Creating partition kernel and setting its arguments:
+    kernel.push_back (clCreateKernel (program, NU_KERNEL_NAME, &loc_error));
+    neutrino::check_error (loc_error);                                                              // Checking returned error code...
+    loc_arg   = 0;
+    loc_error = clSetKernelArg (kernel[p], loc_arg++, sizeof(cl_mem), &neighbour_buffer[p]);        // Local neighbour indices.
+    loc_error |= clSetKernelArg (kernel[p], loc_arg++, sizeof(cl_mem), &offset_buffer[p]);          // Local neighbour end offsets.
+    loc_error |= clSetKernelArg (kernel[p], loc_arg++, sizeof(cl_mem), &link_buffer[p]);            // Neighbour links.
+    loc_error |= clSetKernelArg (kernel[p], loc_arg++, sizeof(cl_mem), &length_buffer[p]);          // Neighbour link lengths.
+
+    for(f = 0; f < field.size (); f++)
+    {
+      loc_error |= clSetKernelArg (kernel[p], loc_arg++, sizeof(cl_mem), &field_buffer[p][f]);      // Field.
+    }
+
+    neutrino::check_error (loc_error);                                                              // Checking returned error code...
+
+    pack_kernel.push_back (clCreateKernel (pack_program, "nu_pack", &loc_error));
+    neutrino::check_error (loc_error);                                                              // Checking returned error code...
+  }
+
+  // Creating halo exchange buffers:
+  for(i = 0; i < halo_index.size (); i++)
+  {
+    halo_index_buffer.push_back (clCreateBuffer (context, CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR, sizeof(GLint)*halo_index[i].size (), halo_index[i].data (), &loc_error));
+    neutrino::check_error (loc_error);                                                              // Checking returned error code...
+    halo_send_buffer.push_back (clCreateBuffer (context, CL_MEM_READ_WRITE, sizeof(nu_float4_structure)*halo_index[i].size ()*std::max (field.size (), (size_t)1), NULL, &loc_error));
+    neutrino::check_error (loc_error);                                                              // Checking returned error code...
+  }
+
+  ready = true;                                                                                     // Setting "ready" flag...
+
+  neutrino::done ();                                                                                // Printing message...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////// exchange //////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::multidevice::exchange (
+                                std::vector<cl_event>& loc_kernel_event                             // Partition kernel events.
+                               )
+{
+  cl_event              loc_pack_event = NULL;                                                      // Pack event.
+  std::vector<cl_event> loc_event;                                                                  // Pack events (one per exchange).
+  size_t                loc_size;                                                                   // Exchange size [#].
+  size_t                loc_global;                                                                 // Pack global size.
+  cl_uint               loc_offset;                                                                 // Pack send buffer offset [#].
+  cl_uint               loc_count;                                                                  // Pack size [#].
+  size_t                e;                                                                          // Exchange index.
+  size_t                f;                                                                          // Field index.
+  size_t                s;                                                                          // Source partition index.
+  size_t                t;                                                                          // Target partition index.
+  cl_uint               loc_wait;                                                                   // Pack wait list size [#].
+
+  if(field.empty ())
+  {
+    return;                                                                                         // Nothing to exchange...
+  }
+
+  // Packing halo nodes on the owner devices (after their kernels):
+  for(e = 0; e < halo_index.size (); e++)
+  {
+    s          = halo_source[e];
+    loc_wait   = (loc_kernel_event[s] != NULL) ? 1 : 0;
+    loc_size   = halo_index[e].size ();
+    loc_count  = (cl_uint)loc_size;
+    loc_global = loc_size;
+
+    for(f = 0; f < field.size (); f++)
+    {
+      loc_offset = (cl_uint)(f*loc_size);
+      neutrino::check_error (clSetKernelArg (pack_kernel[s], 0, sizeof(cl_mem), &field_buffer[s][f]));
+      neutrino::check_error (clSetKernelArg (pack_kernel[s], 1, sizeof(cl_mem), &halo_index_buffer[e]));
+      neutrino::check_error (clSetKernelArg (pack_kernel[s], 2, sizeof(cl_mem), &halo_send_buffer[e]));
+      neutrino::check_error (clSetKernelArg (pack_kernel[s], 3, sizeof(cl_uint), &loc_offset));
+      neutrino::check_error (clSetKernelArg (pack_kernel[s], 4, sizeof(cl_uint), &loc_count));
+      neutrino::check_error (clEnqueueNDRangeKernel (queue[s], pack_kernel[s], 1, NULL, &loc_global, NULL, loc_wait, loc_wait ? &loc_kernel_event[s] : NULL, (f == field.size () - 1) ? &loc_pack_event : NULL));
+    }
+
+    loc_event.push_back (loc_pack_event);
+  }
+
+  for(s = 0; s < queue.size (); s++)
+  {
+    clFlush (queue[s]);                                                                             // Submitting kernels and packs...
+  }
+
+  // Copying packed halo nodes to the target devices (after their kernels, same in-order queue):
+  for(e = 0; e < halo_index.size (); e++)
+  {
+    t        = halo_target[e];
+    loc_size = halo_index[e].size ();
+
+    for(f = 0; f < field.size (); f++)
+    {
+      neutrino::check_error (clEnqueueCopyBuffer (queue[t], halo_send_buffer[e], field_buffer[t][f], sizeof(nu_float4_structure)*f*loc_size, sizeof(nu_float4_structure)*halo_start[e], sizeof(nu_float4_structure)*loc_size, 1, &loc_event[e], NULL));
+    }
+  }
+
+  for(e = 0; e < loc_event.size (); e++)
+  {
+    clReleaseEvent (loc_event[e]);                                                                  // Releasing pack event...
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////// step ////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::multidevice::step ()
+{
+  std::vector<cl_event> loc_kernel_event;                                                           // Partition kernel events.
+  cl_ulong              loc_start;                                                                  // Kernel start time [ns].
+  cl_ulong              loc_end;                                                                    // Kernel end time [ns].
+  size_t                loc_global;                                                                 // Kernel global size.
+  double                loc_slowest;                                                                // Slowest kernel time [s].
+  size_t                p;                                                                          // Partition index.
+
+  auto loc_tic = std::chrono::steady_clock::now ();                                                 // Getting step start time...
+
+  for(p = 0; p < queue.size (); p++)
+  {
+    loc_kernel_event.push_back (NULL);
+    loc_global = std::max (owned[p], (size_t)1);
+
+    if(owned[p] > 0)
+    {
+      neutrino::check_error (clEnqueueNDRangeKernel (queue[p], kernel[p], 1, NULL, &loc_global, NULL, 0, NULL, &loc_kernel_event[p]));
+    }
+  }
+
+  exchange (loc_kernel_event);                                                                      // Exchanging halo nodes...
+
+  for(p = 0; p < queue.size (); p++)
+  {
+    clFinish (queue[p]);                                                                            // Waiting for the partition...
+  }
+
+  step_time   = std::chrono::duration<double>(std::chrono::steady_clock::now () - loc_tic).count ();
+  loc_slowest = 0.0;
+
+  for(p = 0; p < queue.size (); p++)
+  {
+    compute_time[p] = 0.0;
+
+    if(loc_kernel_event[p] != NULL)
+    {
+      clGetEventProfilingInfo (loc_kernel_event[p], CL_PROFILING_COMMAND_START, sizeof(cl_ulong), &loc_start, NULL);
+      clGetEventProfilingInfo (loc_kernel_event[p], CL_PROFILING_COMMAND_END, sizeof(cl_ulong), &loc_end, NULL);
+      compute_time[p] = (double)(loc_end - loc_start)*1.0e-9;                                       // Setting device kernel time...
+      clReleaseEvent (loc_kernel_event[p]);                                                         // Releasing kernel event...
+    }
+
+    loc_slowest = std::max (loc_slowest, compute_time[p]);                                          // Getting slowest kernel time...
+  }
+
+  halo_time = std::max (step_time - loc_slowest, 0.0);                                              // Setting halo exchange time...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////// write ////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::multidevice::write ()
+{
+  std::vector<nu_float4_structure> loc_data;                                                        // Partition field data.
+  size_t                           i;                                                               // Node index.
+  size_t                           f;                                                               // Field index.
+  size_t                           p;                                                               // Partition index.
+
+  for(p = 0; p < queue.size (); p++)
+  {
+    loc_data.resize (node[p].size ());
+
+    for(f = 0; (f < field.size ()) && !loc_data.empty (); f++)
+    {
+      for(i = 0; i < node[p].size (); i++)
+      {
+        loc_data[i] = field[f]->data[node[p][i]];                                                   // Scattering field data...
+      }
+
+      neutrino::check_error (clEnqueueWriteBuffer (queue[p], field_buffer[p][f], CL_TRUE, 0, sizeof(nu_float4_structure)*loc_data.size (), loc_data.data (), 0, NULL, NULL));
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////// gather ///////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::multidevice::gather ()
+{
+  std::vector<nu_float4_structure> loc_data;                                                        // Partition field data.
+  size_t                           i;                                                               // Node index.
+  size_t                           f;                                                               // Field index.
+  size_t                           p;                                                               // Partition index.
+
+  for(p = 0; p < queue.size (); p++)
+  {
+    loc_data.resize (owned[p]);
+
+    for(f = 0; (f < field.size ()) && !loc_data.empty (); f++)
+    {
+      neutrino::check_error (clEnqueueReadBuffer (queue[p], field_buffer[p][f], CL_TRUE, 0, sizeof(nu_float4_structure)*loc_data.size (), loc_data.data (), 0, NULL, NULL));
+
+      for(i = 0; i < owned[p]; i++)
+      {
+        field[f]->data[node[p][i]] = loc_data[i];                                                   // Gathering field data...
+      }
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////// release ///////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::multidevice::release ()
+{
+  size_t i;                                                                                         // Index.
+  size_t f;                                                                                         // Field index.
+
+  for(i = 0; i < halo_index_buffer.size (); i++)
+  {
+    clReleaseMemObject (halo_index_buffer[i]);                                                      // Releasing halo index buffer...
+    clReleaseMemObject (halo_send_buffer[i]);                                                       // Releasing halo send buffer...
+  }
+
+  for(i = 0; i < kernel.size (); i++)
+  {
+    clReleaseKernel (kernel[i]);                                                                    // Releasing partition kernel...
+    clReleaseKernel (pack_kernel[i]);                                                               // Releasing partition pack kernel...
+    clReleaseMemObject (neighbour_buffer[i]);                                                       // Releasing neighbour buffer...
+    clReleaseMemObject (offset_buffer[i]);                                                          // Releasing offset buffer...
+    clReleaseMemObject (link_buffer[i]);                                                            // Releasing link buffer...
+    clReleaseMemObject (length_buffer[i]);                                                          // Releasing length buffer...
+
+    for(f = 0; f < field_buffer[i].size (); f++)
+    {
+      clReleaseMemObject (field_buffer[i][f]);                                                      // Releasing field buffer...
+    }
+  }
+
+  if(program != NULL)
+  {
+    clReleaseProgram (program);                                                                     // Releasing kernel program...
+    program = NULL;                                                                                 // Resetting kernel program...
+  }
+
+  if(pack_program != NULL)
+  {
+    clReleaseProgram (pack_program);                                                                // Releasing halo pack program...
+    pack_program = NULL;                                                                            // Resetting halo pack program...
+  }
+
+  halo_index_buffer.clear ();
+  halo_send_buffer.clear ();
+  kernel.clear ();
+  pack_kernel.clear ();
+  neighbour_buffer.clear ();
+  offset_buffer.clear ();
+  link_buffer.clear ();
+  length_buffer.clear ();
+  field_buffer.clear ();
+  ready = false;                                                                                    // Resetting "ready" flag...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////// ~multidevice ////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+nu::multidevice::~multidevice ()
+{
+  size_t i;                                                                                         // Index.
+
+  release ();                                                                                       // Releasing build objects...
+
+  for(i = 0; i < queue.size (); i++)
+  {
+    clReleaseCommandQueue (queue[i]);                                                               // Releasing device queue...
+  }
+
+  if(context != NULL)
+  {
+    clReleaseContext (context);                                                                     // Releasing context...
+  }
+}
@@ -6,6 +6,9 @@
 #include "neutrino.hpp"
 
 bool                   neutrino::interop;                                                           // Use OpenCL-OpenGL interop (static variable storage).
+render_mode            neutrino::render;                                                            // Render mode (static variable storage).
+size_t                 neutrino::steps;                                                             // Kernel launches since last "toc" (static variable storage).
+double                 neutrino::step_rate;                                                         // Kernel launches per second (static variable storage).
 double                 neutrino::tic;                                                               // Tic time [s] (static variable storage).
 double                 neutrino::toc;                                                               // Toc time [s] (static variable storage).
 double                 neutrino::loop_time;                                                         // Loop time [s] (static variable storage).
@@ -15,10 +18,13 @@ double                 neutrino::task_time;
 cl_context             neutrino::context_id;                                                        // OpenCL context ID (static variable storage).
 cl_platform_id         neutrino::platform_id;                                                       // OpenCL platform ID (static variable storage).
 cl_device_id           neutrino::device_id;                                                         // OpenCL device ID (static variable storage).
+std::vector<cl_device_id> neutrino::subdevice_id;                                                   // OpenCL sub-device ID array (static variable storage).
 cl_command_queue       neutrino::queue_id;                                                          // OpenCL queue ID (static variable storage).
 std::vector<cl_kernel> neutrino::kernel_id;                                                         // OpenCL kernel ID array (static variable storage).
 GLFWwindow*            neutrino::glfw_window;                                                       // Window handle.
 bool                   neutrino::init_done = false;                                                 // init_done flag.
+std::atomic<GLsync>    neutrino::gl_fence (NULL);                                                   // Render thread frame fence (static variable storage).
+std::atomic<GLsync>    neutrino::gl_spent (NULL);                                                   // Consumed frame fence (static variable storage).
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 /////////////////////////////////////////// "neutrino" class /////////////////////////////////////////
@@ -29,6 +35,11 @@ neutrino::neutrino()
 
 void neutrino::init ()
 {
+  if(neutrino::init_done)
+  {
+    return;                                                                                         // Keeping current context and queue...
+  }
+
   // Setting ANSI color modality for Windows:
   #ifdef WIN32
     DWORD  l_mode;
@@ -47,12 +58,16 @@ void neutrino::init ()
 
   neutrino::terminal_time = 0;                                                                      // Resetting terminal time...
   neutrino::interop       = false;                                                                  // Use OpenCL-OpenGL interop.
+  neutrino::render        = NU_RENDER_SYNC;                                                         // Setting serialized render mode...
+  neutrino::steps         = 0;                                                                      // Resetting kernel launches...
+  neutrino::step_rate     = 0.0;                                                                    // Resetting kernel launch rate...
   neutrino::tic           = 0.0;                                                                    // Resetting tic time...
   neutrino::toc           = 0.0;                                                                    // Resetting toc time...
   neutrino::loop_time     = 0.0;                                                                    // Resetting loop time...
   neutrino::context_id    = NULL;                                                                   // OpenCL context ID.
   neutrino::platform_id   = NULL;                                                                   // OpenCL platform ID.
   neutrino::device_id     = NULL;                                                                   // OpenCL device ID.
+  neutrino::queue_id      = NULL;                                                                   // OpenCL queue ID.
   neutrino::init_done     = true;                                                                   // Setting init_done flag...
 
   done ();                                                                                          // Printing message...
@@ -72,6 +87,13 @@ void neutrino::get_toc ()
   neutrino::loop_time      = neutrino::toc - neutrino::tic;                                         // Loop execution time [s].
   neutrino::terminal_time += size_t (round (neutrino::loop_time*1000000.0f));                       // Terminal time [us].
 
+  if(neutrino::loop_time > 0.0)
+  {
+    neutrino::step_rate = neutrino::steps/neutrino::loop_time;                                      // Kernel launches per second [#/s].
+  }
+
+  neutrino::steps          = 0;                                                                     // Resetting kernel launches...
+
   if(neutrino::terminal_time > NU_TERMINAL_REFRESH)                                                 // Checking terminal time...
   {
     neutrino::terminal_time = 0;                                                                    // Resetting terminal time.
@@ -83,7 +105,9 @@ void neutrino::get_toc ()
                               std::string (NU_COLOR_NORMAL) +
                               std::string ("running host loop time = ") +
                               std::to_string (long (round (1000000.0*neutrino::loop_time))) +
-                              std::string (" us");
+                              std::string (" us, ") +
+                              std::to_string (long (round (neutrino::step_rate))) +
+                              std::string (" steps/s");
 
     std::cout << loc_text + loc_pad << std::flush;                                                  // Printing buffer...
   }
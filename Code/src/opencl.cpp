@@ -7,6 +7,40 @@
 
 queue* nu::opencl::opencl_queue;                                                                    // OpenCL queue.
 bool   nu::opencl::init_done = false;                                                               // init_done flag.
+std::string nu::opencl::platform_choice = "";                                                       // Platform choice (name, "" = automatic).
+std::string nu::opencl::device_choice   = "";                                                       // Device choice (index, "" = automatic).
+bool        nu::opencl::verbose         = false;                                                    // Enumeration "verbose" flag.
+std::string nu::opencl::subdevice_choice = "";                                                      // Sub-device choice ("" = none).
+std::vector<cl_command_queue> nu::opencl::subqueue;                                                 // Sub-device queues.
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////// Device selection ////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// Gets an environment variable, or a default value if not set.
+static std::string nu_getenv (
+                              const char* loc_name,                                                 // Variable name.
+                              std::string loc_default                                               // Default value.
+                             )
+{
+  const char* loc_value = std::getenv (loc_name);                                                   // Variable value.
+
+  if((loc_value == NULL) || (loc_value[0] == '\0'))
+  {
+    return loc_default;
+  }
+
+  return std::string (loc_value);
+}
+
+// Converts a text to lower case.
+static std::string nu_lowercase (
+                                 std::string loc_text                                               // Text.
+                                )
+{
+  std::transform (loc_text.begin (), loc_text.end (), loc_text.begin (), ::tolower);
+
+  return loc_text;
+}
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////// "nu::opencl" class /////////////////////////////////////////
@@ -24,6 +58,22 @@ nu::opencl::opencl (
   {
     nu::opencl::init (loc_device_type);                                                             // OpenCL device type.)
     nu::opencl::opencl_queue = new queue ();                                                        // OpenCL queue.
+    nu::opencl::subqueue.clear ();
+
+    for(size_t i = 0; i < neutrino::subdevice_id.size (); i++)
+    {
+      if(i == 0)
+      {
+        nu::opencl::subqueue.push_back (opencl_queue->queue_id);                                    // Using OpenCL queue on first sub-device...
+      }
+      else
+      {
+        cl_int loc_error;                                                                           // Error code.
+
+        nu::opencl::subqueue.push_back (clCreateCommandQueue (neutrino::context_id, neutrino::subdevice_id[i], 0, &loc_error));
+        neutrino::check_error (loc_error);                                                          // Checking returned error code...
+      }
+    }
   }
 }
 
@@ -100,6 +150,11 @@ cl_uint nu::opencl::get_devices_number
                &loc_devices_number                                                                  // Returned local number of existing devices.
               );
 
+  if(loc_error == CL_DEVICE_NOT_FOUND)
+  {
+    return 0;                                                                                       // No device of the requested type on this platform...
+  }
+
   neutrino::check_error (loc_error);                                                                // Checking returned error code...
 
   return(loc_devices_number);                                                                       // Returning number of existing devices...
@@ -142,11 +197,110 @@ cl_device_id nu::opencl::get_device_id
   return(loc_selected_device_id);                                                                   // Returning selected device ID...
 }
 
+double nu::opencl::score
+(
+ device* loc_device,                                                                                // OpenCL device.
+ bool    loc_platform_interop                                                                       // Platform interoperability flag.
+)
+{
+  double loc_score;                                                                                 // Device score.
+  double loc_memory;                                                                                // Device global memory [GiB].
+
+  if(!loc_device->available)
+  {
+    return 0.0;                                                                                     // Not available: never selected...
+  }
+
+  loc_memory = (double)loc_device->global_mem_size/1073741824.0;                                    // Getting global memory [GiB]...
+  loc_score  = (double)loc_device->max_compute_units*                                               // Scoring compute units...
+               (double)std::max (loc_device->max_clock_frequency, (cl_uint)1)*                      // Scoring clock frequency [MHz]...
+               (1.0 + std::log2 (1.0 + loc_memory));                                                // Scoring global memory (logarithmic)...
+
+  if(loc_platform_interop && neutrino::property (loc_device->extensions, NU_INTEROP))
+  {
+    loc_score *= NU_SELECT_INTEROP_WEIGHT;                                                          // Scoring interoperability...
+  }
+
+  return loc_score;
+}
+
+std::vector<cl_device_id> nu::opencl::subdivide
+(
+ cl_device_id loc_device_id                                                                         // OpenCL device ID.
+)
+{
+  std::vector<cl_device_id>                 loc_subdevice;                                          // Sub-device IDs.
+  std::vector<cl_device_partition_property> loc_property;                                           // Partition properties.
+  cl_uint                                   loc_max;                                                // Maximum number of sub-devices.
+  cl_uint                                   loc_units;                                              // Device compute units.
+  cl_uint                                   loc_parts;                                              // Requested number of sub-devices.
+  cl_uint                                   loc_number = 0;                                         // Number of sub-devices.
+  cl_int                                    loc_error;                                              // Error code.
+
+  neutrino::action ("partitioning OpenCL device in sub-devices...");                                // Printing message...
+
+  loc_error  = clGetDeviceInfo (loc_device_id, CL_DEVICE_PARTITION_MAX_SUB_DEVICES, sizeof(cl_uint), &loc_max, NULL);
+  loc_error |= clGetDeviceInfo (loc_device_id, CL_DEVICE_MAX_COMPUTE_UNITS, sizeof(cl_uint), &loc_units, NULL);
+
+  if((loc_error != CL_SUCCESS) || (loc_max < 2))
+  {
+    neutrino::warning ("device cannot be partitioned: using the whole device!");                    // Printing message...
+    return loc_subdevice;
+  }
+
+  if(nu_lowercase (subdevice_choice) == NU_SUBDEVICES_NUMA)
+  {
+    // Partitioning by NUMA node (or by the next partitionable affinity domain):
+    loc_property = {CL_DEVICE_PARTITION_BY_AFFINITY_DOMAIN, CL_DEVICE_AFFINITY_DOMAIN_NUMA, 0};
+    loc_error    = clCreateSubDevices (loc_device_id, loc_property.data (), 0, NULL, &loc_number);
+
+    if((loc_error != CL_SUCCESS) || (loc_number < 2))
+    {
+      loc_property[1] = CL_DEVICE_AFFINITY_DOMAIN_NEXT_PARTITIONABLE;
+      loc_error       = clCreateSubDevices (loc_device_id, loc_property.data (), 0, NULL, &loc_number);
+    }
+  }
+  else
+  {
+    // Partitioning in equal parts:
+    loc_parts    = (cl_uint)std::max (std::atoi (subdevice_choice.c_str ()), 0);
+    loc_parts    = std::min (std::min (loc_parts, loc_max), loc_units);
+
+    if(loc_parts < 2)
+    {
+      neutrino::warning ("invalid number of sub-devices: using the whole device!");                 // Printing message...
+      return loc_subdevice;
+    }
+
+    loc_property = {CL_DEVICE_PARTITION_EQUALLY, (cl_device_partition_property)(loc_units/loc_parts), 0};
+    loc_error    = clCreateSubDevices (loc_device_id, loc_property.data (), 0, NULL, &loc_number);
+  }
+
+  if((loc_error != CL_SUCCESS) || (loc_number < 2))
+  {
+    neutrino::warning ("device partitioning not supported: using the whole device!");               // Printing message...
+    return loc_subdevice;
+  }
+
+  loc_subdevice.resize (loc_number);
+  neutrino::check_error (clCreateSubDevices (loc_device_id, loc_property.data (), loc_number, loc_subdevice.data (), NULL));
+
+  neutrino::done ();                                                                                // Printing message...
+  std::cout << "        --> " << loc_number << " sub-devices" << std::endl;                         // Printing message...
+
+  return loc_subdevice;
+}
+
 void nu::opencl::init
 (
  compute_device_type loc_device_type                                                                // OpenCL device type.
 )
 {
+  if(nu::opencl::init_done)
+  {
+    return;                                                                                         // Keeping current context and queue...
+  }
+
   opencl_platform        = NULL;                                                                    // Initializing platforms IDs array...
   platforms_number       = 0;                                                                       // Initializing number of platforms...
   devices_number         = 0;                                                                       // Initializing number of devices...
@@ -154,10 +308,16 @@ void nu::opencl::init
   nu::opencl::context_id = NULL;                                                                    // Initializing platforms' context...
   device_type            = NU_DEFAULT;                                                              // Initializing device type...
 
-  cl_int  loc_error;                                                                                // Error code.
-  cl_uint i;                                                                                        // Index.
-  bool    loc_platform_interop = false;                                                             // Platform interoperability flag.
-  bool    loc_device_interop   = false;                                                             // Device interoperability flag.
+  cl_int      loc_error;                                                                            // Error code.
+  cl_uint     i;                                                                                    // Index.
+  cl_uint     j;                                                                                    // Index.
+  bool        loc_platform_interop = false;                                                         // Platform interoperability flag.
+  bool        loc_device_interop   = false;                                                         // Device interoperability flag.
+  std::string loc_type;                                                                             // Device type choice.
+  bool        loc_found            = false;                                                         // "Platform found" flag.
+  device*     loc_device;                                                                           // Candidate device.
+  double      loc_score;                                                                            // Candidate device score.
+  double      loc_best_score;                                                                       // Best device score.
 
   glFinish ();                                                                                      // Waiting for OpenGL to finish...
 
@@ -167,6 +327,36 @@ void nu::opencl::init
   ////////////////////////////////////////////////////////////////////////////////////////////////////
   ///////////////////////////////////// SETTING TARGET DEVICE TYPE ///////////////////////////////////
   ////////////////////////////////////////////////////////////////////////////////////////////////////
+  platform_choice = nu_getenv (NU_ENV_PLATFORM, platform_choice);                                   // Getting platform choice...
+  device_choice   = nu_getenv (NU_ENV_DEVICE, device_choice);                                       // Getting device choice...
+  verbose         = (nu_getenv (NU_ENV_VERBOSE, verbose ? "1" : "0") != "0");                       // Getting enumeration "verbose" flag...
+  loc_type        = nu_lowercase (nu_getenv (NU_ENV_DEVICE_TYPE, ""));                              // Getting device type choice...
+
+  if(loc_type == "cpu")
+  {
+    loc_device_type = NU_CPU;                                                                       // Overriding device type...
+  }
+
+  if(loc_type == "gpu")
+  {
+    loc_device_type = NU_GPU;                                                                       // Overriding device type...
+  }
+
+  if(loc_type == "accelerator")
+  {
+    loc_device_type = NU_ACCELERATOR;                                                               // Overriding device type...
+  }
+
+  if(loc_type == "default")
+  {
+    loc_device_type = NU_DEFAULT;                                                                   // Overriding device type...
+  }
+
+  if(loc_type == "all")
+  {
+    loc_device_type = NU_ALL;                                                                       // Overriding device type...
+  }
+
   switch(loc_device_type)                                                                           // Selecting device type...
   {
     case NU_CPU:
@@ -213,6 +403,11 @@ void nu::opencl::init
     opencl_platform[i] = new platform ();
     opencl_platform[i]->init (get_platform_id (i));
 
+    if(!verbose)
+    {
+      continue;                                                                                     // Printing enumeration details only on request...
+    }
+
     std::cout << "        PLATFORM #: " + std::to_string (i + 1) << std::endl;                      // Printing message...
     std::cout << "        --> profile:    " + opencl_platform[i]->profile << std::endl;             // Printing message...
     std::cout << "        --> version:    " + opencl_platform[i]->version << std::endl;             // Printing message...
@@ -228,12 +423,60 @@ void nu::opencl::init
                    );
   }
 
-  if(platforms_number == 1)
+  if(platforms_number == 0)
+  {
+    neutrino::error ("no OpenCL platform found!");                                                  // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  neutrino::action ("selecting OpenCL platform...");                                                // Printing message...
+  selected_platform = 0;                                                                            // Setting 1st platform, in case it is the only found one...
+
+  if((platform_choice != "") && (platform_choice != NU_SELECT_QUERY))                               // Selecting platform by name...
+  {
+    for(i = 0; (i < platforms_number) && !loc_found; i++)
+    {
+      if(nu_lowercase (opencl_platform[i]->name).find (nu_lowercase (platform_choice)) != std::string::npos)
+      {
+        selected_platform = i;                                                                      // Setting 1st matching platform...
+        loc_found         = true;                                                                   // Setting "platform found" flag...
+      }
+    }
+
+    if(!loc_found)
+    {
+      neutrino::error ("OpenCL platform \"" + platform_choice + "\" not found!");                   // Printing message...
+      exit (EXIT_FAILURE);                                                                          // Exiting...
+    }
+  }
+
+  if((platform_choice == "") && (platforms_number > 1))                                             // Selecting best device platform...
   {
-    selected_platform = 0;                                                                          // Setting 1st platform, in case it is the only found one...
+    loc_best_score = -1.0;                                                                          // Resetting best device score...
+
+    for(i = 0; i < platforms_number; i++)
+    {
+      loc_platform_interop = neutrino::property (opencl_platform[i]->extensions, NU_INTEROP);       // Getting platform interoperability...
+
+      for(j = 0; j < get_devices_number (i); j++)
+      {
+        loc_device = new device ();                                                                 // Creating candidate device...
+        loc_device->init (get_device_id (j, i));                                                    // Initializing candidate device...
+        loc_score  = score (loc_device, loc_platform_interop);                                      // Scoring candidate device...
+        delete loc_device;                                                                          // Deleting candidate device...
+
+        if(loc_score > loc_best_score)
+        {
+          loc_best_score    = loc_score;                                                            // Setting best device score...
+          selected_platform = i;                                                                    // Setting best device platform...
+        }
+      }
+    }
   }
 
-  if(platforms_number > 1)                                                                          // Asking to select a platform...
+  neutrino::done ();                                                                                // Printing message...
+
+  if((platform_choice == NU_SELECT_QUERY) && (platforms_number > 1))                                // Asking to select a platform...
   {
     std::cout << "Action: please select a platform [1..." + std::to_string (platforms_number);      // Formulating query...
 
@@ -247,6 +490,7 @@ void nu::opencl::init
                         ) - 1;                                                                      // Setting selected platform index...
   }
 
+  std::cout << "        --> platform: " + opencl_platform[selected_platform]->name << std::endl;    // Printing message...
   neutrino::platform_id = opencl_platform[selected_platform]->id;                                   // Setting neutrino OpenCL platform ID...
 
   if(neutrino::property (opencl_platform[selected_platform]->extensions, NU_INTEROP))               // Checking for platform interoperability flag...
@@ -270,6 +514,11 @@ void nu::opencl::init
     opencl_device[i] = new device ();
     opencl_device[i]->init (get_device_id (i, selected_platform));                                  // Initializing OpenCL device...
 
+    if(!verbose)
+    {
+      continue;                                                                                     // Printing enumeration details only on request...
+    }
+
     std::cout << "        DEVICE #: ";
     std::cout << std::to_string (i + 1) << std::endl;                                               // Printing message...
 
@@ -432,12 +681,45 @@ void nu::opencl::init
     std::cout << opencl_device[i]->queue_properties << std::endl;                                   // Printing message...
   }
 
-  if(devices_number == 1)
+  if(devices_number == 0)
   {
-    selected_device = 0;                                                                            // Setting 1st device, in case it is the only found one...
+    neutrino::error ("no OpenCL device of type " + device_type_text + " found!");                   // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  neutrino::action ("selecting OpenCL device...");                                                  // Printing message...
+  selected_device = 0;                                                                              // Setting 1st device, in case it is the only found one...
+
+  if((device_choice != "") && (device_choice != NU_SELECT_QUERY))                                   // Selecting device by index...
+  {
+    selected_device = (cl_uint)(std::atoi (device_choice.c_str ()) - 1);                            // Setting device index...
+
+    if(selected_device >= devices_number)
+    {
+      neutrino::error ("OpenCL device " + device_choice + " not found!");                           // Printing message...
+      exit (EXIT_FAILURE);                                                                          // Exiting...
+    }
   }
 
-  if(devices_number > 1)                                                                            // Asking to select a platform...
+  if((device_choice == "") && (devices_number > 1))                                                 // Selecting best device...
+  {
+    loc_best_score = -1.0;                                                                          // Resetting best device score...
+
+    for(i = 0; i < devices_number; i++)
+    {
+      loc_score = score (opencl_device[i], loc_platform_interop);                                   // Scoring device...
+
+      if(loc_score > loc_best_score)
+      {
+        loc_best_score  = loc_score;                                                                // Setting best device score...
+        selected_device = i;                                                                        // Setting best device...
+      }
+    }
+  }
+
+  neutrino::done ();                                                                                // Printing message...
+
+  if((device_choice == NU_SELECT_QUERY) && (devices_number > 1))                                    // Asking to select a device...
   {
     std::cout << "Action: please select a device [1..." +
       std::to_string (devices_number);                                                              // Formulating query...
@@ -451,6 +733,8 @@ void nu::opencl::init
                       ) - 1;                                                                        // Setting selected device index...
   }
 
+  std::cout << "        --> device: " + opencl_device[selected_device]->name << std::endl;          // Printing message...
+
   if(neutrino::property (opencl_device[selected_device]->extensions, NU_INTEROP))                   // Checking for device interoperability flag...
   {
     loc_device_interop = true;                                                                      // Setting device interoperability flag...
@@ -473,8 +757,42 @@ void nu::opencl::init
   // It looks it works also when interop = false.
   // neutrino::interop   = false;
 
+  gl_event        = false;                                                                          // Resetting OpenCL event from OpenGL sync flag...
+  gl_event_warned = false;                                                                          // Resetting missing OpenCL event warning flag...
+  create_gl_event = NULL;                                                                           // Resetting clCreateEventFromGLsyncKHR function...
+
+  if(neutrino::interop && neutrino::property (opencl_device[selected_device]->extensions, NU_GL_EVENT))
+  {
+    // Getting OpenCL event from OpenGL sync function:
+    create_gl_event = (nu_gl_event)clGetExtensionFunctionAddressForPlatform
+                      (
+                       opencl_platform[selected_platform]->id,                                      // Platform ID.
+                       "clCreateEventFromGLsyncKHR"                                                 // Function name.
+                      );
+
+    gl_event        = (create_gl_event != NULL);                                                    // Setting OpenCL event from OpenGL sync flag...
+  }
+
   neutrino::device_id = opencl_device[selected_device]->id;                                         // Setting neutrino OpenCL device ID...
 
+  ////////////////////////////////////////////////////////////////////////////////////////////////////
+  ////////////////////////////////////// PARTITIONING DEVICE /////////////////////////////////////////
+  ////////////////////////////////////////////////////////////////////////////////////////////////////
+  subdevice_choice = nu_getenv (NU_ENV_SUBDEVICES, subdevice_choice);                               // Getting sub-device choice...
+  neutrino::subdevice_id.clear ();                                                                  // Resetting sub-devices...
+
+  if(!subdevice_choice.empty ())
+  {
+    neutrino::subdevice_id = subdivide (opencl_device[selected_device]->id);                        // Partitioning device...
+  }
+
+  if(!neutrino::subdevice_id.empty ())
+  {
+    neutrino::interop   = false;                                                                    // Resetting interoperability flag (compute only)...
+    gl_event            = false;                                                                    // Resetting OpenCL event from OpenGL sync flag...
+    neutrino::device_id = neutrino::subdevice_id[0];                                                // Setting first sub-device as default device...
+  }
+
   ////////////////////////////////////////////////////////////////////////////////////////////////////
   ////////////////////////////////////////// IDENTIFYING OS //////////////////////////////////////////
   ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -599,8 +917,8 @@ void nu::opencl::init
   nu::opencl::context_id = clCreateContext
                            (
                             properties,                                                             // Context properties.
-                            1,                                                                      // Number of devices on selected platform.
-                            &opencl_device[selected_device]->id,                                    // Pointer to the selected device on selected platform.
+                            neutrino::subdevice_id.empty () ? 1 : (cl_uint)neutrino::subdevice_id.size (),
+                            neutrino::subdevice_id.empty () ? &opencl_device[selected_device]->id : neutrino::subdevice_id.data (),
                             NULL,                                                                   // Context error report callback function.
                             NULL,                                                                   // Context error report callback function argument.
                             &loc_error                                                              // Error code.
@@ -623,44 +941,84 @@ void nu::opencl::write ()
     switch(container[i]->type)
     {
       case NU_INT:
-        ((nu::int1*)neutrino::container[i])->name   = std::string ("arg_") + std::to_string (i);
+        ((nu::int1*)neutrino::container[i])->name    = std::string ("arg_") + std::to_string (i);
         opencl_queue->write ((nu::int1*)neutrino::container[i], i);
         break;
 
       case NU_INT2:
-        ((nu::int2*)neutrino::container[i])->name   = std::string ("arg_") + std::to_string (i);
+        ((nu::int2*)neutrino::container[i])->name    = std::string ("arg_") + std::to_string (i);
         opencl_queue->write ((nu::int2*)neutrino::container[i], i);
         break;
 
       case NU_INT3:
-        ((nu::int3*)neutrino::container[i])->name   = std::string ("arg_") + std::to_string (i);
+        ((nu::int3*)neutrino::container[i])->name    = std::string ("arg_") + std::to_string (i);
         opencl_queue->write ((nu::int3*)neutrino::container[i], i);
         break;
 
       case NU_INT4:
-        ((nu::int4*)neutrino::container[i])->name   = std::string ("arg_") + std::to_string (i);
+        ((nu::int4*)neutrino::container[i])->name    = std::string ("arg_") + std::to_string (i);
         opencl_queue->write ((nu::int4*)neutrino::container[i], i);
         break;
 
       case NU_FLOAT:
-        ((nu::float1*)neutrino::container[i])->name = std::string ("arg_") + std::to_string (i);
+        ((nu::float1*)neutrino::container[i])->name  = std::string ("arg_") + std::to_string (i);
         opencl_queue->write ((nu::float1*)neutrino::container[i], i);
         break;
 
       case NU_FLOAT2:
-        ((nu::float2*)neutrino::container[i])->name = std::string ("arg_") + std::to_string (i);
+        ((nu::float2*)neutrino::container[i])->name  = std::string ("arg_") + std::to_string (i);
         opencl_queue->write ((nu::float2*)neutrino::container[i], i);
         break;
 
       case NU_FLOAT3:
-        ((nu::float3*)neutrino::container[i])->name = std::string ("arg_") + std::to_string (i);
+        ((nu::float3*)neutrino::container[i])->name  = std::string ("arg_") + std::to_string (i);
         opencl_queue->write ((nu::float3*)neutrino::container[i], i);
         break;
 
       case NU_FLOAT4:
-        ((nu::float4*)neutrino::container[i])->name = std::string ("arg_") + std::to_string (i);
+        ((nu::float4*)neutrino::container[i])->name  = std::string ("arg_") + std::to_string (i);
         opencl_queue->write ((nu::float4*)neutrino::container[i], i);
         break;
+
+      case NU_HALF:
+        ((nu::half1*)neutrino::container[i])->name   = std::string ("arg_") + std::to_string (i);
+        opencl_queue->write ((nu::half1*)neutrino::container[i], i);
+        break;
+
+      case NU_HALF4:
+        ((nu::half4*)neutrino::container[i])->name   = std::string ("arg_") + std::to_string (i);
+        opencl_queue->write ((nu::half4*)neutrino::container[i], i);
+        break;
+
+      case NU_SHORT4:
+        ((nu::short4*)neutrino::container[i])->name  = std::string ("arg_") + std::to_string (i);
+        opencl_queue->write ((nu::short4*)neutrino::container[i], i);
+        break;
+
+      case NU_UCHAR4:
+        ((nu::uchar4*)neutrino::container[i])->name  = std::string ("arg_") + std::to_string (i);
+        opencl_queue->write ((nu::uchar4*)neutrino::container[i], i);
+        break;
+
+      case NU_DOUBLE:
+        ((nu::double1*)neutrino::container[i])->name = std::string ("arg_") + std::to_string (i);
+        opencl_queue->write ((nu::double1*)neutrino::container[i], i);
+        break;
+
+      case NU_DOUBLE2:
+        ((nu::double2*)neutrino::container[i])->name = std::string ("arg_") + std::to_string (i);
+        opencl_queue->write ((nu::double2*)neutrino::container[i], i);
+        break;
+
+      case NU_DOUBLE3:
+        ((nu::double3*)neutrino::container[i])->name = std::string ("arg_") + std::to_string (i);
+        opencl_queue->write ((nu::double3*)neutrino::container[i], i);
+        break;
+
+      case NU_DOUBLE4:
+        ((nu::double4*)neutrino::container[i])->name = std::string ("arg_") + std::to_string (i);
+        opencl_queue->write ((nu::double4*)neutrino::container[i], i);
+        break;
     }
   }
 }
@@ -673,59 +1031,247 @@ void nu::opencl::write (
   switch(container[loc_i]->type)
   {
     case NU_INT:
-      ((nu::int1*)neutrino::container[loc_i])->name   = std::string ("arg_") +
-                                                        std::to_string (loc_i);
+      ((nu::int1*)neutrino::container[loc_i])->name    = std::string ("arg_") +
+                                                         std::to_string (loc_i);
       opencl_queue->write ((nu::int1*)neutrino::container[loc_i], loc_i);
       break;
 
     case NU_INT2:
-      ((nu::int2*)neutrino::container[loc_i])->name   = std::string ("arg_") +
-                                                        std::to_string (loc_i);
+      ((nu::int2*)neutrino::container[loc_i])->name    = std::string ("arg_") +
+                                                         std::to_string (loc_i);
       opencl_queue->write ((nu::int2*)neutrino::container[loc_i], loc_i);
       break;
 
     case NU_INT3:
-      ((nu::int3*)neutrino::container[loc_i])->name   = std::string ("arg_") +
-                                                        std::to_string (loc_i);
+      ((nu::int3*)neutrino::container[loc_i])->name    = std::string ("arg_") +
+                                                         std::to_string (loc_i);
       opencl_queue->write ((nu::int3*)neutrino::container[loc_i], loc_i);
       break;
 
     case NU_INT4:
-      ((nu::int4*)neutrino::container[loc_i])->name   = std::string ("arg_") +
-                                                        std::to_string (loc_i);
+      ((nu::int4*)neutrino::container[loc_i])->name    = std::string ("arg_") +
+                                                         std::to_string (loc_i);
       opencl_queue->write ((nu::int4*)neutrino::container[loc_i], loc_i);
       break;
 
     case NU_FLOAT:
-      ((nu::float1*)neutrino::container[loc_i])->name = std::string ("arg_") +
-                                                        std::to_string (loc_i);
+      ((nu::float1*)neutrino::container[loc_i])->name  = std::string ("arg_") +
+                                                         std::to_string (loc_i);
       opencl_queue->write ((nu::float1*)neutrino::container[loc_i], loc_i);
       break;
 
     case NU_FLOAT2:
-      ((nu::float2*)neutrino::container[loc_i])->name = std::string ("arg_") +
-                                                        std::to_string (loc_i);
+      ((nu::float2*)neutrino::container[loc_i])->name  = std::string ("arg_") +
+                                                         std::to_string (loc_i);
       opencl_queue->write ((nu::float2*)neutrino::container[loc_i], loc_i);
       break;
 
     case NU_FLOAT3:
-      ((nu::float3*)neutrino::container[loc_i])->name = std::string ("arg_") +
-                                                        std::to_string (loc_i);
+      ((nu::float3*)neutrino::container[loc_i])->name  = std::string ("arg_") +
+                                                         std::to_string (loc_i);
       opencl_queue->write ((nu::float3*)neutrino::container[loc_i], loc_i);
       break;
 
     case NU_FLOAT4:
-      ((nu::float4*)neutrino::container[loc_i])->name = std::string ("arg_") +
-                                                        std::to_string (loc_i);
+      ((nu::float4*)neutrino::container[loc_i])->name  = std::string ("arg_") +
+                                                         std::to_string (loc_i);
       opencl_queue->write ((nu::float4*)neutrino::container[loc_i], loc_i);
       break;
+
+    case NU_HALF:
+      ((nu::half1*)neutrino::container[loc_i])->name   = std::string ("arg_") +
+                                                         std::to_string (loc_i);
+      opencl_queue->write ((nu::half1*)neutrino::container[loc_i], loc_i);
+      break;
+
+    case NU_HALF4:
+      ((nu::half4*)neutrino::container[loc_i])->name   = std::string ("arg_") +
+                                                         std::to_string (loc_i);
+      opencl_queue->write ((nu::half4*)neutrino::container[loc_i], loc_i);
+      break;
+
+    case NU_SHORT4:
+      ((nu::short4*)neutrino::container[loc_i])->name  = std::string ("arg_") +
+                                                         std::to_string (loc_i);
+      opencl_queue->write ((nu::short4*)neutrino::container[loc_i], loc_i);
+      break;
+
+    case NU_UCHAR4:
+      ((nu::uchar4*)neutrino::container[loc_i])->name  = std::string ("arg_") +
+                                                         std::to_string (loc_i);
+      opencl_queue->write ((nu::uchar4*)neutrino::container[loc_i], loc_i);
+      break;
+
+    case NU_DOUBLE:
+      ((nu::double1*)neutrino::container[loc_i])->name = std::string ("arg_") +
+                                                         std::to_string (loc_i);
+      opencl_queue->write ((nu::double1*)neutrino::container[loc_i], loc_i);
+      break;
+
+    case NU_DOUBLE2:
+      ((nu::double2*)neutrino::container[loc_i])->name = std::string ("arg_") +
+                                                         std::to_string (loc_i);
+      opencl_queue->write ((nu::double2*)neutrino::container[loc_i], loc_i);
+      break;
+
+    case NU_DOUBLE3:
+      ((nu::double3*)neutrino::container[loc_i])->name = std::string ("arg_") +
+                                                         std::to_string (loc_i);
+      opencl_queue->write ((nu::double3*)neutrino::container[loc_i], loc_i);
+      break;
+
+    case NU_DOUBLE4:
+      ((nu::double4*)neutrino::container[loc_i])->name = std::string ("arg_") +
+                                                         std::to_string (loc_i);
+      opencl_queue->write ((nu::double4*)neutrino::container[loc_i], loc_i);
+      break;
   }
 }
 
-void nu::opencl::acquire ()
+void nu::opencl::batch ()
 {
   size_t i;                                                                                         // Index.
 
+  for(i = 0; i < container.size (); i++)
+  {
+    switch(container[i]->type)
+    {
+      case NU_INT:
+        opencl_queue->batch.push_back (((nu::int1*)container[i])->buffer);
+        break;
+
+      case NU_INT2:
+        opencl_queue->batch.push_back (((nu::int2*)container[i])->buffer);
+        break;
+
+      case NU_INT3:
+        opencl_queue->batch.push_back (((nu::int3*)container[i])->buffer);
+        break;
+
+      case NU_INT4:
+        opencl_queue->batch.push_back (((nu::int4*)container[i])->buffer);
+        break;
+
+      case NU_FLOAT:
+        opencl_queue->batch.push_back (((nu::float1*)container[i])->buffer);
+        break;
+
+      case NU_FLOAT2:
+        opencl_queue->batch.push_back (((nu::float2*)container[i])->buffer);
+        break;
+
+      case NU_FLOAT3:
+        opencl_queue->batch.push_back (((nu::float3*)container[i])->buffer);
+        break;
+
+      case NU_FLOAT4:
+        opencl_queue->batch.push_back (((nu::float4*)container[i])->buffer);
+        break;
+
+      case NU_HALF:
+        opencl_queue->batch.push_back (((nu::half1*)container[i])->buffer);
+        break;
+
+      case NU_HALF4:
+        opencl_queue->batch.push_back (((nu::half4*)container[i])->buffer);
+        break;
+
+      case NU_SHORT4:
+        opencl_queue->batch.push_back (((nu::short4*)container[i])->buffer);
+        break;
+
+      case NU_UCHAR4:
+        opencl_queue->batch.push_back (((nu::uchar4*)container[i])->buffer);
+        break;
+
+      case NU_DOUBLE:
+        opencl_queue->batch.push_back (((nu::double1*)container[i])->buffer);
+        break;
+
+      case NU_DOUBLE2:
+        opencl_queue->batch.push_back (((nu::double2*)container[i])->buffer);
+        break;
+
+      case NU_DOUBLE3:
+        opencl_queue->batch.push_back (((nu::double3*)container[i])->buffer);
+        break;
+
+      case NU_DOUBLE4:
+        opencl_queue->batch.push_back (((nu::double4*)container[i])->buffer);
+        break;
+    }
+  }
+}
+
+void nu::opencl::acquire ()
+{
+  size_t   i;                                                                                       // Index.
+  cl_int   loc_error;                                                                               // Error code.
+  GLsync   loc_fence;                                                                               // OpenGL fence.
+  cl_event loc_event  = NULL;                                                                       // OpenCL event linked to OpenGL fence.
+  cl_uint  loc_events = 0;                                                                          // Number of events in wait list.
+
+  if(neutrino::render == NU_RENDER_THREADED)
+  {
+    // Compute thread: enqueuing only (the shared buffers are drawn through nu::exchange slots):
+    if(neutrino::interop)
+    {
+      loc_fence = NULL;                                                                             // Resetting fence...
+
+      if(!gl_event && !gl_event_warned)
+      {
+        neutrino::warning ("no cl_khr_gl_event: acquiring shared buffers without OpenGL fence!");   // Printing message...
+        gl_event_warned = true;                                                                     // Setting warning flag...
+      }
+
+      if(gl_event && (neutrino::gl_spent.load (std::memory_order_acquire) == NULL))
+      {
+        loc_fence = neutrino::gl_fence.exchange (NULL, std::memory_order_acq_rel);                  // Taking last frame fence of the render thread...
+      }
+
+      if(loc_fence != NULL)
+      {
+        // Letting OpenCL wait for the last frame of the render thread on the device:
+        loc_event  = create_gl_event (neutrino::context_id, loc_fence, &loc_error);                 // Creating OpenCL event from OpenGL fence...
+        neutrino::check_error (loc_error);                                                          // Checking returned error code...
+        loc_events = 1;                                                                             // Setting number of events in wait list...
+      }
+
+      batch ();                                                                                     // Batching all shared buffers...
+      opencl_queue->acquire_batch (loc_events, (loc_events > 0) ? &loc_event : NULL);               // Acquiring all shared buffers...
+
+      if(loc_fence != NULL)
+      {
+        clReleaseEvent (loc_event);                                                                 // Releasing OpenCL event...
+        neutrino::gl_spent.store (loc_fence, std::memory_order_release);                            // Handing fence back to the render thread...
+      }
+    }
+
+    return;
+  }
+
+  if(neutrino::interop)
+  {
+    loc_fence = glFenceSync (GL_SYNC_GPU_COMMANDS_COMPLETE, 0);                                     // Inserting OpenGL fence...
+
+    if(gl_event)
+    {
+      // Letting OpenCL wait for the OpenGL fence on the device, without any host wait:
+      glFlush ();                                                                                   // Submitting OpenGL commands...
+      loc_event = create_gl_event (neutrino::context_id, loc_fence, &loc_error);                    // Creating OpenCL event from OpenGL fence...
+      neutrino::check_error (loc_error);                                                            // Checking returned error code...
+      loc_events = 1;                                                                               // Setting number of events in wait list...
+    }
+
+    else
+    {
+      // Waiting (once) for the OpenGL commands using the shared buffers, instead of a glFinish per buffer:
+      glClientWaitSync (loc_fence, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);                 // Waiting for fence...
+    }
+
+    opencl_queue->batched = true;                                                                   // Setting batch mode...
+  }
+
   for(i = 0; i < container.size (); i++)
   {
     switch(container[i]->type)
@@ -761,7 +1307,52 @@ void nu::opencl::acquire ()
       case NU_FLOAT4:
         opencl_queue->acquire ((nu::float4*)container[i], i);
         break;
+
+      case NU_HALF:
+        opencl_queue->acquire ((nu::half1*)container[i], i);
+        break;
+
+      case NU_HALF4:
+        opencl_queue->acquire ((nu::half4*)container[i], i);
+        break;
+
+      case NU_SHORT4:
+        opencl_queue->acquire ((nu::short4*)container[i], i);
+        break;
+
+      case NU_UCHAR4:
+        opencl_queue->acquire ((nu::uchar4*)container[i], i);
+        break;
+
+      case NU_DOUBLE:
+        opencl_queue->acquire ((nu::double1*)container[i], i);
+        break;
+
+      case NU_DOUBLE2:
+        opencl_queue->acquire ((nu::double2*)container[i], i);
+        break;
+
+      case NU_DOUBLE3:
+        opencl_queue->acquire ((nu::double3*)container[i], i);
+        break;
+
+      case NU_DOUBLE4:
+        opencl_queue->acquire ((nu::double4*)container[i], i);
+        break;
+    }
+  }
+
+  if(neutrino::interop)
+  {
+    opencl_queue->batched = false;                                                                  // Resetting batch mode...
+    opencl_queue->acquire_batch (loc_events, (loc_events > 0) ? &loc_event : NULL);                 // Acquiring all shared buffers...
+
+    if(loc_event != NULL)
+    {
+      clReleaseEvent (loc_event);                                                                   // Releasing OpenCL event...
     }
+
+    glDeleteSync (loc_fence);                                                                       // Deleting fence...
   }
 }
 
@@ -769,6 +1360,23 @@ void nu::opencl::release ()
 {
   size_t i;                                                                                         // Index.
 
+  if(neutrino::render == NU_RENDER_THREADED)
+  {
+    // Compute thread: enqueuing only (the shared buffers are drawn through nu::exchange slots):
+    if(neutrino::interop)
+    {
+      batch ();                                                                                     // Batching all shared buffers...
+      opencl_queue->release_batch ();                                                               // Releasing all shared buffers...
+    }
+
+    return;
+  }
+
+  if(neutrino::interop)
+  {
+    opencl_queue->batched = true;                                                                   // Setting batch mode...
+  }
+
   for(i = 0; i < container.size (); i++)
   {
     switch(container[i]->type)
@@ -804,13 +1412,138 @@ void nu::opencl::release ()
       case NU_FLOAT4:
         opencl_queue->release ((nu::float4*)container[i], i);
         break;
+
+      case NU_HALF:
+        opencl_queue->release ((nu::half1*)container[i], i);
+        break;
+
+      case NU_HALF4:
+        opencl_queue->release ((nu::half4*)container[i], i);
+        break;
+
+      case NU_SHORT4:
+        opencl_queue->release ((nu::short4*)container[i], i);
+        break;
+
+      case NU_UCHAR4:
+        opencl_queue->release ((nu::uchar4*)container[i], i);
+        break;
+
+      case NU_DOUBLE:
+        opencl_queue->release ((nu::double1*)container[i], i);
+        break;
+
+      case NU_DOUBLE2:
+        opencl_queue->release ((nu::double2*)container[i], i);
+        break;
+
+      case NU_DOUBLE3:
+        opencl_queue->release ((nu::double3*)container[i], i);
+        break;
+
+      case NU_DOUBLE4:
+        opencl_queue->release ((nu::double4*)container[i], i);
+        break;
     }
   }
+
+  if(neutrino::interop)
+  {
+    opencl_queue->batched = false;                                                                  // Resetting batch mode...
+    opencl_queue->release_batch ();                                                                 // Releasing all shared buffers...
+
+    if(gl_event)
+    {
+      clFlush (opencl_queue->queue_id);                                                             // Submitting OpenCL commands (implicit sync by OpenGL)...
+    }
+
+    else
+    {
+      clFinish (opencl_queue->queue_id);                                                            // Waiting (once) for OpenCL before OpenGL uses the shared buffers...
+    }
+  }
+}
+
+void nu::opencl::execute
+(
+ nu::kernel* loc_kernel,                                                                            // OpenCL kernel.
+ kernel_mode loc_kernel_mode                                                                        // Kernel mode.
+)
+{
+  loc_kernel->reload ();                                                                            // Swapping hot reloaded kernel, if any...
+  launch (loc_kernel, loc_kernel->kernel_id, loc_kernel_mode);                                      // Launching default entry point...
 }
 
 void nu::opencl::execute
 (
  nu::kernel* loc_kernel,                                                                            // OpenCL kernel.
+ std::string loc_entry_name,                                                                        // OpenCL kernel entry point name.
+ kernel_mode loc_kernel_mode                                                                        // Kernel mode.
+)
+{
+  loc_kernel->reload ();                                                                            // Swapping hot reloaded kernel, if any...
+  launch (loc_kernel, loc_kernel->getentry (loc_entry_name), loc_kernel_mode);                      // Launching named entry point...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////// split ///////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::opencl::split
+(
+ nu::kernel* loc_kernel,                                                                            // OpenCL kernel.
+ cl_kernel   loc_kernel_id,                                                                         // OpenCL kernel entry point.
+ cl_uint     loc_dimension,                                                                         // Kernel dimension.
+ size_t*     loc_size                                                                               // Kernel size array.
+)
+{
+  cl_event              loc_start;                                                                  // Start marker (after previous commands).
+  std::vector<cl_event> loc_part_event;                                                             // Part events.
+  size_t                loc_offset[3] = {0, 0, 0};                                                  // Part global work offset.
+  size_t                loc_part[3];                                                                // Part global work size.
+  size_t                loc_parts;                                                                  // Number of parts.
+  size_t                loc_chunk;                                                                  // Part size along i-index.
+  size_t                i;                                                                          // Part index.
+
+  loc_parts = std::min (subqueue.size (), loc_size[0]);                                             // Setting number of parts...
+  loc_chunk = (loc_size[0] + loc_parts - 1)/loc_parts;                                              // Setting part size along i-index...
+
+  // Making the other sub-devices wait for the previous commands on the OpenCL queue:
+  neutrino::check_error (clEnqueueMarkerWithWaitList (subqueue[0], 0, NULL, &loc_start));
+
+  for(i = 0; i < loc_parts; i++)
+  {
+    loc_offset[0] = i*loc_chunk;                                                                    // Setting part offset...
+    loc_part[0]   = std::min (loc_chunk, loc_size[0] - loc_offset[0]);                              // Setting part size (i-index)...
+    loc_part[1]   = (loc_dimension > 1) ? loc_size[1] : 1;                                          // Setting part size (j-index)...
+    loc_part[2]   = (loc_dimension > 2) ? loc_size[2] : 1;                                          // Setting part size (k-index)...
+
+    if(loc_part[0] == 0)
+    {
+      break;
+    }
+
+    loc_part_event.push_back (NULL);
+    neutrino::check_error (clEnqueueNDRangeKernel (subqueue[i], loc_kernel_id, loc_dimension, loc_offset, loc_part, NULL, (i == 0) ? 0 : 1, (i == 0) ? NULL : &loc_start, &loc_part_event[i]));
+    clFlush (subqueue[i]);                                                                          // Submitting part...
+  }
+
+  // Making the following commands on the OpenCL queue wait for all parts:
+  neutrino::check_error (clEnqueueBarrierWithWaitList (subqueue[0], (cl_uint)loc_part_event.size (), loc_part_event.data (), &loc_kernel->event));
+  clReleaseEvent (loc_start);                                                                       // Releasing start marker...
+
+  for(i = 0; i < loc_part_event.size (); i++)
+  {
+    clReleaseEvent (loc_part_event[i]);                                                             // Releasing part event...
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////// launch ///////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::opencl::launch
+(
+ nu::kernel* loc_kernel,                                                                            // OpenCL kernel.
+ cl_kernel   loc_kernel_id,                                                                         // OpenCL kernel entry point.
  kernel_mode loc_kernel_mode                                                                        // Kernel mode.
 )
 {
@@ -819,8 +1552,11 @@ void nu::opencl::execute
   size_t* kernel_size;                                                                              // Kernel size array.
   bool    kernel_valid = false;                                                                     // Validity flag.
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
-  clFinish (opencl_queue->queue_id);                                                                // Waiting for OpenCL to finish...
+  if(neutrino::render == NU_RENDER_SYNC)
+  {
+    glFinish ();                                                                                    // Waiting for OpenGL to finish...
+    clFinish (opencl_queue->queue_id);                                                              // Waiting for OpenCL to finish...
+  }
 
   // Selecting kernel size:
   if(
@@ -868,23 +1604,36 @@ void nu::opencl::execute
     exit (EXIT_FAILURE);
   }
 
-  // Enqueueing OpenCL kernel (as a single task):
-  loc_error = clEnqueueNDRangeKernel
-              (
-               opencl_queue->queue_id,                                                              // Queue ID.
-               loc_kernel->kernel_id,                                                               // Kernel ID.
-               kernel_dimension,                                                                    // Kernel dimension.
-               NULL,                                                                                // Global work offset.
-               kernel_size,                                                                         // Global work size.
-               NULL,                                                                                // Local work size.
-               0,                                                                                   // Number of events.
-               NULL,                                                                                // Event list.
-               &loc_kernel->event                                                                   // Event.
-              );
+  if(nu::opencl::subqueue.size () > 1)
+  {
+    split (loc_kernel, loc_kernel_id, kernel_dimension, kernel_size);                               // Splitting kernel among sub-devices...
+  }
+  else
+  {
+    // Enqueueing OpenCL kernel (as a single task):
+    loc_error = clEnqueueNDRangeKernel
+                (
+                 opencl_queue->queue_id,                                                            // Queue ID.
+                 loc_kernel_id,                                                                     // Kernel ID.
+                 kernel_dimension,                                                                  // Kernel dimension.
+                 NULL,                                                                              // Global work offset.
+                 kernel_size,                                                                       // Global work size.
+                 NULL,                                                                              // Local work size.
+                 0,                                                                                 // Number of events.
+                 NULL,                                                                              // Event list.
+                 &loc_kernel->event                                                                 // Event.
+                );
+
+    neutrino::check_error (loc_error);                                                              // Checking error...
+  }
 
-  neutrino::check_error (loc_error);                                                                // Checking error...
+  delete[] kernel_size;                                                                             // Deleting kernel size array...
+  neutrino::steps++;                                                                                // Counting kernel launch...
 
-  clFinish (opencl_queue->queue_id);                                                                // Waiting for OpenCL to finish...
+  if(neutrino::render == NU_RENDER_SYNC)
+  {
+    clFinish (opencl_queue->queue_id);                                                              // Waiting for OpenCL to finish...
+  }
 
   // Selecting kernel mode:
   switch(loc_kernel_mode)
@@ -911,6 +1660,11 @@ nu::opencl::~opencl ()
 
   glFinish ();                                                                                      // Waiting for OpenGL to finish...
 
+  for(size_t i = 1; i < subqueue.size (); i++)
+  {
+    clReleaseCommandQueue (subqueue[i]);                                                            // Releasing sub-device queue...
+  }
+
   delete opencl_queue;                                                                              // Deleting opencl queue...
   delete[] opencl_platform;                                                                         // Deleting platform...
   delete[] opencl_device;                                                                           // Deleting device...
@@ -918,5 +1672,11 @@ nu::opencl::~opencl ()
   neutrino::action ("releasing OpenCL context...");                                                 // Printing message...
   loc_error = clReleaseContext (nu::opencl::context_id);                                            // Releasing OpenCL context...
   neutrino::check_error (loc_error);                                                                // Checking returned error code...
+
+  for(size_t i = 0; i < neutrino::subdevice_id.size (); i++)
+  {
+    clReleaseDevice (neutrino::subdevice_id[i]);                                                    // Releasing sub-device...
+  }
+
   neutrino::done ();                                                                                // Printing message...
 }
@@ -36,7 +36,41 @@ nu::opengl::opengl (
                       loc_orbit_y_initial,                                                          // Initial "near clipping-plane" y-coordinate.
                       loc_pan_x_initial,                                                            // Initial pan-x coordinate.
                       loc_pan_y_initial,                                                            // Initial pan-y coordinate.
-                      loc_pan_z_initial                                                             // Initial pan-z coordinate.
+                      loc_pan_z_initial,                                                            // Initial pan-z coordinate.
+                      NU_WINDOW_VISIBLE                                                             // Window mode.
+                     );
+  }
+}
+
+nu::opengl::opengl (
+                    std::string loc_title,                                                          ///< Window title.
+                    int         loc_window_size_x,                                                  ///< Window x-size [px].
+                    int         loc_window_size_y,                                                  ///< Window y-size [px].
+                    float       loc_orbit_x_initial,                                                ///< Initial "near clipping-plane" x-coordinate.
+                    float       loc_orbit_y_initial,                                                ///< Initial "near clipping-plane" y-coordinate.
+                    float       loc_pan_x_initial,                                                  ///< Initial pan-x coordinate.
+                    float       loc_pan_y_initial,                                                  ///< Initial pan-y coordinate.
+                    float       loc_pan_z_initial,                                                  ///< Initial pan-z coordinate.
+                    window_mode loc_window_mode                                                     ///< Window mode.
+                   )
+{
+  if(neutrino::init_done != true)
+  {
+    neutrino::init ();                                                                              // Initializing Neutrino...
+  }
+
+  if(nu::opengl::init_done != true)
+  {
+    nu::opengl::init (
+                      loc_title,                                                                    // Window title.
+                      loc_window_size_x,                                                            // Window x-size [px].
+                      loc_window_size_y,                                                            // Window y-size [px].
+                      loc_orbit_x_initial,                                                          // Initial "near clipping-plane" x-coordinate.
+                      loc_orbit_y_initial,                                                          // Initial "near clipping-plane" y-coordinate.
+                      loc_pan_x_initial,                                                            // Initial pan-x coordinate.
+                      loc_pan_y_initial,                                                            // Initial pan-y coordinate.
+                      loc_pan_z_initial,                                                            // Initial pan-z coordinate.
+                      loc_window_mode                                                               // Window mode.
                      );
   }
 }
@@ -44,6 +78,89 @@ nu::opengl::opengl (
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////// PRIVATE METHODS ///////////////////////////////////////////
 //////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::opengl::finish ()
+{
+  if(neutrino::render == NU_RENDER_SYNC)
+  {
+    glFinish ();                                                                                    // Waiting for OpenGL to finish...
+  }
+}
+
+void nu::opengl::draw
+(
+ nu::shader* loc_shader,                                                                            // Shader.
+ float       view_matrix[16],                                                                       // View matrix.
+ float       projection_matrix[16]                                                                  // Projection matrix.
+)
+{
+  size_t i;                                                                                         // Index.
+
+  switch(loc_shader->primitive)
+  {
+    case NU_PLOT_POINTS:
+      if(loc_shader->culling)
+      {
+        loc_shader->cull (view_matrix, projection_matrix);                                          // Culling points...
+        glBindBuffer (GL_ELEMENT_ARRAY_BUFFER, loc_shader->element_buffer);                         // Binding element buffer...
+        glBindBuffer (GL_DRAW_INDIRECT_BUFFER, loc_shader->command_buffer);                         // Binding command buffer...
+        glDrawElementsIndirect (
+                                GL_POINTS,
+                                GL_UNSIGNED_INT,
+                                0
+                               );                                                                   // Drawing visible "points"...
+        glBindBuffer (GL_DRAW_INDIRECT_BUFFER, 0);                                                  // Unbinding command buffer...
+        break;
+      }
+
+      glDrawArrays (
+                    GL_POINTS,
+                    0,
+                    loc_shader->size
+                   );                                                                               // Drawing "points"...
+      break;
+
+    case NU_PLOT_LINES:
+      glBindBuffer (GL_ELEMENT_ARRAY_BUFFER, loc_shader->element_buffer);                           // Binding element buffer...
+      glDrawElements (
+                      GL_LINES,
+                      loc_shader->element_size,
+                      GL_UNSIGNED_INT,
+                      0
+                     );                                                                             // Drawing indexed "lines"...
+      break;
+
+    case NU_PLOT_TRIANGLES:
+      glBindBuffer (GL_ELEMENT_ARRAY_BUFFER, loc_shader->element_buffer);                           // Binding element buffer...
+      glDrawElements (
+                      GL_TRIANGLES,
+                      loc_shader->element_size,
+                      GL_UNSIGNED_INT,
+                      0
+                     );                                                                             // Drawing indexed "triangles"...
+      break;
+
+    case NU_PLOT_GLYPHS:
+      // Advancing the shader arguments once per glyph instance:
+      for(i = 0; i < loc_shader->glyph_attribute.size (); i++)
+      {
+        glVertexAttribDivisor (loc_shader->glyph_attribute[i], 1);                                  // Setting per-instance attribute...
+      }
+
+      glDrawArraysInstanced (
+                             GL_TRIANGLES,
+                             0,
+                             loc_shader->glyph_size,
+                             loc_shader->size
+                            );                                                                      // Drawing instanced "glyphs"...
+
+      for(i = 0; i < loc_shader->glyph_attribute.size (); i++)
+      {
+        glVertexAttribDivisor (loc_shader->glyph_attribute[i], 0);                                  // Resetting per-vertex attribute...
+      }
+      break;
+  }
+}
+
 void nu::opengl::set_shader
 (
  nu::shader* loc_shader,                                                                            // Shader.
@@ -54,69 +171,38 @@ void nu::opengl::set_shader
  float       framebuffer_AR                                                                         // Framebuffer aspect ratio.
 )
 {
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  nu_camera_structure loc_camera;                                                                   // Camera state.
 
   glUseProgram (loc_shader->program);                                                               // Using shader...
 
-  // Setting View_matrix matrix on shader:
-  glUniformMatrix4fv
-  (
-   // Getting variable's uniform location:
-   glGetUniformLocation
-   (
-    loc_shader->program,                                                                            // Program.
-    "V_mat"                                                                                         // Variable.
-   ),
-   1,                                                                                               // Number of matrices to be modified.
-   GL_FALSE,                                                                                        // FALSE = column major.
-   &view_matrix[0]                                                                                  // View matrix.
-  );
-
-  // Setting Projection_matrix matrix on shader:
-  glUniformMatrix4fv
-  (
-   glGetUniformLocation                                                                             // Getting variable's uniform location:
-   (
-    loc_shader->program,                                                                            // Program.
-    "P_mat"                                                                                         // Variable.
-   ),
-   1,                                                                                               // Number of matrices to be modified.
-   GL_FALSE,                                                                                        // FALSE = column major.
-   &projection_matrix[0]                                                                            // Projection matrix.
-  );
-
-  // Setting framebuffer size_x on shader:
-  glUniform1f
-  (
-   glGetUniformLocation                                                                             // Getting variable's uniform location:
-   (
-    loc_shader->program,                                                                            // Program.
-    "size_x"                                                                                        // Variable.
-   ),
-   framebuffer_size_x                                                                               // Window x-size [px_float].
-  );
-
-  // Setting framebuffer size_y on shader:
-  glUniform1f
-  (
-   glGetUniformLocation                                                                             // Getting variable's uniform location:
-   (
-    loc_shader->program,                                                                            // Program.
-    "size_y"                                                                                        // Variable.
-   ),
-   framebuffer_size_y                                                                               // Window y-size [px_float].
-  );
+  if(loc_shader->camera_block != GL_INVALID_INDEX)                                                  // Checking for camera uniform block...
+  {
+    memcpy (loc_camera.V_mat, view_matrix, sizeof(loc_camera.V_mat));                               // Setting view matrix...
+    memcpy (loc_camera.P_mat, projection_matrix, sizeof(loc_camera.P_mat));                         // Setting projection matrix...
+    loc_camera.size_x  = framebuffer_size_x;                                                        // Setting framebuffer x-size...
+    loc_camera.size_y  = framebuffer_size_y;                                                        // Setting framebuffer y-size...
+    loc_camera.AR      = framebuffer_AR;                                                            // Setting framebuffer aspect ratio...
+    loc_camera.padding = 0.0f;                                                                      // Resetting padding...
+
+    // Uploading camera state (only if changed since last upload):
+    if(!camera_valid || (memcmp (&loc_camera, &camera, sizeof(nu_camera_structure)) != 0))
+    {
+      glBindBuffer (GL_UNIFORM_BUFFER, camera_ubo);                                                 // Binding camera UBO...
+      glBufferSubData (GL_UNIFORM_BUFFER, 0, sizeof(nu_camera_structure), &loc_camera);             // Uploading camera state...
+      camera       = loc_camera;                                                                    // Backing up camera state...
+      camera_valid = true;                                                                          // Setting "valid" flag...
+    }
+  }
 
-  // Setting framebuffer aspect ratio on shader:
-  glUniform1f
-  (
-   glGetUniformLocation                                                                             // Getting variable's uniform location:
-   (
-    loc_shader->program,                                                                            // Program.
-    "AR"                                                                                            // Variable.
-   ),
-   framebuffer_AR                                                                                   // Framebuffer aspect ratio [].
-  );
+  else
+  {
+    // Setting camera uniforms on shader, from cached locations (-1 = ignored by OpenGL):
+    glUniformMatrix4fv (loc_shader->V_mat_location, 1, GL_FALSE, &view_matrix[0]);                  // Setting view matrix...
+    glUniformMatrix4fv (loc_shader->P_mat_location, 1, GL_FALSE, &projection_matrix[0]);            // Setting projection matrix...
+    glUniform1f (loc_shader->size_x_location, framebuffer_size_x);                                  // Setting framebuffer x-size...
+    glUniform1f (loc_shader->size_y_location, framebuffer_size_y);                                  // Setting framebuffer y-size...
+    glUniform1f (loc_shader->AR_location, framebuffer_AR);                                          // Setting framebuffer aspect ratio...
+  }
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -331,16 +417,22 @@ void nu::opengl::init
  float       loc_orbit_y_initial,                                                                   // Initial "near clipping-plane" y-coordinate.
  float       loc_pan_x_initial,                                                                     // Initial pan-x coordinate.
  float       loc_pan_y_initial,                                                                     // Initial pan-y coordinate.
- float       loc_pan_z_initial                                                                      // Initial pan-z coordinate.
+ float       loc_pan_z_initial,                                                                     // Initial pan-z coordinate.
+ window_mode loc_window_mode                                                                        // Window mode.
 )
 {
   char*  loc_title_buffer;
   size_t loc_title_size;
+  GLenum loc_status;                                                                                // Offscreen framebuffer status.
 
   title                     = loc_title;                                                            // Initializing window title...
   window_size_x             = loc_window_size_x;                                                    // Initializing window x-size [px]...
   window_size_y             = loc_window_size_y;                                                    // Initializing window y-size [px]...
   aspect_ratio              = (float)window_size_x/(float)window_size_y;                            // Initializing window aspect ration []...
+  mode                      = loc_window_mode;                                                      // Initializing window mode...
+  offscreen_fbo             = 0;                                                                    // Resetting offscreen framebuffer...
+  offscreen_color           = 0;                                                                    // Resetting offscreen color renderbuffer...
+  offscreen_depth           = 0;                                                                    // Resetting offscreen depth renderbuffer...
 
   initial_scene_position[0] = loc_pan_x_initial;                                                    // Initializing x-position...
   initial_scene_position[1] = loc_pan_y_initial;                                                    // Initializing y-position...
@@ -434,6 +526,11 @@ void nu::opengl::init
     glfwWindowHint (GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);                                           // Initializing GLFW hints...
     glfwWindowHint (GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);                                 // Initializing GLFW hints...
     glfwWindowHint (GLFW_SAMPLES, opengl_msaa);                                                     // Initializing GLFW hints... EZOR 05OCT2018: (was 4)
+
+    if(mode == NU_WINDOW_OFFSCREEN)
+    {
+      glfwWindowHint (GLFW_VISIBLE, GLFW_FALSE);                                                    // Hiding window (offscreen rendering)...
+    }
   }
 
   else
@@ -501,10 +598,48 @@ void nu::opengl::init
   );                                                                                                // Getting window size...
   aspect_ratio = (float)framebuffer_size_x/(float)framebuffer_size_y;                               // Setting window aspect ration []...
 
+  // Creating offscreen framebuffer (of the requested size, not bound to the window size):
+  if(mode == NU_WINDOW_OFFSCREEN)
+  {
+    window_size_x      = loc_window_size_x;                                                         // Setting offscreen x-size [px]...
+    window_size_y      = loc_window_size_y;                                                         // Setting offscreen y-size [px]...
+    framebuffer_size_x = loc_window_size_x;                                                         // Setting offscreen framebuffer x-size [px]...
+    framebuffer_size_y = loc_window_size_y;                                                         // Setting offscreen framebuffer y-size [px]...
+    aspect_ratio       = (float)framebuffer_size_x/(float)framebuffer_size_y;                       // Setting offscreen aspect ratio []...
+
+    glGenRenderbuffers (1, &offscreen_color);                                                       // Generating color renderbuffer...
+    glBindRenderbuffer (GL_RENDERBUFFER, offscreen_color);                                          // Binding color renderbuffer...
+    glRenderbufferStorage (GL_RENDERBUFFER, GL_RGBA8, framebuffer_size_x, framebuffer_size_y);      // Allocating color renderbuffer...
+    glGenRenderbuffers (1, &offscreen_depth);                                                       // Generating depth renderbuffer...
+    glBindRenderbuffer (GL_RENDERBUFFER, offscreen_depth);                                          // Binding depth renderbuffer...
+    glRenderbufferStorage (GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, framebuffer_size_x, framebuffer_size_y);
+    glBindRenderbuffer (GL_RENDERBUFFER, 0);                                                        // Unbinding renderbuffer...
+
+    glGenFramebuffers (1, &offscreen_fbo);                                                          // Generating offscreen framebuffer...
+    glBindFramebuffer (GL_FRAMEBUFFER, offscreen_fbo);                                              // Binding offscreen framebuffer...
+    glFramebufferRenderbuffer (GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, offscreen_color);
+    glFramebufferRenderbuffer (GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, offscreen_depth);
+    loc_status         = glCheckFramebufferStatus (GL_FRAMEBUFFER);                                 // Checking framebuffer...
+
+    if(loc_status != GL_FRAMEBUFFER_COMPLETE)
+    {
+      neutrino::error ("unable to create offscreen framebuffer!\n");                                // Printing message...
+      glfwTerminate ();                                                                             // Terminating GLFW context...
+      exit (EXIT_FAILURE);                                                                          // Exiting...
+    }
+  }
+
   glFinish ();                                                                                      // Waiting for OpenGL to finish...
   glClearColor (0.0f, 0.0f, 0.0f, 1.0f);                                                            // Setting color for clearing window...
   glClear (GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);                                              // Clearing window...
 
+  // Creating camera uniform buffer (shared by all shader programs):
+  glGenBuffers (1, &camera_ubo);                                                                    // Generating camera UBO...
+  glBindBuffer (GL_UNIFORM_BUFFER, camera_ubo);                                                     // Binding camera UBO...
+  glBufferData (GL_UNIFORM_BUFFER, sizeof(nu_camera_structure), NULL, GL_DYNAMIC_DRAW);             // Allocating camera UBO...
+  glBindBufferBase (GL_UNIFORM_BUFFER, NU_CAMERA_BINDING, camera_ubo);                              // Binding camera UBO to binding point...
+  camera_valid = false;                                                                             // Resetting "valid" flag...
+
   // SETTINGS FOR TRANSPARENCY:
   glDisable (GL_DEPTH_TEST);                                                                        // Disabling depth test...
   glEnable (GL_PROGRAM_POINT_SIZE);                                                                 // Enabling "gl_PointSize" in vertex shader...
@@ -541,6 +676,13 @@ void nu::opengl::init
   backup (T_mat_old, T_mat);                                                                        // Backing up translation matrix...
 
   glfwSwapInterval (1);                                                                             // Enabling screen vertical retrace synch (vsync)...
+  pacing_fps   = 0.0f;                                                                              // Disabling frame pacing...
+  pacing_steps = 1;                                                                                 // Setting one compute step per frame...
+  step_time    = 0.0;                                                                               // Resetting compute time per step...
+  render_time  = 0.0;                                                                               // Resetting render time per frame...
+  compute_tic  = 0.0;                                                                               // Resetting compute start time...
+  render_tic   = 0.0;                                                                               // Resetting render start time...
+  computing    = false;                                                                             // Resetting "computing" flag...
   glfwSwapBuffers (glfw_window);                                                                    // Swapping front and back buffers...
   glfwPollEvents ();                                                                                // Polling GLFW events...
   glFinish ();                                                                                      // Waiting for OpenGL to finish...
@@ -924,9 +1066,86 @@ bool nu::opengl::closed ()
 
 void nu::opengl::clear ()
 {
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  double loc_time;                                                                                  // Current time [s].
+  double loc_sample;                                                                                // Compute time per step sample [s].
+
+  if(computing)
+  {
+    if((pacing_fps > 0.0f) && (neutrino::render != NU_RENDER_THREADED))
+    {
+      // Waiting for the compute steps (the release may have only flushed the queue):
+      clFinish (neutrino::queue_id);                                                                // Waiting for OpenCL to finish...
+    }
+
+    loc_time    = glfwGetTime ();                                                                   // Getting compute end time...
+    loc_sample  = (loc_time - compute_tic)/pacing_steps;                                            // Getting compute time per step sample...
+
+    if(step_time == 0.0)
+    {
+      step_time = loc_sample;                                                                       // Initializing compute time per step (first sample)...
+    }
+
+    else
+    {
+      step_time = (1.0 - NU_PACING_SMOOTHING)*step_time + NU_PACING_SMOOTHING*loc_sample;           // Updating compute time per step...
+    }
+
+    render_tic = loc_time;                                                                          // Setting render start time...
+    computing  = false;                                                                             // Resetting "computing" flag...
+  }
+
+  finish ();                                                                                        // Waiting for OpenGL to finish (sync mode)...
   glClear (GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);                                              // Clearing window...
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  finish ();                                                                                        // Waiting for OpenGL to finish (sync mode)...
+}
+
+void nu::opengl::set_pacing
+(
+ GLfloat loc_target_fps,                                                                            // Target frame rate [frames/s].
+ bool    loc_vsync                                                                                  // Vsync flag.
+)
+{
+  pacing_fps   = loc_target_fps;                                                                    // Setting target frame rate...
+  pacing_steps = 1;                                                                                 // Restarting from one compute step per frame...
+
+  if(loc_vsync)
+  {
+    glfwSwapInterval (1);                                                                           // Enabling screen vertical retrace synch (vsync)...
+  }
+
+  else
+  {
+    glfwSwapInterval (0);                                                                           // Disabling screen vertical retrace synch (vsync)...
+  }
+}
+
+size_t nu::opengl::pace ()
+{
+  double loc_budget;                                                                                // Compute time budget per frame [s].
+
+  if((pacing_fps > 0.0f) && (step_time > 0.0))
+  {
+    loc_budget   = 1.0/pacing_fps - render_time;                                                    // Computing compute time budget...
+    pacing_steps = (size_t)std::max (1.0, std::min ((double)NU_PACING_MAX_STEPS, loc_budget/step_time));
+  }
+
+  else
+  {
+    pacing_steps = 1;                                                                               // Setting one compute step per frame...
+  }
+
+  compute_tic = glfwGetTime ();                                                                     // Setting compute start time...
+  computing   = true;                                                                               // Setting "computing" flag...
+
+  return pacing_steps;
+}
+
+void nu::opengl::set_render
+(
+ render_mode loc_render_mode                                                                        // Render mode.
+)
+{
+  neutrino::render = loc_render_mode;                                                               // Setting render mode...
 }
 
 void nu::opengl::plot
@@ -934,10 +1153,12 @@ void nu::opengl::plot
  nu::shader* loc_shader                                                                             // OpenGL shader.
 )
 {
+  loc_shader->reload ();                                                                            // Swapping hot reloaded shader program, if any...
+
   switch(PR_mode)
   {
     case NU_MODE_MONO:
-      glFinish ();                                                                                  // Waiting for OpenGL to finish...
+      finish ();                                                                                    // Waiting for OpenGL to finish (sync mode)...
 
       // Computing view matrix:
       multiplicate (V_mat, T_mat, R_mat);                                                           // Setting view matrix...
@@ -954,16 +1175,12 @@ void nu::opengl::plot
 
       // Drawing:
       glViewport (0, 0, window_size_x, window_size_y);
-      glDrawArrays (
-                    GL_POINTS,
-                    0,
-                    loc_shader->size
-                   );                                                                               // Drawing "points"...
-      glFinish ();                                                                                  // Waiting for OpenGL to finish...
+      draw (loc_shader, V_mat, P_mat);                                                              // Drawing...
+      finish ();                                                                                    // Waiting for OpenGL to finish (sync mode)...
       break;
 
     case NU_MODE_STEREO:
-      glFinish ();                                                                                  // Waiting for OpenGL to finish...
+      finish ();                                                                                    // Waiting for OpenGL to finish (sync mode)...
 
       multiplicate (V_mat, T_mat, R_mat);                                                           // Setting view matrix...
       multiplicate (VL_mat, TL_mat, V_mat);                                                         // Setting left eye stereoscopic view matrix...
@@ -985,13 +1202,9 @@ void nu::opengl::plot
                   window_size_x/2,
                   window_size_y
                  );                                                                                 // Setting viewport...
-      glDrawArrays (
-                    GL_POINTS,
-                    0,
-                    loc_shader->size
-                   );                                                                               // Drawing "points"...
+      draw (loc_shader, VL_mat, PL_mat);                                                            // Drawing...
 
-      glFinish ();                                                                                  // Waiting for OpenGL to finish...
+      finish ();                                                                                    // Waiting for OpenGL to finish (sync mode)...
 
       // Right eye:
       set_shader (
@@ -1010,13 +1223,9 @@ void nu::opengl::plot
                   window_size_x/2,
                   window_size_y
                  );                                                                                 // Setting viewport...
-      glDrawArrays (
-                    GL_POINTS,
-                    0,
-                    loc_shader->size
-                   );                                                                               // Drawing "points"...
+      draw (loc_shader, VR_mat, PR_mat);                                                            // Drawing...
 
-      glFinish ();                                                                                  // Waiting for OpenGL to finish...
+      finish ();                                                                                    // Waiting for OpenGL to finish (sync mode)...
       break;
   }
 }
@@ -1026,9 +1235,63 @@ void nu::opengl::plot
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 void nu::opengl::refresh ()
 {
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
-  glfwSwapBuffers (glfw_window);                                                                    // Swapping front and back buffers...
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  double loc_sample;                                                                                // Render time sample [s].
+  GLsync loc_fence;                                                                                 // OpenGL fence.
+
+  if(render_tic > 0.0)
+  {
+    // Measuring the render time (up to the swap, not to count the vsync wait):
+    loc_sample  = glfwGetTime () - render_tic;                                                      // Getting render time sample...
+
+    if(render_time == 0.0)
+    {
+      render_time = loc_sample;                                                                     // Initializing render time per frame (first sample)...
+    }
+
+    else
+    {
+      render_time = (1.0 - NU_PACING_SMOOTHING)*render_time + NU_PACING_SMOOTHING*loc_sample;       // Updating render time per frame...
+    }
+
+    render_tic = 0.0;                                                                               // Resetting render start time...
+  }
+
+  finish ();                                                                                        // Waiting for OpenGL to finish (sync mode)...
+
+  if(mode == NU_WINDOW_OFFSCREEN)
+  {
+    glFlush ();                                                                                     // Submitting OpenGL commands (no front buffer to swap)...
+  }
+
+  else
+  {
+    glfwSwapBuffers (glfw_window);                                                                  // Swapping front and back buffers...
+  }
+
+  finish ();                                                                                        // Waiting for OpenGL to finish (sync mode)...
+
+  if((neutrino::render == NU_RENDER_THREADED) && neutrino::interop)
+  {
+    // Deleting the fence consumed by the compute thread, once its frame is complete:
+    loc_fence = neutrino::gl_spent.load (std::memory_order_acquire);                                // Getting consumed fence...
+
+    if(loc_fence != NULL)
+    {
+      glClientWaitSync (loc_fence, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);                 // Waiting for fence...
+      glDeleteSync (loc_fence);                                                                     // Deleting fence...
+      neutrino::gl_spent.store (NULL, std::memory_order_release);                                   // Resetting consumed fence...
+    }
+
+    // Fencing this frame, for the compute thread to acquire the shared buffers after it:
+    loc_fence = glFenceSync (GL_SYNC_GPU_COMMANDS_COMPLETE, 0);                                     // Inserting OpenGL fence...
+    glFlush ();                                                                                     // Submitting OpenGL commands...
+    loc_fence = neutrino::gl_fence.exchange (loc_fence, std::memory_order_acq_rel);                 // Publishing fence...
+
+    if(loc_fence != NULL)
+    {
+      glDeleteSync (loc_fence);                                                                     // Deleting fence not consumed by the compute thread...
+    }
+  }
 }
 
 void nu::opengl::window_resize
@@ -1037,6 +1300,11 @@ void nu::opengl::window_resize
  int loc_y_size                                                                                     // Window y-size [screen coordinates].
 )
 {
+  if(mode == NU_WINDOW_OFFSCREEN)
+  {
+    return;                                                                                         // Keeping offscreen size...
+  }
+
   window_size_x = loc_x_size;                                                                       // Setting window_size_x...
   window_size_y = loc_y_size;                                                                       // Setting window_size_y...
 }
@@ -1047,6 +1315,11 @@ void nu::opengl::framebuffer_resize
  int loc_y_size                                                                                     // Window y-size [screen coordinates].
 )
 {
+  if(mode == NU_WINDOW_OFFSCREEN)
+  {
+    return;                                                                                         // Keeping offscreen framebuffer size...
+  }
+
   framebuffer_size_x = loc_x_size;                                                                  // Setting framebuffer_size_x...
   framebuffer_size_y = loc_y_size;                                                                  // Setting framebuffer_size_y...
   aspect_ratio       = (float)framebuffer_size_x/(float)framebuffer_size_y;                         // Setting window aspect ration []...
@@ -1080,5 +1353,12 @@ void nu::opengl::framebuffer_resize
 
 nu::opengl::~opengl ()
 {
+  if(offscreen_fbo != 0)
+  {
+    glDeleteFramebuffers (1, &offscreen_fbo);                                                       // Deleting offscreen framebuffer...
+    glDeleteRenderbuffers (1, &offscreen_color);                                                    // Deleting offscreen color renderbuffer...
+    glDeleteRenderbuffers (1, &offscreen_depth);                                                    // Deleting offscreen depth renderbuffer...
+  }
+
   glfwTerminate ();                                                                                 // Terminating GLFW...
 }
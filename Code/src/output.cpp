@@ -0,0 +1,467 @@
+/// @file     output.cpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Definition of a time-series "output" class.
+
+#include "output.hpp"
+#include <filesystem>
+#include <cstdio>
+
+// Closing tags of the XDMF temporal collection (rewritten after each appended grid):
+static const std::string nu_xdmf_tail = "  </Grid>\n  </Domain>\n</Xdmf>\n";
+
+// Formats a time with full double precision (distinct times stay distinct):
+static std::string nu_time (
+                            double loc_time                                                         // Time.
+                           )
+{
+  char loc_text[32];                                                                                // Time text.
+
+  snprintf (loc_text, sizeof(loc_text), "%.17g", loc_time);                                         // Formatting time...
+
+  return std::string (loc_text);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////// "output" class ////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+nu::output::output ()
+{
+  file      = NULL;                                                                                 // Resetting binary data file...
+  points    = NULL;                                                                                 // Resetting node positions...
+  slot_size = 0;                                                                                    // Resetting staging buffer size...
+  file_size = 0;                                                                                    // Resetting binary data file size...
+  stop      = false;                                                                                // Resetting "stop" flag...
+  written   = 0;                                                                                    // Resetting number of written records...
+  stalls    = 0;                                                                                    // Resetting number of stalled writes...
+  ready     = false;                                                                                // Resetting "ready" flag...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////// init ////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::output::init (
+                       std::string   loc_file_name,                                                 // Output file name prefix.
+                       output_format loc_format                                                     // Output format.
+                      )
+{
+  neutrino::action ("initializing output...");                                                      // Printing message...
+
+  file_name = loc_file_name;                                                                        // Setting output file name prefix...
+  format    = loc_format;                                                                           // Setting output format...
+  file      = fopen ((file_name + ".bin").c_str (), "wb");                                          // Opening binary data file...
+
+  if(file == NULL)
+  {
+    neutrino::error ("could not open output file!");                                                // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  if(format == NU_OUTPUT_RAW)
+  {
+    index.open (file_name + ".idx");                                                                // Opening index file...
+    index << "# record time name type components count offset" << std::endl;                        // Writing index header...
+  }
+
+  if(format == NU_OUTPUT_XDMF)
+  {
+    // Writing an empty temporal collection (the grids are appended before its closing tags):
+    xdmf.open (file_name + ".xmf");                                                                 // Opening XDMF file...
+    xdmf << "<?xml version=\"1.0\" ?>\n<Xdmf Version=\"3.0\">\n  <Domain>\n";
+    xdmf << "  <Grid Name=\"series\" GridType=\"Collection\" CollectionType=\"Temporal\">\n";
+    xdmf << nu_xdmf_tail;
+    xdmf.flush ();
+  }
+
+  file_size = 0;                                                                                    // Resetting binary data file size...
+  written   = 0;                                                                                    // Resetting number of written records...
+  stalls    = 0;                                                                                    // Resetting number of stalled writes...
+  stop      = false;                                                                                // Resetting "stop" flag...
+  writer    = std::thread (&nu::output::loop, this);                                                // Starting writer thread...
+  ready     = true;                                                                                 // Setting "ready" flag...
+
+  neutrino::done ();                                                                                // Printing message...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////// addfield //////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::output::addfield (
+                           nu::data*   loc_data,                                                    // Data object.
+                           std::string loc_name                                                     // Data object name.
+                          )
+{
+  if((format == NU_OUTPUT_XDMF) && ((loc_data->type == NU_HALF) || (loc_data->type == NU_HALF4)))
+  {
+    neutrino::warning ("XDMF has no half precision type: writing raw 16-bit words!");               // Printing message...
+  }
+
+  field.push_back (loc_data);                                                                       // Adding data object...
+  field_name.push_back (loc_name);                                                                  // Adding data object name...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////// setpoints /////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::output::setpoints (
+                            nu::float4* loc_points                                                  // Node positions.
+                           )
+{
+  points = loc_points;                                                                              // Setting node positions...
+
+  if(std::find (field.begin (), field.end (), (nu::data*)loc_points) == field.end ())
+  {
+    addfield (loc_points, "points");                                                                // Adding node positions...
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////// allocate //////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::output::allocate ()
+{
+  void*   loc_host;                                                                                 // Host data.
+  size_t  loc_element;                                                                              // Element size [bytes].
+  size_t  loc_count;                                                                                // Number of elements [#].
+  cl_mem* loc_buffer;                                                                               // Device buffer.
+  bool*   loc_ready;                                                                                // Buffer "ready" flag.
+  cl_int  loc_error;                                                                                // Error code.
+  size_t  i;                                                                                        // Index.
+
+  if((format == NU_OUTPUT_XDMF) && (points == NULL))
+  {
+    neutrino::error ("XDMF output needs the node positions!");                                      // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  // Laying out the data objects in a staging buffer:
+  slot_size = 0;
+  field_offset.clear ();
+
+  for(i = 0; i < field.size (); i++)
+  {
+    field[i]->access (&loc_host, &loc_element, &loc_count, &loc_buffer, &loc_ready);
+    field_offset.push_back (slot_size);                                                             // Setting data object offset...
+    slot_size += loc_element*loc_count;                                                             // Advancing to next data object...
+  }
+
+  // Allocating pinned staging buffers (mapped once, for the whole run):
+  for(i = 0; i < NU_OUTPUT_RING; i++)
+  {
+    slot.push_back (clCreateBuffer (neutrino::context_id, CL_MEM_READ_WRITE | CL_MEM_ALLOC_HOST_PTR, std::max (slot_size, (size_t)1), NULL, &loc_error));
+    neutrino::check_error (loc_error);                                                              // Checking returned error code...
+    slot_data.push_back ((char*)clEnqueueMapBuffer (neutrino::queue_id, slot[i], CL_TRUE, CL_MAP_READ | CL_MAP_WRITE, 0, std::max (slot_size, (size_t)1), 0, NULL, NULL, &loc_error));
+    neutrino::check_error (loc_error);                                                              // Checking returned error code...
+    free_slot.push_back (i);                                                                        // Setting staging buffer free...
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////// write ///////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::output::write (
+                        double loc_time                                                             // Output time.
+                       )
+{
+  void*    loc_host;                                                                                // Host data.
+  size_t   loc_element;                                                                             // Element size [bytes].
+  size_t   loc_count;                                                                               // Number of elements [#].
+  cl_mem*  loc_buffer;                                                                              // Device buffer.
+  bool*    loc_ready;                                                                               // Buffer "ready" flag.
+  cl_event loc_event;                                                                               // Read event.
+  size_t   loc_slot;                                                                                // Staging buffer index.
+  size_t   i;                                                                                       // Index.
+
+  if(!ready)
+  {
+    return;
+  }
+
+  if(slot.empty ())
+  {
+    allocate ();                                                                                    // Allocating staging buffers...
+  }
+
+  // Getting a free staging buffer (waiting for the disk, if all are queued):
+  {
+    std::unique_lock<std::mutex> loc_lock (slot_lock);
+
+    if(free_slot.empty ())
+    {
+      stalls++;                                                                                     // Counting stalled write...
+    }
+
+    slot_signal.wait (loc_lock, [this] {return !free_slot.empty ();});
+    loc_slot = free_slot.back ();                                                                   // Getting staging buffer...
+    free_slot.pop_back ();
+  }
+
+  // Enqueueing non-blocking reads of the selected device buffers:
+  neutrino::check_error (nu::data::share (field, true));                                            // Acquiring shared buffers...
+
+  for(i = 0; i < field.size (); i++)
+  {
+    field[i]->access (&loc_host, &loc_element, &loc_count, &loc_buffer, &loc_ready);
+
+    if(loc_count > 0)
+    {
+      neutrino::check_error (clEnqueueReadBuffer (neutrino::queue_id, *loc_buffer, CL_FALSE, 0, loc_element*loc_count, slot_data[loc_slot] + field_offset[i], 0, NULL, NULL));
+    }
+  }
+
+  neutrino::check_error (nu::data::share (field, false));                                           // Releasing shared buffers...
+  neutrino::check_error (clEnqueueMarkerWithWaitList (neutrino::queue_id, 0, NULL, &loc_event));    // Marking end of reads...
+  clFlush (neutrino::queue_id);                                                                     // Submitting reads...
+
+  // Queuing staging buffer to the writer thread:
+  {
+    std::lock_guard<std::mutex> loc_lock (slot_lock);
+    queued_slot.push_back (loc_slot);
+    queued_time.push_back (loc_time);
+    queued_event.push_back (loc_event);
+  }
+
+  slot_signal.notify_all ();                                                                        // Waking up writer thread...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////// loop ////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::output::loop ()
+{
+  size_t   loc_slot;                                                                                // Staging buffer index.
+  double   loc_time;                                                                                // Output time.
+  cl_event loc_event;                                                                               // Read event.
+
+  while(true)
+  {
+    {
+      std::unique_lock<std::mutex> loc_lock (slot_lock);
+      slot_signal.wait (loc_lock, [this] {return stop || !queued_slot.empty ();});
+
+      if(queued_slot.empty ())
+      {
+        break;                                                                                      // Stopping (all records written)...
+      }
+
+      loc_slot  = queued_slot.front ();                                                             // Getting staging buffer...
+      loc_time  = queued_time.front ();                                                             // Getting output time...
+      loc_event = queued_event.front ();                                                            // Getting read event...
+      queued_slot.pop_front ();
+      queued_time.pop_front ();
+      queued_event.pop_front ();
+    }
+
+    clWaitForEvents (1, &loc_event);                                                                // Waiting for reads...
+    clReleaseEvent (loc_event);                                                                     // Releasing read event...
+    record (slot_data[loc_slot], loc_time);                                                         // Writing record...
+
+    {
+      std::lock_guard<std::mutex> loc_lock (slot_lock);
+      free_slot.push_back (loc_slot);                                                               // Setting staging buffer free...
+    }
+
+    slot_signal.notify_all ();                                                                      // Waking up writer...
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////// record ///////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::output::record (
+                         char*  loc_data,                                                           // Staging buffer.
+                         double loc_time                                                            // Output time.
+                        )
+{
+  void*         loc_host;                                                                           // Host data.
+  size_t        loc_element;                                                                        // Element size [bytes].
+  size_t        loc_count;                                                                          // Number of elements [#].
+  cl_mem*       loc_buffer;                                                                         // Device buffer.
+  bool*         loc_ready;                                                                          // Buffer "ready" flag.
+  size_t        loc_components;                                                                     // Number of components [#].
+  size_t        loc_points;                                                                         // Number of nodes [#].
+  std::string   loc_type;                                                                           // Data type name (index).
+  std::string   loc_number;                                                                         // XDMF number type.
+  size_t        loc_precision;                                                                      // Component size [bytes].
+  std::string   loc_bin;                                                                            // Binary data file name (relative).
+  std::string   loc_item;                                                                           // XDMF data item.
+  std::string   loc_grid;                                                                           // XDMF record grid.
+  size_t        i;                                                                                  // Index.
+
+  if(fwrite (loc_data, 1, slot_size, file) != slot_size)
+  {
+    neutrino::warning ("could not write output record!");                                           // Printing message...
+  }
+
+  fflush (file);                                                                                    // Flushing record...
+
+  loc_bin    = std::filesystem::path (file_name + ".bin").filename ().string ();
+  loc_points = (points != NULL) ? points->data.size () : 0;
+  loc_item   = "";
+
+  if(format == NU_OUTPUT_XDMF)
+  {
+    // Opening the record grid:
+    loc_grid  = "    <Grid Name=\"record_" + std::to_string (written) + "\" GridType=\"Uniform\">\n";
+    loc_grid += "      <Time Value=\"" + nu_time (loc_time) + "\"/>\n";
+  }
+
+  for(i = 0; i < field.size (); i++)
+  {
+    field[i]->access (&loc_host, &loc_element, &loc_count, &loc_buffer, &loc_ready);
+
+    switch(field[i]->type)
+    {
+      case NU_INT:
+      case NU_INT2:
+      case NU_INT3:
+      case NU_INT4:
+        loc_type      = "int";
+        loc_number    = "Int";
+        loc_precision = sizeof(GLint);
+        break;
+
+      case NU_HALF:
+      case NU_HALF4:
+        loc_type      = "half";
+        loc_number    = "UInt";                                                                     // Raw 16-bit words.
+        loc_precision = sizeof(GLhalf);
+        break;
+
+      case NU_SHORT4:
+        loc_type      = "short";
+        loc_number    = "Int";
+        loc_precision = sizeof(GLshort);
+        break;
+
+      case NU_UCHAR4:
+        loc_type      = "uchar";
+        loc_number    = "UChar";
+        loc_precision = sizeof(GLubyte);
+        break;
+
+      case NU_DOUBLE:
+      case NU_DOUBLE2:
+      case NU_DOUBLE3:
+      case NU_DOUBLE4:
+        loc_type      = "double";
+        loc_number    = "Float";
+        loc_precision = sizeof(GLdouble);
+        break;
+
+      default:
+        loc_type      = "float";
+        loc_number    = "Float";
+        loc_precision = sizeof(GLfloat);
+        break;
+    }
+
+    loc_components = loc_element/loc_precision;
+
+    switch(format)
+    {
+      case NU_OUTPUT_RAW:
+        index << written << " " << nu_time (loc_time) << " " << field_name[i] << " " << loc_type << " " << loc_components << " " << loc_count << " " << file_size + field_offset[i] << std::endl;
+        break;
+
+      case NU_OUTPUT_XDMF:
+        loc_item  = "<DataItem Dimensions=\"" + std::to_string (loc_count) + " " + std::to_string (loc_components) + "\" NumberType=\"" + loc_number + "\" Precision=\"" + std::to_string (loc_precision) + "\" Format=\"Binary\" Endian=\"Native\" Seek=\"" + std::to_string (file_size + field_offset[i]) + "\">" + loc_bin + "</DataItem>";
+
+        if(field[i] == (nu::data*)points)
+        {
+          // Geometry: x, y, z of the (x, y, z, w) node positions:
+          loc_grid += "      <Topology TopologyType=\"Polyvertex\" NumberOfElements=\"" + std::to_string (loc_points) + "\"/>\n";
+          loc_grid += "      <Geometry GeometryType=\"XYZ\">\n";
+          loc_grid += "        <DataItem ItemType=\"HyperSlab\" Dimensions=\"" + std::to_string (loc_points) + " 3\">\n";
+          loc_grid += "          <DataItem Dimensions=\"3 2\" Format=\"XML\">0 0 1 1 " + std::to_string (loc_points) + " 3</DataItem>\n";
+          loc_grid += "          " + loc_item + "\n";
+          loc_grid += "        </DataItem>\n";
+          loc_grid += "      </Geometry>\n";
+        }
+
+        if((field[i] != (nu::data*)points) && (loc_count == loc_points))
+        {
+          loc_grid += "      <Attribute Name=\"" + field_name[i] + "\" AttributeType=\"" + ((loc_components == 1) ? "Scalar" : ((loc_components == 3) ? "Vector" : "Matrix")) + "\" Center=\"Node\">\n";
+          loc_grid += "        " + loc_item + "\n";
+          loc_grid += "      </Attribute>\n";
+        }
+        break;
+    }
+  }
+
+  if(format == NU_OUTPUT_XDMF)
+  {
+    // Appending the record grid over the closing tags (always a complete XDMF file):
+    loc_grid += "    </Grid>\n";
+    xdmf.seekp (-(std::streamoff)nu_xdmf_tail.size (), std::ios::end);                              // Seeking back over the closing tags...
+    xdmf << loc_grid << nu_xdmf_tail;                                                               // Appending grid and closing tags...
+    xdmf.flush ();                                                                                  // Flushing XDMF file...
+  }
+
+  file_size += slot_size;                                                                           // Updating binary data file size...
+  written++;                                                                                        // Counting written record...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////// close ///////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::output::close ()
+{
+  size_t i;                                                                                         // Index.
+
+  if(!ready)
+  {
+    return;
+  }
+
+  neutrino::action ("closing output...");                                                           // Printing message...
+
+  // Stopping writer thread, after all queued records have been written:
+  {
+    std::lock_guard<std::mutex> loc_lock (slot_lock);
+    stop = true;                                                                                    // Setting "stop" flag...
+  }
+
+  slot_signal.notify_all ();                                                                        // Waking up writer thread...
+  writer.join ();                                                                                   // Waiting for writer thread...
+
+  fclose (file);                                                                                    // Closing binary data file...
+  file = NULL;
+
+  if(index.is_open ())
+  {
+    index.close ();                                                                                 // Closing index file...
+  }
+
+  if(xdmf.is_open ())
+  {
+    xdmf.close ();                                                                                  // Closing XDMF file...
+  }
+
+  for(i = 0; i < slot.size (); i++)
+  {
+    clEnqueueUnmapMemObject (neutrino::queue_id, slot[i], slot_data[i], 0, NULL, NULL);             // Unmapping staging buffer...
+  }
+
+  clFinish (neutrino::queue_id);                                                                    // Waiting for unmaps...
+
+  for(i = 0; i < slot.size (); i++)
+  {
+    clReleaseMemObject (slot[i]);                                                                   // Releasing staging buffer...
+  }
+
+  slot.clear ();
+  slot_data.clear ();
+  free_slot.clear ();
+  ready = false;                                                                                    // Resetting "ready" flag...
+
+  neutrino::done ();                                                                                // Printing message...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////// DESTRUCTOR ////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+nu::output::~output ()
+{
+  close ();                                                                                         // Terminating output...
+}
@@ -0,0 +1,309 @@
+/// @file     pool.cpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Definition of a device memory "pool" class.
+
+#include "pool.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////// "pool" class /////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+nu::pool::pool ()
+{
+  block_default = 0;                                                                                // Resetting default block size...
+  align         = 1;                                                                                // Resetting sub-buffer offset alignment...
+  max_alloc     = 0;                                                                                // Resetting maximum device buffer size...
+  used          = 0;                                                                                // Resetting used device memory...
+  peak          = 0;                                                                                // Resetting peak used device memory...
+  reserved      = 0;                                                                                // Resetting reserved device memory...
+  capacity      = 0;                                                                                // Resetting device global memory size...
+  ready         = false;                                                                            // Resetting "ready" flag...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////// init ////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::pool::init (
+                     size_t loc_block_size                                                          // Default block size [bytes].
+                    )
+{
+  cl_uint  loc_align_bits = 0;                                                                      // Base address alignment [bits].
+  cl_ulong loc_global     = 0;                                                                      // Global memory size [bytes].
+  cl_ulong loc_max_alloc  = 0;                                                                      // Maximum device buffer size [bytes].
+
+  neutrino::action ("initializing device memory pool...");                                          // Printing message...
+
+  neutrino::check_error (clGetDeviceInfo (neutrino::device_id, CL_DEVICE_MEM_BASE_ADDR_ALIGN, sizeof(cl_uint), &loc_align_bits, NULL));
+  neutrino::check_error (clGetDeviceInfo (neutrino::device_id, CL_DEVICE_GLOBAL_MEM_SIZE, sizeof(cl_ulong), &loc_global, NULL));
+  neutrino::check_error (clGetDeviceInfo (neutrino::device_id, CL_DEVICE_MAX_MEM_ALLOC_SIZE, sizeof(cl_ulong), &loc_max_alloc, NULL));
+
+  align         = std::max ((size_t)loc_align_bits/8, (size_t)1);                                   // Setting sub-buffer offset alignment...
+  capacity      = (size_t)loc_global;                                                               // Setting device global memory size...
+  max_alloc     = (size_t)loc_max_alloc;                                                            // Setting maximum device buffer size...
+  block_default = std::min (std::max (loc_block_size, align), max_alloc);                           // Setting default block size...
+  ready         = true;                                                                             // Setting "ready" flag...
+
+  neutrino::done ();                                                                                // Printing message...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////// grow ////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+size_t nu::pool::grow (
+                       size_t loc_size                                                              // Requested size [bytes].
+                      )
+{
+  cl_int loc_error;                                                                                 // Error code.
+  cl_mem loc_block;                                                                                 // Device memory block.
+  size_t loc_block_size;                                                                            // Device memory block size [bytes].
+
+  if(loc_size > max_alloc)
+  {
+    neutrino::error ("pool buffer larger than the maximum device buffer size!");                    // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  loc_block_size = std::max (loc_size, block_default);                                              // Setting block size...
+
+  if(reserved + loc_block_size > capacity)
+  {
+    loc_block_size = loc_size;                                                                      // Shrinking block to the requested size...
+  }
+
+  if(reserved + loc_block_size > capacity)
+  {
+    neutrino::error ("device memory pool exceeds the device global memory size!");                  // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  loc_block = clCreateBuffer (neutrino::context_id, CL_MEM_READ_WRITE, loc_block_size, NULL, &loc_error);
+  neutrino::check_error (loc_error);                                                                // Checking returned error code...
+
+  block.push_back (loc_block);                                                                      // Adding block...
+  block_size.push_back (loc_block_size);                                                            // Adding block size...
+  hole.push_back (std::map<size_t, size_t> ());                                                     // Adding block free regions...
+  hole.back ()[0] = loc_block_size;                                                                 // Setting whole block as free...
+  reserved       += loc_block_size;                                                                 // Updating reserved device memory...
+
+  return block.size () - 1;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////// allocate //////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+cl_mem nu::pool::allocate (
+                           size_t loc_size                                                          // Buffer size [bytes].
+                          )
+{
+  cl_int           loc_error;                                                                       // Error code.
+  cl_mem           loc_buffer;                                                                      // Sub-buffer.
+  cl_buffer_region loc_region;                                                                      // Sub-buffer region.
+  nu_pool_region   loc_pool_region;                                                                 // Pool region.
+  size_t           loc_aligned;                                                                     // Aligned size [bytes].
+  size_t           loc_block  = block.size ();                                                      // Block index.
+  size_t           loc_offset = 0;                                                                  // Region offset [bytes].
+  size_t           loc_free;                                                                        // Free region size [bytes].
+  size_t           i;                                                                               // Block index.
+
+  if(!ready)
+  {
+    neutrino::error ("device memory pool not initialized!");                                        // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  loc_aligned = ((std::max (loc_size, (size_t)1) + align - 1)/align)*align;                         // Rounding size up to the alignment...
+
+  // Finding the first free region large enough:
+  for(i = 0; (i < block.size ()) && (loc_block == block.size ()); i++)
+  {
+    for(auto& loc_hole : hole[i])
+    {
+      if(loc_hole.second >= loc_aligned)
+      {
+        loc_block  = i;                                                                             // Setting block index...
+        loc_offset = loc_hole.first;                                                                // Setting region offset...
+        break;
+      }
+    }
+  }
+
+  if(loc_block == block.size ())
+  {
+    loc_block  = grow (loc_aligned);                                                                // Adding block...
+    loc_offset = 0;                                                                                 // Setting region offset...
+  }
+
+  // Taking the region from the free region:
+  loc_free = hole[loc_block][loc_offset];
+  hole[loc_block].erase (loc_offset);
+
+  if(loc_free > loc_aligned)
+  {
+    hole[loc_block][loc_offset + loc_aligned] = loc_free - loc_aligned;                             // Keeping the remainder free...
+  }
+
+  loc_region.origin = loc_offset;                                                                   // Setting sub-buffer origin...
+  loc_region.size   = std::max (loc_size, (size_t)1);                                               // Setting sub-buffer size...
+  loc_buffer        = clCreateSubBuffer (block[loc_block], CL_MEM_READ_WRITE, CL_BUFFER_CREATE_TYPE_REGION, &loc_region, &loc_error);
+  neutrino::check_error (loc_error);                                                                // Checking returned error code...
+
+  loc_pool_region.block  = loc_block;                                                               // Setting region block...
+  loc_pool_region.offset = loc_offset;                                                              // Setting region offset...
+  loc_pool_region.size   = loc_aligned;                                                             // Setting region size...
+  region[loc_buffer]     = loc_pool_region;                                                         // Adding live sub-buffer...
+  used                  += loc_aligned;                                                             // Updating used device memory...
+  peak                   = std::max (peak, used);                                                   // Updating peak used device memory...
+
+  return loc_buffer;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////// recycle ///////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::pool::recycle (
+                        cl_mem loc_buffer                                                           // Sub-buffer.
+                       )
+{
+  nu_pool_region                     loc_region;                                                    // Pool region.
+  std::map<size_t, size_t>::iterator loc_next;                                                      // Next free region.
+  std::map<size_t, size_t>::iterator loc_previous;                                                  // Previous free region.
+
+  if(region.find (loc_buffer) == region.end ())
+  {
+    neutrino::error ("buffer not allocated by this device memory pool!");                           // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  loc_region = region[loc_buffer];                                                                  // Getting pool region...
+  region.erase (loc_buffer);                                                                        // Removing live sub-buffer...
+  neutrino::check_error (clReleaseMemObject (loc_buffer));                                          // Releasing sub-buffer...
+
+  std::map<size_t, size_t>& loc_hole = hole[loc_region.block];                                      // Block free regions.
+
+  loc_hole[loc_region.offset] = loc_region.size;                                                    // Freeing region...
+  loc_next                    = loc_hole.find (loc_region.offset);
+  loc_next++;
+
+  // Merging with the next free region:
+  if((loc_next != loc_hole.end ()) && (loc_region.offset + loc_region.size == loc_next->first))
+  {
+    loc_hole[loc_region.offset] += loc_next->second;
+    loc_hole.erase (loc_next);
+  }
+
+  loc_previous = loc_hole.find (loc_region.offset);
+
+  // Merging with the previous free region:
+  if(loc_previous != loc_hole.begin ())
+  {
+    loc_previous--;
+
+    if(loc_previous->first + loc_previous->second == loc_region.offset)
+    {
+      loc_previous->second += loc_hole[loc_region.offset];
+      loc_hole.erase (loc_region.offset);
+    }
+  }
+
+  used -= loc_region.size;                                                                          // Updating used device memory...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////// add /////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::pool::add (
+                    nu::data* loc_data                                                              // Data object.
+                   )
+{
+  void*   loc_host;                                                                                 // Host data.
+  size_t  loc_element;                                                                              // Element size [bytes].
+  size_t  loc_count;                                                                                // Number of elements [#].
+  cl_mem* loc_buffer;                                                                               // Data object device buffer.
+  bool*   loc_ready;                                                                                // Data object "ready" flag.
+
+  if(neutrino::interop)
+  {
+    return;                                                                                         // Shared buffers: left to kernel::setarg...
+  }
+
+  loc_data->access (&loc_host, &loc_element, &loc_count, &loc_buffer, &loc_ready);
+
+  if(*loc_ready)
+  {
+    neutrino::warning ("data object already set as kernel argument: not pooled!");                  // Printing message...
+    return;
+  }
+
+  *loc_buffer = allocate (loc_element*loc_count);                                                   // Suballocating device buffer...
+
+  if(loc_element*loc_count > 0)
+  {
+    // Uploading host data:
+    neutrino::check_error (clEnqueueWriteBuffer (neutrino::queue_id, *loc_buffer, CL_TRUE, 0, loc_element*loc_count, loc_host, 0, NULL, NULL));
+  }
+
+  *loc_ready  = true;                                                                               // Setting "ready" flag...
+  pooled.push_back (loc_data);                                                                      // Adding pooled data object...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////// remove ///////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::pool::remove (
+                       nu::data* loc_data                                                           // Data object.
+                      )
+{
+  void*   loc_host;                                                                                 // Host data.
+  size_t  loc_element;                                                                              // Element size [bytes].
+  size_t  loc_count;                                                                                // Number of elements [#].
+  cl_mem* loc_buffer;                                                                               // Data object device buffer.
+  bool*   loc_ready;                                                                                // Data object "ready" flag.
+
+  loc_data->access (&loc_host, &loc_element, &loc_count, &loc_buffer, &loc_ready);
+
+  if(!(*loc_ready) || (region.find (*loc_buffer) == region.end ()))
+  {
+    neutrino::warning ("data object not pooled!");                                                  // Printing message...
+    return;
+  }
+
+  clFinish (neutrino::queue_id);                                                                    // Waiting for OpenCL to finish...
+  recycle (*loc_buffer);                                                                            // Recycling device buffer...
+  *loc_buffer = NULL;                                                                               // Resetting device buffer...
+  *loc_ready  = false;                                                                              // Resetting "ready" flag...
+  pooled.erase (std::find (pooled.begin (), pooled.end (), loc_data));                              // Removing pooled data object...
+}
+
+nu::pool::~pool ()
+{
+  void*   loc_host;                                                                                 // Host data.
+  size_t  loc_element;                                                                              // Element size [bytes].
+  size_t  loc_count;                                                                                // Number of elements [#].
+  cl_mem* loc_buffer;                                                                               // Data object device buffer.
+  bool*   loc_ready;                                                                                // Data object "ready" flag.
+  size_t  i;                                                                                        // Index.
+
+  // Resetting the pooled data objects (their buffers are released below):
+  for(i = 0; i < pooled.size (); i++)
+  {
+    pooled[i]->access (&loc_host, &loc_element, &loc_count, &loc_buffer, &loc_ready);
+    *loc_buffer = NULL;                                                                             // Resetting device buffer...
+    *loc_ready  = false;                                                                            // Resetting "ready" flag...
+  }
+
+  for(auto& loc_region : region)
+  {
+    clReleaseMemObject (loc_region.first);                                                          // Releasing live sub-buffer...
+  }
+
+  for(i = 0; i < block.size (); i++)
+  {
+    clReleaseMemObject (block[i]);                                                                  // Releasing device memory block...
+  }
+
+  pooled.clear ();
+  region.clear ();
+  block.clear ();
+  block_size.clear ();
+  hole.clear ();
+}
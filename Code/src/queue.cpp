@@ -30,11 +30,33 @@ queue::queue()
 
   neutrino::check_error (loc_error);                                                                // Checking error...
 
+  if(neutrino::queue_id == NULL)
+  {
+    neutrino::queue_id = queue_id;                                                                  // Setting neutrino OpenCL queue ID (first queue)...
+  }
+
+  batched = false;                                                                                  // Resetting batch mode...
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
 
   neutrino::done ();                                                                                // Printing message...
 }
 
+void queue::finish_gl ()
+{
+  if((neutrino::render == NU_RENDER_SYNC) && !batched)
+  {
+    glFinish ();                                                                                    // Waiting for OpenGL to finish...
+  }
+}
+
+void queue::finish_cl ()
+{
+  if((neutrino::render == NU_RENDER_SYNC) && !batched)
+  {
+    clFinish (queue_id);                                                                            // Waiting for OpenCL to finish...
+  }
+}
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////
 //////////////////////////////////////// "read" functions ///////////////////////////////////////////
 /////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -438,13 +460,10 @@ void queue::read
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
 };
 
-/////////////////////////////////////////////////////////////////////////////////////////////////////
-////////////////////////////////////////// write "functions" ////////////////////////////////////////
-/////////////////////////////////////////////////////////////////////////////////////////////////////
-void queue::write
+void queue::read
 (
- nu::int1* loc_data,                                                                                // nu::int1 object.
- GLuint    loc_layout_index                                                                         // Layout index.
+ nu::half1* loc_data,                                                                               // nu::half1 object.
+ GLuint     loc_layout_index                                                                        // Layout index.
 )
 {
   cl_int loc_error;                                                                                 // Local error code.
@@ -465,14 +484,14 @@ void queue::write
            loc_layout_index                                                                         // OpenGL shader layout index.
           );
 
-  // Writing OpenCL buffer:
-  loc_error = clEnqueueWriteBuffer
+  // Reading OpenCL buffer:
+  loc_error = clEnqueueReadBuffer
               (
                queue_id,                                                                            // OpenCL queue ID.
                loc_data->buffer,                                                                    // Data buffer.
                CL_TRUE,                                                                             // Blocking write flag.
                0,                                                                                   // Data buffer offset.
-               sizeof(GL_INT)*loc_data->data.size (),                                               // Data buffer size.
+               sizeof(GLhalf)*loc_data->data.size (),                                               // Data buffer size.
                loc_data->data.data (),                                                              // Data buffer.
                0,                                                                                   // Number of events in the list.
                NULL,                                                                                // Event list.
@@ -491,10 +510,10 @@ void queue::write
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
 };
 
-void queue::write
+void queue::read
 (
- nu::int2* loc_data,                                                                                // nu::int2 object.
- GLuint    loc_layout_index                                                                         // Layout index.
+ nu::half4* loc_data,                                                                               // nu::half4 object.
+ GLuint     loc_layout_index                                                                        // Layout index.
 )
 {
   cl_int loc_error;                                                                                 // Local error code.
@@ -515,14 +534,14 @@ void queue::write
            loc_layout_index                                                                         // OpenGL shader layout index.
           );
 
-  // Writing OpenCL buffer:
-  loc_error = clEnqueueWriteBuffer
+  // Reading OpenCL buffer:
+  loc_error = clEnqueueReadBuffer
               (
                queue_id,                                                                            // OpenCL queue ID.
                loc_data->buffer,                                                                    // Data buffer.
                CL_TRUE,                                                                             // Blocking write flag.
                0,                                                                                   // Data buffer offset.
-               sizeof(nu_int2_structure)*loc_data->data.size (),                                    // Data buffer size.
+               sizeof(nu_half4_structure)*loc_data->data.size (),                                   // Data buffer size.
                loc_data->data.data (),                                                              // Data buffer.
                0,                                                                                   // Number of events in the list.
                NULL,                                                                                // Event list.
@@ -541,10 +560,10 @@ void queue::write
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
 };
 
-void queue::write
+void queue::read
 (
- nu::int3* loc_data,                                                                                // nu::int3 object.
- GLuint    loc_layout_index                                                                         // Layout index.
+ nu::short4* loc_data,                                                                              // nu::short4 object.
+ GLuint      loc_layout_index                                                                       // Layout index.
 )
 {
   cl_int loc_error;                                                                                 // Local error code.
@@ -565,14 +584,14 @@ void queue::write
            loc_layout_index                                                                         // OpenGL shader layout index.
           );
 
-  // Writing OpenCL buffer:
-  loc_error = clEnqueueWriteBuffer
+  // Reading OpenCL buffer:
+  loc_error = clEnqueueReadBuffer
               (
                queue_id,                                                                            // OpenCL queue ID.
                loc_data->buffer,                                                                    // Data buffer.
                CL_TRUE,                                                                             // Blocking write flag.
                0,                                                                                   // Data buffer offset.
-               sizeof(nu_int3_structure)*loc_data->data.size (),                                    // Data buffer size.
+               sizeof(nu_short4_structure)*loc_data->data.size (),                                  // Data buffer size.
                loc_data->data.data (),                                                              // Data buffer.
                0,                                                                                   // Number of events in the list.
                NULL,                                                                                // Event list.
@@ -591,10 +610,10 @@ void queue::write
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
 };
 
-void queue::write
+void queue::read
 (
- nu::int4* loc_data,                                                                                // nu::int4 object.
- GLuint    loc_layout_index                                                                         // Layout index.
+ nu::uchar4* loc_data,                                                                              // nu::uchar4 object.
+ GLuint      loc_layout_index                                                                       // Layout index.
 )
 {
   cl_int loc_error;                                                                                 // Local error code.
@@ -615,14 +634,14 @@ void queue::write
            loc_layout_index                                                                         // OpenGL shader layout index.
           );
 
-  // Writing OpenCL buffer:
-  loc_error = clEnqueueWriteBuffer
+  // Reading OpenCL buffer:
+  loc_error = clEnqueueReadBuffer
               (
                queue_id,                                                                            // OpenCL queue ID.
                loc_data->buffer,                                                                    // Data buffer.
                CL_TRUE,                                                                             // Blocking write flag.
                0,                                                                                   // Data buffer offset.
-               sizeof(nu_int4_structure)*loc_data->data.size (),                                    // Data buffer size.
+               sizeof(nu_uchar4_structure)*loc_data->data.size (),                                  // Data buffer size.
                loc_data->data.data (),                                                              // Data buffer.
                0,                                                                                   // Number of events in the list.
                NULL,                                                                                // Event list.
@@ -641,10 +660,10 @@ void queue::write
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
 };
 
-void queue::write
+void queue::read
 (
- nu::float1* loc_data,                                                                              // nu::float1 object.
- GLuint      loc_layout_index                                                                       // Layout index.
+ nu::double1* loc_data,                                                                             // nu::double1 object.
+ GLuint       loc_layout_index                                                                      // Layout index.
 )
 {
   cl_int loc_error;                                                                                 // Local error code.
@@ -665,14 +684,14 @@ void queue::write
            loc_layout_index                                                                         // OpenGL shader layout index.
           );
 
-  // Writing OpenCL buffer:
-  loc_error = clEnqueueWriteBuffer
+  // Reading OpenCL buffer:
+  loc_error = clEnqueueReadBuffer
               (
                queue_id,                                                                            // OpenCL queue ID.
                loc_data->buffer,                                                                    // Data buffer.
                CL_TRUE,                                                                             // Blocking write flag.
                0,                                                                                   // Data buffer offset.
-               sizeof(GL_FLOAT)*loc_data->data.size (),                                             // Data buffer size.
+               sizeof(GLdouble)*loc_data->data.size (),                                             // Data buffer size.
                loc_data->data.data (),                                                              // Data buffer.
                0,                                                                                   // Number of events in the list.
                NULL,                                                                                // Event list.
@@ -691,10 +710,10 @@ void queue::write
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
 };
 
-void queue::write
+void queue::read
 (
- nu::float2* loc_data,                                                                              // nu::float2 object.
- GLuint      loc_layout_index                                                                       // Layout index.
+ nu::double2* loc_data,                                                                             // nu::double2 object.
+ GLuint       loc_layout_index                                                                      // Layout index.
 )
 {
   cl_int loc_error;                                                                                 // Local error code.
@@ -715,14 +734,14 @@ void queue::write
            loc_layout_index                                                                         // OpenGL shader layout index.
           );
 
-  // Writing OpenCL buffer:
-  loc_error = clEnqueueWriteBuffer
+  // Reading OpenCL buffer:
+  loc_error = clEnqueueReadBuffer
               (
                queue_id,                                                                            // OpenCL queue ID.
                loc_data->buffer,                                                                    // Data buffer.
                CL_TRUE,                                                                             // Blocking write flag.
                0,                                                                                   // Data buffer offset.
-               sizeof(nu_float2_structure)*loc_data->data.size (),                                  // Data buffer size.
+               sizeof(nu_double2_structure)*loc_data->data.size (),                                 // Data buffer size.
                loc_data->data.data (),                                                              // Data buffer.
                0,                                                                                   // Number of events in the list.
                NULL,                                                                                // Event list.
@@ -741,10 +760,10 @@ void queue::write
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
 };
 
-void queue::write
+void queue::read
 (
- nu::float3* loc_data,                                                                              // nu::float3 object.
- GLuint      loc_layout_index                                                                       // Layout index.
+ nu::double3* loc_data,                                                                             // nu::double3 object.
+ GLuint       loc_layout_index                                                                      // Layout index.
 )
 {
   cl_int loc_error;                                                                                 // Local error code.
@@ -765,14 +784,14 @@ void queue::write
            loc_layout_index                                                                         // OpenGL shader layout index.
           );
 
-  // Writing OpenCL buffer:
-  loc_error = clEnqueueWriteBuffer
+  // Reading OpenCL buffer:
+  loc_error = clEnqueueReadBuffer
               (
                queue_id,                                                                            // OpenCL queue ID.
                loc_data->buffer,                                                                    // Data buffer.
                CL_TRUE,                                                                             // Blocking write flag.
                0,                                                                                   // Data buffer offset.
-               sizeof(nu_float3_structure)*loc_data->data.size (),                                  // Data buffer size.
+               sizeof(nu_double3_structure)*loc_data->data.size (),                                 // Data buffer size.
                loc_data->data.data (),                                                              // Data buffer.
                0,                                                                                   // Number of events in the list.
                NULL,                                                                                // Event list.
@@ -791,10 +810,10 @@ void queue::write
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
 };
 
-void queue::write
+void queue::read
 (
- nu::float4* loc_data,                                                                              // nu::float4 object.
- GLuint      loc_layout_index                                                                       // Layout index.
+ nu::double4* loc_data,                                                                             // nu::double4 object.
+ GLuint       loc_layout_index                                                                      // Layout index.
 )
 {
   cl_int loc_error;                                                                                 // Local error code.
@@ -815,14 +834,14 @@ void queue::write
            loc_layout_index                                                                         // OpenGL shader layout index.
           );
 
-  // Writing OpenCL buffer:
-  loc_error = clEnqueueWriteBuffer
+  // Reading OpenCL buffer:
+  loc_error = clEnqueueReadBuffer
               (
                queue_id,                                                                            // OpenCL queue ID.
                loc_data->buffer,                                                                    // Data buffer.
                CL_TRUE,                                                                             // Blocking write flag.
                0,                                                                                   // Data buffer offset.
-               sizeof(nu_float4_structure)*loc_data->data.size (),                                  // Data buffer size.
+               sizeof(nu_double4_structure)*loc_data->data.size (),                                 // Data buffer size.
                loc_data->data.data (),                                                              // Data buffer.
                0,                                                                                   // Number of events in the list.
                NULL,                                                                                // Event list.
@@ -841,10 +860,13 @@ void queue::write
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
 };
 
-void queue::acquire
+/////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////// write "functions" ////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////////////////
+void queue::write
 (
- nu::int1* loc_data,                                                                                // Data object.
- GLuint    loc_layout_index                                                                         // OpenGL shader layout index.
+ nu::int1* loc_data,                                                                                // nu::int1 object.
+ GLuint    loc_layout_index                                                                         // Layout index.
 )
 {
   cl_int loc_error;                                                                                 // Local error code.
@@ -859,31 +881,42 @@ void queue::acquire
     exit (EXIT_FAILURE);                                                                            // Exiting...
   }
 
-  // Setting layout index in vertex shader...
-  glDisableVertexAttribArray (loc_layout_index);                                                    // Unbinding data array...
-
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  // Acquiring OpenGL buffer:
+  acquire (
+           loc_data,                                                                                // Data object.
+           loc_layout_index                                                                         // OpenGL shader layout index.
+          );
 
-  // Acquiring OpenCL buffer:
-  loc_error = clEnqueueAcquireGLObjects
+  // Writing OpenCL buffer:
+  loc_error = clEnqueueWriteBuffer
               (
-               queue_id,                                                                            // Queue.
-               1,                                                                                   // Number of memory objects.
-               &loc_data->buffer,                                                                   // Memory object array.
-               0,                                                                                   // Number of events in event list.
+               queue_id,                                                                            // OpenCL queue ID.
+               loc_data->buffer,                                                                    // Data buffer.
+               CL_TRUE,                                                                             // Blocking write flag.
+               0,                                                                                   // Data buffer offset.
+               sizeof(GL_INT)*loc_data->data.size (),                                               // Data buffer size.
+               loc_data->data.data (),                                                              // Data buffer.
+               0,                                                                                   // Number of events in the list.
                NULL,                                                                                // Event list.
                NULL                                                                                 // Event.
               );
 
-  neutrino::check_error (loc_error);                                                                // Checking returned error code...
+  neutrino::check_error (loc_error);
+
+  // Releasing OpenGL buffer:
+  release
+  (
+   loc_data,                                                                                        // Data object.
+   loc_layout_index                                                                                 // OpenGL shader layout index.
+  );
 
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
 };
 
-void queue::acquire
+void queue::write
 (
- nu::int2* loc_data,                                                                                // Data object.
- GLuint    loc_layout_index                                                                         // OpenGL shader layout index.
+ nu::int2* loc_data,                                                                                // nu::int2 object.
+ GLuint    loc_layout_index                                                                         // Layout index.
 )
 {
   cl_int loc_error;                                                                                 // Local error code.
@@ -898,31 +931,42 @@ void queue::acquire
     exit (EXIT_FAILURE);                                                                            // Exiting...
   }
 
-  // Setting layout index in vertex shader...
-  glDisableVertexAttribArray (loc_layout_index);                                                    // Unbinding data array...
-
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  // Acquiring OpenGL buffer:
+  acquire (
+           loc_data,                                                                                // Data object.
+           loc_layout_index                                                                         // OpenGL shader layout index.
+          );
 
-  // Acquiring OpenCL buffer:
-  loc_error = clEnqueueAcquireGLObjects
+  // Writing OpenCL buffer:
+  loc_error = clEnqueueWriteBuffer
               (
-               queue_id,                                                                            // Queue.
-               2,                                                                                   // Number of memory objects.
-               &loc_data->buffer,                                                                   // Memory object array.
-               0,                                                                                   // Number of events in event list.
+               queue_id,                                                                            // OpenCL queue ID.
+               loc_data->buffer,                                                                    // Data buffer.
+               CL_TRUE,                                                                             // Blocking write flag.
+               0,                                                                                   // Data buffer offset.
+               sizeof(nu_int2_structure)*loc_data->data.size (),                                    // Data buffer size.
+               loc_data->data.data (),                                                              // Data buffer.
+               0,                                                                                   // Number of events in the list.
                NULL,                                                                                // Event list.
                NULL                                                                                 // Event.
               );
 
-  neutrino::check_error (loc_error);                                                                // Checking returned error code...
+  neutrino::check_error (loc_error);
+
+  // Releasing OpenGL buffer:
+  release
+  (
+   loc_data,                                                                                        // Data object.
+   loc_layout_index                                                                                 // OpenGL shader layout index.
+  );
 
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
 };
 
-void queue::acquire
+void queue::write
 (
- nu::int3* loc_data,                                                                                // Data object.
- GLuint    loc_layout_index                                                                         // OpenGL shader layout index.
+ nu::int3* loc_data,                                                                                // nu::int3 object.
+ GLuint    loc_layout_index                                                                         // Layout index.
 )
 {
   cl_int loc_error;                                                                                 // Local error code.
@@ -937,31 +981,42 @@ void queue::acquire
     exit (EXIT_FAILURE);                                                                            // Exiting...
   }
 
-  // Setting layout index in vertex shader...
-  glDisableVertexAttribArray (loc_layout_index);                                                    // Unbinding data array...
-
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  // Acquiring OpenGL buffer:
+  acquire (
+           loc_data,                                                                                // Data object.
+           loc_layout_index                                                                         // OpenGL shader layout index.
+          );
 
-  // Acquiring OpenCL buffer:
-  loc_error = clEnqueueAcquireGLObjects
+  // Writing OpenCL buffer:
+  loc_error = clEnqueueWriteBuffer
               (
-               queue_id,                                                                            // Queue.
-               3,                                                                                   // Number of memory objects.
-               &loc_data->buffer,                                                                   // Memory object array.
-               0,                                                                                   // Number of events in event list.
+               queue_id,                                                                            // OpenCL queue ID.
+               loc_data->buffer,                                                                    // Data buffer.
+               CL_TRUE,                                                                             // Blocking write flag.
+               0,                                                                                   // Data buffer offset.
+               sizeof(nu_int3_structure)*loc_data->data.size (),                                    // Data buffer size.
+               loc_data->data.data (),                                                              // Data buffer.
+               0,                                                                                   // Number of events in the list.
                NULL,                                                                                // Event list.
                NULL                                                                                 // Event.
               );
 
-  neutrino::check_error (loc_error);                                                                // Checking returned error code...
+  neutrino::check_error (loc_error);
+
+  // Releasing OpenGL buffer:
+  release
+  (
+   loc_data,                                                                                        // Data object.
+   loc_layout_index                                                                                 // OpenGL shader layout index.
+  );
 
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
 };
 
-void queue::acquire
+void queue::write
 (
- nu::int4* loc_data,                                                                                // Data object.
- GLuint    loc_layout_index                                                                         // OpenGL shader layout index.
+ nu::int4* loc_data,                                                                                // nu::int4 object.
+ GLuint    loc_layout_index                                                                         // Layout index.
 )
 {
   cl_int loc_error;                                                                                 // Local error code.
@@ -976,31 +1031,42 @@ void queue::acquire
     exit (EXIT_FAILURE);                                                                            // Exiting...
   }
 
-  // Setting layout index in vertex shader...
-  glDisableVertexAttribArray (loc_layout_index);                                                    // Unbinding data array...
-
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  // Acquiring OpenGL buffer:
+  acquire (
+           loc_data,                                                                                // Data object.
+           loc_layout_index                                                                         // OpenGL shader layout index.
+          );
 
-  // Acquiring OpenCL buffer:
-  loc_error = clEnqueueAcquireGLObjects
+  // Writing OpenCL buffer:
+  loc_error = clEnqueueWriteBuffer
               (
-               queue_id,                                                                            // Queue.
-               4,                                                                                   // Number of memory objects.
-               &loc_data->buffer,                                                                   // Memory object array.
-               0,                                                                                   // Number of events in event list.
+               queue_id,                                                                            // OpenCL queue ID.
+               loc_data->buffer,                                                                    // Data buffer.
+               CL_TRUE,                                                                             // Blocking write flag.
+               0,                                                                                   // Data buffer offset.
+               sizeof(nu_int4_structure)*loc_data->data.size (),                                    // Data buffer size.
+               loc_data->data.data (),                                                              // Data buffer.
+               0,                                                                                   // Number of events in the list.
                NULL,                                                                                // Event list.
                NULL                                                                                 // Event.
               );
 
-  neutrino::check_error (loc_error);                                                                // Checking returned error code...
+  neutrino::check_error (loc_error);
+
+  // Releasing OpenGL buffer:
+  release
+  (
+   loc_data,                                                                                        // Data object.
+   loc_layout_index                                                                                 // OpenGL shader layout index.
+  );
 
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
 };
 
-void queue::acquire
+void queue::write
 (
- nu::float1* loc_data,                                                                              // Data object.
- GLuint      loc_layout_index                                                                       // OpenGL shader layout index.
+ nu::float1* loc_data,                                                                              // nu::float1 object.
+ GLuint      loc_layout_index                                                                       // Layout index.
 )
 {
   cl_int loc_error;                                                                                 // Local error code.
@@ -1015,37 +1081,1640 @@ void queue::acquire
     exit (EXIT_FAILURE);                                                                            // Exiting...
   }
 
-  // Setting layout index in vertex shader...
-  glDisableVertexAttribArray (loc_layout_index);                                                    // Unbinding data array...
-
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  // Acquiring OpenGL buffer:
+  acquire (
+           loc_data,                                                                                // Data object.
+           loc_layout_index                                                                         // OpenGL shader layout index.
+          );
 
-  // Acquiring OpenCL buffer:
-  loc_error = clEnqueueAcquireGLObjects
+  // Writing OpenCL buffer:
+  loc_error = clEnqueueWriteBuffer
               (
-               queue_id,                                                                            // Queue.
-               1,                                                                                   // Number of memory objects.
-               &loc_data->buffer,                                                                   // Memory object array.
-               0,                                                                                   // Number of events in event list.
+               queue_id,                                                                            // OpenCL queue ID.
+               loc_data->buffer,                                                                    // Data buffer.
+               CL_TRUE,                                                                             // Blocking write flag.
+               0,                                                                                   // Data buffer offset.
+               sizeof(GL_FLOAT)*loc_data->data.size (),                                             // Data buffer size.
+               loc_data->data.data (),                                                              // Data buffer.
+               0,                                                                                   // Number of events in the list.
                NULL,                                                                                // Event list.
                NULL                                                                                 // Event.
               );
 
-  neutrino::check_error (loc_error);                                                                // Checking returned error code...
+  neutrino::check_error (loc_error);
+
+  // Releasing OpenGL buffer:
+  release
+  (
+   loc_data,                                                                                        // Data object.
+   loc_layout_index                                                                                 // OpenGL shader layout index.
+  );
 
   clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
 };
 
-void queue::acquire
+void queue::write
 (
- nu::float2* loc_data,                                                                              // Data object.
+ nu::float2* loc_data,                                                                              // nu::float2 object.
+ GLuint      loc_layout_index                                                                       // Layout index.
+)
+{
+  cl_int loc_error;                                                                                 // Local error code.
+
+  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+
+  // Checking layout index:
+  if(loc_layout_index != loc_data->layout)
+  {
+    neutrino::error ("Layout index mismatch!");                                                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  // Acquiring OpenGL buffer:
+  acquire (
+           loc_data,                                                                                // Data object.
+           loc_layout_index                                                                         // OpenGL shader layout index.
+          );
+
+  // Writing OpenCL buffer:
+  loc_error = clEnqueueWriteBuffer
+              (
+               queue_id,                                                                            // OpenCL queue ID.
+               loc_data->buffer,                                                                    // Data buffer.
+               CL_TRUE,                                                                             // Blocking write flag.
+               0,                                                                                   // Data buffer offset.
+               sizeof(nu_float2_structure)*loc_data->data.size (),                                  // Data buffer size.
+               loc_data->data.data (),                                                              // Data buffer.
+               0,                                                                                   // Number of events in the list.
+               NULL,                                                                                // Event list.
+               NULL                                                                                 // Event.
+              );
+
+  neutrino::check_error (loc_error);
+
+  // Releasing OpenGL buffer:
+  release
+  (
+   loc_data,                                                                                        // Data object.
+   loc_layout_index                                                                                 // OpenGL shader layout index.
+  );
+
+  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+};
+
+void queue::write
+(
+ nu::float3* loc_data,                                                                              // nu::float3 object.
+ GLuint      loc_layout_index                                                                       // Layout index.
+)
+{
+  cl_int loc_error;                                                                                 // Local error code.
+
+  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+
+  // Checking layout index:
+  if(loc_layout_index != loc_data->layout)
+  {
+    neutrino::error ("Layout index mismatch!");                                                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  // Acquiring OpenGL buffer:
+  acquire (
+           loc_data,                                                                                // Data object.
+           loc_layout_index                                                                         // OpenGL shader layout index.
+          );
+
+  // Writing OpenCL buffer:
+  loc_error = clEnqueueWriteBuffer
+              (
+               queue_id,                                                                            // OpenCL queue ID.
+               loc_data->buffer,                                                                    // Data buffer.
+               CL_TRUE,                                                                             // Blocking write flag.
+               0,                                                                                   // Data buffer offset.
+               sizeof(nu_float3_structure)*loc_data->data.size (),                                  // Data buffer size.
+               loc_data->data.data (),                                                              // Data buffer.
+               0,                                                                                   // Number of events in the list.
+               NULL,                                                                                // Event list.
+               NULL                                                                                 // Event.
+              );
+
+  neutrino::check_error (loc_error);
+
+  // Releasing OpenGL buffer:
+  release
+  (
+   loc_data,                                                                                        // Data object.
+   loc_layout_index                                                                                 // OpenGL shader layout index.
+  );
+
+  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+};
+
+void queue::write
+(
+ nu::float4* loc_data,                                                                              // nu::float4 object.
+ GLuint      loc_layout_index                                                                       // Layout index.
+)
+{
+  cl_int loc_error;                                                                                 // Local error code.
+
+  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+
+  // Checking layout index:
+  if(loc_layout_index != loc_data->layout)
+  {
+    neutrino::error ("Layout index mismatch!");                                                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  // Acquiring OpenGL buffer:
+  acquire (
+           loc_data,                                                                                // Data object.
+           loc_layout_index                                                                         // OpenGL shader layout index.
+          );
+
+  // Writing OpenCL buffer:
+  loc_error = clEnqueueWriteBuffer
+              (
+               queue_id,                                                                            // OpenCL queue ID.
+               loc_data->buffer,                                                                    // Data buffer.
+               CL_TRUE,                                                                             // Blocking write flag.
+               0,                                                                                   // Data buffer offset.
+               sizeof(nu_float4_structure)*loc_data->data.size (),                                  // Data buffer size.
+               loc_data->data.data (),                                                              // Data buffer.
+               0,                                                                                   // Number of events in the list.
+               NULL,                                                                                // Event list.
+               NULL                                                                                 // Event.
+              );
+
+  neutrino::check_error (loc_error);
+
+  // Releasing OpenGL buffer:
+  release
+  (
+   loc_data,                                                                                        // Data object.
+   loc_layout_index                                                                                 // OpenGL shader layout index.
+  );
+
+  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+};
+
+void queue::write
+(
+ nu::half1* loc_data,                                                                               // nu::half1 object.
+ GLuint     loc_layout_index                                                                        // Layout index.
+)
+{
+  cl_int loc_error;                                                                                 // Local error code.
+
+  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+
+  // Checking layout index:
+  if(loc_layout_index != loc_data->layout)
+  {
+    neutrino::error ("Layout index mismatch!");                                                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  // Acquiring OpenGL buffer:
+  acquire (
+           loc_data,                                                                                // Data object.
+           loc_layout_index                                                                         // OpenGL shader layout index.
+          );
+
+  // Writing OpenCL buffer:
+  loc_error = clEnqueueWriteBuffer
+              (
+               queue_id,                                                                            // OpenCL queue ID.
+               loc_data->buffer,                                                                    // Data buffer.
+               CL_TRUE,                                                                             // Blocking write flag.
+               0,                                                                                   // Data buffer offset.
+               sizeof(GLhalf)*loc_data->data.size (),                                               // Data buffer size.
+               loc_data->data.data (),                                                              // Data buffer.
+               0,                                                                                   // Number of events in the list.
+               NULL,                                                                                // Event list.
+               NULL                                                                                 // Event.
+              );
+
+  neutrino::check_error (loc_error);
+
+  // Releasing OpenGL buffer:
+  release
+  (
+   loc_data,                                                                                        // Data object.
+   loc_layout_index                                                                                 // OpenGL shader layout index.
+  );
+
+  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+};
+
+void queue::write
+(
+ nu::half4* loc_data,                                                                               // nu::half4 object.
+ GLuint     loc_layout_index                                                                        // Layout index.
+)
+{
+  cl_int loc_error;                                                                                 // Local error code.
+
+  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+
+  // Checking layout index:
+  if(loc_layout_index != loc_data->layout)
+  {
+    neutrino::error ("Layout index mismatch!");                                                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  // Acquiring OpenGL buffer:
+  acquire (
+           loc_data,                                                                                // Data object.
+           loc_layout_index                                                                         // OpenGL shader layout index.
+          );
+
+  // Writing OpenCL buffer:
+  loc_error = clEnqueueWriteBuffer
+              (
+               queue_id,                                                                            // OpenCL queue ID.
+               loc_data->buffer,                                                                    // Data buffer.
+               CL_TRUE,                                                                             // Blocking write flag.
+               0,                                                                                   // Data buffer offset.
+               sizeof(nu_half4_structure)*loc_data->data.size (),                                   // Data buffer size.
+               loc_data->data.data (),                                                              // Data buffer.
+               0,                                                                                   // Number of events in the list.
+               NULL,                                                                                // Event list.
+               NULL                                                                                 // Event.
+              );
+
+  neutrino::check_error (loc_error);
+
+  // Releasing OpenGL buffer:
+  release
+  (
+   loc_data,                                                                                        // Data object.
+   loc_layout_index                                                                                 // OpenGL shader layout index.
+  );
+
+  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+};
+
+void queue::write
+(
+ nu::short4* loc_data,                                                                              // nu::short4 object.
+ GLuint      loc_layout_index                                                                       // Layout index.
+)
+{
+  cl_int loc_error;                                                                                 // Local error code.
+
+  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+
+  // Checking layout index:
+  if(loc_layout_index != loc_data->layout)
+  {
+    neutrino::error ("Layout index mismatch!");                                                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  // Acquiring OpenGL buffer:
+  acquire (
+           loc_data,                                                                                // Data object.
+           loc_layout_index                                                                         // OpenGL shader layout index.
+          );
+
+  // Writing OpenCL buffer:
+  loc_error = clEnqueueWriteBuffer
+              (
+               queue_id,                                                                            // OpenCL queue ID.
+               loc_data->buffer,                                                                    // Data buffer.
+               CL_TRUE,                                                                             // Blocking write flag.
+               0,                                                                                   // Data buffer offset.
+               sizeof(nu_short4_structure)*loc_data->data.size (),                                  // Data buffer size.
+               loc_data->data.data (),                                                              // Data buffer.
+               0,                                                                                   // Number of events in the list.
+               NULL,                                                                                // Event list.
+               NULL                                                                                 // Event.
+              );
+
+  neutrino::check_error (loc_error);
+
+  // Releasing OpenGL buffer:
+  release
+  (
+   loc_data,                                                                                        // Data object.
+   loc_layout_index                                                                                 // OpenGL shader layout index.
+  );
+
+  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+};
+
+void queue::write
+(
+ nu::uchar4* loc_data,                                                                              // nu::uchar4 object.
+ GLuint      loc_layout_index                                                                       // Layout index.
+)
+{
+  cl_int loc_error;                                                                                 // Local error code.
+
+  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+
+  // Checking layout index:
+  if(loc_layout_index != loc_data->layout)
+  {
+    neutrino::error ("Layout index mismatch!");                                                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  // Acquiring OpenGL buffer:
+  acquire (
+           loc_data,                                                                                // Data object.
+           loc_layout_index                                                                         // OpenGL shader layout index.
+          );
+
+  // Writing OpenCL buffer:
+  loc_error = clEnqueueWriteBuffer
+              (
+               queue_id,                                                                            // OpenCL queue ID.
+               loc_data->buffer,                                                                    // Data buffer.
+               CL_TRUE,                                                                             // Blocking write flag.
+               0,                                                                                   // Data buffer offset.
+               sizeof(nu_uchar4_structure)*loc_data->data.size (),                                  // Data buffer size.
+               loc_data->data.data (),                                                              // Data buffer.
+               0,                                                                                   // Number of events in the list.
+               NULL,                                                                                // Event list.
+               NULL                                                                                 // Event.
+              );
+
+  neutrino::check_error (loc_error);
+
+  // Releasing OpenGL buffer:
+  release
+  (
+   loc_data,                                                                                        // Data object.
+   loc_layout_index                                                                                 // OpenGL shader layout index.
+  );
+
+  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+};
+
+void queue::write
+(
+ nu::double1* loc_data,                                                                             // nu::double1 object.
+ GLuint       loc_layout_index                                                                      // Layout index.
+)
+{
+  cl_int loc_error;                                                                                 // Local error code.
+
+  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+
+  // Checking layout index:
+  if(loc_layout_index != loc_data->layout)
+  {
+    neutrino::error ("Layout index mismatch!");                                                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  // Acquiring OpenGL buffer:
+  acquire (
+           loc_data,                                                                                // Data object.
+           loc_layout_index                                                                         // OpenGL shader layout index.
+          );
+
+  // Writing OpenCL buffer:
+  loc_error = clEnqueueWriteBuffer
+              (
+               queue_id,                                                                            // OpenCL queue ID.
+               loc_data->buffer,                                                                    // Data buffer.
+               CL_TRUE,                                                                             // Blocking write flag.
+               0,                                                                                   // Data buffer offset.
+               sizeof(GLdouble)*loc_data->data.size (),                                             // Data buffer size.
+               loc_data->data.data (),                                                              // Data buffer.
+               0,                                                                                   // Number of events in the list.
+               NULL,                                                                                // Event list.
+               NULL                                                                                 // Event.
+              );
+
+  neutrino::check_error (loc_error);
+
+  // Releasing OpenGL buffer:
+  release
+  (
+   loc_data,                                                                                        // Data object.
+   loc_layout_index                                                                                 // OpenGL shader layout index.
+  );
+
+  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+};
+
+void queue::write
+(
+ nu::double2* loc_data,                                                                             // nu::double2 object.
+ GLuint       loc_layout_index                                                                      // Layout index.
+)
+{
+  cl_int loc_error;                                                                                 // Local error code.
+
+  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+
+  // Checking layout index:
+  if(loc_layout_index != loc_data->layout)
+  {
+    neutrino::error ("Layout index mismatch!");                                                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  // Acquiring OpenGL buffer:
+  acquire (
+           loc_data,                                                                                // Data object.
+           loc_layout_index                                                                         // OpenGL shader layout index.
+          );
+
+  // Writing OpenCL buffer:
+  loc_error = clEnqueueWriteBuffer
+              (
+               queue_id,                                                                            // OpenCL queue ID.
+               loc_data->buffer,                                                                    // Data buffer.
+               CL_TRUE,                                                                             // Blocking write flag.
+               0,                                                                                   // Data buffer offset.
+               sizeof(nu_double2_structure)*loc_data->data.size (),                                 // Data buffer size.
+               loc_data->data.data (),                                                              // Data buffer.
+               0,                                                                                   // Number of events in the list.
+               NULL,                                                                                // Event list.
+               NULL                                                                                 // Event.
+              );
+
+  neutrino::check_error (loc_error);
+
+  // Releasing OpenGL buffer:
+  release
+  (
+   loc_data,                                                                                        // Data object.
+   loc_layout_index                                                                                 // OpenGL shader layout index.
+  );
+
+  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+};
+
+void queue::write
+(
+ nu::double3* loc_data,                                                                             // nu::double3 object.
+ GLuint       loc_layout_index                                                                      // Layout index.
+)
+{
+  cl_int loc_error;                                                                                 // Local error code.
+
+  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+
+  // Checking layout index:
+  if(loc_layout_index != loc_data->layout)
+  {
+    neutrino::error ("Layout index mismatch!");                                                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  // Acquiring OpenGL buffer:
+  acquire (
+           loc_data,                                                                                // Data object.
+           loc_layout_index                                                                         // OpenGL shader layout index.
+          );
+
+  // Writing OpenCL buffer:
+  loc_error = clEnqueueWriteBuffer
+              (
+               queue_id,                                                                            // OpenCL queue ID.
+               loc_data->buffer,                                                                    // Data buffer.
+               CL_TRUE,                                                                             // Blocking write flag.
+               0,                                                                                   // Data buffer offset.
+               sizeof(nu_double3_structure)*loc_data->data.size (),                                 // Data buffer size.
+               loc_data->data.data (),                                                              // Data buffer.
+               0,                                                                                   // Number of events in the list.
+               NULL,                                                                                // Event list.
+               NULL                                                                                 // Event.
+              );
+
+  neutrino::check_error (loc_error);
+
+  // Releasing OpenGL buffer:
+  release
+  (
+   loc_data,                                                                                        // Data object.
+   loc_layout_index                                                                                 // OpenGL shader layout index.
+  );
+
+  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+};
+
+void queue::write
+(
+ nu::double4* loc_data,                                                                             // nu::double4 object.
+ GLuint       loc_layout_index                                                                      // Layout index.
+)
+{
+  cl_int loc_error;                                                                                 // Local error code.
+
+  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+
+  // Checking layout index:
+  if(loc_layout_index != loc_data->layout)
+  {
+    neutrino::error ("Layout index mismatch!");                                                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  // Acquiring OpenGL buffer:
+  acquire (
+           loc_data,                                                                                // Data object.
+           loc_layout_index                                                                         // OpenGL shader layout index.
+          );
+
+  // Writing OpenCL buffer:
+  loc_error = clEnqueueWriteBuffer
+              (
+               queue_id,                                                                            // OpenCL queue ID.
+               loc_data->buffer,                                                                    // Data buffer.
+               CL_TRUE,                                                                             // Blocking write flag.
+               0,                                                                                   // Data buffer offset.
+               sizeof(nu_double4_structure)*loc_data->data.size (),                                 // Data buffer size.
+               loc_data->data.data (),                                                              // Data buffer.
+               0,                                                                                   // Number of events in the list.
+               NULL,                                                                                // Event list.
+               NULL                                                                                 // Event.
+              );
+
+  neutrino::check_error (loc_error);
+
+  // Releasing OpenGL buffer:
+  release
+  (
+   loc_data,                                                                                        // Data object.
+   loc_layout_index                                                                                 // OpenGL shader layout index.
+  );
+
+  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+};
+
+void queue::acquire
+(
+ nu::int1* loc_data,                                                                                // Data object.
+ GLuint    loc_layout_index                                                                         // OpenGL shader layout index.
+)
+{
+  cl_int loc_error;                                                                                 // Local error code.
+
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
+  finish_cl ();                                                                                     // Waiting for OpenCL to finish...
+
+  // Checking layout index:
+  if(loc_layout_index != loc_data->layout)
+  {
+    neutrino::error ("Layout index mismatch!");                                                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  // Setting layout index in vertex shader...
+  glDisableVertexAttribArray (loc_layout_index);                                                    // Unbinding data array...
+
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
+
+  if(batched)
+  {
+    batch.push_back (loc_data->buffer);                                                             // Batching OpenCL buffer...
+  }
+
+  else
+  {
+    // Acquiring OpenCL buffer:
+    loc_error = clEnqueueAcquireGLObjects
+                (
+                 queue_id,                                                                          // Queue.
+                 1,                                                                                 // Number of memory objects.
+                 &loc_data->buffer,                                                                 // Memory object array.
+                 0,                                                                                 // Number of events in event list.
+                 NULL,                                                                              // Event list.
+                 NULL                                                                               // Event.
+                );
+
+    neutrino::check_error (loc_error);                                                              // Checking returned error code...
+  }
+
+  finish_cl ();                                                                                     // Waiting for OpenCL to finish...
+};
+
+void queue::acquire
+(
+ nu::int2* loc_data,                                                                                // Data object.
+ GLuint    loc_layout_index                                                                         // OpenGL shader layout index.
+)
+{
+  cl_int loc_error;                                                                                 // Local error code.
+
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
+  finish_cl ();                                                                                     // Waiting for OpenCL to finish...
+
+  // Checking layout index:
+  if(loc_layout_index != loc_data->layout)
+  {
+    neutrino::error ("Layout index mismatch!");                                                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  // Setting layout index in vertex shader...
+  glDisableVertexAttribArray (loc_layout_index);                                                    // Unbinding data array...
+
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
+
+  if(batched)
+  {
+    batch.push_back (loc_data->buffer);                                                             // Batching OpenCL buffer...
+  }
+
+  else
+  {
+    // Acquiring OpenCL buffer:
+    loc_error = clEnqueueAcquireGLObjects
+                (
+                 queue_id,                                                                          // Queue.
+                 2,                                                                                 // Number of memory objects.
+                 &loc_data->buffer,                                                                 // Memory object array.
+                 0,                                                                                 // Number of events in event list.
+                 NULL,                                                                              // Event list.
+                 NULL                                                                               // Event.
+                );
+
+    neutrino::check_error (loc_error);                                                              // Checking returned error code...
+  }
+
+  finish_cl ();                                                                                     // Waiting for OpenCL to finish...
+};
+
+void queue::acquire
+(
+ nu::int3* loc_data,                                                                                // Data object.
+ GLuint    loc_layout_index                                                                         // OpenGL shader layout index.
+)
+{
+  cl_int loc_error;                                                                                 // Local error code.
+
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
+  finish_cl ();                                                                                     // Waiting for OpenCL to finish...
+
+  // Checking layout index:
+  if(loc_layout_index != loc_data->layout)
+  {
+    neutrino::error ("Layout index mismatch!");                                                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  // Setting layout index in vertex shader...
+  glDisableVertexAttribArray (loc_layout_index);                                                    // Unbinding data array...
+
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
+
+  if(batched)
+  {
+    batch.push_back (loc_data->buffer);                                                             // Batching OpenCL buffer...
+  }
+
+  else
+  {
+    // Acquiring OpenCL buffer:
+    loc_error = clEnqueueAcquireGLObjects
+                (
+                 queue_id,                                                                          // Queue.
+                 3,                                                                                 // Number of memory objects.
+                 &loc_data->buffer,                                                                 // Memory object array.
+                 0,                                                                                 // Number of events in event list.
+                 NULL,                                                                              // Event list.
+                 NULL                                                                               // Event.
+                );
+
+    neutrino::check_error (loc_error);                                                              // Checking returned error code...
+  }
+
+  finish_cl ();                                                                                     // Waiting for OpenCL to finish...
+};
+
+void queue::acquire
+(
+ nu::int4* loc_data,                                                                                // Data object.
+ GLuint    loc_layout_index                                                                         // OpenGL shader layout index.
+)
+{
+  cl_int loc_error;                                                                                 // Local error code.
+
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
+  finish_cl ();                                                                                     // Waiting for OpenCL to finish...
+
+  // Checking layout index:
+  if(loc_layout_index != loc_data->layout)
+  {
+    neutrino::error ("Layout index mismatch!");                                                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  // Setting layout index in vertex shader...
+  glDisableVertexAttribArray (loc_layout_index);                                                    // Unbinding data array...
+
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
+
+  if(batched)
+  {
+    batch.push_back (loc_data->buffer);                                                             // Batching OpenCL buffer...
+  }
+
+  else
+  {
+    // Acquiring OpenCL buffer:
+    loc_error = clEnqueueAcquireGLObjects
+                (
+                 queue_id,                                                                          // Queue.
+                 4,                                                                                 // Number of memory objects.
+                 &loc_data->buffer,                                                                 // Memory object array.
+                 0,                                                                                 // Number of events in event list.
+                 NULL,                                                                              // Event list.
+                 NULL                                                                               // Event.
+                );
+
+    neutrino::check_error (loc_error);                                                              // Checking returned error code...
+  }
+
+  finish_cl ();                                                                                     // Waiting for OpenCL to finish...
+};
+
+void queue::acquire
+(
+ nu::float1* loc_data,                                                                              // Data object.
+ GLuint      loc_layout_index                                                                       // OpenGL shader layout index.
+)
+{
+  cl_int loc_error;                                                                                 // Local error code.
+
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
+  finish_cl ();                                                                                     // Waiting for OpenCL to finish...
+
+  // Checking layout index:
+  if(loc_layout_index != loc_data->layout)
+  {
+    neutrino::error ("Layout index mismatch!");                                                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  // Setting layout index in vertex shader...
+  glDisableVertexAttribArray (loc_layout_index);                                                    // Unbinding data array...
+
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
+
+  if(batched)
+  {
+    batch.push_back (loc_data->buffer);                                                             // Batching OpenCL buffer...
+  }
+
+  else
+  {
+    // Acquiring OpenCL buffer:
+    loc_error = clEnqueueAcquireGLObjects
+                (
+                 queue_id,                                                                          // Queue.
+                 1,                                                                                 // Number of memory objects.
+                 &loc_data->buffer,                                                                 // Memory object array.
+                 0,                                                                                 // Number of events in event list.
+                 NULL,                                                                              // Event list.
+                 NULL                                                                               // Event.
+                );
+
+    neutrino::check_error (loc_error);                                                              // Checking returned error code...
+  }
+
+  finish_cl ();                                                                                     // Waiting for OpenCL to finish...
+};
+
+void queue::acquire
+(
+ nu::float2* loc_data,                                                                              // Data object.
+ GLuint      loc_layout_index                                                                       // OpenGL shader layout index.
+)
+{
+  cl_int loc_error;                                                                                 // Local error code.
+
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
+  finish_cl ();                                                                                     // Waiting for OpenCL to finish...
+
+  // Checking layout index:
+  if(loc_layout_index != loc_data->layout)
+  {
+    neutrino::error ("Layout index mismatch!");                                                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  // Setting layout index in vertex shader...
+  glDisableVertexAttribArray (loc_layout_index);                                                    // Unbinding data array...
+
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
+
+  if(batched)
+  {
+    batch.push_back (loc_data->buffer);                                                             // Batching OpenCL buffer...
+  }
+
+  else
+  {
+    // Acquiring OpenCL buffer:
+    loc_error = clEnqueueAcquireGLObjects
+                (
+                 queue_id,                                                                          // Queue.
+                 2,                                                                                 // Number of memory objects.
+                 &loc_data->buffer,                                                                 // Memory object array.
+                 0,                                                                                 // Number of events in event list.
+                 NULL,                                                                              // Event list.
+                 NULL                                                                               // Event.
+                );
+
+    neutrino::check_error (loc_error);                                                              // Checking returned error code...
+  }
+
+  finish_cl ();                                                                                     // Waiting for OpenCL to finish...
+};
+
+void queue::acquire
+(
+ nu::float3* loc_data,                                                                              // Data object.
+ GLuint      loc_layout_index                                                                       // OpenGL shader layout index.
+)
+{
+  cl_int loc_error;                                                                                 // Local error code.
+
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
+  finish_cl ();                                                                                     // Waiting for OpenCL to finish...
+
+  // Checking layout index:
+  if(loc_layout_index != loc_data->layout)
+  {
+    neutrino::error ("Layout index mismatch!");                                                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  // Setting layout index in vertex shader...
+  glDisableVertexAttribArray (loc_layout_index);                                                    // Unbinding data array...
+
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
+
+  if(batched)
+  {
+    batch.push_back (loc_data->buffer);                                                             // Batching OpenCL buffer...
+  }
+
+  else
+  {
+    // Acquiring OpenCL buffer:
+    loc_error = clEnqueueAcquireGLObjects
+                (
+                 queue_id,                                                                          // Queue.
+                 3,                                                                                 // Number of memory objects.
+                 &loc_data->buffer,                                                                 // Memory object array.
+                 0,                                                                                 // Number of events in event list.
+                 NULL,                                                                              // Event list.
+                 NULL                                                                               // Event.
+                );
+
+    neutrino::check_error (loc_error);                                                              // Checking returned error code...
+  }
+
+  finish_cl ();                                                                                     // Waiting for OpenCL to finish...
+};
+
+void queue::acquire
+(
+ nu::float4* loc_data,                                                                              // Data object.
+ GLuint      loc_layout_index                                                                       // OpenGL shader layout index.
+)
+{
+  cl_int loc_error;                                                                                 // Local error code.
+
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
+  finish_cl ();                                                                                     // Waiting for OpenCL to finish...
+
+  // Checking layout index:
+  if(loc_layout_index != loc_data->layout)
+  {
+    neutrino::error ("Layout index mismatch!");                                                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  // Setting layout index in vertex shader...
+  glDisableVertexAttribArray (loc_layout_index);                                                    // Unbinding data array...
+
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
+
+  if(batched)
+  {
+    batch.push_back (loc_data->buffer);                                                             // Batching OpenCL buffer...
+  }
+
+  else
+  {
+    // Acquiring OpenCL buffer:
+    loc_error = clEnqueueAcquireGLObjects
+                (
+                 queue_id,                                                                          // Queue.
+                 1,                                                                                 // Number of memory objects.
+                 &loc_data->buffer,                                                                 // Memory object array.
+                 0,                                                                                 // Number of events in event list.
+                 NULL,                                                                              // Event list.
+                 NULL                                                                               // Event.
+                );
+
+    neutrino::check_error (loc_error);                                                              // Checking returned error code...
+  }
+
+  finish_cl ();                                                                                     // Waiting for OpenCL to finish...
+};
+
+void queue::acquire
+(
+ nu::half1* loc_data,                                                                               // Data object.
+ GLuint     loc_layout_index                                                                        // OpenGL shader layout index.
+)
+{
+  cl_int loc_error;                                                                                 // Local error code.
+
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
+  finish_cl ();                                                                                     // Waiting for OpenCL to finish...
+
+  // Checking layout index:
+  if(loc_layout_index != loc_data->layout)
+  {
+    neutrino::error ("Layout index mismatch!");                                                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  // Setting layout index in vertex shader...
+  glDisableVertexAttribArray (loc_layout_index);                                                    // Unbinding data array...
+
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
+
+  if(batched)
+  {
+    batch.push_back (loc_data->buffer);                                                             // Batching OpenCL buffer...
+  }
+
+  else
+  {
+    // Acquiring OpenCL buffer:
+    loc_error = clEnqueueAcquireGLObjects
+                (
+                 queue_id,                                                                          // Queue.
+                 1,                                                                                 // Number of memory objects.
+                 &loc_data->buffer,                                                                 // Memory object array.
+                 0,                                                                                 // Number of events in event list.
+                 NULL,                                                                              // Event list.
+                 NULL                                                                               // Event.
+                );
+
+    neutrino::check_error (loc_error);                                                              // Checking returned error code...
+  }
+
+  finish_cl ();                                                                                     // Waiting for OpenCL to finish...
+};
+
+void queue::acquire
+(
+ nu::half4* loc_data,                                                                               // Data object.
+ GLuint     loc_layout_index                                                                        // OpenGL shader layout index.
+)
+{
+  cl_int loc_error;                                                                                 // Local error code.
+
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
+  finish_cl ();                                                                                     // Waiting for OpenCL to finish...
+
+  // Checking layout index:
+  if(loc_layout_index != loc_data->layout)
+  {
+    neutrino::error ("Layout index mismatch!");                                                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  // Setting layout index in vertex shader...
+  glDisableVertexAttribArray (loc_layout_index);                                                    // Unbinding data array...
+
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
+
+  if(batched)
+  {
+    batch.push_back (loc_data->buffer);                                                             // Batching OpenCL buffer...
+  }
+
+  else
+  {
+    // Acquiring OpenCL buffer:
+    loc_error = clEnqueueAcquireGLObjects
+                (
+                 queue_id,                                                                          // Queue.
+                 1,                                                                                 // Number of memory objects.
+                 &loc_data->buffer,                                                                 // Memory object array.
+                 0,                                                                                 // Number of events in event list.
+                 NULL,                                                                              // Event list.
+                 NULL                                                                               // Event.
+                );
+
+    neutrino::check_error (loc_error);                                                              // Checking returned error code...
+  }
+
+  finish_cl ();                                                                                     // Waiting for OpenCL to finish...
+};
+
+void queue::acquire
+(
+ nu::short4* loc_data,                                                                              // Data object.
+ GLuint      loc_layout_index                                                                       // OpenGL shader layout index.
+)
+{
+  cl_int loc_error;                                                                                 // Local error code.
+
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
+  finish_cl ();                                                                                     // Waiting for OpenCL to finish...
+
+  // Checking layout index:
+  if(loc_layout_index != loc_data->layout)
+  {
+    neutrino::error ("Layout index mismatch!");                                                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  // Setting layout index in vertex shader...
+  glDisableVertexAttribArray (loc_layout_index);                                                    // Unbinding data array...
+
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
+
+  if(batched)
+  {
+    batch.push_back (loc_data->buffer);                                                             // Batching OpenCL buffer...
+  }
+
+  else
+  {
+    // Acquiring OpenCL buffer:
+    loc_error = clEnqueueAcquireGLObjects
+                (
+                 queue_id,                                                                          // Queue.
+                 1,                                                                                 // Number of memory objects.
+                 &loc_data->buffer,                                                                 // Memory object array.
+                 0,                                                                                 // Number of events in event list.
+                 NULL,                                                                              // Event list.
+                 NULL                                                                               // Event.
+                );
+
+    neutrino::check_error (loc_error);                                                              // Checking returned error code...
+  }
+
+  finish_cl ();                                                                                     // Waiting for OpenCL to finish...
+};
+
+void queue::acquire
+(
+ nu::uchar4* loc_data,                                                                              // Data object.
+ GLuint      loc_layout_index                                                                       // OpenGL shader layout index.
+)
+{
+  cl_int loc_error;                                                                                 // Local error code.
+
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
+  finish_cl ();                                                                                     // Waiting for OpenCL to finish...
+
+  // Checking layout index:
+  if(loc_layout_index != loc_data->layout)
+  {
+    neutrino::error ("Layout index mismatch!");                                                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  // Setting layout index in vertex shader...
+  glDisableVertexAttribArray (loc_layout_index);                                                    // Unbinding data array...
+
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
+
+  if(batched)
+  {
+    batch.push_back (loc_data->buffer);                                                             // Batching OpenCL buffer...
+  }
+
+  else
+  {
+    // Acquiring OpenCL buffer:
+    loc_error = clEnqueueAcquireGLObjects
+                (
+                 queue_id,                                                                          // Queue.
+                 1,                                                                                 // Number of memory objects.
+                 &loc_data->buffer,                                                                 // Memory object array.
+                 0,                                                                                 // Number of events in event list.
+                 NULL,                                                                              // Event list.
+                 NULL                                                                               // Event.
+                );
+
+    neutrino::check_error (loc_error);                                                              // Checking returned error code...
+  }
+
+  finish_cl ();                                                                                     // Waiting for OpenCL to finish...
+};
+
+void queue::acquire
+(
+ nu::double1* loc_data,                                                                             // Data object.
+ GLuint       loc_layout_index                                                                      // OpenGL shader layout index.
+)
+{
+  cl_int loc_error;                                                                                 // Local error code.
+
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
+  finish_cl ();                                                                                     // Waiting for OpenCL to finish...
+
+  // Checking layout index:
+  if(loc_layout_index != loc_data->layout)
+  {
+    neutrino::error ("Layout index mismatch!");                                                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  // Setting layout index in vertex shader...
+  glDisableVertexAttribArray (loc_layout_index);                                                    // Unbinding data array...
+
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
+
+  if(batched)
+  {
+    batch.push_back (loc_data->buffer);                                                             // Batching OpenCL buffer...
+  }
+
+  else
+  {
+    // Acquiring OpenCL buffer:
+    loc_error = clEnqueueAcquireGLObjects
+                (
+                 queue_id,                                                                          // Queue.
+                 1,                                                                                 // Number of memory objects.
+                 &loc_data->buffer,                                                                 // Memory object array.
+                 0,                                                                                 // Number of events in event list.
+                 NULL,                                                                              // Event list.
+                 NULL                                                                               // Event.
+                );
+
+    neutrino::check_error (loc_error);                                                              // Checking returned error code...
+  }
+
+  finish_cl ();                                                                                     // Waiting for OpenCL to finish...
+};
+
+void queue::acquire
+(
+ nu::double2* loc_data,                                                                             // Data object.
+ GLuint       loc_layout_index                                                                      // OpenGL shader layout index.
+)
+{
+  cl_int loc_error;                                                                                 // Local error code.
+
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
+  finish_cl ();                                                                                     // Waiting for OpenCL to finish...
+
+  // Checking layout index:
+  if(loc_layout_index != loc_data->layout)
+  {
+    neutrino::error ("Layout index mismatch!");                                                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  // Setting layout index in vertex shader...
+  glDisableVertexAttribArray (loc_layout_index);                                                    // Unbinding data array...
+
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
+
+  if(batched)
+  {
+    batch.push_back (loc_data->buffer);                                                             // Batching OpenCL buffer...
+  }
+
+  else
+  {
+    // Acquiring OpenCL buffer:
+    loc_error = clEnqueueAcquireGLObjects
+                (
+                 queue_id,                                                                          // Queue.
+                 1,                                                                                 // Number of memory objects.
+                 &loc_data->buffer,                                                                 // Memory object array.
+                 0,                                                                                 // Number of events in event list.
+                 NULL,                                                                              // Event list.
+                 NULL                                                                               // Event.
+                );
+
+    neutrino::check_error (loc_error);                                                              // Checking returned error code...
+  }
+
+  finish_cl ();                                                                                     // Waiting for OpenCL to finish...
+};
+
+void queue::acquire
+(
+ nu::double3* loc_data,                                                                             // Data object.
+ GLuint       loc_layout_index                                                                      // OpenGL shader layout index.
+)
+{
+  cl_int loc_error;                                                                                 // Local error code.
+
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
+  finish_cl ();                                                                                     // Waiting for OpenCL to finish...
+
+  // Checking layout index:
+  if(loc_layout_index != loc_data->layout)
+  {
+    neutrino::error ("Layout index mismatch!");                                                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  // Setting layout index in vertex shader...
+  glDisableVertexAttribArray (loc_layout_index);                                                    // Unbinding data array...
+
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
+
+  if(batched)
+  {
+    batch.push_back (loc_data->buffer);                                                             // Batching OpenCL buffer...
+  }
+
+  else
+  {
+    // Acquiring OpenCL buffer:
+    loc_error = clEnqueueAcquireGLObjects
+                (
+                 queue_id,                                                                          // Queue.
+                 1,                                                                                 // Number of memory objects.
+                 &loc_data->buffer,                                                                 // Memory object array.
+                 0,                                                                                 // Number of events in event list.
+                 NULL,                                                                              // Event list.
+                 NULL                                                                               // Event.
+                );
+
+    neutrino::check_error (loc_error);                                                              // Checking returned error code...
+  }
+
+  finish_cl ();                                                                                     // Waiting for OpenCL to finish...
+};
+
+void queue::acquire
+(
+ nu::double4* loc_data,                                                                             // Data object.
+ GLuint       loc_layout_index                                                                      // OpenGL shader layout index.
+)
+{
+  cl_int loc_error;                                                                                 // Local error code.
+
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
+  finish_cl ();                                                                                     // Waiting for OpenCL to finish...
+
+  // Checking layout index:
+  if(loc_layout_index != loc_data->layout)
+  {
+    neutrino::error ("Layout index mismatch!");                                                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  // Setting layout index in vertex shader...
+  glDisableVertexAttribArray (loc_layout_index);                                                    // Unbinding data array...
+
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
+
+  if(batched)
+  {
+    batch.push_back (loc_data->buffer);                                                             // Batching OpenCL buffer...
+  }
+
+  else
+  {
+    // Acquiring OpenCL buffer:
+    loc_error = clEnqueueAcquireGLObjects
+                (
+                 queue_id,                                                                          // Queue.
+                 1,                                                                                 // Number of memory objects.
+                 &loc_data->buffer,                                                                 // Memory object array.
+                 0,                                                                                 // Number of events in event list.
+                 NULL,                                                                              // Event list.
+                 NULL                                                                               // Event.
+                );
+
+    neutrino::check_error (loc_error);                                                              // Checking returned error code...
+  }
+
+  finish_cl ();                                                                                     // Waiting for OpenCL to finish...
+};
+
+void queue::release
+(
+ nu::int1* loc_data,                                                                                // Data object.
+ GLuint    loc_layout_index                                                                         // OpenGL shader layout index.
+)
+{
+  cl_int loc_error;                                                                                 // Local error code.
+
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
+  finish_cl ();                                                                                     // Waiting for OpenCL to finish...
+
+  // Checking layout index:
+  if(loc_layout_index != loc_data->layout)
+  {
+    neutrino::error ("Layout index mismatch!");                                                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  if(batched)
+  {
+    batch.push_back (loc_data->buffer);                                                             // Batching OpenCL buffer...
+  }
+
+  else
+  {
+    // Releasing openCL buffer:
+    loc_error = clEnqueueReleaseGLObjects
+                (
+                 queue_id,                                                                          // Queue.
+                 1,                                                                                 // Number of memory objects.
+                 &loc_data->buffer,                                                                 // Memory object array.
+                 0,                                                                                 // Number of events in event list.
+                 NULL,                                                                              // Event list.
+                 NULL                                                                               // Event.
+                );
+
+    neutrino::check_error (loc_error);                                                              // Checking returned error code...
+  }
+
+  finish_cl ();                                                                                     // Ensuring that all OpenCL has completed all operations...
+
+  glEnableVertexAttribArray (loc_layout_index);
+
+  // Binding data:
+  glBindBuffer (GL_SHADER_STORAGE_BUFFER, loc_data->ssbo);                                          // Binding SSBO...
+  glVertexAttribPointer
+  (
+   loc_layout_index,                                                                                // VAO index.
+   1,                                                                                               // Number of components of data vector.
+   GL_INT,                                                                                          // Data type.
+   GL_FALSE,                                                                                        // Fixed-point data normalization.
+   0,                                                                                               // Data stride.
+   0                                                                                                // Data offset.
+  );
+
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
+};
+
+void queue::release
+(
+ nu::int2* loc_data,                                                                                // Data object.
+ GLuint    loc_layout_index                                                                         // OpenGL shader layout index.
+)
+{
+  cl_int loc_error;                                                                                 // Local error code.
+
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
+  finish_cl ();                                                                                     // Waiting for OpenCL to finish...
+
+  // Checking layout index:
+  if(loc_layout_index != loc_data->layout)
+  {
+    neutrino::error ("Layout index mismatch!");                                                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  if(batched)
+  {
+    batch.push_back (loc_data->buffer);                                                             // Batching OpenCL buffer...
+  }
+
+  else
+  {
+    // Releasing openCL buffer:
+    loc_error = clEnqueueReleaseGLObjects
+                (
+                 queue_id,                                                                          // Queue.
+                 1,                                                                                 // Number of memory objects.
+                 &loc_data->buffer,                                                                 // Memory object array.
+                 0,                                                                                 // Number of events in event list.
+                 NULL,                                                                              // Event list.
+                 NULL                                                                               // Event.
+                );
+
+    neutrino::check_error (loc_error);                                                              // Checking returned error code...
+  }
+
+  finish_cl ();                                                                                     // Ensuring that all OpenCL has completed all operations...
+
+  glEnableVertexAttribArray (loc_layout_index);
+
+  // Binding data:
+  glBindBuffer (GL_SHADER_STORAGE_BUFFER, loc_data->ssbo);                                          // Binding SSBO...
+  glVertexAttribPointer
+  (
+   loc_layout_index,                                                                                // VAO index.
+   2,                                                                                               // Number of components of data vector.
+   GL_INT,                                                                                          // Data type.
+   GL_FALSE,                                                                                        // Fixed-point data normalization.
+   0,                                                                                               // Data stride.
+   0                                                                                                // Data offset.
+  );
+
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
+};
+
+void queue::release
+(
+ nu::int3* loc_data,                                                                                // Data object.
+ GLuint    loc_layout_index                                                                         // OpenGL shader layout index.
+)
+{
+  cl_int loc_error;                                                                                 // Local error code.
+
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
+  finish_cl ();                                                                                     // Waiting for OpenCL to finish...
+
+  // Checking layout index:
+  if(loc_layout_index != loc_data->layout)
+  {
+    neutrino::error ("Layout index mismatch!");                                                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  if(batched)
+  {
+    batch.push_back (loc_data->buffer);                                                             // Batching OpenCL buffer...
+  }
+
+  else
+  {
+    // Releasing openCL buffer:
+    loc_error = clEnqueueReleaseGLObjects
+                (
+                 queue_id,                                                                          // Queue.
+                 1,                                                                                 // Number of memory objects.
+                 &loc_data->buffer,                                                                 // Memory object array.
+                 0,                                                                                 // Number of events in event list.
+                 NULL,                                                                              // Event list.
+                 NULL                                                                               // Event.
+                );
+
+    neutrino::check_error (loc_error);                                                              // Checking returned error code...
+  }
+
+  finish_cl ();                                                                                     // Ensuring that all OpenCL has completed all operations...
+
+  glEnableVertexAttribArray (loc_layout_index);
+
+  // Binding data:
+  glBindBuffer (GL_SHADER_STORAGE_BUFFER, loc_data->ssbo);                                          // Binding SSBO...
+  glVertexAttribPointer
+  (
+   loc_layout_index,                                                                                // VAO index.
+   3,                                                                                               // Number of components of data vector.
+   GL_INT,                                                                                          // Data type.
+   GL_FALSE,                                                                                        // Fixed-point data normalization.
+   0,                                                                                               // Data stride.
+   0                                                                                                // Data offset.
+  );
+
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
+};
+
+void queue::release
+(
+ nu::int4* loc_data,                                                                                // Data object.
+ GLuint    loc_layout_index                                                                         // OpenGL shader layout index.
+)
+{
+  cl_int loc_error;                                                                                 // Local error code.
+
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
+  finish_cl ();                                                                                     // Waiting for OpenCL to finish...
+
+  // Checking layout index:
+  if(loc_layout_index != loc_data->layout)
+  {
+    neutrino::error ("Layout index mismatch!");                                                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  if(batched)
+  {
+    batch.push_back (loc_data->buffer);                                                             // Batching OpenCL buffer...
+  }
+
+  else
+  {
+    // Releasing openCL buffer:
+    loc_error = clEnqueueReleaseGLObjects
+                (
+                 queue_id,                                                                          // Queue.
+                 1,                                                                                 // Number of memory objects.
+                 &loc_data->buffer,                                                                 // Memory object array.
+                 0,                                                                                 // Number of events in event list.
+                 NULL,                                                                              // Event list.
+                 NULL                                                                               // Event.
+                );
+
+    neutrino::check_error (loc_error);                                                              // Checking returned error code...
+  }
+
+  finish_cl ();                                                                                     // Ensuring that all OpenCL has completed all operations...
+
+  glEnableVertexAttribArray (loc_layout_index);
+
+  // Binding data:
+  glBindBuffer (GL_SHADER_STORAGE_BUFFER, loc_data->ssbo);                                          // Binding SSBO...
+  glVertexAttribPointer
+  (
+   loc_layout_index,                                                                                // VAO index.
+   4,                                                                                               // Number of components of data vector.
+   GL_INT,                                                                                          // Data type.
+   GL_FALSE,                                                                                        // Fixed-point data normalization.
+   0,                                                                                               // Data stride.
+   0                                                                                                // Data offset.
+  );
+
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
+};
+
+void queue::release
+(
+ nu::float1* loc_data,                                                                              // Data object.
+ GLuint      loc_layout_index                                                                       // OpenGL shader layout index.
+)
+{
+  cl_int loc_error;                                                                                 // Local error code.
+
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
+  finish_cl ();                                                                                     // Waiting for OpenCL to finish...
+
+  // Checking layout index:
+  if(loc_layout_index != loc_data->layout)
+  {
+    neutrino::error ("Layout index mismatch!");                                                     // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  if(batched)
+  {
+    batch.push_back (loc_data->buffer);                                                             // Batching OpenCL buffer...
+  }
+
+  else
+  {
+    // Releasing openCL buffer:
+    loc_error = clEnqueueReleaseGLObjects
+                (
+                 queue_id,                                                                          // Queue.
+                 1,                                                                                 // Number of memory objects.
+                 &loc_data->buffer,                                                                 // Memory object array.
+                 0,                                                                                 // Number of events in event list.
+                 NULL,                                                                              // Event list.
+                 NULL                                                                               // Event.
+                );
+
+    neutrino::check_error (loc_error);                                                              // Checking returned error code...
+  }
+
+  finish_cl ();                                                                                     // Ensuring that all OpenCL has completed all operations...
+
+  glEnableVertexAttribArray (loc_layout_index);
+
+  // Binding data:
+  glBindBuffer (GL_SHADER_STORAGE_BUFFER, loc_data->ssbo);                                          // Binding SSBO...
+  glVertexAttribPointer
+  (
+   loc_layout_index,                                                                                // VAO index.
+   1,                                                                                               // Number of components of data vector.
+   GL_FLOAT,                                                                                        // Data type.
+   GL_FALSE,                                                                                        // Fixed-point data normalization.
+   0,                                                                                               // Data stride.
+   0                                                                                                // Data offset.
+  );
+
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
+};
+
+void queue::release
+(
+ nu::float2* loc_data,                                                                              // Data object.
  GLuint      loc_layout_index                                                                       // OpenGL shader layout index.
 )
 {
   cl_int loc_error;                                                                                 // Local error code.
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
-  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
+  finish_cl ();                                                                                     // Waiting for OpenCL to finish...
 
   // Checking layout index:
   if(loc_layout_index != loc_data->layout)
@@ -1054,28 +2723,47 @@ void queue::acquire
     exit (EXIT_FAILURE);                                                                            // Exiting...
   }
 
-  // Setting layout index in vertex shader...
-  glDisableVertexAttribArray (loc_layout_index);                                                    // Unbinding data array...
+  if(batched)
+  {
+    batch.push_back (loc_data->buffer);                                                             // Batching OpenCL buffer...
+  }
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  else
+  {
+    // Releasing openCL buffer:
+    loc_error = clEnqueueReleaseGLObjects
+                (
+                 queue_id,                                                                          // Queue.
+                 1,                                                                                 // Number of memory objects.
+                 &loc_data->buffer,                                                                 // Memory object array.
+                 0,                                                                                 // Number of events in event list.
+                 NULL,                                                                              // Event list.
+                 NULL                                                                               // Event.
+                );
+
+    neutrino::check_error (loc_error);                                                              // Checking returned error code...
+  }
 
-  // Acquiring OpenCL buffer:
-  loc_error = clEnqueueAcquireGLObjects
-              (
-               queue_id,                                                                            // Queue.
-               2,                                                                                   // Number of memory objects.
-               &loc_data->buffer,                                                                   // Memory object array.
-               0,                                                                                   // Number of events in event list.
-               NULL,                                                                                // Event list.
-               NULL                                                                                 // Event.
-              );
+  finish_cl ();                                                                                     // Ensuring that all OpenCL has completed all operations...
 
-  neutrino::check_error (loc_error);                                                                // Checking returned error code...
+  glEnableVertexAttribArray (loc_layout_index);
 
-  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+  // Binding data:
+  glBindBuffer (GL_SHADER_STORAGE_BUFFER, loc_data->ssbo);                                          // Binding SSBO...
+  glVertexAttribPointer
+  (
+   loc_layout_index,                                                                                // VAO index.
+   2,                                                                                               // Number of components of data vector.
+   GL_FLOAT,                                                                                        // Data type.
+   GL_FALSE,                                                                                        // Fixed-point data normalization.
+   0,                                                                                               // Data stride.
+   0                                                                                                // Data offset.
+  );
+
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
 };
 
-void queue::acquire
+void queue::release
 (
  nu::float3* loc_data,                                                                              // Data object.
  GLuint      loc_layout_index                                                                       // OpenGL shader layout index.
@@ -1083,8 +2771,8 @@ void queue::acquire
 {
   cl_int loc_error;                                                                                 // Local error code.
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
-  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
+  finish_cl ();                                                                                     // Waiting for OpenCL to finish...
 
   // Checking layout index:
   if(loc_layout_index != loc_data->layout)
@@ -1093,28 +2781,47 @@ void queue::acquire
     exit (EXIT_FAILURE);                                                                            // Exiting...
   }
 
-  // Setting layout index in vertex shader...
-  glDisableVertexAttribArray (loc_layout_index);                                                    // Unbinding data array...
+  if(batched)
+  {
+    batch.push_back (loc_data->buffer);                                                             // Batching OpenCL buffer...
+  }
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  else
+  {
+    // Releasing openCL buffer:
+    loc_error = clEnqueueReleaseGLObjects
+                (
+                 queue_id,                                                                          // Queue.
+                 1,                                                                                 // Number of memory objects.
+                 &loc_data->buffer,                                                                 // Memory object array.
+                 0,                                                                                 // Number of events in event list.
+                 NULL,                                                                              // Event list.
+                 NULL                                                                               // Event.
+                );
+
+    neutrino::check_error (loc_error);                                                              // Checking returned error code...
+  }
 
-  // Acquiring OpenCL buffer:
-  loc_error = clEnqueueAcquireGLObjects
-              (
-               queue_id,                                                                            // Queue.
-               3,                                                                                   // Number of memory objects.
-               &loc_data->buffer,                                                                   // Memory object array.
-               0,                                                                                   // Number of events in event list.
-               NULL,                                                                                // Event list.
-               NULL                                                                                 // Event.
-              );
+  finish_cl ();                                                                                     // Ensuring that all OpenCL has completed all operations...
 
-  neutrino::check_error (loc_error);                                                                // Checking returned error code...
+  glEnableVertexAttribArray (loc_layout_index);
 
-  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+  // Binding data:
+  glBindBuffer (GL_SHADER_STORAGE_BUFFER, loc_data->ssbo);                                          // Binding SSBO...
+  glVertexAttribPointer
+  (
+   loc_layout_index,                                                                                // VAO index.
+   3,                                                                                               // Number of components of data vector.
+   GL_FLOAT,                                                                                        // Data type.
+   GL_FALSE,                                                                                        // Fixed-point data normalization.
+   0,                                                                                               // Data stride.
+   0                                                                                                // Data offset.
+  );
+
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
 };
 
-void queue::acquire
+void queue::release
 (
  nu::float4* loc_data,                                                                              // Data object.
  GLuint      loc_layout_index                                                                       // OpenGL shader layout index.
@@ -1122,8 +2829,8 @@ void queue::acquire
 {
   cl_int loc_error;                                                                                 // Local error code.
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
-  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
+  finish_cl ();                                                                                     // Waiting for OpenCL to finish...
 
   // Checking layout index:
   if(loc_layout_index != loc_data->layout)
@@ -1132,37 +2839,56 @@ void queue::acquire
     exit (EXIT_FAILURE);                                                                            // Exiting...
   }
 
-  // Setting layout index in vertex shader...
-  glDisableVertexAttribArray (loc_layout_index);                                                    // Unbinding data array...
+  if(batched)
+  {
+    batch.push_back (loc_data->buffer);                                                             // Batching OpenCL buffer...
+  }
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  else
+  {
+    // Releasing openCL buffer:
+    loc_error = clEnqueueReleaseGLObjects
+                (
+                 queue_id,                                                                          // Queue.
+                 1,                                                                                 // Number of memory objects.
+                 &loc_data->buffer,                                                                 // Memory object array.
+                 0,                                                                                 // Number of events in event list.
+                 NULL,                                                                              // Event list.
+                 NULL                                                                               // Event.
+                );
+
+    neutrino::check_error (loc_error);                                                              // Checking returned error code...
+  }
 
-  // Acquiring OpenCL buffer:
-  loc_error = clEnqueueAcquireGLObjects
-              (
-               queue_id,                                                                            // Queue.
-               1,                                                                                   // Number of memory objects.
-               &loc_data->buffer,                                                                   // Memory object array.
-               0,                                                                                   // Number of events in event list.
-               NULL,                                                                                // Event list.
-               NULL                                                                                 // Event.
-              );
+  finish_cl ();                                                                                     // Ensuring that all OpenCL has completed all operations...
 
-  neutrino::check_error (loc_error);                                                                // Checking returned error code...
+  glEnableVertexAttribArray (loc_layout_index);
 
-  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+  // Binding data:
+  glBindBuffer (GL_SHADER_STORAGE_BUFFER, loc_data->ssbo);                                          // Binding SSBO...
+  glVertexAttribPointer
+  (
+   loc_layout_index,                                                                                // VAO index.
+   4,                                                                                               // Number of components of data vector.
+   GL_FLOAT,                                                                                        // Data type.
+   GL_FALSE,                                                                                        // Fixed-point data normalization.
+   0,                                                                                               // Data stride.
+   0                                                                                                // Data offset.
+  );
+
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
 };
 
 void queue::release
 (
- nu::int1* loc_data,                                                                                // Data object.
- GLuint    loc_layout_index                                                                         // OpenGL shader layout index.
+ nu::half1* loc_data,                                                                               // Data object.
+ GLuint     loc_layout_index                                                                        // OpenGL shader layout index.
 )
 {
   cl_int loc_error;                                                                                 // Local error code.
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
-  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
+  finish_cl ();                                                                                     // Waiting for OpenCL to finish...
 
   // Checking layout index:
   if(loc_layout_index != loc_data->layout)
@@ -1171,20 +2897,28 @@ void queue::release
     exit (EXIT_FAILURE);                                                                            // Exiting...
   }
 
-  // Releasing openCL buffer:
-  loc_error = clEnqueueReleaseGLObjects
-              (
-               queue_id,                                                                            // Queue.
-               1,                                                                                   // Number of memory objects.
-               &loc_data->buffer,                                                                   // Memory object array.
-               0,                                                                                   // Number of events in event list.
-               NULL,                                                                                // Event list.
-               NULL                                                                                 // Event.
-              );
+  if(batched)
+  {
+    batch.push_back (loc_data->buffer);                                                             // Batching OpenCL buffer...
+  }
 
-  neutrino::check_error (loc_error);                                                                // Checking returned error code...
+  else
+  {
+    // Releasing openCL buffer:
+    loc_error = clEnqueueReleaseGLObjects
+                (
+                 queue_id,                                                                          // Queue.
+                 1,                                                                                 // Number of memory objects.
+                 &loc_data->buffer,                                                                 // Memory object array.
+                 0,                                                                                 // Number of events in event list.
+                 NULL,                                                                              // Event list.
+                 NULL                                                                               // Event.
+                );
+
+    neutrino::check_error (loc_error);                                                              // Checking returned error code...
+  }
 
-  clFinish (queue_id);                                                                              // Ensuring that all OpenCL has completed all operations...
+  finish_cl ();                                                                                     // Ensuring that all OpenCL has completed all operations...
 
   glEnableVertexAttribArray (loc_layout_index);
 
@@ -1194,25 +2928,25 @@ void queue::release
   (
    loc_layout_index,                                                                                // VAO index.
    1,                                                                                               // Number of components of data vector.
-   GL_INT,                                                                                          // Data type.
+   GL_HALF_FLOAT,                                                                                   // Data type.
    GL_FALSE,                                                                                        // Fixed-point data normalization.
    0,                                                                                               // Data stride.
    0                                                                                                // Data offset.
   );
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
 };
 
 void queue::release
 (
- nu::int2* loc_data,                                                                                // Data object.
- GLuint    loc_layout_index                                                                         // OpenGL shader layout index.
+ nu::half4* loc_data,                                                                               // Data object.
+ GLuint     loc_layout_index                                                                        // OpenGL shader layout index.
 )
 {
   cl_int loc_error;                                                                                 // Local error code.
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
-  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
+  finish_cl ();                                                                                     // Waiting for OpenCL to finish...
 
   // Checking layout index:
   if(loc_layout_index != loc_data->layout)
@@ -1221,20 +2955,28 @@ void queue::release
     exit (EXIT_FAILURE);                                                                            // Exiting...
   }
 
-  // Releasing openCL buffer:
-  loc_error = clEnqueueReleaseGLObjects
-              (
-               queue_id,                                                                            // Queue.
-               1,                                                                                   // Number of memory objects.
-               &loc_data->buffer,                                                                   // Memory object array.
-               0,                                                                                   // Number of events in event list.
-               NULL,                                                                                // Event list.
-               NULL                                                                                 // Event.
-              );
+  if(batched)
+  {
+    batch.push_back (loc_data->buffer);                                                             // Batching OpenCL buffer...
+  }
 
-  neutrino::check_error (loc_error);                                                                // Checking returned error code...
+  else
+  {
+    // Releasing openCL buffer:
+    loc_error = clEnqueueReleaseGLObjects
+                (
+                 queue_id,                                                                          // Queue.
+                 1,                                                                                 // Number of memory objects.
+                 &loc_data->buffer,                                                                 // Memory object array.
+                 0,                                                                                 // Number of events in event list.
+                 NULL,                                                                              // Event list.
+                 NULL                                                                               // Event.
+                );
+
+    neutrino::check_error (loc_error);                                                              // Checking returned error code...
+  }
 
-  clFinish (queue_id);                                                                              // Ensuring that all OpenCL has completed all operations...
+  finish_cl ();                                                                                     // Ensuring that all OpenCL has completed all operations...
 
   glEnableVertexAttribArray (loc_layout_index);
 
@@ -1243,26 +2985,26 @@ void queue::release
   glVertexAttribPointer
   (
    loc_layout_index,                                                                                // VAO index.
-   2,                                                                                               // Number of components of data vector.
-   GL_INT,                                                                                          // Data type.
+   4,                                                                                               // Number of components of data vector.
+   GL_HALF_FLOAT,                                                                                   // Data type.
    GL_FALSE,                                                                                        // Fixed-point data normalization.
    0,                                                                                               // Data stride.
    0                                                                                                // Data offset.
   );
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
 };
 
 void queue::release
 (
- nu::int3* loc_data,                                                                                // Data object.
- GLuint    loc_layout_index                                                                         // OpenGL shader layout index.
+ nu::short4* loc_data,                                                                              // Data object.
+ GLuint      loc_layout_index                                                                       // OpenGL shader layout index.
 )
 {
   cl_int loc_error;                                                                                 // Local error code.
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
-  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
+  finish_cl ();                                                                                     // Waiting for OpenCL to finish...
 
   // Checking layout index:
   if(loc_layout_index != loc_data->layout)
@@ -1271,48 +3013,55 @@ void queue::release
     exit (EXIT_FAILURE);                                                                            // Exiting...
   }
 
-  // Releasing openCL buffer:
-  loc_error = clEnqueueReleaseGLObjects
-              (
-               queue_id,                                                                            // Queue.
-               1,                                                                                   // Number of memory objects.
-               &loc_data->buffer,                                                                   // Memory object array.
-               0,                                                                                   // Number of events in event list.
-               NULL,                                                                                // Event list.
-               NULL                                                                                 // Event.
-              );
+  if(batched)
+  {
+    batch.push_back (loc_data->buffer);                                                             // Batching OpenCL buffer...
+  }
 
-  neutrino::check_error (loc_error);                                                                // Checking returned error code...
+  else
+  {
+    // Releasing openCL buffer:
+    loc_error = clEnqueueReleaseGLObjects
+                (
+                 queue_id,                                                                          // Queue.
+                 1,                                                                                 // Number of memory objects.
+                 &loc_data->buffer,                                                                 // Memory object array.
+                 0,                                                                                 // Number of events in event list.
+                 NULL,                                                                              // Event list.
+                 NULL                                                                               // Event.
+                );
+
+    neutrino::check_error (loc_error);                                                              // Checking returned error code...
+  }
 
-  clFinish (queue_id);                                                                              // Ensuring that all OpenCL has completed all operations...
+  finish_cl ();                                                                                     // Ensuring that all OpenCL has completed all operations...
 
   glEnableVertexAttribArray (loc_layout_index);
 
   // Binding data:
   glBindBuffer (GL_SHADER_STORAGE_BUFFER, loc_data->ssbo);                                          // Binding SSBO...
-  glVertexAttribPointer
+  glVertexAttribIPointer
   (
    loc_layout_index,                                                                                // VAO index.
-   3,                                                                                               // Number of components of data vector.
-   GL_INT,                                                                                          // Data type.
-   GL_FALSE,                                                                                        // Fixed-point data normalization.
+   4,                                                                                               // Number of components of data vector.
+   GL_SHORT,                                                                                        // Data type.
    0,                                                                                               // Data stride.
    0                                                                                                // Data offset.
   );
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
 };
 
 void queue::release
 (
- nu::int4* loc_data,                                                                                // Data object.
- GLuint    loc_layout_index                                                                         // OpenGL shader layout index.
+ nu::uchar4* loc_data,                                                                              // Data object.
+ GLuint      loc_layout_index                                                                       // OpenGL shader layout index.
 )
 {
   cl_int loc_error;                                                                                 // Local error code.
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
-  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
+  finish_cl ();                                                                                     // Waiting for OpenCL to finish...
 
   // Checking layout index:
   if(loc_layout_index != loc_data->layout)
@@ -1321,20 +3070,28 @@ void queue::release
     exit (EXIT_FAILURE);                                                                            // Exiting...
   }
 
-  // Releasing openCL buffer:
-  loc_error = clEnqueueReleaseGLObjects
-              (
-               queue_id,                                                                            // Queue.
-               1,                                                                                   // Number of memory objects.
-               &loc_data->buffer,                                                                   // Memory object array.
-               0,                                                                                   // Number of events in event list.
-               NULL,                                                                                // Event list.
-               NULL                                                                                 // Event.
-              );
+  if(batched)
+  {
+    batch.push_back (loc_data->buffer);                                                             // Batching OpenCL buffer...
+  }
 
-  neutrino::check_error (loc_error);                                                                // Checking returned error code...
+  else
+  {
+    // Releasing openCL buffer:
+    loc_error = clEnqueueReleaseGLObjects
+                (
+                 queue_id,                                                                          // Queue.
+                 1,                                                                                 // Number of memory objects.
+                 &loc_data->buffer,                                                                 // Memory object array.
+                 0,                                                                                 // Number of events in event list.
+                 NULL,                                                                              // Event list.
+                 NULL                                                                               // Event.
+                );
+
+    neutrino::check_error (loc_error);                                                              // Checking returned error code...
+  }
 
-  clFinish (queue_id);                                                                              // Ensuring that all OpenCL has completed all operations...
+  finish_cl ();                                                                                     // Ensuring that all OpenCL has completed all operations...
 
   glEnableVertexAttribArray (loc_layout_index);
 
@@ -1344,25 +3101,25 @@ void queue::release
   (
    loc_layout_index,                                                                                // VAO index.
    4,                                                                                               // Number of components of data vector.
-   GL_INT,                                                                                          // Data type.
-   GL_FALSE,                                                                                        // Fixed-point data normalization.
+   GL_UNSIGNED_BYTE,                                                                                // Data type.
+   GL_TRUE,                                                                                         // Fixed-point data normalization.
    0,                                                                                               // Data stride.
    0                                                                                                // Data offset.
   );
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
 };
 
 void queue::release
 (
- nu::float1* loc_data,                                                                              // Data object.
- GLuint      loc_layout_index                                                                       // OpenGL shader layout index.
+ nu::double1* loc_data,                                                                             // Data object.
+ GLuint       loc_layout_index                                                                      // OpenGL shader layout index.
 )
 {
   cl_int loc_error;                                                                                 // Local error code.
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
-  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
+  finish_cl ();                                                                                     // Waiting for OpenCL to finish...
 
   // Checking layout index:
   if(loc_layout_index != loc_data->layout)
@@ -1371,48 +3128,55 @@ void queue::release
     exit (EXIT_FAILURE);                                                                            // Exiting...
   }
 
-  // Releasing openCL buffer:
-  loc_error = clEnqueueReleaseGLObjects
-              (
-               queue_id,                                                                            // Queue.
-               1,                                                                                   // Number of memory objects.
-               &loc_data->buffer,                                                                   // Memory object array.
-               0,                                                                                   // Number of events in event list.
-               NULL,                                                                                // Event list.
-               NULL                                                                                 // Event.
-              );
+  if(batched)
+  {
+    batch.push_back (loc_data->buffer);                                                             // Batching OpenCL buffer...
+  }
 
-  neutrino::check_error (loc_error);                                                                // Checking returned error code...
+  else
+  {
+    // Releasing openCL buffer:
+    loc_error = clEnqueueReleaseGLObjects
+                (
+                 queue_id,                                                                          // Queue.
+                 1,                                                                                 // Number of memory objects.
+                 &loc_data->buffer,                                                                 // Memory object array.
+                 0,                                                                                 // Number of events in event list.
+                 NULL,                                                                              // Event list.
+                 NULL                                                                               // Event.
+                );
+
+    neutrino::check_error (loc_error);                                                              // Checking returned error code...
+  }
 
-  clFinish (queue_id);                                                                              // Ensuring that all OpenCL has completed all operations...
+  finish_cl ();                                                                                     // Ensuring that all OpenCL has completed all operations...
 
   glEnableVertexAttribArray (loc_layout_index);
 
   // Binding data:
   glBindBuffer (GL_SHADER_STORAGE_BUFFER, loc_data->ssbo);                                          // Binding SSBO...
-  glVertexAttribPointer
+  glVertexAttribLPointer
   (
    loc_layout_index,                                                                                // VAO index.
    1,                                                                                               // Number of components of data vector.
-   GL_FLOAT,                                                                                        // Data type.
-   GL_FALSE,                                                                                        // Fixed-point data normalization.
+   GL_DOUBLE,                                                                                       // Data type.
    0,                                                                                               // Data stride.
    0                                                                                                // Data offset.
   );
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
 };
 
 void queue::release
 (
- nu::float2* loc_data,                                                                              // Data object.
- GLuint      loc_layout_index                                                                       // OpenGL shader layout index.
+ nu::double2* loc_data,                                                                             // Data object.
+ GLuint       loc_layout_index                                                                      // OpenGL shader layout index.
 )
 {
   cl_int loc_error;                                                                                 // Local error code.
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
-  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
+  finish_cl ();                                                                                     // Waiting for OpenCL to finish...
 
   // Checking layout index:
   if(loc_layout_index != loc_data->layout)
@@ -1421,48 +3185,55 @@ void queue::release
     exit (EXIT_FAILURE);                                                                            // Exiting...
   }
 
-  // Releasing openCL buffer:
-  loc_error = clEnqueueReleaseGLObjects
-              (
-               queue_id,                                                                            // Queue.
-               1,                                                                                   // Number of memory objects.
-               &loc_data->buffer,                                                                   // Memory object array.
-               0,                                                                                   // Number of events in event list.
-               NULL,                                                                                // Event list.
-               NULL                                                                                 // Event.
-              );
+  if(batched)
+  {
+    batch.push_back (loc_data->buffer);                                                             // Batching OpenCL buffer...
+  }
 
-  neutrino::check_error (loc_error);                                                                // Checking returned error code...
+  else
+  {
+    // Releasing openCL buffer:
+    loc_error = clEnqueueReleaseGLObjects
+                (
+                 queue_id,                                                                          // Queue.
+                 1,                                                                                 // Number of memory objects.
+                 &loc_data->buffer,                                                                 // Memory object array.
+                 0,                                                                                 // Number of events in event list.
+                 NULL,                                                                              // Event list.
+                 NULL                                                                               // Event.
+                );
+
+    neutrino::check_error (loc_error);                                                              // Checking returned error code...
+  }
 
-  clFinish (queue_id);                                                                              // Ensuring that all OpenCL has completed all operations...
+  finish_cl ();                                                                                     // Ensuring that all OpenCL has completed all operations...
 
   glEnableVertexAttribArray (loc_layout_index);
 
   // Binding data:
   glBindBuffer (GL_SHADER_STORAGE_BUFFER, loc_data->ssbo);                                          // Binding SSBO...
-  glVertexAttribPointer
+  glVertexAttribLPointer
   (
    loc_layout_index,                                                                                // VAO index.
    2,                                                                                               // Number of components of data vector.
-   GL_FLOAT,                                                                                        // Data type.
-   GL_FALSE,                                                                                        // Fixed-point data normalization.
+   GL_DOUBLE,                                                                                       // Data type.
    0,                                                                                               // Data stride.
    0                                                                                                // Data offset.
   );
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
 };
 
 void queue::release
 (
- nu::float3* loc_data,                                                                              // Data object.
- GLuint      loc_layout_index                                                                       // OpenGL shader layout index.
+ nu::double3* loc_data,                                                                             // Data object.
+ GLuint       loc_layout_index                                                                      // OpenGL shader layout index.
 )
 {
   cl_int loc_error;                                                                                 // Local error code.
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
-  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
+  finish_cl ();                                                                                     // Waiting for OpenCL to finish...
 
   // Checking layout index:
   if(loc_layout_index != loc_data->layout)
@@ -1471,48 +3242,55 @@ void queue::release
     exit (EXIT_FAILURE);                                                                            // Exiting...
   }
 
-  // Releasing openCL buffer:
-  loc_error = clEnqueueReleaseGLObjects
-              (
-               queue_id,                                                                            // Queue.
-               1,                                                                                   // Number of memory objects.
-               &loc_data->buffer,                                                                   // Memory object array.
-               0,                                                                                   // Number of events in event list.
-               NULL,                                                                                // Event list.
-               NULL                                                                                 // Event.
-              );
+  if(batched)
+  {
+    batch.push_back (loc_data->buffer);                                                             // Batching OpenCL buffer...
+  }
 
-  neutrino::check_error (loc_error);                                                                // Checking returned error code...
+  else
+  {
+    // Releasing openCL buffer:
+    loc_error = clEnqueueReleaseGLObjects
+                (
+                 queue_id,                                                                          // Queue.
+                 1,                                                                                 // Number of memory objects.
+                 &loc_data->buffer,                                                                 // Memory object array.
+                 0,                                                                                 // Number of events in event list.
+                 NULL,                                                                              // Event list.
+                 NULL                                                                               // Event.
+                );
+
+    neutrino::check_error (loc_error);                                                              // Checking returned error code...
+  }
 
-  clFinish (queue_id);                                                                              // Ensuring that all OpenCL has completed all operations...
+  finish_cl ();                                                                                     // Ensuring that all OpenCL has completed all operations...
 
   glEnableVertexAttribArray (loc_layout_index);
 
   // Binding data:
   glBindBuffer (GL_SHADER_STORAGE_BUFFER, loc_data->ssbo);                                          // Binding SSBO...
-  glVertexAttribPointer
+  glVertexAttribLPointer
   (
    loc_layout_index,                                                                                // VAO index.
    3,                                                                                               // Number of components of data vector.
-   GL_FLOAT,                                                                                        // Data type.
-   GL_FALSE,                                                                                        // Fixed-point data normalization.
+   GL_DOUBLE,                                                                                       // Data type.
    0,                                                                                               // Data stride.
    0                                                                                                // Data offset.
   );
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
 };
 
 void queue::release
 (
- nu::float4* loc_data,                                                                              // Data object.
- GLuint      loc_layout_index                                                                       // OpenGL shader layout index.
+ nu::double4* loc_data,                                                                             // Data object.
+ GLuint       loc_layout_index                                                                      // OpenGL shader layout index.
 )
 {
   cl_int loc_error;                                                                                 // Local error code.
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
-  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
+  finish_cl ();                                                                                     // Waiting for OpenCL to finish...
 
   // Checking layout index:
   if(loc_layout_index != loc_data->layout)
@@ -1521,52 +3299,117 @@ void queue::release
     exit (EXIT_FAILURE);                                                                            // Exiting...
   }
 
-  // Releasing openCL buffer:
-  loc_error = clEnqueueReleaseGLObjects
-              (
-               queue_id,                                                                            // Queue.
-               1,                                                                                   // Number of memory objects.
-               &loc_data->buffer,                                                                   // Memory object array.
-               0,                                                                                   // Number of events in event list.
-               NULL,                                                                                // Event list.
-               NULL                                                                                 // Event.
-              );
+  if(batched)
+  {
+    batch.push_back (loc_data->buffer);                                                             // Batching OpenCL buffer...
+  }
 
-  neutrino::check_error (loc_error);                                                                // Checking returned error code...
+  else
+  {
+    // Releasing openCL buffer:
+    loc_error = clEnqueueReleaseGLObjects
+                (
+                 queue_id,                                                                          // Queue.
+                 1,                                                                                 // Number of memory objects.
+                 &loc_data->buffer,                                                                 // Memory object array.
+                 0,                                                                                 // Number of events in event list.
+                 NULL,                                                                              // Event list.
+                 NULL                                                                               // Event.
+                );
+
+    neutrino::check_error (loc_error);                                                              // Checking returned error code...
+  }
 
-  clFinish (queue_id);                                                                              // Ensuring that all OpenCL has completed all operations...
+  finish_cl ();                                                                                     // Ensuring that all OpenCL has completed all operations...
 
   glEnableVertexAttribArray (loc_layout_index);
 
   // Binding data:
   glBindBuffer (GL_SHADER_STORAGE_BUFFER, loc_data->ssbo);                                          // Binding SSBO...
-  glVertexAttribPointer
+  glVertexAttribLPointer
   (
    loc_layout_index,                                                                                // VAO index.
    4,                                                                                               // Number of components of data vector.
-   GL_FLOAT,                                                                                        // Data type.
-   GL_FALSE,                                                                                        // Fixed-point data normalization.
+   GL_DOUBLE,                                                                                       // Data type.
    0,                                                                                               // Data stride.
    0                                                                                                // Data offset.
   );
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
 };
 
 queue::~queue()
 {
   cl_int loc_error;                                                                                 // Local error code.
 
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
-  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+  finish_gl ();                                                                                     // Waiting for OpenGL to finish (sync mode)...
+  finish_cl ();                                                                                     // Waiting for OpenCL to finish...
 
   neutrino::action ("releasing OpenCL command queue...");                                           // Printing message...
 
+  if(neutrino::queue_id == queue_id)
+  {
+    neutrino::queue_id = NULL;                                                                      // Resetting neutrino OpenCL queue ID...
+  }
+
   loc_error = clReleaseCommandQueue (queue_id);                                                     // Releasing OpenCL queue...
 
   neutrino::check_error (loc_error);                                                                // Checking error...
 
-  clFinish (queue_id);                                                                              // Waiting for OpenCL to finish...
+  finish_cl ();                                                                                     // Waiting for OpenCL to finish...
 
   neutrino::done ();                                                                                // Printing message...
 }
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////// "batch" functions //////////////////////////////////////////
+/////////////////////////////////////////////////////////////////////////////////////////////////////
+void queue::acquire_batch
+(
+ cl_uint         loc_events,                                                                        // Number of events in wait list.
+ const cl_event* loc_event_list                                                                     // Wait list.
+)
+{
+  cl_int loc_error;                                                                                 // Local error code.
+
+  if(!batch.empty ())
+  {
+    // Acquiring all batched OpenCL buffers at once:
+    loc_error = clEnqueueAcquireGLObjects
+                (
+                 queue_id,                                                                          // Queue.
+                 (cl_uint)batch.size (),                                                            // Number of memory objects.
+                 batch.data (),                                                                     // Memory object array.
+                 loc_events,                                                                        // Number of events in event list.
+                 loc_event_list,                                                                    // Event list.
+                 NULL                                                                               // Event.
+                );
+
+    neutrino::check_error (loc_error);                                                              // Checking returned error code...
+  }
+
+  batch.clear ();                                                                                   // Clearing batch...
+};
+
+void queue::release_batch ()
+{
+  cl_int loc_error;                                                                                 // Local error code.
+
+  if(!batch.empty ())
+  {
+    // Releasing all batched OpenCL buffers at once:
+    loc_error = clEnqueueReleaseGLObjects
+                (
+                 queue_id,                                                                          // Queue.
+                 (cl_uint)batch.size (),                                                            // Number of memory objects.
+                 batch.data (),                                                                     // Memory object array.
+                 0,                                                                                 // Number of events in event list.
+                 NULL,                                                                              // Event list.
+                 NULL                                                                               // Event.
+                );
+
+    neutrino::check_error (loc_error);                                                              // Checking returned error code...
+  }
+
+  batch.clear ();                                                                                   // Clearing batch...
+};
@@ -0,0 +1,340 @@
+/// @file     random.cpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Definition of a "random" number generator class.
+
+#include "random.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////// Device functions /////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// Counter convention: (element index, step low word, step high word, stream); key: seed words.
+static const char* nu_random_source = R"(
+#ifndef NU_RANDOM_ROUNDS
+#define NU_RANDOM_ROUNDS 10
+#endif
+
+#define NU_PHILOX_M0 0xD2511F53u
+#define NU_PHILOX_M1 0xCD9E8D57u
+#define NU_PHILOX_W0 0x9E3779B9u
+#define NU_PHILOX_W1 0xBB67AE85u
+
+inline uint4 nu_philox4x32 (uint4 c, uint2 k)
+{
+  uint hi0;
+  uint hi1;
+  uint lo0;
+  uint lo1;
+  int  r;
+
+  for(r = 0; r < NU_RANDOM_ROUNDS; r++)
+  {
+    hi0 = mul_hi (NU_PHILOX_M0, c.x);
+    lo0 = NU_PHILOX_M0*c.x;
+    hi1 = mul_hi (NU_PHILOX_M1, c.z);
+    lo1 = NU_PHILOX_M1*c.z;
+    c   = (uint4)(hi1 ^ c.y ^ k.x, lo1, hi0 ^ c.w ^ k.y, lo0);
+    k  += (uint2)(NU_PHILOX_W0, NU_PHILOX_W1);
+  }
+
+  return c;
+}
+
+inline float4 nu_uniform4 (uint4 c, uint2 k)
+{
+  uint4 x = nu_philox4x32 (c, k);
+
+  // 24 bit mantissa, open interval (0, 1):
+  return (convert_float4 (x >> 8) + 0.5f)*(1.0f/16777216.0f);
+}
+
+inline float4 nu_normal4 (uint4 c, uint2 k)
+{
+  float4 u = nu_uniform4 (c, k);
+  float2 r = sqrt (-2.0f*log (u.xz));
+  float2 a = 6.28318530717958647692f*u.yw;
+
+  return (float4)(r.x*cos (a.x), r.x*sin (a.x), r.y*cos (a.y), r.y*sin (a.y));
+}
+)";
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////// Fill kernels ///////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// Each work-item generates 4 consecutive values from one counter (block index = element index/4).
+static const char* nu_random_fill_source = R"(
+__kernel void nu_random_uniform (
+                                 const int       n,
+                                 const uint2     k,
+                                 const uint4     c,
+                                 const float     a,
+                                 const float     b,
+                                 __global float* y
+                                )
+{
+  int    i = get_global_id (0);
+  int    j = 4*i;
+  float4 u;
+
+  if(j < n)
+  {
+    u = a + (b - a)*nu_uniform4 ((uint4)(i, c.y, c.z, c.w), k);
+
+    y[j] = u.x;
+    if(j + 1 < n) y[j + 1] = u.y;
+    if(j + 2 < n) y[j + 2] = u.z;
+    if(j + 3 < n) y[j + 3] = u.w;
+  }
+}
+
+__kernel void nu_random_normal (
+                                const int       n,
+                                const uint2     k,
+                                const uint4     c,
+                                const float     a,
+                                const float     b,
+                                __global float* y
+                               )
+{
+  int    i = get_global_id (0);
+  int    j = 4*i;
+  float4 u;
+
+  if(j < n)
+  {
+    u = a + b*nu_normal4 ((uint4)(i, c.y, c.z, c.w), k);
+
+    y[j] = u.x;
+    if(j + 1 < n) y[j + 1] = u.y;
+    if(j + 2 < n) y[j + 2] = u.z;
+    if(j + 3 < n) y[j + 3] = u.w;
+  }
+}
+)";
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////// "random" class /////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+nu::random::random ()
+{
+  source         = nu_random_source;                                                                // Setting device functions source...
+  program        = NULL;                                                                            // Resetting generator program...
+  uniform_kernel = NULL;                                                                            // Resetting uniform distribution kernel...
+  normal_kernel  = NULL;                                                                            // Resetting normal distribution kernel...
+  seed           = NU_RANDOM_SEED;                                                                  // Setting default seed...
+  stream         = 0;                                                                               // Resetting stream...
+  step           = 0;                                                                               // Resetting step...
+  ready          = false;                                                                           // Resetting "ready" flag...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////// init ////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::random::init (
+                       cl_ulong loc_seed,                                                           // Generator seed.
+                       cl_uint  loc_stream                                                          // Generator stream.
+                      )
+{
+  cl_int      loc_error;                                                                            // Error code.
+  size_t      loc_log_size;                                                                         // OpenCL JIT compiler log size.
+  std::string loc_options;                                                                          // OpenCL JIT compiler options.
+  const char* loc_source[2] = {nu_random_source, nu_random_fill_source};                            // Program sources.
+
+  seed   = loc_seed;                                                                                // Setting seed...
+  stream = loc_stream;                                                                              // Setting stream...
+  step   = 0;                                                                                       // Resetting step...
+
+  neutrino::action ("building random number generator program...");                                 // Printing message...
+
+  program     = clCreateProgramWithSource
+                (
+                 neutrino::context_id,                                                              // OpenCL context ID.
+                 2,                                                                                 // Number of program sources.
+                 loc_source,                                                                        // Program sources.
+                 NULL,                                                                              // Source sizes (null terminated).
+                 &loc_error                                                                         // Error code.
+                );
+  neutrino::check_error (loc_error);                                                                // Checking error...
+
+  loc_options = std::string ("-D NU_RANDOM_ROUNDS=") + std::to_string (NU_RANDOM_ROUNDS);           // Setting compiler options...
+
+  loc_error   = clBuildProgram
+                (
+                 program,                                                                           // Program.
+                 1,                                                                                 // Number of devices.
+                 &neutrino::device_id,                                                              // Device ID.
+                 loc_options.c_str (),                                                              // Compiler options.
+                 NULL,                                                                              // Notification routine.
+                 NULL                                                                               // Notification argument.
+                );
+
+  if(loc_error != CL_SUCCESS)                                                                       // Checking compiled program...
+  {
+    neutrino::error (neutrino::get_error (loc_error));                                              // Printing message...
+
+    // Getting OpenCL compiler information:
+    clGetProgramBuildInfo
+    (
+     program,                                                                                       // Program.
+     neutrino::device_id,                                                                           // Device ID.
+     CL_PROGRAM_BUILD_LOG,                                                                          // Build log parameter.
+     0,                                                                                             // Dummy parameter size.
+     NULL,                                                                                          // Dummy parameter value.
+     &loc_log_size                                                                                  // Size of log.
+    );
+
+    std::string loc_log (loc_log_size + 1, '\0');                                                   // Log buffer.
+
+    // Reading OpenCL compiler error log:
+    clGetProgramBuildInfo
+    (
+     program,                                                                                       // Program.
+     neutrino::device_id,                                                                           // Device ID.
+     CL_PROGRAM_BUILD_LOG,                                                                          // Build log parameter.
+     loc_log_size + 1,                                                                              // Log size.
+     &loc_log[0],                                                                                   // The log.
+     NULL                                                                                           // Dummy size parameter.
+    );
+
+    std::cout << "" << std::endl;                                                                   // Printing message...
+    std::cout << "See error log:" << std::endl;                                                     // Printing message...
+    std::cout << "" << std::endl;                                                                   // Printing message...
+    std::cout << loc_log << std::endl;                                                              // Printing log...
+    exit (loc_error);                                                                               // Exiting...
+  }
+
+  uniform_kernel = clCreateKernel (program, "nu_random_uniform", &loc_error);                       // Creating uniform kernel...
+  neutrino::check_error (loc_error);                                                                // Checking error...
+
+  normal_kernel  = clCreateKernel (program, "nu_random_normal", &loc_error);                        // Creating normal kernel...
+  neutrino::check_error (loc_error);                                                                // Checking error...
+
+  ready          = true;                                                                            // Setting "ready" flag...
+
+  neutrino::done ();                                                                                // Printing message...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////// fill ////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::random::fill (
+                       cl_kernel loc_kernel,                                                        // Fill kernel.
+                       cl_mem    loc_buffer,                                                        // Data buffer.
+                       size_t    loc_size,                                                          // Number of values [#].
+                       GLfloat   loc_a,                                                             // First distribution parameter.
+                       GLfloat   loc_b                                                              // Second distribution parameter.
+                      )
+{
+  cl_int   loc_error;                                                                               // Error code.
+  cl_int   loc_n           = (cl_int)loc_size;                                                      // Number of values.
+  cl_uint2 loc_key;                                                                                 // Philox key.
+  cl_uint4 loc_counter;                                                                             // Philox counter.
+  size_t   loc_global_size = (loc_size + 3)/4;                                                      // One work-item every 4 values.
+
+  if(!ready)
+  {
+    neutrino::error ("random number generator not initialized!");                                   // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  if(loc_size == 0)
+  {
+    return;                                                                                         // Nothing to fill...
+  }
+
+  loc_key.s[0]     = (cl_uint)(seed & 0xFFFFFFFF);                                                  // Seed low word.
+  loc_key.s[1]     = (cl_uint)(seed >> 32);                                                         // Seed high word.
+  loc_counter.s[0] = 0;                                                                             // Element index (set by kernel).
+  loc_counter.s[1] = (cl_uint)(step & 0xFFFFFFFF);                                                  // Step low word.
+  loc_counter.s[2] = (cl_uint)(step >> 32);                                                         // Step high word.
+  loc_counter.s[3] = stream;                                                                        // Stream.
+
+  loc_error        = clSetKernelArg (loc_kernel, 0, sizeof(cl_int), &loc_n);
+  loc_error       |= clSetKernelArg (loc_kernel, 1, sizeof(cl_uint2), &loc_key);
+  loc_error       |= clSetKernelArg (loc_kernel, 2, sizeof(cl_uint4), &loc_counter);
+  loc_error       |= clSetKernelArg (loc_kernel, 3, sizeof(GLfloat), &loc_a);
+  loc_error       |= clSetKernelArg (loc_kernel, 4, sizeof(GLfloat), &loc_b);
+  loc_error       |= clSetKernelArg (loc_kernel, 5, sizeof(cl_mem), &loc_buffer);
+  neutrino::check_error (loc_error);                                                                // Checking error...
+
+  loc_error        = clEnqueueNDRangeKernel
+                     (
+                      neutrino::queue_id,                                                           // Queue ID.
+                      loc_kernel,                                                                   // Kernel ID.
+                      1,                                                                            // Kernel dimension.
+                      NULL,                                                                         // Global work offset.
+                      &loc_global_size,                                                             // Global work size.
+                      NULL,                                                                         // Local work size (any: the sequence does not depend on it).
+                      0,                                                                            // Number of events.
+                      NULL,                                                                         // Event list.
+                      NULL                                                                          // Event.
+                     );
+  neutrino::check_error (loc_error);                                                                // Checking error...
+
+  step++;                                                                                           // Advancing step (next fill gives new numbers)...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////// uniform //////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::random::uniform (
+                          nu::float1* loc_data,                                                     // Data.
+                          GLfloat     loc_min,                                                      // Minimum value.
+                          GLfloat     loc_max                                                       // Maximum value.
+                         )
+{
+  fill (uniform_kernel, loc_data->buffer, loc_data->data.size (), loc_min, loc_max);                // Filling buffer...
+}
+
+void nu::random::uniform (
+                          cl_mem  loc_buffer,                                                       // Data buffer.
+                          size_t  loc_size,                                                         // Number of values [#].
+                          GLfloat loc_min,                                                          // Minimum value.
+                          GLfloat loc_max                                                           // Maximum value.
+                         )
+{
+  fill (uniform_kernel, loc_buffer, loc_size, loc_min, loc_max);                                    // Filling buffer...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////// normal ///////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::random::normal (
+                         nu::float1* loc_data,                                                      // Data.
+                         GLfloat     loc_mean,                                                      // Mean value.
+                         GLfloat     loc_deviation                                                  // Standard deviation.
+                        )
+{
+  fill (normal_kernel, loc_data->buffer, loc_data->data.size (), loc_mean, loc_deviation);          // Filling buffer...
+}
+
+void nu::random::normal (
+                         cl_mem  loc_buffer,                                                        // Data buffer.
+                         size_t  loc_size,                                                          // Number of values [#].
+                         GLfloat loc_mean,                                                          // Mean value.
+                         GLfloat loc_deviation                                                      // Standard deviation.
+                        )
+{
+  fill (normal_kernel, loc_buffer, loc_size, loc_mean, loc_deviation);                              // Filling buffer...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////// DESTRUCTOR /////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+nu::random::~random ()
+{
+  if(uniform_kernel != NULL)
+  {
+    clReleaseKernel (uniform_kernel);                                                               // Releasing uniform distribution kernel...
+  }
+
+  if(normal_kernel != NULL)
+  {
+    clReleaseKernel (normal_kernel);                                                                // Releasing normal distribution kernel...
+  }
+
+  if(program != NULL)
+  {
+    clReleaseProgram (program);                                                                     // Releasing generator program...
+  }
+}
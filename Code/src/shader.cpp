@@ -5,11 +5,97 @@
 
 #include "shader.hpp"
 
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////// Culling compute shader //////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// Command layout: DrawElementsIndirectCommand (count, instances, first index, base vertex, base instance).
+static const char* nu_cull_source = R"(
+layout (local_size_x = NU_CULL_GROUP_SIZE) in;
+
+layout (std430) readonly buffer nu_cull_position {vec4 position[];};
+layout (std430) writeonly buffer nu_cull_index {uint index[];};
+layout (std430) buffer nu_cull_command {uint count; uint instances; uint first; int base_vertex; uint base_instance;};
+
+uniform mat4  V_mat;
+uniform mat4  P_mat;
+uniform uint  points;
+uniform float lod_distance;
+
+void main ()
+{
+  uint  i = gl_GlobalInvocationID.x;
+  vec4  v;
+  vec4  c;
+  float d;
+  uint  level;
+
+  if(i >= points) return;
+
+  v = V_mat*position[i];
+  c = P_mat*v;
+
+  // Frustum culling (clip space):
+  if((c.w <= 0.0) || any (greaterThan (abs (c.xyz), vec3 (c.w)))) return;
+
+  // Level of detail decimation (1 point every 2^level beyond lod_distance):
+  d = -v.z;
+
+  if((lod_distance > 0.0) && (d > lod_distance))
+  {
+    level = min (uint (log2 (d/lod_distance)) + 1u, uint (NU_CULL_MAX_LEVEL));
+
+    if((i & ((1u << level) - 1u)) != 0u) return;
+  }
+
+  index[atomicAdd (count, 1u)] = i;
+}
+)";
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////// Program binary cache //////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// FNV-1a 64 bit hash, used as program binary cache key.
+static uint64_t nu_shader_hash (
+                                const std::string& loc_data,                                        // Data.
+                                uint64_t           loc_hash                                         // Initial hash.
+                               )
+{
+  size_t i;                                                                                         // Byte index.
+
+  for(i = 0; i < loc_data.size (); i++)
+  {
+    loc_hash ^= (uint8_t)loc_data[i];                                                               // Adding byte...
+    loc_hash *= 0x100000001B3ull;                                                                   // Multiplying by FNV prime...
+  }
+
+  return loc_hash;
+}
+
 nu::shader::shader ()
 {
   neutrino::action ("initializing OpenGL shader object...");                                        // Printing message...
   glFinish ();                                                                                      // Waiting for OpenGL to finish...
   program = glCreateProgram ();                                                                     // Creating program...
+  V_mat_location  = -1;                                                                             // Resetting uniform location...
+  P_mat_location  = -1;                                                                             // Resetting uniform location...
+  size_x_location = -1;                                                                             // Resetting uniform location...
+  size_y_location = -1;                                                                             // Resetting uniform location...
+  AR_location     = -1;                                                                             // Resetting uniform location...
+  camera_block    = GL_INVALID_INDEX;                                                               // Resetting uniform block index...
+  primitive       = NU_PLOT_POINTS;                                                                 // Setting default plot primitive...
+  element_buffer  = 0;                                                                              // Resetting element buffer...
+  element_size    = 0;                                                                              // Resetting element buffer size...
+  glyph_size      = 0;                                                                              // Resetting glyph size...
+  culling         = false;                                                                          // Resetting frustum culling flag...
+  cull_program    = 0;                                                                              // Resetting culling program...
+  cull_position   = 0;                                                                              // Resetting culling position buffer...
+  cull_size       = 0;                                                                              // Resetting culling capacity...
+  command_buffer  = 0;                                                                              // Resetting indirect draw command buffer...
+  cull_binding    = 0;                                                                              // Resetting culling binding point...
+  lod_distance    = 0.0f;                                                                           // Resetting level of detail distance...
+  cache_path      = "";                                                                             // Resetting program binary cache...
+  pending         = false;                                                                          // Resetting "changed sources" flag...
+  watching        = false;                                                                          // Resetting "watcher running" flag...
   glFinish ();                                                                                      // Waiting for OpenGL to finish...
   neutrino::done ();                                                                                // Printing message...
 }
@@ -19,29 +105,30 @@ void nu::shader::addsource
  std::string loc_shader_filename,                                                                   // GLSL shader file name.
  shader_type loc_shader_type                                                                        // GLSL shader type.
 )
+{
+  std::error_code loc_error;                                                                        // File system error code.
+
+  neutrino::action ("loading OpenGL shader source from file...");                                   // Printing message...
+  source_file.push_back (loc_shader_filename);                                                      // Adding source file name...
+  source_type.push_back (loc_shader_type);                                                          // Adding source type...
+  source.push_back (neutrino::read_file (loc_shader_filename));                                     // Loading shader from file...
+  source_time.push_back (std::filesystem::last_write_time (loc_shader_filename, loc_error));        // Getting modification time...
+  neutrino::done ();                                                                                // Printing message...
+}
+
+GLuint nu::shader::compile
+(
+ std::string loc_shader_source,                                                                     // Shader source.
+ shader_type loc_shader_type                                                                        // Shader type.
+)
 {
   GLuint      loc_shader;                                                                           // Shader.
-  std::string loc_shader_source;                                                                    // Shader source.
-  GLchar**    loc_shader_source_c;                                                                  // Shader source, C style string.
-  GLint*      loc_shader_source_c_size;                                                             // Shader source size.
+  const char* loc_shader_source_c;                                                                  // Shader source, C style string.
+  GLint       loc_shader_source_c_size;                                                             // Shader source size.
   GLint       loc_success;                                                                          // "GL_COMPILE_STATUS" flag.
   GLchar*     loc_log;                                                                              // Buffer for OpenGL error log.
   GLsizei     loc_log_size;                                                                         // Size of OpenGL error log.
 
-  neutrino::action ("loading OpenGL shader source from file...");                                   // Printing message...
-
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
-
-  // Loading shader from file:
-  loc_shader_source           = neutrino::read_file (
-                                                     loc_shader_filename                            // Shader file.
-                                                    );
-  loc_shader_source_c         = new char*[1]();                                                     // Building temporary shader source char buffer...
-  loc_shader_source_c[0]      = new char[loc_shader_source.size ()]();                              // Building temporary source char buffer...
-  loc_shader_source.copy (loc_shader_source_c[0], loc_shader_source.size ());                       // Building string source buffer...
-  loc_shader_source_c_size    = new GLint[1]();                                                     // Building shader source size array...
-  loc_shader_source_c_size[0] = loc_shader_source.size ();                                          // Setting shader source size...
-
   // Selecting shader type:
   switch(loc_shader_type)
   {
@@ -58,25 +145,18 @@ void nu::shader::addsource
       break;
   }
 
-  neutrino::done ();                                                                                // Printing message...
-
-  neutrino::action ("attaching OpenGL shader source to shader object...");                          // Printing message...
+  loc_shader_source_c      = loc_shader_source.c_str ();                                            // Getting C style source...
+  loc_shader_source_c_size = (GLint)loc_shader_source.size ();                                      // Getting source size...
 
   // Attaching source code to shader:
   glShaderSource
   (
    loc_shader,                                                                                      // GLSL shader.
    1,                                                                                               // Number of shaders.
-   (const GLchar**)loc_shader_source_c,                                                             // Shader source.
-   loc_shader_source_c_size                                                                         // Shader size: NULL = null-terminated string.
+   &loc_shader_source_c,                                                                            // Shader source.
+   &loc_shader_source_c_size                                                                        // Shader size.
   );
 
-  neutrino::done ();                                                                                // Printing message...
-
-  delete[] loc_shader_source_c;                                                                     // Deleting buffer...
-  delete[] loc_shader_source_c_size;                                                                // Deleting buffer size array...
-
-  neutrino::action ("compiling OpenGL shader...");                                                  // Printing message...
   glCompileShader (loc_shader);                                                                     // Compiling shader...
 
   // Reading "GL_COMPILE_STATUS" flag:
@@ -96,86 +176,605 @@ void nu::shader::addsource
     std::string loc_log_string (loc_log);
     std::cout << loc_log_string << std::endl;                                                       // Printing log...
     free (loc_log);                                                                                 // Freeing log...
-    exit (1);                                                                                       // Exiting...
+    glDeleteShader (loc_shader);                                                                    // Deleting shader...
+    return 0;
   }
 
-  neutrino::done ();                                                                                // Printing message...
+  return loc_shader;
+}
 
-  neutrino::action ("attaching OpenGL shader to OpenGL program...");                                // Printing message...
-  glAttachShader (program, loc_shader);                                                             // Attaching shader to program...
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
-  neutrino::done ();                                                                                // Printing message...
+bool nu::shader::link
+(
+ std::vector<std::string>& loc_source                                                               // Shader sources.
+)
+{
+  uint64_t             loc_hash;                                                                    // Program binary cache key.
+  std::string          loc_cache_file;                                                              // Program binary cache file.
+  std::string          loc_binding;                                                                 // Attribute binding (name@location).
+  std::ifstream        loc_cache_in;                                                                // Program binary cache input file.
+  std::ofstream        loc_cache_out;                                                               // Program binary cache output file.
+  std::vector<GLubyte> loc_binary;                                                                  // Program binary.
+  GLenum               loc_format;                                                                  // Program binary format.
+  GLint                loc_formats;                                                                 // Number of program binary formats.
+  GLint                loc_size;                                                                    // Program binary size.
+  std::vector<GLuint>  loc_shader;                                                                  // Compiled shaders.
+  GLint                loc_success;                                                                 // "GL_LINK_STATUS" flag.
+  GLchar*              loc_log;                                                                     // Buffer for OpenGL error log.
+  GLsizei              loc_log_size;                                                                // Size of OpenGL error log.
+  size_t               i;                                                                           // Index.
+
+  glGetIntegerv (GL_NUM_PROGRAM_BINARY_FORMATS, &loc_formats);                                      // Getting number of binary formats...
+
+  if((cache_path != "") && (loc_formats > 0))
+  {
+    // Hashing driver strings, attribute bindings and sources:
+    loc_hash = 0xCBF29CE484222325ull;                                                               // Setting FNV offset basis...
+    loc_hash = nu_shader_hash ((const char*)glGetString (GL_VENDOR), loc_hash);                     // Hashing driver vendor...
+    loc_hash = nu_shader_hash ((const char*)glGetString (GL_RENDERER), loc_hash);                   // Hashing driver renderer...
+    loc_hash = nu_shader_hash ((const char*)glGetString (GL_VERSION), loc_hash);                    // Hashing driver version...
+
+    for(i = 0; i < loc_source.size (); i++)
+    {
+      loc_hash = nu_shader_hash (std::to_string (source_type[i]) + loc_source[i], loc_hash);        // Hashing source...
+    }
+
+    for(i = 0; i < neutrino::container.size (); i++)
+    {
+      loc_binding = std::string ("arg_") + std::to_string (i) + "@" + std::to_string (i);           // Setting attribute binding (see bindargs)...
+      loc_hash    = nu_shader_hash (loc_binding, loc_hash);                                         // Hashing attribute binding...
+    }
+
+    std::ostringstream loc_key;                                                                     // Cache key.
+    loc_key << std::hex << std::setw (16) << std::setfill ('0') << loc_hash;
+    loc_cache_file = cache_path + "/nu_shader_" + loc_key.str () + ".bin";                          // Setting cache file name...
+
+    // Loading program binary from cache:
+    loc_cache_in.open (loc_cache_file, std::ios::in | std::ios::binary);
+
+    if(loc_cache_in)
+    {
+      loc_cache_in.read ((char*)&loc_format, sizeof(GLenum));                                       // Reading binary format...
+      loc_binary.assign (std::istreambuf_iterator<char>(loc_cache_in), std::istreambuf_iterator<char>());
+      loc_cache_in.close ();
+      glProgramBinary (program, loc_format, loc_binary.data (), (GLsizei)loc_binary.size ());       // Loading program binary...
+      glGetProgramiv (program, GL_LINK_STATUS, &loc_success);                                       // Reading "GL_LINK_STATUS" flag...
+
+      if(loc_success)
+      {
+        return true;                                                                                // Cache hit: skipping compilation...
+      }
+
+      neutrino::warning ("stale OpenGL program binary, rebuilding from sources!");                  // Printing message...
+    }
+  }
+
+  // Compiling shaders:
+  for(i = 0; i < loc_source.size (); i++)
+  {
+    loc_shader.push_back (compile (loc_source[i], source_type[i]));                                 // Compiling shader...
+
+    if(loc_shader.back () == 0)
+    {
+      std::cout << "Error: shader " << source_file[i] << " not compiled!" << std::endl;             // Printing message...
+      break;
+    }
+
+    glAttachShader (program, loc_shader.back ());                                                   // Attaching shader to program...
+  }
+
+  loc_success = (!loc_shader.empty () && (loc_shader.back () != 0)) ? GL_TRUE : GL_FALSE;           // Checking compilation...
+
+  if(loc_success)
+  {
+    glProgramParameteri (program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);                     // Allowing binary retrieval...
+    glLinkProgram (program);                                                                        // Linking program...
+    glGetProgramiv (program, GL_LINK_STATUS, &loc_success);                                         // Reading "GL_LINK_STATUS" flag...
+
+    if(!loc_success)
+    {
+      glGetProgramiv (program, GL_INFO_LOG_LENGTH, &loc_log_size);                                  // Getting log length...
+      loc_log = (char*) calloc (loc_log_size + 1, sizeof(GLchar));                                  // Allocating temporary buffer for log...
+      glGetProgramInfoLog (program, loc_log_size + 1, NULL, loc_log);                               // Getting log...
+      std::string loc_log_string (loc_log);
+      std::cout << loc_log_string << std::endl;                                                     // Printing log...
+      free (loc_log);                                                                               // Freeing log...
+    }
+  }
+
+  // Releasing shaders (owned by the program once linked):
+  for(i = 0; i < loc_shader.size (); i++)
+  {
+    if(loc_shader[i] != 0)
+    {
+      glDetachShader (program, loc_shader[i]);                                                      // Detaching shader...
+      glDeleteShader (loc_shader[i]);                                                               // Deleting shader...
+    }
+  }
+
+  if(loc_success && (loc_cache_file != ""))
+  {
+    // Saving program binary to cache:
+    glGetProgramiv (program, GL_PROGRAM_BINARY_LENGTH, &loc_size);                                  // Getting binary size...
+    loc_binary.resize (loc_size);
+    glGetProgramBinary (program, loc_size, NULL, &loc_format, loc_binary.data ());                  // Getting program binary...
+    loc_cache_out.open (loc_cache_file, std::ios::out | std::ios::binary);
+
+    if(loc_cache_out)
+    {
+      loc_cache_out.write ((const char*)&loc_format, sizeof(GLenum));                               // Writing binary format...
+      loc_cache_out.write ((const char*)loc_binary.data (), loc_binary.size ());                    // Writing binary...
+      loc_cache_out.close ();
+    }
+
+    else
+    {
+      neutrino::warning ("OpenGL program binary cache not writable!");                              // Printing message...
+    }
+  }
+
+  return loc_success;
 }
 
-void nu::shader::build (
-                        size_t loc_points                                                           // Number of points to be rendered...
-                       )
+void nu::shader::resolve ()
 {
-  size_t i;                                                                                         // Index.
+  GLint   loc_attributes = 0;                                                                       // Number of active attributes [#].
+  GLchar  loc_name[256];                                                                            // Attribute name.
+  GLsizei loc_length;                                                                               // Attribute name length.
+  GLint   loc_size;                                                                                 // Attribute array size [#].
+  GLenum  loc_type;                                                                                 // Attribute type.
+  GLint   loc_location;                                                                             // Attribute location.
+  GLint   i;                                                                                        // Attribute index.
+  GLint   j;                                                                                        // Attribute array index.
+
+  camera_block    = glGetUniformBlockIndex (program, NU_CAMERA_BLOCK);                              // Getting camera block index...
+  V_mat_location  = -1;                                                                             // Resetting uniform location...
+  P_mat_location  = -1;                                                                             // Resetting uniform location...
+  size_x_location = -1;                                                                             // Resetting uniform location...
+  size_y_location = -1;                                                                             // Resetting uniform location...
+  AR_location     = -1;                                                                             // Resetting uniform location...
+
+  if(camera_block != GL_INVALID_INDEX)
+  {
+    glUniformBlockBinding (program, camera_block, NU_CAMERA_BINDING);                               // Binding camera block...
+  }
 
-  neutrino::action ("linking OpenGL shader sources...");                                            // Printing message...
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
-  glLinkProgram (program);                                                                          // Linking program...
-  glFinish ();                                                                                      // Waiting for OpenGL to finish...
-  neutrino::done ();                                                                                // Printing message...
+  else
+  {
+    V_mat_location  = glGetUniformLocation (program, "V_mat");                                      // Getting view matrix location...
+    P_mat_location  = glGetUniformLocation (program, "P_mat");                                      // Getting projection matrix location...
+    size_x_location = glGetUniformLocation (program, "size_x");                                     // Getting framebuffer x-size location...
+    size_y_location = glGetUniformLocation (program, "size_y");                                     // Getting framebuffer y-size location...
+    AR_location     = glGetUniformLocation (program, "AR");                                         // Getting aspect ratio location...
+  }
 
-  size = loc_points;                                                                                // Setting shader size...
+  // Getting the active attribute locations (per-instance attributes of the glyphs):
+  glyph_attribute.clear ();
+  glGetProgramiv (program, GL_ACTIVE_ATTRIBUTES, &loc_attributes);                                  // Getting number of active attributes...
 
-  // Setting shader arguments:
-  neutrino::action ("setting OpenGL shader arguments...");                                          // Printing message...
+  for(i = 0; i < loc_attributes; i++)
+  {
+    glGetActiveAttrib (program, (GLuint)i, sizeof(loc_name), &loc_length, &loc_size, &loc_type, loc_name);
+    loc_location = glGetAttribLocation (program, loc_name);                                         // Getting attribute location...
+
+    for(j = 0; (loc_location >= 0) && (j < loc_size); j++)                                          // Skipping built-in attributes (e.g. gl_VertexID)...
+    {
+      glyph_attribute.push_back ((GLuint)(loc_location + j));                                       // Adding attribute location...
+    }
+  }
+}
+
+void nu::shader::bindargs ()
+{
+  size_t i;                                                                                         // Index.
 
   for(i = 0; i < neutrino::container.size (); i++)
   {
     switch(container[i]->type)
     {
       case NU_INT:
-        ((nu::int1*)neutrino::container[i])->name   = std::string ("arg_") + std::to_string (i);
+        ((nu::int1*)neutrino::container[i])->name    = std::string ("arg_") + std::to_string (i);
         this->setarg ((nu::int1*)neutrino::container[i], i);
         break;
 
       case NU_INT2:
-        ((nu::int2*)neutrino::container[i])->name   = std::string ("arg_") + std::to_string (i);
+        ((nu::int2*)neutrino::container[i])->name    = std::string ("arg_") + std::to_string (i);
         this->setarg ((nu::int2*)neutrino::container[i], i);
         break;
 
       case NU_INT3:
-        ((nu::int3*)neutrino::container[i])->name   = std::string ("arg_") + std::to_string (i);
+        ((nu::int3*)neutrino::container[i])->name    = std::string ("arg_") + std::to_string (i);
         this->setarg ((nu::int3*)neutrino::container[i], i);
         break;
 
       case NU_INT4:
-        ((nu::int4*)neutrino::container[i])->name   = std::string ("arg_") + std::to_string (i);
+        ((nu::int4*)neutrino::container[i])->name    = std::string ("arg_") + std::to_string (i);
         this->setarg ((nu::int4*)neutrino::container[i], i);
         break;
 
       case NU_FLOAT:
-        ((nu::float1*)neutrino::container[i])->name = std::string ("arg_") + std::to_string (i);
+        ((nu::float1*)neutrino::container[i])->name  = std::string ("arg_") + std::to_string (i);
         this->setarg ((nu::float1*)neutrino::container[i], i);
         break;
 
       case NU_FLOAT2:
-        ((nu::float2*)neutrino::container[i])->name = std::string ("arg_") + std::to_string (i);
+        ((nu::float2*)neutrino::container[i])->name  = std::string ("arg_") + std::to_string (i);
         this->setarg ((nu::float2*)neutrino::container[i], i);
         break;
 
       case NU_FLOAT3:
-        ((nu::float3*)neutrino::container[i])->name = std::string ("arg_") + std::to_string (i);
+        ((nu::float3*)neutrino::container[i])->name  = std::string ("arg_") + std::to_string (i);
         this->setarg ((nu::float3*)neutrino::container[i], i);
         break;
 
       case NU_FLOAT4:
-        ((nu::float4*)neutrino::container[i])->name = std::string ("arg_") + std::to_string (i);
+        ((nu::float4*)neutrino::container[i])->name  = std::string ("arg_") + std::to_string (i);
         this->setarg ((nu::float4*)neutrino::container[i], i);
         break;
+
+      case NU_HALF:
+        ((nu::half1*)neutrino::container[i])->name   = std::string ("arg_") + std::to_string (i);
+        this->setarg ((nu::half1*)neutrino::container[i], i);
+        break;
+
+      case NU_HALF4:
+        ((nu::half4*)neutrino::container[i])->name   = std::string ("arg_") + std::to_string (i);
+        this->setarg ((nu::half4*)neutrino::container[i], i);
+        break;
+
+      case NU_SHORT4:
+        ((nu::short4*)neutrino::container[i])->name  = std::string ("arg_") + std::to_string (i);
+        this->setarg ((nu::short4*)neutrino::container[i], i);
+        break;
+
+      case NU_UCHAR4:
+        ((nu::uchar4*)neutrino::container[i])->name  = std::string ("arg_") + std::to_string (i);
+        this->setarg ((nu::uchar4*)neutrino::container[i], i);
+        break;
+
+      case NU_DOUBLE:
+        ((nu::double1*)neutrino::container[i])->name = std::string ("arg_") + std::to_string (i);
+        this->setarg ((nu::double1*)neutrino::container[i], i);
+        break;
+
+      case NU_DOUBLE2:
+        ((nu::double2*)neutrino::container[i])->name = std::string ("arg_") + std::to_string (i);
+        this->setarg ((nu::double2*)neutrino::container[i], i);
+        break;
+
+      case NU_DOUBLE3:
+        ((nu::double3*)neutrino::container[i])->name = std::string ("arg_") + std::to_string (i);
+        this->setarg ((nu::double3*)neutrino::container[i], i);
+        break;
+
+      case NU_DOUBLE4:
+        ((nu::double4*)neutrino::container[i])->name = std::string ("arg_") + std::to_string (i);
+        this->setarg ((nu::double4*)neutrino::container[i], i);
+        break;
+    }
+  }
+}
+
+void nu::shader::build (
+                        size_t loc_points                                                           // Number of points to be rendered...
+                       )
+{
+  // Setting shader arguments (attribute bindings take effect at link time):
+  neutrino::action ("setting OpenGL shader arguments...");                                          // Printing message...
+  bindargs ();                                                                                      // Binding arguments...
+  neutrino::done ();                                                                                // Printing message...
+
+  neutrino::action ("linking OpenGL shader sources...");                                            // Printing message...
+  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+
+  if(!link (source))
+  {
+    neutrino::error ("OpenGL shader not built!");                                                   // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+  neutrino::done ();                                                                                // Printing message...
+
+  // Resolving camera uniforms (once, instead of at each plot):
+  neutrino::action ("resolving OpenGL shader uniforms...");                                         // Printing message...
+  resolve ();                                                                                       // Resolving uniforms...
+  neutrino::done ();                                                                                // Printing message...
+
+  size = loc_points;                                                                                // Setting shader size...
+}
+
+void nu::shader::setcache (
+                           std::string loc_cache_path                                               // Program binary cache directory.
+                          )
+{
+  std::error_code loc_error;                                                                        // File system error code.
+
+  std::filesystem::create_directories (loc_cache_path, loc_error);                                  // Creating cache directory...
+
+  if(loc_error)
+  {
+    neutrino::warning ("OpenGL program binary cache directory not available!");                     // Printing message...
+    return;
+  }
+
+  cache_path = loc_cache_path;                                                                      // Setting cache directory...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////// Hot reload ////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::shader::loop ()
+{
+  std::filesystem::file_time_type loc_time;                                                         // Source file modification time.
+  std::vector<std::string>        loc_source;                                                       // Changed sources.
+  std::error_code                 loc_error;                                                        // File system error code.
+  bool                            loc_changed;                                                      // "Changed sources" flag.
+  size_t                          i;                                                                // Source index.
+
+  while(watching)
+  {
+    std::this_thread::sleep_for (std::chrono::milliseconds (NU_SHADER_WATCH_PERIOD));               // Waiting for next poll...
+    loc_changed = false;                                                                            // Resetting "changed sources" flag...
+
+    for(i = 0; i < source_file.size (); i++)
+    {
+      loc_time = std::filesystem::last_write_time (source_file[i], loc_error);                      // Getting modification time...
+
+      if(!loc_error && (loc_time != source_time[i]))
+      {
+        source_time[i] = loc_time;                                                                  // Updating modification time...
+        loc_changed    = true;                                                                      // Setting "changed sources" flag...
+      }
+    }
+
+    if(loc_changed)
+    {
+      loc_source.clear ();
+
+      for(i = 0; i < source_file.size (); i++)
+      {
+        loc_source.push_back (neutrino::read_file (source_file[i]));                                // Reading source...
+      }
+
+      std::lock_guard<std::mutex> loc_lock (pending_lock);                                          // Locking changed sources...
+      pending_source = loc_source;                                                                  // Setting changed sources...
+      pending        = true;                                                                        // Setting "changed sources" flag...
     }
   }
+}
 
+void nu::shader::watch (
+                        bool loc_watch                                                              // "Watch" flag.
+                       )
+{
+  if(loc_watch && !watching)
+  {
+    watching = true;                                                                                // Setting "watcher running" flag...
+    watcher  = std::thread (&nu::shader::loop, this);                                               // Starting watcher thread...
+  }
+
+  if(!loc_watch && watching)
+  {
+    watching = false;                                                                               // Resetting "watcher running" flag...
+    watcher.join ();                                                                                // Waiting for watcher thread...
+  }
+}
+
+bool nu::shader::reload ()
+{
+  std::vector<std::string> loc_source;                                                              // Changed sources.
+  GLuint                   loc_program;                                                             // Current program.
+
+  if(!pending)
+  {
+    return false;                                                                                   // Nothing changed: keeping program...
+  }
+
+  {
+    std::lock_guard<std::mutex> loc_lock (pending_lock);                                            // Locking changed sources...
+    loc_source = pending_source;                                                                    // Getting changed sources...
+    pending    = false;                                                                             // Resetting "changed sources" flag...
+  }
+
+  neutrino::action ("reloading OpenGL shader...");                                                  // Printing message...
+  loc_program = program;                                                                            // Saving current program...
+  program     = glCreateProgram ();                                                                 // Creating new program...
+  bindargs ();                                                                                      // Binding arguments...
+
+  if(!link (loc_source))
+  {
+    glDeleteProgram (program);                                                                      // Deleting new program...
+    program = loc_program;                                                                          // Restoring current program...
+    neutrino::warning ("OpenGL shader not reloaded: keeping the current one!");                     // Printing message...
+    return false;
+  }
+
+  glDeleteProgram (loc_program);                                                                    // Deleting previous program...
+  source = loc_source;                                                                              // Setting sources...
+  resolve ();                                                                                       // Resolving uniforms...
   neutrino::done ();                                                                                // Printing message...
+
+  return true;
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////
 //////////////////////////////////////// setarg "functions" //////////////////////////////////////////
 //////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::shader::setindex (
+                           std::vector<GLint>& loc_index,                                           // Node index vector.
+                           plot_primitive      loc_primitive                                        // Plot primitive.
+                          )
+{
+  neutrino::action ("setting OpenGL element buffer...");                                            // Printing message...
+
+  if(element_buffer == 0)
+  {
+    glGenBuffers (1, &element_buffer);                                                              // Generating element buffer...
+  }
+
+  glBindBuffer (GL_ELEMENT_ARRAY_BUFFER, element_buffer);                                           // Binding element buffer...
+
+  // Uploading node indices:
+  glBufferData (
+                GL_ELEMENT_ARRAY_BUFFER,                                                            // Element buffer target.
+                sizeof(GLint)*loc_index.size (),                                                    // Element buffer size.
+                loc_index.data (),                                                                  // Element buffer data.
+                GL_STATIC_DRAW                                                                      // Element buffer usage.
+               );
+
+  glBindBuffer (GL_ELEMENT_ARRAY_BUFFER, 0);                                                        // Unbinding element buffer...
+
+  element_size = (GLsizei)loc_index.size ();                                                        // Setting element buffer size...
+  primitive    = loc_primitive;                                                                     // Setting plot primitive...
+
+  neutrino::done ();                                                                                // Printing message...
+}
+
+void nu::shader::setglyph (
+                           GLsizei loc_glyph_size                                                   // Number of vertices per glyph.
+                          )
+{
+  glyph_size = loc_glyph_size;                                                                      // Setting glyph size...
+  primitive  = NU_PLOT_GLYPHS;                                                                      // Setting plot primitive...
+}
+
+void nu::shader::setculling (
+                             nu::float4* loc_position,                                              // Point positions (shader argument).
+                             GLfloat     loc_lod_distance                                           // Level of detail distance.
+                            )
+{
+  GLuint      loc_shader;                                                                           // Culling compute shader.
+  std::string loc_source;                                                                           // Culling compute shader source.
+  const char* loc_source_c;                                                                         // Culling compute shader source, C style string.
+  GLint       loc_success;                                                                          // "GL_COMPILE_STATUS" or "GL_LINK_STATUS" flag.
+  GLchar*     loc_log;                                                                              // Buffer for OpenGL error log.
+  GLsizei     loc_log_size;                                                                         // Size of OpenGL error log.
+  GLint       loc_bindings;                                                                         // Number of storage buffer binding points.
+  GLuint      loc_command[5] = {0, 1, 0, 0, 0};                                                     // Indirect draw command (count, instances, first, base vertex, base instance).
+
+  neutrino::action ("building OpenGL frustum culling compute shader...");                           // Printing message...
+
+  loc_source   = std::string ("#version 430 core\n") +
+                 "#define NU_CULL_GROUP_SIZE " + std::to_string (NU_CULL_GROUP_SIZE) + "\n" +
+                 "#define NU_CULL_MAX_LEVEL " + std::to_string (NU_CULL_MAX_LEVEL) + "\n" +
+                 nu_cull_source;                                                                    // Building source...
+  loc_source_c = loc_source.c_str ();                                                               // Getting C style source...
+  loc_shader   = glCreateShader (GL_COMPUTE_SHADER);                                                // Creating shader...
+  glShaderSource (loc_shader, 1, &loc_source_c, NULL);                                              // Attaching source code to shader...
+  glCompileShader (loc_shader);                                                                     // Compiling shader...
+  glGetShaderiv (loc_shader, GL_COMPILE_STATUS, &loc_success);                                      // Reading "GL_COMPILE_STATUS" flag...
+
+  // Checking compiled shader code:
+  if(!loc_success)
+  {
+    glGetShaderiv (loc_shader, GL_INFO_LOG_LENGTH, &loc_log_size);                                  // Getting log length...
+    loc_log = (char*) calloc (loc_log_size + 1, sizeof(GLchar));                                    // Allocating temporary buffer for log...
+    glGetShaderInfoLog (loc_shader, loc_log_size + 1, NULL, loc_log);                               // Getting log...
+    std::string loc_log_string (loc_log);
+    std::cout << loc_log_string << std::endl;                                                       // Printing log...
+    free (loc_log);                                                                                 // Freeing log...
+    exit (1);                                                                                       // Exiting...
+  }
+
+  cull_program = glCreateProgram ();                                                                // Creating program...
+  glAttachShader (cull_program, loc_shader);                                                        // Attaching shader to program...
+  glLinkProgram (cull_program);                                                                     // Linking program...
+  glDeleteShader (loc_shader);                                                                      // Deleting shader (owned by program)...
+  glGetProgramiv (cull_program, GL_LINK_STATUS, &loc_success);                                      // Reading "GL_LINK_STATUS" flag...
+
+  // Checking linked program:
+  if(!loc_success)
+  {
+    glGetProgramiv (cull_program, GL_INFO_LOG_LENGTH, &loc_log_size);                               // Getting log length...
+    loc_log = (char*) calloc (loc_log_size + 1, sizeof(GLchar));                                    // Allocating temporary buffer for log...
+    glGetProgramInfoLog (cull_program, loc_log_size + 1, NULL, loc_log);                            // Getting log...
+    std::string loc_log_string (loc_log);
+    std::cout << loc_log_string << std::endl;                                                       // Printing log...
+    free (loc_log);                                                                                 // Freeing log...
+    exit (1);                                                                                       // Exiting...
+  }
+
+  // Using the last binding points, not to interfere with the data layout indices:
+  glGetIntegerv (GL_MAX_SHADER_STORAGE_BUFFER_BINDINGS, &loc_bindings);                             // Getting number of binding points...
+  cull_binding = (GLuint)loc_bindings - 3;                                                          // Setting first culling binding point...
+
+  glShaderStorageBlockBinding (
+                               cull_program,                                                        // Culling program.
+                               glGetProgramResourceIndex (cull_program, GL_SHADER_STORAGE_BLOCK, "nu_cull_position"),
+                               cull_binding + 0                                                     // Position binding point.
+                              );
+  glShaderStorageBlockBinding (
+                               cull_program,                                                        // Culling program.
+                               glGetProgramResourceIndex (cull_program, GL_SHADER_STORAGE_BLOCK, "nu_cull_index"),
+                               cull_binding + 1                                                     // Index binding point.
+                              );
+  glShaderStorageBlockBinding (
+                               cull_program,                                                        // Culling program.
+                               glGetProgramResourceIndex (cull_program, GL_SHADER_STORAGE_BLOCK, "nu_cull_command"),
+                               cull_binding + 2                                                     // Command binding point.
+                              );
+
+  cull_V_mat_location  = glGetUniformLocation (cull_program, "V_mat");                              // Getting view matrix location...
+  cull_P_mat_location  = glGetUniformLocation (cull_program, "P_mat");                              // Getting projection matrix location...
+  cull_points_location = glGetUniformLocation (cull_program, "points");                             // Getting number of points location...
+  cull_lod_location    = glGetUniformLocation (cull_program, "lod_distance");                       // Getting level of detail distance location...
+
+  // Creating compacted index buffer (worst case: all points visible):
+  if(element_buffer == 0)
+  {
+    glGenBuffers (1, &element_buffer);                                                              // Generating element buffer...
+  }
+
+  glBindBuffer (GL_ELEMENT_ARRAY_BUFFER, element_buffer);                                           // Binding element buffer...
+  glBufferData (
+                GL_ELEMENT_ARRAY_BUFFER,                                                            // Element buffer target.
+                sizeof(GLuint)*loc_position->data.size (),                                          // Element buffer size.
+                NULL,                                                                               // Element buffer data (written by culling).
+                GL_DYNAMIC_COPY                                                                     // Element buffer usage.
+               );
+  glBindBuffer (GL_ELEMENT_ARRAY_BUFFER, 0);                                                        // Unbinding element buffer...
+
+  // Creating indirect draw command buffer:
+  glGenBuffers (1, &command_buffer);                                                                // Generating command buffer...
+  glBindBuffer (GL_DRAW_INDIRECT_BUFFER, command_buffer);                                           // Binding command buffer...
+  glBufferData (GL_DRAW_INDIRECT_BUFFER, sizeof(loc_command), loc_command, GL_DYNAMIC_COPY);        // Initializing command buffer...
+  glBindBuffer (GL_DRAW_INDIRECT_BUFFER, 0);                                                        // Unbinding command buffer...
+
+  cull_position = loc_position->ssbo;                                                               // Setting position buffer...
+  cull_size     = (GLsizei)loc_position->data.size ();                                              // Setting culling capacity...
+  lod_distance  = loc_lod_distance;                                                                 // Setting level of detail distance...
+  primitive     = NU_PLOT_POINTS;                                                                   // Setting plot primitive...
+  culling       = true;                                                                             // Setting frustum culling flag...
+
+  neutrino::done ();                                                                                // Printing message...
+}
+
+void nu::shader::cull (
+                       float loc_view_matrix[16],                                                   // View matrix.
+                       float loc_projection_matrix[16]                                              // Projection matrix.
+                      )
+{
+  GLuint loc_reset[1] = {0};                                                                        // Command count reset value.
+  GLuint loc_points   = (GLuint)std::min (size, cull_size);                                         // Number of culled points (within the element buffer).
+
+  // Resetting the visible point count:
+  glBindBuffer (GL_DRAW_INDIRECT_BUFFER, command_buffer);                                           // Binding command buffer...
+  glBufferSubData (GL_DRAW_INDIRECT_BUFFER, 0, sizeof(loc_reset), loc_reset);                       // Resetting count...
+  glBindBuffer (GL_DRAW_INDIRECT_BUFFER, 0);                                                        // Unbinding command buffer...
+
+  glUseProgram (cull_program);                                                                      // Using culling program...
+  glUniformMatrix4fv (cull_V_mat_location, 1, GL_FALSE, loc_view_matrix);                           // Setting view matrix...
+  glUniformMatrix4fv (cull_P_mat_location, 1, GL_FALSE, loc_projection_matrix);                     // Setting projection matrix...
+  glUniform1ui (cull_points_location, loc_points);                                                  // Setting number of points...
+  glUniform1f (cull_lod_location, lod_distance);                                                    // Setting level of detail distance...
+  glBindBufferBase (GL_SHADER_STORAGE_BUFFER, cull_binding + 0, cull_position);                     // Binding position buffer...
+  glBindBufferBase (GL_SHADER_STORAGE_BUFFER, cull_binding + 1, element_buffer);                    // Binding index buffer...
+  glBindBufferBase (GL_SHADER_STORAGE_BUFFER, cull_binding + 2, command_buffer);                    // Binding command buffer...
+  glDispatchCompute ((loc_points + NU_CULL_GROUP_SIZE - 1)/NU_CULL_GROUP_SIZE, 1, 1);               // Culling points...
+  glMemoryBarrier (GL_COMMAND_BARRIER_BIT | GL_ELEMENT_ARRAY_BARRIER_BIT);                          // Making results visible to draw...
+  glUseProgram (program);                                                                           // Restoring plot program...
+}
+
 void nu::shader::setarg
 (
  nu::int1* loc_data,                                                                                // Data object.
@@ -392,7 +991,234 @@ void nu::shader::setarg
   delete loc_name_buffer;
 };
 
+void nu::shader::setarg
+(
+ nu::half1* loc_data,                                                                               // Data object.
+ GLuint     loc_layout_index                                                                        // Data layout index.
+)
+{
+  size_t loc_name_size;
+  char*  loc_name_buffer;
+
+  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+
+  loc_name_size                  = loc_data->name.size ();                                          // Getting source size...
+  loc_name_buffer                = new char[loc_name_size + 1]();
+  loc_data->name.copy (loc_name_buffer, loc_name_size);
+  loc_name_buffer[loc_name_size] = '\0';
+
+  glBindAttribLocation (
+                        program,                                                                    // OpenGL GLSL program.
+                        loc_layout_index,                                                           // Data layout index.
+                        loc_name_buffer                                                             // Data name.
+                       );
+
+  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+
+  delete loc_name_buffer;
+};
+
+void nu::shader::setarg
+(
+ nu::half4* loc_data,                                                                               // Data object.
+ GLuint     loc_layout_index                                                                        // Data layout index.
+)
+{
+  size_t loc_name_size;
+  char*  loc_name_buffer;
+
+  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+
+  loc_name_size                  = loc_data->name.size ();                                          // Getting source size...
+  loc_name_buffer                = new char[loc_name_size + 1]();
+  loc_data->name.copy (loc_name_buffer, loc_name_size);
+  loc_name_buffer[loc_name_size] = '\0';
+
+  glBindAttribLocation (
+                        program,                                                                    // OpenGL GLSL program.
+                        loc_layout_index,                                                           // Data layout index.
+                        loc_name_buffer                                                             // Data name.
+                       );
+
+  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+
+  delete loc_name_buffer;
+};
+
+void nu::shader::setarg
+(
+ nu::short4* loc_data,                                                                              // Data object.
+ GLuint      loc_layout_index                                                                       // Data layout index.
+)
+{
+  size_t loc_name_size;
+  char*  loc_name_buffer;
+
+  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+
+  loc_name_size                  = loc_data->name.size ();                                          // Getting source size...
+  loc_name_buffer                = new char[loc_name_size + 1]();
+  loc_data->name.copy (loc_name_buffer, loc_name_size);
+  loc_name_buffer[loc_name_size] = '\0';
+
+  glBindAttribLocation (
+                        program,                                                                    // OpenGL GLSL program.
+                        loc_layout_index,                                                           // Data layout index.
+                        loc_name_buffer                                                             // Data name.
+                       );
+
+  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+
+  delete loc_name_buffer;
+};
+
+void nu::shader::setarg
+(
+ nu::uchar4* loc_data,                                                                              // Data object.
+ GLuint      loc_layout_index                                                                       // Data layout index.
+)
+{
+  size_t loc_name_size;
+  char*  loc_name_buffer;
+
+  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+
+  loc_name_size                  = loc_data->name.size ();                                          // Getting source size...
+  loc_name_buffer                = new char[loc_name_size + 1]();
+  loc_data->name.copy (loc_name_buffer, loc_name_size);
+  loc_name_buffer[loc_name_size] = '\0';
+
+  glBindAttribLocation (
+                        program,                                                                    // OpenGL GLSL program.
+                        loc_layout_index,                                                           // Data layout index.
+                        loc_name_buffer                                                             // Data name.
+                       );
+
+  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+
+  delete loc_name_buffer;
+};
+
+void nu::shader::setarg
+(
+ nu::double1* loc_data,                                                                             // Data object.
+ GLuint       loc_layout_index                                                                      // Data layout index.
+)
+{
+  size_t loc_name_size;
+  char*  loc_name_buffer;
+
+  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+
+  loc_name_size                  = loc_data->name.size ();                                          // Getting source size...
+  loc_name_buffer                = new char[loc_name_size + 1]();
+  loc_data->name.copy (loc_name_buffer, loc_name_size);
+  loc_name_buffer[loc_name_size] = '\0';
+
+  glBindAttribLocation (
+                        program,                                                                    // OpenGL GLSL program.
+                        loc_layout_index,                                                           // Data layout index.
+                        loc_name_buffer                                                             // Data name.
+                       );
+
+  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+
+  delete loc_name_buffer;
+};
+
+void nu::shader::setarg
+(
+ nu::double2* loc_data,                                                                             // Data object.
+ GLuint       loc_layout_index                                                                      // Data layout index.
+)
+{
+  size_t loc_name_size;
+  char*  loc_name_buffer;
+
+  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+
+  loc_name_size                  = loc_data->name.size ();                                          // Getting source size...
+  loc_name_buffer                = new char[loc_name_size + 1]();
+  loc_data->name.copy (loc_name_buffer, loc_name_size);
+  loc_name_buffer[loc_name_size] = '\0';
+
+  glBindAttribLocation (
+                        program,                                                                    // OpenGL GLSL program.
+                        loc_layout_index,                                                           // Data layout index.
+                        loc_name_buffer                                                             // Data name.
+                       );
+
+  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+
+  delete loc_name_buffer;
+};
+
+void nu::shader::setarg
+(
+ nu::double3* loc_data,                                                                             // Data object.
+ GLuint       loc_layout_index                                                                      // Data layout index.
+)
+{
+  size_t loc_name_size;
+  char*  loc_name_buffer;
+
+  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+
+  loc_name_size                  = loc_data->name.size ();                                          // Getting source size...
+  loc_name_buffer                = new char[loc_name_size + 1]();
+  loc_data->name.copy (loc_name_buffer, loc_name_size);
+  loc_name_buffer[loc_name_size] = '\0';
+
+  glBindAttribLocation (
+                        program,                                                                    // OpenGL GLSL program.
+                        loc_layout_index,                                                           // Data layout index.
+                        loc_name_buffer                                                             // Data name.
+                       );
+
+  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+
+  delete loc_name_buffer;
+};
+
+void nu::shader::setarg
+(
+ nu::double4* loc_data,                                                                             // Data object.
+ GLuint       loc_layout_index                                                                      // Data layout index.
+)
+{
+  size_t loc_name_size;
+  char*  loc_name_buffer;
+
+  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+
+  loc_name_size                  = loc_data->name.size ();                                          // Getting source size...
+  loc_name_buffer                = new char[loc_name_size + 1]();
+  loc_data->name.copy (loc_name_buffer, loc_name_size);
+  loc_name_buffer[loc_name_size] = '\0';
+
+  glBindAttribLocation (
+                        program,                                                                    // OpenGL GLSL program.
+                        loc_layout_index,                                                           // Data layout index.
+                        loc_name_buffer                                                             // Data name.
+                       );
+
+  glFinish ();                                                                                      // Waiting for OpenGL to finish...
+
+  delete loc_name_buffer;
+};
+
 nu::shader::~shader ()
 {
-  // Doing nothing.
+  watch (false);                                                                                    // Stopping source file watcher...
+
+  if(element_buffer != 0)
+  {
+    glDeleteBuffers (1, &element_buffer);                                                           // Deleting element buffer...
+  }
+
+  if(culling)
+  {
+    glDeleteBuffers (1, &command_buffer);                                                           // Deleting indirect draw command buffer...
+    glDeleteProgram (cull_program);                                                                 // Deleting culling program...
+  }
 }
@@ -0,0 +1,299 @@
+/// @file     snapshot.cpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Definition of a checkpoint "snapshot" class.
+
+#include "snapshot.hpp"
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+
+#if defined(__linux__) || defined(__APPLE__)
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <fcntl.h>
+  #include <unistd.h>
+#endif
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////// Snapshot format /////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// Snapshot file header:
+typedef struct _nu_snapshot_header
+{
+  char     magic[8];                                                                                // Magic string.
+  uint32_t version;                                                                                 // Format version.
+  uint32_t count;                                                                                   // Number of data objects.
+} nu_snapshot_header;
+
+// Snapshot file table entry (one per data object):
+typedef struct _nu_snapshot_entry
+{
+  uint32_t type;                                                                                    // Data type.
+  uint32_t element;                                                                                 // Element size [bytes].
+  uint64_t count;                                                                                   // Number of elements [#].
+  uint64_t offset;                                                                                  // Data block file offset [bytes].
+} nu_snapshot_entry;
+
+// Rounds a file offset up to the data block alignment:
+static size_t nu_snapshot_align (
+                                 size_t loc_offset                                                  // File offset [bytes].
+                                )
+{
+  return (loc_offset + NU_SNAPSHOT_ALIGN - 1)/NU_SNAPSHOT_ALIGN*NU_SNAPSHOT_ALIGN;
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////// "snapshot" class ///////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+nu::snapshot::snapshot ()
+{
+  event  = NULL;                                                                                    // Resetting read event...
+  saving = false;                                                                                   // Resetting "save in progress" flag...
+  failed = false;                                                                                   // Resetting "last save failed" flag...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////// save ////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::snapshot::save (
+                         std::string loc_file_name                                                  // Snapshot file name.
+                        )
+{
+  nu_snapshot_header             loc_header;                                                        // Snapshot header.
+  std::vector<nu_snapshot_entry> loc_entry;                                                         // Snapshot table.
+  void*                          loc_host;                                                          // Host data.
+  size_t                         loc_element;                                                       // Element size [bytes].
+  size_t                         loc_count;                                                         // Number of elements [#].
+  cl_mem*                        loc_buffer;                                                        // Device buffer.
+  bool*                          loc_ready;                                                         // Buffer "ready" flag.
+  size_t                         loc_offset;                                                        // File offset [bytes].
+  size_t                         i;                                                                 // Data object index.
+
+  wait ();                                                                                          // Waiting for previous save...
+
+  // Laying out the file (header, table, aligned data blocks):
+  loc_offset = sizeof(nu_snapshot_header) + sizeof(nu_snapshot_entry)*neutrino::container.size ();
+
+  for(i = 0; i < neutrino::container.size (); i++)
+  {
+    neutrino::container[i]->access (&loc_host, &loc_element, &loc_count, &loc_buffer, &loc_ready);
+    loc_offset = nu_snapshot_align (loc_offset);                                                    // Aligning data block...
+    loc_entry.push_back ({(uint32_t)neutrino::container[i]->type, (uint32_t)loc_element, (uint64_t)loc_count, (uint64_t)loc_offset});
+    loc_offset += loc_element*loc_count;                                                            // Advancing to next data block...
+  }
+
+  memset (&loc_header, 0, sizeof(loc_header));
+  memcpy (loc_header.magic, NU_SNAPSHOT_MAGIC, sizeof(loc_header.magic));                           // Setting magic string...
+  loc_header.version = NU_SNAPSHOT_VERSION;                                                         // Setting format version...
+  loc_header.count   = (uint32_t)loc_entry.size ();                                                 // Setting number of data objects...
+
+  staging.resize (loc_offset);                                                                      // Allocating staging area (reused between saves)...
+  memcpy (staging.data (), &loc_header, sizeof(loc_header));                                        // Copying header...
+
+  if(!loc_entry.empty ())
+  {
+    memcpy (staging.data () + sizeof(loc_header), loc_entry.data (), sizeof(nu_snapshot_entry)*loc_entry.size ());
+  }
+
+  // Enqueueing non-blocking reads of all device buffers:
+  neutrino::check_error (nu::data::share (neutrino::container, true));                              // Acquiring shared buffers...
+
+  for(i = 0; i < neutrino::container.size (); i++)
+  {
+    neutrino::container[i]->access (&loc_host, &loc_element, &loc_count, &loc_buffer, &loc_ready);
+
+    if(loc_count > 0)
+    {
+      neutrino::check_error (clEnqueueReadBuffer (neutrino::queue_id, *loc_buffer, CL_FALSE, 0, loc_element*loc_count, staging.data () + loc_entry[i].offset, 0, NULL, NULL));
+    }
+  }
+
+  neutrino::check_error (nu::data::share (neutrino::container, false));                             // Releasing shared buffers...
+  neutrino::check_error (clEnqueueMarkerWithWaitList (neutrino::queue_id, 0, NULL, &event));        // Marking end of reads...
+  clFlush (neutrino::queue_id);                                                                     // Submitting reads...
+
+  saving = true;                                                                                    // Setting "save in progress" flag...
+  writer = std::thread (&nu::snapshot::write, this, loc_file_name);                                 // Starting writer thread...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////// write ///////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::snapshot::write (
+                          std::string loc_file_name                                                 // Snapshot file name.
+                         )
+{
+  std::string loc_temporary = loc_file_name + ".tmp";                                               // Temporary file name.
+  FILE*       loc_file;                                                                             // Temporary file.
+  bool        loc_ok;                                                                               // "Written" flag.
+
+  loc_ok   = (clWaitForEvents (1, &event) == CL_SUCCESS);                                           // Waiting for buffer reads...
+  clReleaseEvent (event);                                                                           // Releasing read event...
+  event    = NULL;
+
+  loc_file = loc_ok ? fopen (loc_temporary.c_str (), "wb") : NULL;                                  // Opening temporary file...
+  loc_ok   = (loc_file != NULL);
+
+  if(loc_ok)
+  {
+    loc_ok = (fwrite (staging.data (), 1, staging.size (), loc_file) == staging.size ());           // Writing snapshot...
+    loc_ok = (fclose (loc_file) == 0) && loc_ok;                                                    // Closing temporary file...
+  }
+
+  if(loc_ok)
+  {
+    remove (loc_file_name.c_str ());                                                                // Removing previous snapshot (needed on Windows)...
+    loc_ok = (rename (loc_temporary.c_str (), loc_file_name.c_str ()) == 0);                        // Replacing snapshot...
+  }
+
+  if(!loc_ok)
+  {
+    neutrino::warning ("could not write snapshot file: previous snapshot kept!");                   // Printing message...
+  }
+
+  failed = !loc_ok;                                                                                 // Setting "last save failed" flag...
+  saving = false;                                                                                   // Resetting "save in progress" flag...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////// wait ////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::snapshot::wait ()
+{
+  if(writer.joinable ())
+  {
+    writer.join ();                                                                                 // Waiting for writer thread...
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////// restore //////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::snapshot::restore (
+                            std::string loc_file_name                                               // Snapshot file name.
+                           )
+{
+  const char*        loc_map  = NULL;                                                               // Mapped file.
+  size_t             loc_size = 0;                                                                  // File size [bytes].
+  nu_snapshot_header loc_header;                                                                    // Snapshot header.
+  nu_snapshot_entry  loc_entry;                                                                     // Snapshot table entry.
+  void*              loc_host;                                                                      // Host data.
+  size_t             loc_element;                                                                   // Element size [bytes].
+  size_t             loc_count;                                                                     // Number of elements [#].
+  cl_mem*            loc_buffer;                                                                    // Device buffer.
+  bool*              loc_ready;                                                                     // Buffer "ready" flag.
+  bool               loc_valid;                                                                     // "Valid snapshot" flag.
+  size_t             i;                                                                             // Data object index.
+
+  wait ();                                                                                          // Waiting for save in progress...
+
+  neutrino::action ("restoring snapshot...");                                                       // Printing message...
+
+  #if defined(__linux__) || defined(__APPLE__)
+    int         loc_descriptor;                                                                     // File descriptor.
+    struct stat loc_stat;                                                                           // File status.
+
+    loc_descriptor = open (loc_file_name.c_str (), O_RDONLY);                                       // Opening file...
+
+    if((loc_descriptor >= 0) && (fstat (loc_descriptor, &loc_stat) == 0) && (loc_stat.st_size > 0))
+    {
+      loc_size = (size_t)loc_stat.st_size;                                                          // Getting file size...
+      loc_map  = (const char*)mmap (NULL, loc_size, PROT_READ, MAP_PRIVATE, loc_descriptor, 0);     // Mapping file...
+
+      if(loc_map == (const char*)MAP_FAILED)
+      {
+        loc_map = NULL;
+      }
+      else
+      {
+        madvise ((void*)loc_map, loc_size, MADV_SEQUENTIAL);                                        // Advising sequential access...
+      }
+    }
+
+    if(loc_descriptor >= 0)
+    {
+      close (loc_descriptor);                                                                       // Closing file (the mapping stays)...
+    }
+  #else
+    std::vector<char> loc_read;                                                                     // Read file (no memory mapping).
+    std::ifstream     loc_file (loc_file_name, std::ios::binary | std::ios::ate);                   // Snapshot file.
+
+    if(loc_file.is_open ())
+    {
+      loc_size = (size_t)loc_file.tellg ();                                                         // Getting file size...
+      loc_read.resize (loc_size);
+      loc_file.seekg (0);
+      loc_file.read (loc_read.data (), loc_size);                                                   // Reading file...
+      loc_map  = loc_file ? loc_read.data () : NULL;
+    }
+  #endif
+
+  if(loc_map == NULL)
+  {
+    neutrino::error ("could not open snapshot file!");                                              // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  // Checking header:
+  loc_valid = (loc_size >= sizeof(loc_header));
+
+  if(loc_valid)
+  {
+    memcpy (&loc_header, loc_map, sizeof(loc_header));
+    loc_valid = (memcmp (loc_header.magic, NU_SNAPSHOT_MAGIC, sizeof(loc_header.magic)) == 0) &&
+                (loc_header.version == NU_SNAPSHOT_VERSION) &&
+                (loc_header.count == neutrino::container.size ()) &&
+                (loc_size >= sizeof(loc_header) + sizeof(nu_snapshot_entry)*loc_header.count);
+  }
+
+  // Checking table against the container:
+  for(i = 0; loc_valid && (i < neutrino::container.size ()); i++)
+  {
+    memcpy (&loc_entry, loc_map + sizeof(loc_header) + sizeof(nu_snapshot_entry)*i, sizeof(loc_entry));
+    neutrino::container[i]->access (&loc_host, &loc_element, &loc_count, &loc_buffer, &loc_ready);
+    loc_valid = (loc_entry.type == (uint32_t)neutrino::container[i]->type) &&
+                (loc_entry.element == loc_element) &&
+                (loc_entry.count == loc_count) &&
+                (loc_entry.offset + loc_element*loc_count <= loc_size);
+  }
+
+  if(!loc_valid)
+  {
+    #if defined(__linux__) || defined(__APPLE__)
+      munmap ((void*)loc_map, loc_size);                                                            // Unmapping file...
+    #endif
+
+    neutrino::error ("snapshot file does not match the data objects!");                             // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  // Uploading data blocks:
+  neutrino::check_error (nu::data::share (neutrino::container, true));                              // Acquiring shared buffers...
+
+  for(i = 0; i < neutrino::container.size (); i++)
+  {
+    memcpy (&loc_entry, loc_map + sizeof(loc_header) + sizeof(nu_snapshot_entry)*i, sizeof(loc_entry));
+    neutrino::container[i]->access (&loc_host, &loc_element, &loc_count, &loc_buffer, &loc_ready);
+
+    if(loc_count > 0)
+    {
+      neutrino::check_error (clEnqueueWriteBuffer (neutrino::queue_id, *loc_buffer, CL_FALSE, 0, loc_element*loc_count, loc_map + loc_entry.offset, 0, NULL, NULL));
+      memcpy (loc_host, loc_map + loc_entry.offset, loc_element*loc_count);                         // Updating host data (while uploading)...
+    }
+  }
+
+  neutrino::check_error (nu::data::share (neutrino::container, false));                             // Releasing shared buffers...
+  clFinish (neutrino::queue_id);                                                                    // Waiting for uploads (before unmapping)...
+
+  #if defined(__linux__) || defined(__APPLE__)
+    munmap ((void*)loc_map, loc_size);                                                              // Unmapping file...
+  #endif
+
+  neutrino::done ();                                                                                // Printing message...
+}
+
+nu::snapshot::~snapshot ()
+{
+  wait ();                                                                                          // Waiting for save in progress...
+}
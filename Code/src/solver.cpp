@@ -0,0 +1,964 @@
+/// @file     solver.cpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Definition of a "solver" class for sparse linear systems.
+
+#include "solver.hpp"
+
+// Solver kernel slots (the same slot is used by CG and BiCGSTAB for analogous kernels):
+enum
+{
+  NU_SOLVER_INIT,                                                                                   // Initial residual (+ dot products).
+  NU_SOLVER_DOT,                                                                                    // Single dot product.
+  NU_SOLVER_UPDATE,                                                                                 // Solution and residual update (+ dot products).
+  NU_SOLVER_DIRECTION,                                                                              // Search direction update.
+  NU_SOLVER_REDUCE,                                                                                 // Partial sums reduction and scalar update.
+  NU_SOLVER_HALF,                                                                                   // BiCGSTAB intermediate residual.
+  NU_SOLVER_DOT2,                                                                                   // Double dot product.
+  NU_SOLVER_KERNELS                                                                                 // Number of kernel slots.
+};
+
+// Scalar update modes (must match the "nu_solver_reduce" kernel):
+enum
+{
+  NU_SOLVER_MODE_CG_INIT,                                                                           // rho, rr, bb.
+  NU_SOLVER_MODE_ALPHA,                                                                             // alpha = rho/(p*Ap) or rho/(rhat*v).
+  NU_SOLVER_MODE_CG_BETA,                                                                           // beta = rho_new/rho, rho, rr.
+  NU_SOLVER_MODE_BICG_INIT,                                                                         // rho, rr, bb, alpha = omega = 1, beta = 0.
+  NU_SOLVER_MODE_OMEGA,                                                                             // omega = (t*s)/(t*t).
+  NU_SOLVER_MODE_BICG_BETA                                                                          // beta = (rho_new/rho)*(alpha/omega), rho, rr.
+};
+
+#define NU_SOLVER_SCALARS 6                                                                         // Number of method scalars (must match the kernels).
+#define NU_SOLVER_RR      4                                                                         // Index of r*r in the scalar buffer (must match the kernels).
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////// Solver kernels //////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// All vector kernels use grid-stride loops over a fixed number of work-groups, so that each dot
+// product produces one partial sum per work-group; "nu_solver_reduce" (one work-group) adds the
+// partial sums and updates the method scalars, which never leave the client.
+static const char* nu_solver_source = R"(
+#define NU_RHO   0
+#define NU_ALPHA 1
+#define NU_BETA  2
+#define NU_OMEGA 3
+#define NU_RR    4
+#define NU_BB    5
+
+inline float nu_div (float a, float b)
+{
+  return (b != 0.0f) ? a/b : 0.0f;
+}
+
+void nu_sum (__local float* shared, float v, __global float* partial, int slot)
+{
+  int l = get_local_id (0);
+  int k;
+
+  shared[l] = v;
+  barrier (CLK_LOCAL_MEM_FENCE);
+
+  for(k = NU_GROUP/2; k > 0; k >>= 1)
+  {
+    if(l < k)
+    {
+      shared[l] += shared[l + k];
+    }
+
+    barrier (CLK_LOCAL_MEM_FENCE);
+  }
+
+  if(l == 0)
+  {
+    partial[slot*get_num_groups (0) + get_group_id (0)] = shared[0];
+  }
+
+  barrier (CLK_LOCAL_MEM_FENCE);
+}
+
+__kernel void nu_solver_reduce (
+                                const int            groups,
+                                const int            sums,
+                                const int            mode,
+                                __global const float* partial,
+                                __global float*       scalar
+                               )
+{
+  __local float shared[NU_GROUP];
+  __local float total[3];
+  int           l = get_local_id (0);
+  int           g;
+  int           m;
+  int           k;
+  float         v;
+
+  for(m = 0; m < sums; m++)
+  {
+    v = 0.0f;
+
+    for(g = l; g < groups; g += NU_GROUP)
+    {
+      v += partial[m*groups + g];
+    }
+
+    shared[l] = v;
+    barrier (CLK_LOCAL_MEM_FENCE);
+
+    for(k = NU_GROUP/2; k > 0; k >>= 1)
+    {
+      if(l < k)
+      {
+        shared[l] += shared[l + k];
+      }
+
+      barrier (CLK_LOCAL_MEM_FENCE);
+    }
+
+    if(l == 0)
+    {
+      total[m] = shared[0];
+    }
+
+    barrier (CLK_LOCAL_MEM_FENCE);
+  }
+
+  if(l == 0)
+  {
+    switch(mode)
+    {
+      case 0:
+        scalar[NU_RHO]   = total[0];
+        scalar[NU_RR]    = total[1];
+        scalar[NU_BB]    = total[2];
+        break;
+
+      case 1:
+        scalar[NU_ALPHA] = nu_div (scalar[NU_RHO], total[0]);
+        break;
+
+      case 2:
+        scalar[NU_BETA]  = nu_div (total[0], scalar[NU_RHO]);
+        scalar[NU_RHO]   = total[0];
+        scalar[NU_RR]    = total[1];
+        break;
+
+      case 3:
+        scalar[NU_RHO]   = total[0];
+        scalar[NU_RR]    = total[1];
+        scalar[NU_BB]    = total[2];
+        scalar[NU_ALPHA] = 1.0f;
+        scalar[NU_OMEGA] = 1.0f;
+        scalar[NU_BETA]  = 0.0f;
+        break;
+
+      case 4:
+        scalar[NU_OMEGA] = nu_div (total[0], total[1]);
+        break;
+
+      case 5:
+        scalar[NU_BETA]  = nu_div (total[0], scalar[NU_RHO])*nu_div (scalar[NU_ALPHA], scalar[NU_OMEGA]);
+        scalar[NU_RHO]   = total[0];
+        scalar[NU_RR]    = total[1];
+        break;
+    }
+  }
+}
+
+__kernel void nu_dot (
+                      const int            n,
+                      __global const float* a,
+                      __global const float* b,
+                      __global float*       partial
+                     )
+{
+  __local float shared[NU_GROUP];
+  int           i;
+  float         ab = 0.0f;
+
+  for(i = get_global_id (0); i < n; i += get_global_size (0))
+  {
+    ab += a[i]*b[i];
+  }
+
+  nu_sum (shared, ab, partial, 0);
+}
+
+__kernel void nu_dot2 (
+                       const int            n,
+                       __global const float* t,
+                       __global const float* s,
+                       __global float*       partial
+                      )
+{
+  __local float shared[NU_GROUP];
+  int           i;
+  float         ts = 0.0f;
+  float         tt = 0.0f;
+
+  for(i = get_global_id (0); i < n; i += get_global_size (0))
+  {
+    ts += t[i]*s[i];
+    tt += t[i]*t[i];
+  }
+
+  nu_sum (shared, ts, partial, 0);
+  nu_sum (shared, tt, partial, 1);
+}
+
+__kernel void nu_cg_init (
+                          const int            n,
+                          __global const float* b,
+                          __global const float* q,
+                          __global float*       r,
+                          __global float*       z,
+                          __global float*       p,
+                          __global const float* d,
+                          __global float*       partial
+                         )
+{
+  __local float shared[NU_GROUP];
+  int           i;
+  float         rz = 0.0f;
+  float         rr = 0.0f;
+  float         bb = 0.0f;
+
+  for(i = get_global_id (0); i < n; i += get_global_size (0))
+  {
+    r[i] = b[i] - q[i];
+    z[i] = d[i]*r[i];
+    p[i] = z[i];
+    rz  += r[i]*z[i];
+    rr  += r[i]*r[i];
+    bb  += b[i]*b[i];
+  }
+
+  nu_sum (shared, rz, partial, 0);
+  nu_sum (shared, rr, partial, 1);
+  nu_sum (shared, bb, partial, 2);
+}
+
+__kernel void nu_cg_update (
+                            const int            n,
+                            __global const float* scalar,
+                            __global const float* p,
+                            __global const float* q,
+                            __global float*       x,
+                            __global float*       r,
+                            __global float*       z,
+                            __global const float* d,
+                            __global float*       partial
+                           )
+{
+  __local float shared[NU_GROUP];
+  float         alpha = scalar[NU_ALPHA];
+  int           i;
+  float         rz    = 0.0f;
+  float         rr    = 0.0f;
+
+  for(i = get_global_id (0); i < n; i += get_global_size (0))
+  {
+    x[i] += alpha*p[i];
+    r[i] -= alpha*q[i];
+    z[i]  = d[i]*r[i];
+    rz   += r[i]*z[i];
+    rr   += r[i]*r[i];
+  }
+
+  nu_sum (shared, rz, partial, 0);
+  nu_sum (shared, rr, partial, 1);
+}
+
+__kernel void nu_cg_direction (
+                               const int            n,
+                               __global const float* scalar,
+                               __global const float* z,
+                               __global float*       p
+                              )
+{
+  float beta = scalar[NU_BETA];
+  int   i;
+
+  for(i = get_global_id (0); i < n; i += get_global_size (0))
+  {
+    p[i] = z[i] + beta*p[i];
+  }
+}
+
+__kernel void nu_bicg_init (
+                            const int            n,
+                            __global const float* b,
+                            __global const float* t,
+                            __global float*       r,
+                            __global float*       rhat,
+                            __global float*       p,
+                            __global float*       v,
+                            __global float*       partial
+                           )
+{
+  __local float shared[NU_GROUP];
+  int           i;
+  float         rr = 0.0f;
+  float         bb = 0.0f;
+
+  for(i = get_global_id (0); i < n; i += get_global_size (0))
+  {
+    r[i]    = b[i] - t[i];
+    rhat[i] = r[i];
+    p[i]    = 0.0f;
+    v[i]    = 0.0f;
+    rr     += r[i]*r[i];
+    bb     += b[i]*b[i];
+  }
+
+  nu_sum (shared, rr, partial, 0);
+  nu_sum (shared, rr, partial, 1);
+  nu_sum (shared, bb, partial, 2);
+}
+
+__kernel void nu_bicg_direction (
+                                 const int            n,
+                                 __global const float* scalar,
+                                 __global const float* r,
+                                 __global const float* v,
+                                 __global float*       p,
+                                 __global float*       phat,
+                                 __global const float* d
+                                )
+{
+  float beta  = scalar[NU_BETA];
+  float omega = scalar[NU_OMEGA];
+  int   i;
+
+  for(i = get_global_id (0); i < n; i += get_global_size (0))
+  {
+    p[i]    = r[i] + beta*(p[i] - omega*v[i]);
+    phat[i] = d[i]*p[i];
+  }
+}
+
+__kernel void nu_bicg_half (
+                            const int            n,
+                            __global const float* scalar,
+                            __global const float* r,
+                            __global const float* v,
+                            __global float*       s,
+                            __global float*       shat,
+                            __global const float* d
+                           )
+{
+  float alpha = scalar[NU_ALPHA];
+  int   i;
+
+  for(i = get_global_id (0); i < n; i += get_global_size (0))
+  {
+    s[i]    = r[i] - alpha*v[i];
+    shat[i] = d[i]*s[i];
+  }
+}
+
+__kernel void nu_bicg_update (
+                              const int            n,
+                              __global const float* scalar,
+                              __global const float* phat,
+                              __global const float* shat,
+                              __global const float* s,
+                              __global const float* t,
+                              __global const float* rhat,
+                              __global float*       x,
+                              __global float*       r,
+                              __global float*       partial
+                             )
+{
+  __local float shared[NU_GROUP];
+  float         alpha = scalar[NU_ALPHA];
+  float         omega = scalar[NU_OMEGA];
+  int           i;
+  float         rhr   = 0.0f;
+  float         rr    = 0.0f;
+
+  for(i = get_global_id (0); i < n; i += get_global_size (0))
+  {
+    x[i] += alpha*phat[i] + omega*shat[i];
+    r[i]  = s[i] - omega*t[i];
+    rhr  += rhat[i]*r[i];
+    rr   += r[i]*r[i];
+  }
+
+  nu_sum (shared, rhr, partial, 0);
+  nu_sum (shared, rr, partial, 1);
+}
+)";
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////// "solver" class /////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+nu::solver::solver ()
+{
+  matrix           = NULL;                                                                          // Resetting system matrix...
+  program          = NULL;                                                                          // Resetting solver program...
+  inverse_diagonal = NULL;                                                                          // Resetting Jacobi preconditioner...
+  partial          = NULL;                                                                          // Resetting partial sums...
+  scalar           = NULL;                                                                          // Resetting method scalars...
+  size             = 0;                                                                             // Resetting system size...
+  group_size       = NU_SOLVER_GROUP_SIZE;                                                          // Resetting work-group size...
+  groups           = 0;                                                                             // Resetting number of work-groups...
+  type             = NU_CG;                                                                         // Resetting solver type...
+  tolerance        = NU_SOLVER_TOLERANCE;                                                           // Setting default tolerance...
+  max_iterations   = NU_SOLVER_MAX_ITERATIONS;                                                      // Setting default maximum number of iterations...
+  check_interval   = NU_SOLVER_CHECK_INTERVAL;                                                      // Setting default convergence check interval...
+  iterations       = 0;                                                                             // Resetting iterations...
+  residual         = 0.0f;                                                                          // Resetting residual...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////// init ////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::solver::init (
+                       nu::sparse* loc_matrix,                                                      // System matrix.
+                       solver_type loc_type                                                         // Solver type.
+                      )
+{
+  cl_int                   loc_error;                                                               // Error code.
+  size_t                   loc_max_group_size;                                                      // Device maximum work-group size.
+  size_t                   loc_log_size;                                                            // OpenCL JIT compiler log size.
+  std::string              loc_options;                                                             // OpenCL JIT compiler options.
+  std::vector<std::string> loc_name;                                                                // Kernel names.
+  cl_int                   loc_size;                                                                // System size.
+  cl_int                   loc_groups;                                                              // Number of work-groups.
+  size_t                   loc_vectors;                                                             // Number of work vectors.
+  size_t                   i;                                                                       // Index.
+
+  if(!loc_matrix->ready)
+  {
+    neutrino::error ("sparse matrix not initialized!");                                             // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  matrix = loc_matrix;                                                                              // Setting system matrix...
+  type   = loc_type;                                                                                // Setting solver type...
+  size   = matrix->rows;                                                                            // Setting system size...
+
+  // Choosing work-group size (power of 2, within device limits):
+  loc_error = clGetDeviceInfo
+              (
+               neutrino::device_id,                                                                 // Device ID.
+               CL_DEVICE_MAX_WORK_GROUP_SIZE,                                                       // Parameter of interest.
+               sizeof(size_t),                                                                      // Parameter size.
+               &loc_max_group_size,                                                                 // Parameter value.
+               NULL                                                                                 // Returned parameter size.
+              );
+  neutrino::check_error (loc_error);                                                                // Checking error...
+
+  group_size = NU_SOLVER_GROUP_SIZE;                                                                // Setting default work-group size...
+
+  while((group_size > 1) && (group_size > loc_max_group_size))
+  {
+    group_size /= 2;                                                                                // Halving work-group size...
+  }
+
+  groups = std::min<size_t>((size + group_size - 1)/group_size, NU_SOLVER_MAX_GROUPS);              // Setting number of work-groups...
+  groups = std::max<size_t>(groups, 1);                                                             // At least one work-group...
+
+  neutrino::action ("building linear solver program...");                                           // Printing message...
+
+  program     = clCreateProgramWithSource
+                (
+                 neutrino::context_id,                                                              // OpenCL context ID.
+                 1,                                                                                 // Number of program sources.
+                 &nu_solver_source,                                                                 // Program source.
+                 NULL,                                                                              // Source size (null terminated).
+                 &loc_error                                                                         // Error code.
+                );
+  neutrino::check_error (loc_error);                                                                // Checking error...
+
+  loc_options = std::string ("-D NU_GROUP=") + std::to_string (group_size);                         // Setting compiler options...
+
+  loc_error   = clBuildProgram
+                (
+                 program,                                                                           // Program.
+                 1,                                                                                 // Number of devices.
+                 &neutrino::device_id,                                                              // Device ID.
+                 loc_options.c_str (),                                                              // Compiler options.
+                 NULL,                                                                              // Notification routine.
+                 NULL                                                                               // Notification argument.
+                );
+
+  if(loc_error != CL_SUCCESS)                                                                       // Checking compiled program...
+  {
+    neutrino::error (neutrino::get_error (loc_error));                                              // Printing message...
+
+    // Getting OpenCL compiler information:
+    clGetProgramBuildInfo
+    (
+     program,                                                                                       // Program.
+     neutrino::device_id,                                                                           // Device ID.
+     CL_PROGRAM_BUILD_LOG,                                                                          // Build log parameter.
+     0,                                                                                             // Dummy parameter size.
+     NULL,                                                                                          // Dummy parameter value.
+     &loc_log_size                                                                                  // Size of log.
+    );
+
+    std::string loc_log (loc_log_size + 1, '\0');                                                   // Log buffer.
+
+    // Reading OpenCL compiler error log:
+    clGetProgramBuildInfo
+    (
+     program,                                                                                       // Program.
+     neutrino::device_id,                                                                           // Device ID.
+     CL_PROGRAM_BUILD_LOG,                                                                          // Build log parameter.
+     loc_log_size + 1,                                                                              // Log size.
+     &loc_log[0],                                                                                   // The log.
+     NULL                                                                                           // Dummy size parameter.
+    );
+
+    std::cout << "" << std::endl;                                                                   // Printing message...
+    std::cout << "See error log:" << std::endl;                                                     // Printing message...
+    std::cout << "" << std::endl;                                                                   // Printing message...
+    std::cout << loc_log << std::endl;                                                              // Printing log...
+    exit (loc_error);                                                                               // Exiting...
+  }
+
+  // Selecting kernels:
+  loc_name.resize (NU_SOLVER_KERNELS);                                                              // Allocating kernel names...
+  loc_name[NU_SOLVER_DOT]    = "nu_dot";                                                            // Dot product.
+  loc_name[NU_SOLVER_REDUCE] = "nu_solver_reduce";                                                  // Reduction.
+
+  switch(type)
+  {
+    case NU_BICGSTAB:
+      loc_name[NU_SOLVER_INIT]      = "nu_bicg_init";                                               // Initial residual.
+      loc_name[NU_SOLVER_UPDATE]    = "nu_bicg_update";                                             // Solution and residual update.
+      loc_name[NU_SOLVER_DIRECTION] = "nu_bicg_direction";                                          // Search direction update.
+      loc_name[NU_SOLVER_HALF]      = "nu_bicg_half";                                               // Intermediate residual.
+      loc_name[NU_SOLVER_DOT2]      = "nu_dot2";                                                    // Double dot product.
+      loc_vectors                   = 8;                                                            // r, rhat, p, v, phat, s, shat, t.
+      break;
+
+    default:
+      loc_name[NU_SOLVER_INIT]      = "nu_cg_init";                                                 // Initial residual.
+      loc_name[NU_SOLVER_UPDATE]    = "nu_cg_update";                                               // Solution and residual update.
+      loc_name[NU_SOLVER_DIRECTION] = "nu_cg_direction";                                            // Search direction update.
+      loc_vectors                   = 4;                                                            // r, z, p, q.
+      break;
+  }
+
+  kernel.assign (NU_SOLVER_KERNELS, NULL);                                                          // Resetting kernels...
+
+  for(i = 0; i < NU_SOLVER_KERNELS; i++)
+  {
+    if(!loc_name[i].empty ())
+    {
+      kernel[i] = clCreateKernel (program, loc_name[i].c_str (), &loc_error);                       // Creating kernel...
+      neutrino::check_error (loc_error);                                                            // Checking error...
+    }
+  }
+
+  neutrino::done ();                                                                                // Printing message...
+
+  neutrino::action ("creating linear solver buffers...");                                           // Printing message...
+
+  work.assign (loc_vectors, NULL);                                                                  // Resetting work vectors...
+
+  for(i = 0; i < loc_vectors; i++)
+  {
+    work[i] = clCreateBuffer
+              (
+               neutrino::context_id,                                                                // OpenCL context.
+               CL_MEM_READ_WRITE,                                                                   // Memory flags.
+               sizeof(GLfloat)*size,                                                                // Data buffer size.
+               NULL,                                                                                // Data buffer.
+               &loc_error                                                                           // Error code.
+              );
+    neutrino::check_error (loc_error);                                                              // Checking error...
+  }
+
+  inverse_diagonal = clCreateBuffer
+                     (
+                      neutrino::context_id,                                                         // OpenCL context.
+                      CL_MEM_READ_ONLY,                                                             // Memory flags.
+                      sizeof(GLfloat)*size,                                                         // Data buffer size.
+                      NULL,                                                                         // Data buffer.
+                      &loc_error                                                                    // Error code.
+                     );
+  neutrino::check_error (loc_error);                                                                // Checking error...
+
+  partial          = clCreateBuffer
+                     (
+                      neutrino::context_id,                                                         // OpenCL context.
+                      CL_MEM_READ_WRITE,                                                            // Memory flags.
+                      sizeof(GLfloat)*3*groups,                                                     // Data buffer size (up to 3 sums per group).
+                      NULL,                                                                         // Data buffer.
+                      &loc_error                                                                    // Error code.
+                     );
+  neutrino::check_error (loc_error);                                                                // Checking error...
+
+  scalar           = clCreateBuffer
+                     (
+                      neutrino::context_id,                                                         // OpenCL context.
+                      CL_MEM_READ_WRITE,                                                            // Memory flags.
+                      sizeof(GLfloat)*NU_SOLVER_SCALARS,                                            // Data buffer size.
+                      NULL,                                                                         // Data buffer.
+                      &loc_error                                                                    // Error code.
+                     );
+  neutrino::check_error (loc_error);                                                                // Checking error...
+
+  neutrino::done ();                                                                                // Printing message...
+
+  // Setting the kernel arguments which do not depend on "x" and "b":
+  loc_size   = (cl_int)size;                                                                        // Getting system size...
+  loc_groups = (cl_int)groups;                                                                      // Getting number of work-groups...
+  loc_error  = CL_SUCCESS;                                                                          // Resetting error code...
+
+  loc_error |= clSetKernelArg (kernel[NU_SOLVER_REDUCE], 0, sizeof(cl_int), &loc_groups);
+  loc_error |= clSetKernelArg (kernel[NU_SOLVER_REDUCE], 3, sizeof(cl_mem), &partial);
+  loc_error |= clSetKernelArg (kernel[NU_SOLVER_REDUCE], 4, sizeof(cl_mem), &scalar);
+
+  switch(type)
+  {
+    case NU_BICGSTAB:
+      // work: 0 = r, 1 = rhat, 2 = p, 3 = v, 4 = phat, 5 = s, 6 = shat, 7 = t.
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_INIT], 0, sizeof(cl_int), &loc_size);
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_INIT], 2, sizeof(cl_mem), &work[7]);
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_INIT], 3, sizeof(cl_mem), &work[0]);
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_INIT], 4, sizeof(cl_mem), &work[1]);
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_INIT], 5, sizeof(cl_mem), &work[2]);
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_INIT], 6, sizeof(cl_mem), &work[3]);
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_INIT], 7, sizeof(cl_mem), &partial);
+
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_DIRECTION], 0, sizeof(cl_int), &loc_size);
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_DIRECTION], 1, sizeof(cl_mem), &scalar);
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_DIRECTION], 2, sizeof(cl_mem), &work[0]);
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_DIRECTION], 3, sizeof(cl_mem), &work[3]);
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_DIRECTION], 4, sizeof(cl_mem), &work[2]);
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_DIRECTION], 5, sizeof(cl_mem), &work[4]);
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_DIRECTION], 6, sizeof(cl_mem), &inverse_diagonal);
+
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_DOT], 0, sizeof(cl_int), &loc_size);
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_DOT], 1, sizeof(cl_mem), &work[1]);
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_DOT], 2, sizeof(cl_mem), &work[3]);
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_DOT], 3, sizeof(cl_mem), &partial);
+
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_HALF], 0, sizeof(cl_int), &loc_size);
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_HALF], 1, sizeof(cl_mem), &scalar);
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_HALF], 2, sizeof(cl_mem), &work[0]);
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_HALF], 3, sizeof(cl_mem), &work[3]);
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_HALF], 4, sizeof(cl_mem), &work[5]);
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_HALF], 5, sizeof(cl_mem), &work[6]);
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_HALF], 6, sizeof(cl_mem), &inverse_diagonal);
+
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_DOT2], 0, sizeof(cl_int), &loc_size);
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_DOT2], 1, sizeof(cl_mem), &work[7]);
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_DOT2], 2, sizeof(cl_mem), &work[5]);
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_DOT2], 3, sizeof(cl_mem), &partial);
+
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_UPDATE], 0, sizeof(cl_int), &loc_size);
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_UPDATE], 1, sizeof(cl_mem), &scalar);
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_UPDATE], 2, sizeof(cl_mem), &work[4]);
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_UPDATE], 3, sizeof(cl_mem), &work[6]);
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_UPDATE], 4, sizeof(cl_mem), &work[5]);
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_UPDATE], 5, sizeof(cl_mem), &work[7]);
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_UPDATE], 6, sizeof(cl_mem), &work[1]);
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_UPDATE], 8, sizeof(cl_mem), &work[0]);
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_UPDATE], 9, sizeof(cl_mem), &partial);
+      break;
+
+    default:
+      // work: 0 = r, 1 = z, 2 = p, 3 = q (= A*p).
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_INIT], 0, sizeof(cl_int), &loc_size);
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_INIT], 2, sizeof(cl_mem), &work[3]);
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_INIT], 3, sizeof(cl_mem), &work[0]);
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_INIT], 4, sizeof(cl_mem), &work[1]);
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_INIT], 5, sizeof(cl_mem), &work[2]);
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_INIT], 6, sizeof(cl_mem), &inverse_diagonal);
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_INIT], 7, sizeof(cl_mem), &partial);
+
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_DOT], 0, sizeof(cl_int), &loc_size);
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_DOT], 1, sizeof(cl_mem), &work[2]);
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_DOT], 2, sizeof(cl_mem), &work[3]);
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_DOT], 3, sizeof(cl_mem), &partial);
+
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_UPDATE], 0, sizeof(cl_int), &loc_size);
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_UPDATE], 1, sizeof(cl_mem), &scalar);
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_UPDATE], 2, sizeof(cl_mem), &work[2]);
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_UPDATE], 3, sizeof(cl_mem), &work[3]);
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_UPDATE], 5, sizeof(cl_mem), &work[0]);
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_UPDATE], 6, sizeof(cl_mem), &work[1]);
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_UPDATE], 7, sizeof(cl_mem), &inverse_diagonal);
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_UPDATE], 8, sizeof(cl_mem), &partial);
+
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_DIRECTION], 0, sizeof(cl_int), &loc_size);
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_DIRECTION], 1, sizeof(cl_mem), &scalar);
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_DIRECTION], 2, sizeof(cl_mem), &work[1]);
+      loc_error |= clSetKernelArg (kernel[NU_SOLVER_DIRECTION], 3, sizeof(cl_mem), &work[2]);
+      break;
+  }
+
+  neutrino::check_error (loc_error);                                                                // Checking error...
+
+  precondition ();                                                                                  // Computing Jacobi preconditioner...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////// precondition ////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::solver::precondition ()
+{
+  cl_int               loc_error;                                                                   // Error code.
+  std::vector<GLfloat> loc_inverse (size, 1.0f);                                                    // Inverse diagonal.
+  GLint                k;                                                                           // CSR index.
+  size_t               i;                                                                           // Row index.
+
+  // Inverting the diagonal (rows with a missing or null diagonal are not preconditioned):
+  for(i = 0; i < size; i++)
+  {
+    k = matrix->index (i, i);                                                                       // Getting diagonal entry...
+
+    if((k >= 0) && (matrix->value[k] != 0.0f))
+    {
+      loc_inverse[i] = 1.0f/matrix->value[k];                                                       // Setting inverse diagonal...
+    }
+  }
+
+  loc_error = clEnqueueWriteBuffer
+              (
+               neutrino::queue_id,                                                                  // OpenCL queue ID.
+               inverse_diagonal,                                                                    // Data buffer.
+               CL_TRUE,                                                                             // Blocking write flag.
+               0,                                                                                   // Data buffer offset.
+               sizeof(GLfloat)*size,                                                                // Data buffer size.
+               loc_inverse.data (),                                                                 // Data buffer.
+               0,                                                                                   // Number of events in the list.
+               NULL,                                                                                // Event list.
+               NULL                                                                                 // Event.
+              );
+  neutrino::check_error (loc_error);                                                                // Checking error...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////// enqueue //////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::solver::enqueue (
+                          cl_kernel loc_kernel,                                                     // Kernel.
+                          size_t    loc_groups                                                      // Number of work-groups.
+                         )
+{
+  cl_int loc_error;                                                                                 // Error code.
+  size_t loc_global_size = loc_groups*group_size;                                                   // Global work size.
+
+  loc_error = clEnqueueNDRangeKernel
+              (
+               neutrino::queue_id,                                                                  // Queue ID.
+               loc_kernel,                                                                          // Kernel ID.
+               1,                                                                                   // Kernel dimension.
+               NULL,                                                                                // Global work offset.
+               &loc_global_size,                                                                    // Global work size.
+               &group_size,                                                                         // Local work size.
+               0,                                                                                   // Number of events.
+               NULL,                                                                                // Event list.
+               NULL                                                                                 // Event.
+              );
+  neutrino::check_error (loc_error);                                                                // Checking error...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////// reduce ///////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::solver::reduce (
+                         cl_int loc_sums,                                                           // Number of partial sums.
+                         cl_int loc_mode                                                            // Scalar update mode.
+                        )
+{
+  cl_int loc_error;                                                                                 // Error code.
+
+  loc_error  = clSetKernelArg (kernel[NU_SOLVER_REDUCE], 1, sizeof(cl_int), &loc_sums);             // Number of sums.
+  loc_error |= clSetKernelArg (kernel[NU_SOLVER_REDUCE], 2, sizeof(cl_int), &loc_mode);             // Update mode.
+  neutrino::check_error (loc_error);                                                                // Checking error...
+
+  enqueue (kernel[NU_SOLVER_REDUCE], 1);                                                            // Reducing on a single work-group...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////// check ////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+float nu::solver::check ()
+{
+  cl_int  loc_error;                                                                                // Error code.
+  GLfloat loc_norm[2];                                                                              // Squared norms of residual and right hand side.
+
+  // Reading r*r and b*b (blocking read: this is the only host sync of the iteration):
+  loc_error = clEnqueueReadBuffer
+              (
+               neutrino::queue_id,                                                                  // OpenCL queue ID.
+               scalar,                                                                              // Data buffer.
+               CL_TRUE,                                                                             // Blocking read flag.
+               sizeof(GLfloat)*NU_SOLVER_RR,                                                        // Data buffer offset.
+               sizeof(GLfloat)*2,                                                                   // Data buffer size.
+               loc_norm,                                                                            // Data buffer.
+               0,                                                                                   // Number of events in the list.
+               NULL,                                                                                // Event list.
+               NULL                                                                                 // Event.
+              );
+  neutrino::check_error (loc_error);                                                                // Checking error...
+
+  if(loc_norm[1] > 0.0f)
+  {
+    return sqrt (loc_norm[0]/loc_norm[1]);                                                          // Returning relative residual...
+  }
+
+  return sqrt (loc_norm[0]);                                                                        // Returning absolute residual (null right hand side)...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////// solve ////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+size_t nu::solver::solve (
+                          nu::float1* loc_x,                                                        // Solution (initial guess).
+                          nu::float1* loc_b                                                         // Right hand side.
+                         )
+{
+  if((loc_x->data.size () < size) || (loc_b->data.size () < size))
+  {
+    neutrino::error ("linear solver and vector size mismatch!");                                    // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  return solve (loc_x->buffer, loc_b->buffer);                                                      // Solving...
+}
+
+size_t nu::solver::solve (
+                          cl_mem loc_x,                                                             // Solution buffer (initial guess).
+                          cl_mem loc_b                                                              // Right hand side buffer.
+                         )
+{
+  cl_int loc_error;                                                                                 // Error code.
+
+  if(matrix == NULL)
+  {
+    neutrino::error ("linear solver not initialized!");                                             // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  iterations = 0;                                                                                   // Resetting iterations...
+
+  // Setting "x" and "b" arguments:
+  loc_error  = clSetKernelArg (kernel[NU_SOLVER_INIT], 1, sizeof(cl_mem), &loc_b);                  // Right hand side.
+  loc_error |= clSetKernelArg (
+                               kernel[NU_SOLVER_UPDATE],                                            // Update kernel.
+                               (type == NU_BICGSTAB) ? 7 : 4,                                       // Solution argument index.
+                               sizeof(cl_mem),                                                      // Argument size.
+                               &loc_x                                                               // Solution.
+                              );
+  neutrino::check_error (loc_error);                                                                // Checking error...
+
+  switch(type)
+  {
+    case NU_BICGSTAB:
+      matrix->spmv (loc_x, work[7]);                                                                // t = A*x...
+      enqueue (kernel[NU_SOLVER_INIT], groups);                                                     // r = b - t, rhat = r...
+      reduce (3, NU_SOLVER_MODE_BICG_INIT);                                                         // rho, rr, bb...
+      residual = check ();                                                                          // Checking initial residual...
+
+      while((residual > tolerance) && (iterations < max_iterations))
+      {
+        enqueue (kernel[NU_SOLVER_DIRECTION], groups);                                              // p = r + beta*(p - omega*v), phat = M*p...
+        matrix->spmv (work[4], work[3]);                                                            // v = A*phat...
+        enqueue (kernel[NU_SOLVER_DOT], groups);                                                    // rhat*v...
+        reduce (1, NU_SOLVER_MODE_ALPHA);                                                           // alpha...
+        enqueue (kernel[NU_SOLVER_HALF], groups);                                                   // s = r - alpha*v, shat = M*s...
+        matrix->spmv (work[6], work[7]);                                                            // t = A*shat...
+        enqueue (kernel[NU_SOLVER_DOT2], groups);                                                   // t*s, t*t...
+        reduce (2, NU_SOLVER_MODE_OMEGA);                                                           // omega...
+        enqueue (kernel[NU_SOLVER_UPDATE], groups);                                                 // x, r, rhat*r, r*r...
+        reduce (2, NU_SOLVER_MODE_BICG_BETA);                                                       // beta, rho, rr...
+        iterations++;                                                                               // Incrementing iterations...
+
+        if((iterations%check_interval == 0) || (iterations == max_iterations))
+        {
+          residual = check ();                                                                      // Checking residual...
+        }
+      }
+
+      break;
+
+    default:
+      matrix->spmv (loc_x, work[3]);                                                                // q = A*x...
+      enqueue (kernel[NU_SOLVER_INIT], groups);                                                     // r = b - q, z = M*r, p = z...
+      reduce (3, NU_SOLVER_MODE_CG_INIT);                                                           // rho, rr, bb...
+      residual = check ();                                                                          // Checking initial residual...
+
+      while((residual > tolerance) && (iterations < max_iterations))
+      {
+        matrix->spmv (work[2], work[3]);                                                            // q = A*p...
+        enqueue (kernel[NU_SOLVER_DOT], groups);                                                    // p*q...
+        reduce (1, NU_SOLVER_MODE_ALPHA);                                                           // alpha...
+        enqueue (kernel[NU_SOLVER_UPDATE], groups);                                                 // x, r, z, r*z, r*r...
+        reduce (2, NU_SOLVER_MODE_CG_BETA);                                                         // beta, rho, rr...
+        enqueue (kernel[NU_SOLVER_DIRECTION], groups);                                              // p = z + beta*p...
+        iterations++;                                                                               // Incrementing iterations...
+
+        if((iterations%check_interval == 0) || (iterations == max_iterations))
+        {
+          residual = check ();                                                                      // Checking residual...
+        }
+      }
+
+      break;
+  }
+
+  if(residual != residual)                                                                          // Checking for NaN...
+  {
+    neutrino::warning ("linear solver breakdown!");                                                 // Printing message...
+  }
+
+  else if(residual > tolerance)
+  {
+    neutrino::warning ("linear solver did not converge!");                                          // Printing message...
+  }
+
+  return iterations;                                                                                // Returning number of iterations...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////// DESTRUCTOR /////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+nu::solver::~solver ()
+{
+  size_t i;                                                                                         // Index.
+
+  for(i = 0; i < kernel.size (); i++)
+  {
+    if(kernel[i] != NULL)
+    {
+      clReleaseKernel (kernel[i]);                                                                  // Releasing solver kernel...
+    }
+  }
+
+  for(i = 0; i < work.size (); i++)
+  {
+    if(work[i] != NULL)
+    {
+      clReleaseMemObject (work[i]);                                                                 // Releasing work vector...
+    }
+  }
+
+  if(program != NULL)
+  {
+    clReleaseProgram (program);                                                                     // Releasing solver program...
+  }
+
+  if(inverse_diagonal != NULL)
+  {
+    clReleaseMemObject (inverse_diagonal);                                                          // Releasing Jacobi preconditioner...
+  }
+
+  if(partial != NULL)
+  {
+    clReleaseMemObject (partial);                                                                   // Releasing partial sums...
+  }
+
+  if(scalar != NULL)
+  {
+    clReleaseMemObject (scalar);                                                                    // Releasing method scalars...
+  }
+}
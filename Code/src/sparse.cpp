@@ -0,0 +1,870 @@
+/// @file     sparse.cpp
+/// @author   Erik ZORZIN
+/// @date     19OCT2026
+/// @brief    Definition of a "sparse" matrix class.
+
+#include "sparse.hpp"
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////// SpMV kernels ///////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+// CSR "scalar" kernel: one work-item per row (short rows).
+// CSR "vector" kernel: one work-group per row, with a local memory reduction (long rows).
+// ELL kernel: one work-item per row, column-major storage (coalesced accesses).
+// SELL kernel: one work-item per row, column-major storage within each slice of rows.
+// Padding entries point to the row itself with a zero value, so that no branching is needed.
+static const char* nu_sparse_source = R"(
+__kernel void nu_spmv_csr_scalar (
+                                  const int            rows,
+                                  __global const int*   row_offset,
+                                  __global const int*   column,
+                                  __global const float* value,
+                                  __global const float* x,
+                                  __global float*       y
+                                 )
+{
+  int   r = get_global_id (0);
+  int   k;
+  float s = 0.0f;
+
+  if(r < rows)
+  {
+    for(k = row_offset[r]; k < row_offset[r + 1]; k++)
+    {
+      s += value[k]*x[column[k]];
+    }
+
+    y[r] = s;
+  }
+}
+
+__kernel void nu_spmv_csr_vector (
+                                  const int            rows,
+                                  __global const int*   row_offset,
+                                  __global const int*   column,
+                                  __global const float* value,
+                                  __global const float* x,
+                                  __global float*       y
+                                 )
+{
+  __local float partial[NU_SPARSE_CSR_VECTOR_SIZE];
+  int           r = get_group_id (0);
+  int           l = get_local_id (0);
+  int           k;
+  float         s = 0.0f;
+
+  for(k = row_offset[r] + l; k < row_offset[r + 1]; k += NU_SPARSE_CSR_VECTOR_SIZE)
+  {
+    s += value[k]*x[column[k]];
+  }
+
+  partial[l] = s;
+  barrier (CLK_LOCAL_MEM_FENCE);
+
+  for(k = NU_SPARSE_CSR_VECTOR_SIZE/2; k > 0; k >>= 1)
+  {
+    if(l < k)
+    {
+      partial[l] += partial[l + k];
+    }
+
+    barrier (CLK_LOCAL_MEM_FENCE);
+  }
+
+  if(l == 0)
+  {
+    y[r] = partial[0];
+  }
+}
+
+__kernel void nu_spmv_ell (
+                           const int            rows,
+                           const int            width,
+                           __global const int*   column,
+                           __global const float* value,
+                           __global const float* x,
+                           __global float*       y
+                          )
+{
+  int   r = get_global_id (0);
+  int   k;
+  int   i;
+  float s = 0.0f;
+
+  if(r < rows)
+  {
+    for(k = 0; k < width; k++)
+    {
+      i  = k*rows + r;
+      s += value[i]*x[column[i]];
+    }
+
+    y[r] = s;
+  }
+}
+
+__kernel void nu_spmv_sell (
+                            const int            rows,
+                            __global const int*   slice_offset,
+                            __global const int*   slice_width,
+                            __global const int*   column,
+                            __global const float* value,
+                            __global const float* x,
+                            __global float*       y
+                           )
+{
+  int   r = get_global_id (0);
+  int   c = r/NU_SPARSE_SLICE;
+  int   l = r%NU_SPARSE_SLICE;
+  int   k;
+  int   i;
+  float s = 0.0f;
+
+  if(r < rows)
+  {
+    for(k = 0; k < slice_width[c]; k++)
+    {
+      i  = slice_offset[c] + k*NU_SPARSE_SLICE + l;
+      s += value[i]*x[column[i]];
+    }
+
+    y[r] = s;
+  }
+}
+)";
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////// "sparse" class /////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+nu::sparse::sparse ()
+{
+  format              = NU_SPARSE_AUTO;                                                             // Resetting storage format...
+  rows                = 0;                                                                          // Resetting number of rows...
+  nonzeros            = 0;                                                                          // Resetting number of nonzeros...
+  row_min             = 0;                                                                          // Resetting minimum row length...
+  row_max             = 0;                                                                          // Resetting maximum row length...
+  row_mean            = 0.0f;                                                                       // Resetting mean row length...
+  row_deviation       = 0.0f;                                                                       // Resetting row length deviation...
+  fill                = 1.0f;                                                                       // Resetting padding ratio...
+  row_offset_buffer   = NULL;                                                                       // Resetting CSR row offset buffer...
+  slice_offset_buffer = NULL;                                                                       // Resetting SELL-C slice offset buffer...
+  slice_width_buffer  = NULL;                                                                       // Resetting SELL-C slice width buffer...
+  column_buffer       = NULL;                                                                       // Resetting column index buffer...
+  value_buffer        = NULL;                                                                       // Resetting value buffer...
+  global_size         = 0;                                                                          // Resetting SpMV global size...
+  local_size          = 0;                                                                          // Resetting SpMV local size...
+  program             = NULL;                                                                       // Resetting SpMV program...
+  kernel_id           = NULL;                                                                       // Resetting SpMV kernel id...
+  ready               = false;                                                                      // Resetting "ready" flag...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////// build ////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::sparse::build (
+                        nu::mesh* loc_mesh                                                          // Processed mesh.
+                       )
+{
+  std::vector<std::vector<GLint> > loc_row;                                                         // Column indices of each row.
+  std::vector<GLint>               loc_row_offset;                                                  // CSR row offsets.
+  std::vector<GLint>               loc_column;                                                      // CSR column indices.
+  size_t                           loc_rows;                                                        // Number of rows.
+  size_t                           i;                                                               // Row index.
+  size_t                           t;                                                               // Neighbour index.
+
+  neutrino::action ("building sparse matrix pattern from mesh...");                                 // Printing message...
+
+  loc_rows = loc_mesh->node_coordinates.size ();                                                    // Getting number of nodes...
+  loc_row.resize (loc_rows);                                                                        // Allocating rows...
+
+  // Adding the diagonal entries:
+  for(i = 0; i < loc_rows; i++)
+  {
+    loc_row[i].push_back ((GLint)i);                                                                // Adding diagonal...
+  }
+
+  // Adding the neighbour entries:
+  for(t = 0; t < loc_mesh->neighbour.size (); t++)
+  {
+    loc_row[loc_mesh->neighbour_center[t]].push_back (loc_mesh->neighbour[t]);                      // Adding neighbour...
+  }
+
+  loc_row_offset.push_back (0);                                                                     // Setting first row offset...
+
+  for(i = 0; i < loc_rows; i++)
+  {
+    // Eliminating repeated indexes:
+    std::sort (loc_row[i].begin (), loc_row[i].end ());
+    loc_row[i].erase (std::unique (loc_row[i].begin (), loc_row[i].end ()), loc_row[i].end ());
+    loc_column.insert (loc_column.end (), loc_row[i].begin (), loc_row[i].end ());                  // Appending row columns...
+    loc_row_offset.push_back ((GLint)loc_column.size ());                                           // Setting row end offset...
+  }
+
+  neutrino::done ();                                                                                // Printing message...
+
+  build (loc_rows, loc_row_offset, loc_column);                                                     // Building pattern...
+}
+
+void nu::sparse::build (
+                        size_t             loc_rows,                                                // Number of rows.
+                        std::vector<GLint> loc_row_offset,                                          // CSR row offsets.
+                        std::vector<GLint> loc_column                                               // CSR column indices.
+                       )
+{
+  size_t i;                                                                                         // Row index.
+  size_t k;                                                                                         // Entry index.
+
+  neutrino::action ("setting sparse matrix pattern...");                                            // Printing message...
+
+  // Checking pattern consistency:
+  if(
+     (loc_row_offset.size () != (loc_rows + 1)) ||
+     (loc_row_offset[0] != 0) ||
+     ((size_t)loc_row_offset[loc_rows] != loc_column.size ())
+    )
+  {
+    neutrino::error ("invalid sparse matrix row offsets!");                                         // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  for(i = 0; i < loc_rows; i++)
+  {
+    if(loc_row_offset[i + 1] < loc_row_offset[i])
+    {
+      neutrino::error ("invalid sparse matrix row offsets!");                                       // Printing message...
+      exit (EXIT_FAILURE);                                                                          // Exiting...
+    }
+
+    // Sorting row columns (needed by the binary search in "index"):
+    std::sort (
+               loc_column.begin () + loc_row_offset[i],                                             // Beginning of row.
+               loc_column.begin () + loc_row_offset[i + 1]                                          // End of row.
+              );
+  }
+
+  for(k = 0; k < loc_column.size (); k++)
+  {
+    if((loc_column[k] < 0) || ((size_t)loc_column[k] >= loc_rows))
+    {
+      neutrino::error ("sparse matrix column index out of range!");                                 // Printing message...
+      exit (EXIT_FAILURE);                                                                          // Exiting...
+    }
+  }
+
+  rows       = loc_rows;                                                                            // Setting number of rows...
+  nonzeros   = loc_column.size ();                                                                  // Setting number of nonzeros...
+  row_offset = loc_row_offset;                                                                      // Setting CSR row offsets...
+  column     = loc_column;                                                                          // Setting CSR column indices...
+  value.assign (nonzeros, 0.0f);                                                                    // Resetting values...
+
+  neutrino::done ();                                                                                // Printing message...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////// index ////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+GLint nu::sparse::index (
+                         size_t loc_row,                                                            // Row index.
+                         size_t loc_column                                                          // Column index.
+                        )
+{
+  std::vector<GLint>::iterator loc_begin;                                                           // Beginning of row.
+  std::vector<GLint>::iterator loc_end;                                                             // End of row.
+  std::vector<GLint>::iterator loc_found;                                                           // Found entry.
+
+  if(loc_row >= rows)
+  {
+    return -1;                                                                                      // Returning "not found"...
+  }
+
+  loc_begin = column.begin () + row_offset[loc_row];                                                // Setting beginning of row...
+  loc_end   = column.begin () + row_offset[loc_row + 1];                                            // Setting end of row...
+  loc_found = std::lower_bound (loc_begin, loc_end, (GLint)loc_column);                             // Searching column...
+
+  if((loc_found == loc_end) || (*loc_found != (GLint)loc_column))
+  {
+    return -1;                                                                                      // Returning "not found"...
+  }
+
+  return (GLint)(loc_found - column.begin ());                                                      // Returning CSR index...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////// set ////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::sparse::set (
+                      size_t  loc_row,                                                              // Row index.
+                      size_t  loc_column,                                                           // Column index.
+                      GLfloat loc_value                                                             // Value.
+                     )
+{
+  GLint k = index (loc_row, loc_column);                                                            // CSR index.
+
+  if(k < 0)
+  {
+    neutrino::error ("sparse matrix entry not in pattern!");                                        // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  value[k] = loc_value;                                                                             // Setting value...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////////// add ////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::sparse::add (
+                      size_t  loc_row,                                                              // Row index.
+                      size_t  loc_column,                                                           // Column index.
+                      GLfloat loc_value                                                             // Value.
+                     )
+{
+  GLint k = index (loc_row, loc_column);                                                            // CSR index.
+
+  if(k < 0)
+  {
+    neutrino::error ("sparse matrix entry not in pattern!");                                        // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  value[k] += loc_value;                                                                            // Accumulating value...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////// analyse //////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::sparse::analyse ()
+{
+  size_t i;                                                                                         // Row index.
+  size_t loc_length;                                                                                // Row length.
+  double loc_sum   = 0.0;                                                                           // Sum of row lengths.
+  double loc_sum_2 = 0.0;                                                                           // Sum of squared row lengths.
+
+  row_min = (rows > 0) ? (size_t)(row_offset[1] - row_offset[0]) : 0;                               // Initializing minimum row length...
+  row_max = 0;                                                                                      // Initializing maximum row length...
+
+  for(i = 0; i < rows; i++)
+  {
+    loc_length = (size_t)(row_offset[i + 1] - row_offset[i]);                                       // Getting row length...
+    row_min    = std::min (row_min, loc_length);                                                    // Updating minimum row length...
+    row_max    = std::max (row_max, loc_length);                                                    // Updating maximum row length...
+    loc_sum   += (double)loc_length;                                                                // Accumulating row length...
+    loc_sum_2 += (double)loc_length*(double)loc_length;                                             // Accumulating squared row length...
+  }
+
+  if(rows > 0)
+  {
+    row_mean      = (float)(loc_sum/rows);                                                          // Computing mean row length...
+    row_deviation = (float)sqrt (std::max (0.0, loc_sum_2/rows - pow (loc_sum/rows, 2)));           // Computing row length deviation...
+  }
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////// choose ///////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+sparse_format nu::sparse::choose ()
+{
+  size_t i;                                                                                         // Row index.
+  size_t c;                                                                                         // Slice index.
+  size_t loc_slices;                                                                                // Number of slices.
+  size_t loc_width;                                                                                 // Slice width.
+  size_t loc_ell_stored;                                                                            // Number of stored entries in ELL format.
+  size_t loc_sell_stored = 0;                                                                       // Number of stored entries in SELL-C format.
+
+  loc_ell_stored = rows*row_max;                                                                    // Computing ELL storage...
+
+  if((float)loc_ell_stored <= NU_SPARSE_ELL_MAX_FILL*(float)nonzeros)
+  {
+    return NU_ELL;                                                                                  // Returning ELL for uniform rows...
+  }
+
+  loc_slices = (rows + NU_SPARSE_SLICE - 1)/NU_SPARSE_SLICE;                                        // Computing number of slices...
+
+  for(c = 0; c < loc_slices; c++)
+  {
+    loc_width = 0;                                                                                  // Resetting slice width...
+
+    for(i = c*NU_SPARSE_SLICE; i < std::min (rows, (c + 1)*NU_SPARSE_SLICE); i++)
+    {
+      loc_width = std::max (loc_width, (size_t)(row_offset[i + 1] - row_offset[i]));                // Updating slice width...
+    }
+
+    loc_sell_stored += loc_width*NU_SPARSE_SLICE;                                                   // Accumulating SELL-C storage...
+  }
+
+  if((float)loc_sell_stored <= NU_SPARSE_SELL_MAX_FILL*(float)nonzeros)
+  {
+    return NU_SELL;                                                                                 // Returning SELL-C for locally uniform rows...
+  }
+
+  return NU_CSR;                                                                                    // Returning CSR for irregular rows...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////// pack ////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::sparse::pack ()
+{
+  size_t i;                                                                                         // Row index.
+  size_t k;                                                                                         // Row entry index.
+  size_t c;                                                                                         // Slice index.
+  size_t p;                                                                                         // Device format index.
+  size_t loc_slices;                                                                                // Number of slices.
+  size_t loc_width;                                                                                 // Slice width.
+  size_t loc_offset = 0;                                                                            // Slice offset.
+
+  position.resize (nonzeros);                                                                       // Allocating index map...
+  slice_offset.clear ();                                                                            // Clearing slice offsets...
+  slice_width.clear ();                                                                             // Clearing slice widths...
+
+  switch(format)
+  {
+    case NU_ELL:
+      packed_column.assign (rows*row_max, 0);                                                       // Allocating column indices...
+
+      for(i = 0; i < rows; i++)
+      {
+        // Padding entries point to the row itself:
+        for(k = 0; k < row_max; k++)
+        {
+          packed_column[k*rows + i] = (GLint)i;                                                     // Setting padding column...
+        }
+
+        for(k = 0; k < (size_t)(row_offset[i + 1] - row_offset[i]); k++)
+        {
+          p                = k*rows + i;                                                            // Computing column-major index...
+          packed_column[p] = column[row_offset[i] + k];                                             // Setting column...
+          position[row_offset[i] + k] = (GLint)p;                                                   // Setting index map...
+        }
+      }
+
+      break;
+
+    case NU_SELL:
+      loc_slices = (rows + NU_SPARSE_SLICE - 1)/NU_SPARSE_SLICE;                                    // Computing number of slices...
+
+      for(c = 0; c < loc_slices; c++)
+      {
+        loc_width = 0;                                                                              // Resetting slice width...
+
+        for(i = c*NU_SPARSE_SLICE; i < std::min (rows, (c + 1)*NU_SPARSE_SLICE); i++)
+        {
+          loc_width = std::max (loc_width, (size_t)(row_offset[i + 1] - row_offset[i]));            // Updating slice width...
+        }
+
+        slice_offset.push_back ((GLint)loc_offset);                                                 // Setting slice offset...
+        slice_width.push_back ((GLint)loc_width);                                                   // Setting slice width...
+        loc_offset += loc_width*NU_SPARSE_SLICE;                                                    // Incrementing slice offset...
+      }
+
+      packed_column.assign (loc_offset, 0);                                                         // Allocating column indices...
+
+      for(i = 0; i < rows; i++)
+      {
+        c = i/NU_SPARSE_SLICE;                                                                      // Getting slice index...
+
+        // Padding entries point to the row itself:
+        for(k = 0; k < (size_t)slice_width[c]; k++)
+        {
+          packed_column[slice_offset[c] + k*NU_SPARSE_SLICE + i%NU_SPARSE_SLICE] = (GLint)i;        // Setting padding column...
+        }
+
+        for(k = 0; k < (size_t)(row_offset[i + 1] - row_offset[i]); k++)
+        {
+          p                = slice_offset[c] + k*NU_SPARSE_SLICE + i%NU_SPARSE_SLICE;               // Computing slice column-major index...
+          packed_column[p] = column[row_offset[i] + k];                                             // Setting column...
+          position[row_offset[i] + k] = (GLint)p;                                                   // Setting index map...
+        }
+      }
+
+      break;
+
+    default:
+      packed_column = column;                                                                       // Copying CSR column indices...
+
+      for(k = 0; k < nonzeros; k++)
+      {
+        position[k] = (GLint)k;                                                                     // Setting identity index map...
+      }
+
+      break;
+  }
+
+  packed_value.assign (packed_column.size (), 0.0f);                                                // Allocating values...
+  fill = (nonzeros > 0) ? (float)packed_column.size ()/(float)nonzeros : 1.0f;                      // Computing padding ratio...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////// compile //////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::sparse::compile ()
+{
+  cl_int      loc_error;                                                                            // Error code.
+  size_t      loc_log_size;                                                                         // OpenCL JIT compiler log size.
+  std::string loc_options;                                                                          // OpenCL JIT compiler options.
+  std::string loc_kernel_name;                                                                      // SpMV kernel name.
+  cl_int      loc_rows  = (cl_int)rows;                                                             // Number of rows.
+  cl_int      loc_width = (cl_int)row_max;                                                          // ELL width.
+  cl_uint     loc_arg   = 0;                                                                        // Kernel argument index.
+
+  neutrino::action ("building sparse matrix SpMV program...");                                      // Printing message...
+
+  program   = clCreateProgramWithSource
+              (
+               neutrino::context_id,                                                                // OpenCL context ID.
+               1,                                                                                   // Number of program sources.
+               &nu_sparse_source,                                                                   // Program source.
+               NULL,                                                                                // Source size (null terminated).
+               &loc_error                                                                           // Error code.
+              );
+  neutrino::check_error (loc_error);                                                                // Checking error...
+
+  loc_options = std::string ("-D NU_SPARSE_SLICE=") + std::to_string (NU_SPARSE_SLICE) +
+                std::string (" -D NU_SPARSE_CSR_VECTOR_SIZE=") +
+                std::to_string (NU_SPARSE_CSR_VECTOR_SIZE);                                         // Setting compiler options...
+
+  loc_error = clBuildProgram
+              (
+               program,                                                                             // Program.
+               1,                                                                                   // Number of devices.
+               &neutrino::device_id,                                                                // Device ID.
+               loc_options.c_str (),                                                                // Compiler options.
+               NULL,                                                                                // Notification routine.
+               NULL                                                                                 // Notification argument.
+              );
+
+  if(loc_error != CL_SUCCESS)                                                                       // Checking compiled program...
+  {
+    neutrino::error (neutrino::get_error (loc_error));                                              // Printing message...
+
+    // Getting OpenCL compiler information:
+    clGetProgramBuildInfo
+    (
+     program,                                                                                       // Program.
+     neutrino::device_id,                                                                           // Device ID.
+     CL_PROGRAM_BUILD_LOG,                                                                          // Build log parameter.
+     0,                                                                                             // Dummy parameter size.
+     NULL,                                                                                          // Dummy parameter value.
+     &loc_log_size                                                                                  // Size of log.
+    );
+
+    std::string loc_log (loc_log_size + 1, '\0');                                                   // Log buffer.
+
+    // Reading OpenCL compiler error log:
+    clGetProgramBuildInfo
+    (
+     program,                                                                                       // Program.
+     neutrino::device_id,                                                                           // Device ID.
+     CL_PROGRAM_BUILD_LOG,                                                                          // Build log parameter.
+     loc_log_size + 1,                                                                              // Log size.
+     &loc_log[0],                                                                                   // The log.
+     NULL                                                                                           // Dummy size parameter.
+    );
+
+    std::cout << "" << std::endl;                                                                   // Printing message...
+    std::cout << "See error log:" << std::endl;                                                     // Printing message...
+    std::cout << "" << std::endl;                                                                   // Printing message...
+    std::cout << loc_log << std::endl;                                                              // Printing log...
+    exit (loc_error);                                                                               // Exiting...
+  }
+
+  // Selecting SpMV kernel and NDRange:
+  switch(format)
+  {
+    case NU_ELL:
+      loc_kernel_name = "nu_spmv_ell";                                                              // Setting kernel name...
+      global_size     = rows;                                                                       // One work-item per row...
+      local_size      = 0;                                                                          // Letting OpenCL choose the work-group size...
+      break;
+
+    case NU_SELL:
+      loc_kernel_name = "nu_spmv_sell";                                                             // Setting kernel name...
+      global_size     = slice_width.size ()*NU_SPARSE_SLICE;                                        // One work-item per (padded) row...
+      local_size      = 0;                                                                          // Letting OpenCL choose the work-group size...
+      break;
+
+    default:
+      if(row_mean > NU_SPARSE_CSR_VECTOR_THRESHOLD)
+      {
+        loc_kernel_name = "nu_spmv_csr_vector";                                                     // Setting kernel name...
+        global_size     = rows*NU_SPARSE_CSR_VECTOR_SIZE;                                           // One work-group per row...
+        local_size      = NU_SPARSE_CSR_VECTOR_SIZE;                                                // Work-group size...
+      }
+
+      else
+      {
+        loc_kernel_name = "nu_spmv_csr_scalar";                                                     // Setting kernel name...
+        global_size     = rows;                                                                     // One work-item per row...
+        local_size      = 0;                                                                        // Letting OpenCL choose the work-group size...
+      }
+
+      break;
+  }
+
+  kernel_id = clCreateKernel
+              (
+               program,                                                                             // OpenCL kernel program.
+               loc_kernel_name.c_str (),                                                            // Kernel name.
+               &loc_error                                                                           // Error code.
+              );
+  neutrino::check_error (loc_error);                                                                // Checking error...
+
+  // Setting the matrix arguments (the vectors are set by "spmv"):
+  loc_error  = clSetKernelArg (kernel_id, loc_arg++, sizeof(cl_int), &loc_rows);                    // Number of rows.
+
+  switch(format)
+  {
+    case NU_ELL:
+      loc_error |= clSetKernelArg (kernel_id, loc_arg++, sizeof(cl_int), &loc_width);               // ELL width.
+      break;
+
+    case NU_SELL:
+      loc_error |= clSetKernelArg (kernel_id, loc_arg++, sizeof(cl_mem), &slice_offset_buffer);     // Slice offsets.
+      loc_error |= clSetKernelArg (kernel_id, loc_arg++, sizeof(cl_mem), &slice_width_buffer);      // Slice widths.
+      break;
+
+    default:
+      loc_error |= clSetKernelArg (kernel_id, loc_arg++, sizeof(cl_mem), &row_offset_buffer);       // Row offsets.
+      break;
+  }
+
+  loc_error |= clSetKernelArg (kernel_id, loc_arg++, sizeof(cl_mem), &column_buffer);               // Column indices.
+  loc_error |= clSetKernelArg (kernel_id, loc_arg++, sizeof(cl_mem), &value_buffer);                // Values.
+  neutrino::check_error (loc_error);                                                                // Checking error...
+
+  neutrino::done ();                                                                                // Printing message...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////// init ////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::sparse::init (
+                       sparse_format loc_format                                                     // Storage format.
+                      )
+{
+  cl_int loc_error;                                                                                 // Error code.
+
+  analyse ();                                                                                       // Computing row-length statistics...
+  format = (loc_format == NU_SPARSE_AUTO) ? choose () : loc_format;                                 // Selecting storage format...
+
+  if(nonzeros == 0)
+  {
+    neutrino::error ("empty sparse matrix!");                                                       // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  switch(format)
+  {
+    case NU_ELL:
+      neutrino::action ("packing sparse matrix in ELL format...");                                  // Printing message...
+      break;
+
+    case NU_SELL:
+      neutrino::action ("packing sparse matrix in SELL-C format...");                               // Printing message...
+      break;
+
+    default:
+      neutrino::action ("packing sparse matrix in CSR format...");                                  // Printing message...
+      break;
+  }
+
+  pack ();                                                                                          // Packing pattern...
+  neutrino::done ();                                                                                // Printing message...
+
+  neutrino::action ("creating sparse matrix buffers...");                                           // Printing message...
+
+  // Creating column index buffer:
+  column_buffer = clCreateBuffer
+                  (
+                   neutrino::context_id,                                                            // OpenCL context.
+                   CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR,                                         // Memory flags.
+                   sizeof(GLint)*packed_column.size (),                                             // Data buffer size.
+                   packed_column.data (),                                                           // Data buffer.
+                   &loc_error                                                                       // Error code.
+                  );
+  neutrino::check_error (loc_error);                                                                // Checking error...
+
+  // Creating value buffer:
+  value_buffer  = clCreateBuffer
+                  (
+                   neutrino::context_id,                                                            // OpenCL context.
+                   CL_MEM_READ_ONLY,                                                                // Memory flags.
+                   sizeof(GLfloat)*packed_value.size (),                                            // Data buffer size.
+                   NULL,                                                                            // Data buffer.
+                   &loc_error                                                                       // Error code.
+                  );
+  neutrino::check_error (loc_error);                                                                // Checking error...
+
+  switch(format)
+  {
+    case NU_SELL:
+      slice_offset_buffer = clCreateBuffer
+                            (
+                             neutrino::context_id,                                                  // OpenCL context.
+                             CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR,                               // Memory flags.
+                             sizeof(GLint)*slice_offset.size (),                                    // Data buffer size.
+                             slice_offset.data (),                                                  // Data buffer.
+                             &loc_error                                                             // Error code.
+                            );
+      neutrino::check_error (loc_error);                                                            // Checking error...
+
+      slice_width_buffer  = clCreateBuffer
+                            (
+                             neutrino::context_id,                                                  // OpenCL context.
+                             CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR,                               // Memory flags.
+                             sizeof(GLint)*slice_width.size (),                                     // Data buffer size.
+                             slice_width.data (),                                                   // Data buffer.
+                             &loc_error                                                             // Error code.
+                            );
+      neutrino::check_error (loc_error);                                                            // Checking error...
+      break;
+
+    case NU_ELL:
+      // Doing nothing: ELL only needs the column and value buffers.
+      break;
+
+    default:
+      row_offset_buffer   = clCreateBuffer
+                            (
+                             neutrino::context_id,                                                  // OpenCL context.
+                             CL_MEM_READ_ONLY | CL_MEM_COPY_HOST_PTR,                               // Memory flags.
+                             sizeof(GLint)*row_offset.size (),                                      // Data buffer size.
+                             row_offset.data (),                                                    // Data buffer.
+                             &loc_error                                                             // Error code.
+                            );
+      neutrino::check_error (loc_error);                                                            // Checking error...
+      break;
+  }
+
+  neutrino::done ();                                                                                // Printing message...
+
+  compile ();                                                                                       // Building SpMV program...
+  ready = true;                                                                                     // Setting "ready" flag...
+  write ();                                                                                         // Writing values...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+/////////////////////////////////////////////// write ////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::sparse::write ()
+{
+  cl_int loc_error;                                                                                 // Error code.
+  size_t k;                                                                                         // CSR index.
+
+  if(!ready)
+  {
+    neutrino::error ("sparse matrix not initialized!");                                             // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  // Scattering CSR values in device format:
+  for(k = 0; k < nonzeros; k++)
+  {
+    packed_value[position[k]] = value[k];                                                           // Setting value...
+  }
+
+  loc_error = clEnqueueWriteBuffer
+              (
+               neutrino::queue_id,                                                                  // OpenCL queue ID.
+               value_buffer,                                                                        // Data buffer.
+               CL_TRUE,                                                                             // Blocking write flag.
+               0,                                                                                   // Data buffer offset.
+               sizeof(GLfloat)*packed_value.size (),                                                // Data buffer size.
+               packed_value.data (),                                                                // Data buffer.
+               0,                                                                                   // Number of events in the list.
+               NULL,                                                                                // Event list.
+               NULL                                                                                 // Event.
+              );
+  neutrino::check_error (loc_error);                                                                // Checking error...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+//////////////////////////////////////////////// spmv ////////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+void nu::sparse::spmv (
+                       nu::float1* loc_x,                                                           // Input vector.
+                       nu::float1* loc_y                                                            // Output vector.
+                      )
+{
+  if((loc_x->data.size () < rows) || (loc_y->data.size () < rows))
+  {
+    neutrino::error ("sparse matrix and vector size mismatch!");                                    // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  spmv (loc_x->buffer, loc_y->buffer);                                                              // Computing product...
+}
+
+void nu::sparse::spmv (
+                       cl_mem loc_x,                                                                // Input vector buffer.
+                       cl_mem loc_y                                                                 // Output vector buffer.
+                      )
+{
+  cl_int  loc_error;                                                                                // Error code.
+  cl_uint loc_arg;                                                                                  // Kernel argument index of the input vector.
+
+  if(!ready)
+  {
+    neutrino::error ("sparse matrix not initialized!");                                             // Printing message...
+    exit (EXIT_FAILURE);                                                                            // Exiting...
+  }
+
+  loc_arg    = (format == NU_SELL) ? 5 : 4;                                                         // Getting input vector argument index...
+  loc_error  = clSetKernelArg (kernel_id, loc_arg, sizeof(cl_mem), &loc_x);                         // Input vector.
+  loc_error |= clSetKernelArg (kernel_id, loc_arg + 1, sizeof(cl_mem), &loc_y);                     // Output vector.
+  neutrino::check_error (loc_error);                                                                // Checking error...
+
+  loc_error = clEnqueueNDRangeKernel
+              (
+               neutrino::queue_id,                                                                  // Queue ID.
+               kernel_id,                                                                           // Kernel ID.
+               1,                                                                                   // Kernel dimension.
+               NULL,                                                                                // Global work offset.
+               &global_size,                                                                        // Global work size.
+               (local_size > 0) ? &local_size : NULL,                                               // Local work size.
+               0,                                                                                   // Number of events.
+               NULL,                                                                                // Event list.
+               NULL                                                                                 // Event.
+              );
+  neutrino::check_error (loc_error);                                                                // Checking error...
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+///////////////////////////////////////////// DESTRUCTOR /////////////////////////////////////////////
+//////////////////////////////////////////////////////////////////////////////////////////////////////
+nu::sparse::~sparse ()
+{
+  if(kernel_id != NULL)
+  {
+    clReleaseKernel (kernel_id);                                                                    // Releasing SpMV kernel...
+  }
+
+  if(program != NULL)
+  {
+    clReleaseProgram (program);                                                                     // Releasing SpMV program...
+  }
+
+  if(row_offset_buffer != NULL)
+  {
+    clReleaseMemObject (row_offset_buffer);                                                         // Releasing CSR row offset buffer...
+  }
+
+  if(slice_offset_buffer != NULL)
+  {
+    clReleaseMemObject (slice_offset_buffer);                                                       // Releasing SELL-C slice offset buffer...
+  }
+
+  if(slice_width_buffer != NULL)
+  {
+    clReleaseMemObject (slice_width_buffer);                                                        // Releasing SELL-C slice width buffer...
+  }
+
+  if(column_buffer != NULL)
+  {
+    clReleaseMemObject (column_buffer);                                                             // Releasing column index buffer...
+  }
+
+  if(value_buffer != NULL)
+  {
+    clReleaseMemObject (value_buffer);                                                              // Releasing value buffer...
+  }
+}